@@ -163,6 +163,19 @@ if (NOT WINDOWS)
         HDF_FUNCTION_TEST (HAVE_DIRECT)
         set (CMAKE_REQUIRED_DEFINITIONS "${CMAKE_REQUIRED_DEFINITIONS} -D_GNU_SOURCE")
         add_definitions ("-D_GNU_SOURCE")
+        # The direct VFD overlaps bounce-buffer copies with I/O when POSIX
+        # asynchronous I/O is available; aio_read() may live in librt
+        CHECK_INCLUDE_FILE ("aio.h" ${HDF_PREFIX}_HAVE_AIO_H)
+        CHECK_FUNCTION_EXISTS (aio_read AIO_READ_IN_LIBC)
+        if (NOT AIO_READ_IN_LIBC)
+          CHECK_LIBRARY_EXISTS (rt aio_read "" AIO_READ_IN_LIBRT)
+        endif ()
+        if (${HDF_PREFIX}_HAVE_AIO_H AND AIO_READ_IN_LIBC)
+          set (${HDF_PREFIX}_HAVE_AIO_READ 1)
+        elseif (${HDF_PREFIX}_HAVE_AIO_H AND AIO_READ_IN_LIBRT)
+          set (${HDF_PREFIX}_HAVE_AIO_READ 1)
+          list (APPEND LINK_LIBS rt)
+        endif ()
       else ()
         set (TEST_DIRECT_VFD_WORKS "" CACHE INTERNAL ${msg})
         if (CMAKE_VERSION VERSION_GREATER_EQUAL "3.15.0")
@@ -184,6 +197,55 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (CMAKE_SYSTEM_NAME MATCHES "Linux")
+  option (HDF5_ENABLE_IOURING_VFD "Build the io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    CHECK_INCLUDE_FILE ("linux/io_uring.h" ${HDF_PREFIX}_HAVE_LINUX_IO_URING_H)
+    CHECK_SYMBOL_EXISTS (__NR_io_uring_setup "sys/syscall.h" ${HDF_PREFIX}_HAVE_NR_IO_URING_SETUP)
+    if (${HDF_PREFIX}_HAVE_LINUX_IO_URING_H AND ${HDF_PREFIX}_HAVE_NR_IO_URING_SETUP)
+      set (${HDF_PREFIX}_HAVE_IOURING 1)
+    else ()
+      message (WARNING "The io_uring VFD was requested but cannot be built. linux/io_uring.h or the io_uring system calls were not found.")
+    endif ()
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check for the pthread library, used by the threaded comparison in h5diff
+#  and by the filter threads of parallel HDF5
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS AND ${HDF_PREFIX}_HAVE_PTHREAD_H)
+  set (THREADS_PREFER_PTHREAD_FLAG ON)
+  find_package (Threads)
+  if (Threads_FOUND AND CMAKE_USE_PTHREADS_INIT)
+    set (${HDF_PREFIX}_HAVE_LIBPTHREAD 1)
+    if (HDF5_ENABLE_PARALLEL)
+      list (APPEND LINK_LIBS Threads::Threads)
+    endif ()
+  endif ()
+endif ()
+
+#-----------------------------------------------------------------------------
+#  Check if the striping driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_STRIPE_VFD "Build the striping Virtual File Driver" OFF)
+  if (HDF5_ENABLE_STRIPE_VFD)
+    CHECK_INCLUDE_FILE ("pthread.h" ${HDF_PREFIX}_HAVE_PTHREAD_H)
+    set (THREADS_PREFER_PTHREAD_FLAG ON)
+    find_package (Threads)
+    if (${HDF_PREFIX}_HAVE_PTHREAD_H AND Threads_FOUND AND CMAKE_USE_PTHREADS_INIT)
+      set (${HDF_PREFIX}_HAVE_STRIPE_VFD 1)
+      list (APPEND LINK_LIBS Threads::Threads)
+    else ()
+      message (WARNING "The striping VFD was requested but cannot be built. Pthreads were not found.")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 #  Check if ROS3 driver can be built
 #-----------------------------------------------------------------------------
@@ -233,6 +233,28 @@ FL_PacketTable::AppendPackets(size_t numPackets, void *data)
     return H5PTappend(table_id, numPackets, data);
 }
 
+/* SetAppendBuffer
+ * Sets the number of packets collected in memory before they are
+ * written to the packet table.  0 turns buffering off.
+ * Returns 0 on success, -1 on failure.
+ */
+int
+FL_PacketTable::SetAppendBuffer(size_t numPackets)
+{
+    return H5PTset_append_buffer(table_id, numPackets);
+}
+
+/* Flush
+ * Writes any buffered packets to the packet table and flushes it
+ * to the file.
+ * Returns 0 on success, -1 on failure.
+ */
+int
+FL_PacketTable::Flush()
+{
+    return H5PTflush(table_id);
+}
+
 /* GetPacket (indexed)
  * Gets a single packet from the packet table.  Takes the index
  * of the packet (with 0 being the first packet) and a pointer
@@ -179,6 +179,20 @@ class H5_HLCPPDLL FL_PacketTable : virtual public PacketTable {
      */
     int AppendPackets(size_t numPackets, void *data);
 
+    /* SetAppendBuffer
+     * Sets the number of packets collected in memory before they are
+     * written to the packet table.  0 turns buffering off.
+     * Returns 0 on success, -1 on failure.
+     */
+    int SetAppendBuffer(size_t numPackets);
+
+    /* Flush
+     * Writes any buffered packets to the packet table and flushes it
+     * to the file.
+     * Returns 0 on success, -1 on failure.
+     */
+    int Flush();
+
     /* GetPacket (indexed)
      * Gets a single packet from the packet table.  Takes the index
      * of the packet (with 0 being the first packet) and a pointer
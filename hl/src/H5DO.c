@@ -17,6 +17,39 @@
 /* public LT prototypes			*/
 #include "H5DOpublic.h"
 
+/* An append stream: records appended along one axis of a chunked dataset,
+ * buffered until they fill a slab one chunk thick along that axis */
+typedef struct H5DO_stream_t {
+    hid_t          dset_id;                    /* The dataset appended to */
+    hid_t          dxpl_id;                    /* Transfer property list for the writes */
+    hid_t          mem_type;                   /* Datatype of the appended records */
+    hid_t          file_type;                  /* The dataset's datatype */
+    unsigned       axis;                       /* The dimension appended along */
+    unsigned       ndims;                      /* Rank of the dataset */
+    hbool_t        direct;                     /* Whether full chunks can be written directly */
+    hsize_t        dims[H5S_MAX_RANK];         /* Dimensions of the data written so far */
+    hsize_t        chunk[H5S_MAX_RANK];        /* Chunk dimensions */
+    hsize_t        slab_dims[H5S_MAX_RANK];    /* Dimensions of the slab buffer */
+    size_t         outer;                      /* # of elements before the axis in a slab */
+    size_t         inner;                      /* # of elements after the axis in a slab */
+    size_t         mem_size;                   /* Size of an element in memory */
+    size_t         file_size;                  /* Size of an element in the file */
+    size_t         nbuf;                       /* # of records in the slab buffer */
+    unsigned char *slab;                       /* The slab buffer */
+    unsigned char *chunk_buf;                  /* One chunk, packed for a direct write */
+    void *         bkg;                        /* Background buffer for conversion */
+} H5DO_stream_t;
+
+static hsize_t    H5DO_stream_count   = 0;
+static H5I_type_t H5DO_stream_id_type = H5I_UNINIT;
+
+#define H5DO_HASH_TABLE_SIZE 64
+
+static herr_t H5DO_stream_free(void *stream, void **request);
+static herr_t H5DO_stream_release(H5DO_stream_t *stream);
+static herr_t H5DO_stream_write(H5DO_stream_t *stream);
+static void   H5DO_stream_pack(const H5DO_stream_t *stream, const hsize_t *offset);
+
 #ifndef H5_NO_DEPRECATED_SYMBOLS
 
 /*-------------------------------------------------------------------------
@@ -252,3 +285,479 @@ done:
 
     return ret_value;
 } /* H5DOappend() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DO_stream_release
+ *
+ * Purpose:     Releases the resources of an append stream without
+ *              writing the records it still buffers.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5DO_stream_release(H5DO_stream_t *stream)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    if (stream->dset_id >= 0 && H5Dclose(stream->dset_id) < 0)
+        ret_value = FAIL;
+    if (stream->dxpl_id >= 0 && H5Pclose(stream->dxpl_id) < 0)
+        ret_value = FAIL;
+    if (stream->mem_type >= 0 && H5Tclose(stream->mem_type) < 0)
+        ret_value = FAIL;
+    if (stream->file_type >= 0 && H5Tclose(stream->file_type) < 0)
+        ret_value = FAIL;
+    HDfree(stream->slab);
+    HDfree(stream->chunk_buf);
+    HDfree(stream->bkg);
+    HDfree(stream);
+
+    return ret_value;
+} /* H5DO_stream_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DO_stream_free
+ *
+ * Purpose:     ID free callback for append streams still open when the
+ *              library shuts down.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5DO_stream_free(void *stream, void H5_ATTR_UNUSED **request)
+{
+    return H5DO_stream_release((H5DO_stream_t *)stream);
+} /* H5DO_stream_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DO_stream_pack
+ *
+ * Purpose:     Copies the chunk at OFFSET out of the (converted) slab
+ *              buffer into the chunk buffer, in the chunk's own layout.
+ *              The parts of edge chunks outside the dataset are zeroed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5DO_stream_pack(const H5DO_stream_t *stream, const hsize_t *offset)
+{
+    hsize_t  valid[H5S_MAX_RANK];        /* Extent of the chunk inside the dataset */
+    hsize_t  slab_stride[H5S_MAX_RANK];  /* Element strides in the slab buffer */
+    hsize_t  chunk_stride[H5S_MAX_RANK]; /* Element strides in the chunk buffer */
+    hsize_t  idx[H5S_MAX_RANK];          /* Current position within the chunk */
+    hsize_t  chunk_nelmts = 1;           /* # of elements in a chunk */
+    hbool_t  edge         = FALSE;       /* Whether the chunk crosses the dataset's edge */
+    unsigned last         = stream->ndims - 1;
+    unsigned u;
+
+    for (u = 0; u < stream->ndims; u++) {
+        if (u == stream->axis)
+            valid[u] = stream->chunk[u];
+        else
+            valid[u] = MIN(stream->chunk[u], stream->dims[u] - offset[u]);
+        if (valid[u] < stream->chunk[u])
+            edge = TRUE;
+        chunk_nelmts *= stream->chunk[u];
+        idx[u] = 0;
+    } /* end for */
+    slab_stride[last]  = 1;
+    chunk_stride[last] = 1;
+    for (u = last; u > 0; u--) {
+        slab_stride[u - 1]  = slab_stride[u] * stream->slab_dims[u];
+        chunk_stride[u - 1] = chunk_stride[u] * stream->chunk[u];
+    } /* end for */
+
+    if (edge)
+        HDmemset(stream->chunk_buf, 0, (size_t)chunk_nelmts * stream->file_size);
+
+    /* Copy a run of the fastest changing dimension at a time */
+    for (;;) {
+        hsize_t src = 0, dst = 0;
+
+        for (u = 0; u < stream->ndims; u++) {
+            src += (idx[u] + (u == stream->axis ? 0 : offset[u])) * slab_stride[u];
+            dst += idx[u] * chunk_stride[u];
+        } /* end for */
+        HDmemcpy(stream->chunk_buf + dst * stream->file_size, stream->slab + src * stream->file_size,
+                 (size_t)valid[last] * stream->file_size);
+
+        /* Move to the next run */
+        for (u = last; u > 0; u--) {
+            if (++idx[u - 1] < valid[u - 1])
+                break;
+            idx[u - 1] = 0;
+        } /* end for */
+        if (u == 0)
+            break;
+    } /* end for */
+} /* H5DO_stream_pack() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DO_stream_write
+ *
+ * Purpose:     Writes the records in the slab buffer, extends the dataset
+ *              to include them and flushes the dataset.
+ *
+ *              When the slab is exactly one row of full chunks and the
+ *              dataset has no filters, each chunk is converted, packed and
+ *              written with H5Dwrite_chunk before the extent changes, so
+ *              readers never see the new extent before its data.
+ *              Otherwise the records go through H5Dwrite.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5DO_stream_write(H5DO_stream_t *stream)
+{
+    hsize_t  size[H5S_MAX_RANK];   /* The new size of the dataset */
+    hsize_t  start[H5S_MAX_RANK];  /* Start of the new records */
+    hsize_t  count[H5S_MAX_RANK];  /* Extent of the new records */
+    hid_t    file_space_id = FAIL; /* File space of the extended dataset */
+    hid_t    mem_space_id  = FAIL; /* Memory space of the slab buffer */
+    unsigned u;                    /* Local index variable */
+    herr_t   ret_value = FAIL;     /* Return value */
+
+    if (stream->nbuf == 0)
+        return SUCCEED;
+
+    for (u = 0; u < stream->ndims; u++) {
+        size[u]  = stream->dims[u];
+        start[u] = 0;
+        count[u] = stream->dims[u];
+    } /* end for */
+    size[stream->axis] += stream->nbuf;
+    start[stream->axis] = stream->dims[stream->axis];
+    count[stream->axis] = stream->nbuf;
+
+    if (stream->direct && (stream->dims[stream->axis] % stream->chunk[stream->axis]) == 0 &&
+        (hsize_t)stream->nbuf == stream->chunk[stream->axis]) {
+        hsize_t offset[H5S_MAX_RANK]; /* Offset of the chunk being written */
+        size_t  chunk_bytes = stream->file_size;
+
+        for (u = 0; u < stream->ndims; u++) {
+            chunk_bytes *= (size_t)stream->chunk[u];
+            offset[u] = 0;
+        } /* end for */
+        offset[stream->axis] = stream->dims[stream->axis];
+
+        /* Convert the whole slab to the dataset's datatype */
+        if (H5Tconvert(stream->mem_type, stream->file_type, stream->outer * stream->nbuf * stream->inner,
+                       stream->slab, stream->bkg, stream->dxpl_id) < 0)
+            goto done;
+
+        /* Write the chunks of the slab */
+        for (;;) {
+            H5DO_stream_pack(stream, offset);
+            if (H5Dwrite_chunk(stream->dset_id, stream->dxpl_id, 0, offset, chunk_bytes, stream->chunk_buf) <
+                0)
+                goto done;
+
+            /* Move to the next chunk in the dimensions other than the axis */
+            for (u = stream->ndims; u > 0; u--) {
+                if (u - 1 == stream->axis)
+                    continue;
+                offset[u - 1] += stream->chunk[u - 1];
+                if (offset[u - 1] < stream->dims[u - 1])
+                    break;
+                offset[u - 1] = 0;
+            } /* end for */
+            if (u == 0)
+                break;
+        } /* end for */
+
+        if (H5Dset_extent(stream->dset_id, size) < 0)
+            goto done;
+    } /* end if */
+    else {
+        if (H5Dset_extent(stream->dset_id, size) < 0)
+            goto done;
+        if ((file_space_id = H5Dget_space(stream->dset_id)) < 0)
+            goto done;
+        if (H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto done;
+
+        /* The records are the first NBUF rows of the slab buffer */
+        if ((mem_space_id = H5Screate_simple((int)stream->ndims, stream->slab_dims, NULL)) < 0)
+            goto done;
+        start[stream->axis] = 0;
+        if (H5Sselect_hyperslab(mem_space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto done;
+
+        if (H5Dwrite(stream->dset_id, stream->mem_type, mem_space_id, file_space_id, stream->dxpl_id,
+                     stream->slab) < 0)
+            goto done;
+    } /* end else */
+
+    stream->dims[stream->axis] = size[stream->axis];
+    stream->nbuf               = 0;
+
+    /* Make the new records visible to SWMR readers */
+    if (H5Dflush(stream->dset_id) < 0)
+        goto done;
+
+    /* Indicate success */
+    ret_value = SUCCEED;
+
+done:
+    if (file_space_id != FAIL && H5Sclose(file_space_id) < 0)
+        ret_value = FAIL;
+    if (mem_space_id != FAIL && H5Sclose(mem_space_id) < 0)
+        ret_value = FAIL;
+
+    return ret_value;
+} /* H5DO_stream_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DOstream_open()
+ *
+ * Purpose:     To open an append stream on a chunked dataset.
+ *
+ *      dset_id:    the dataset to append to; the stream holds its own
+ *                  reference to it
+ *      dxpl_id:    transfer property list for the writes
+ *      axis:       the dataset dimension (zero-based) for the appends
+ *      memtype:    the datatype of the data appended
+ *
+ *              Records appended with H5DOstream_append() are buffered
+ *              until they fill a slab one chunk thick along AXIS, which
+ *              is then written and the dataset extended and flushed.
+ *              The other dimensions of the dataset must not change while
+ *              the stream is open.
+ *
+ * Return:      Success: stream ID, Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5DOstream_open(hid_t dset_id, hid_t dxpl_id, unsigned axis, hid_t memtype)
+{
+    H5DO_stream_t *stream   = NULL;         /* The new stream */
+    hid_t          space_id = FAIL;         /* The dataset's dataspace */
+    hid_t          dcpl_id  = FAIL;         /* The dataset's creation property list */
+    hsize_t        max_dims[H5S_MAX_RANK];  /* Maximum dimensions of the dataset */
+    hsize_t        slab_nelmts;             /* # of elements in the slab buffer */
+    hsize_t        chunk_nelmts = 1;        /* # of elements in a chunk */
+    int            sndims;                  /* Rank of the dataset (signed) */
+    unsigned       u;                       /* Local index variable */
+    H5T_class_t    tclass;                  /* Class of the dataset's datatype */
+    hid_t          ret_value = FAIL;        /* Return value */
+
+    /* check arguments */
+    if (H5I_DATASET != H5Iget_type(dset_id))
+        goto done;
+    if (H5P_DEFAULT != dxpl_id)
+        if (TRUE != H5Pisa_class(dxpl_id, H5P_DATASET_XFER))
+            goto done;
+
+    /* Register the stream ID type if this is the first stream */
+    if (H5DO_stream_id_type < 0)
+        if ((H5DO_stream_id_type = H5Iregister_type((size_t)H5DO_HASH_TABLE_SIZE, 0, H5DO_stream_free)) < 0)
+            goto done;
+
+    if (NULL == (stream = (H5DO_stream_t *)HDcalloc(1, sizeof(H5DO_stream_t))))
+        goto done;
+    stream->dset_id   = FAIL;
+    stream->dxpl_id   = FAIL;
+    stream->mem_type  = FAIL;
+    stream->file_type = FAIL;
+    stream->axis      = axis;
+
+    /* Get the dimensions; the dataset must be chunked and extendible */
+    if (FAIL == (space_id = H5Dget_space(dset_id)))
+        goto done;
+    if ((sndims = H5Sget_simple_extent_ndims(space_id)) <= 0)
+        goto done;
+    stream->ndims = (unsigned)sndims;
+    if (axis >= stream->ndims)
+        goto done;
+    if (H5Sget_simple_extent_dims(space_id, stream->dims, max_dims) < 0)
+        goto done;
+    if ((dcpl_id = H5Dget_create_plist(dset_id)) < 0)
+        goto done;
+    if (H5D_CHUNKED != H5Pget_layout(dcpl_id))
+        goto done;
+    if (H5Pget_chunk(dcpl_id, sndims, stream->chunk) != sndims)
+        goto done;
+
+    /* Set up the slab buffer */
+    stream->outer = 1;
+    stream->inner = 1;
+    for (u = 0; u < stream->ndims; u++) {
+        stream->slab_dims[u] = (u == axis) ? stream->chunk[u] : stream->dims[u];
+        if (u < axis)
+            stream->outer *= (size_t)stream->dims[u];
+        else if (u > axis)
+            stream->inner *= (size_t)stream->dims[u];
+        chunk_nelmts *= stream->chunk[u];
+    } /* end for */
+    if (stream->outer == 0 || stream->inner == 0)
+        goto done;
+    slab_nelmts = (hsize_t)stream->outer * stream->chunk[axis] * stream->inner;
+
+    /* Copy the datatypes */
+    if ((stream->mem_type = H5Tcopy(memtype)) < 0)
+        goto done;
+    if ((stream->file_type = H5Dget_type(dset_id)) < 0)
+        goto done;
+    if (0 == (stream->mem_size = H5Tget_size(stream->mem_type)))
+        goto done;
+    if (0 == (stream->file_size = H5Tget_size(stream->file_type)))
+        goto done;
+
+    /* Full chunks can be written directly unless they need filtering or
+     * hold variable-length data or references */
+    if ((tclass = H5Tget_class(stream->file_type)) < 0)
+        goto done;
+    stream->direct = (H5Pget_nfilters(dcpl_id) == 0 && H5T_REFERENCE != tclass &&
+                      H5Tdetect_class(stream->file_type, H5T_VLEN) == FALSE &&
+                      H5Tis_variable_str(stream->file_type) == FALSE);
+
+    if (NULL ==
+        (stream->slab = (unsigned char *)HDmalloc((size_t)slab_nelmts *
+                                                  MAX(stream->mem_size, stream->file_size))))
+        goto done;
+    if (stream->direct) {
+        if (NULL ==
+            (stream->chunk_buf = (unsigned char *)HDmalloc((size_t)chunk_nelmts * stream->file_size)))
+            goto done;
+        if (H5T_COMPOUND == tclass || H5T_COMPOUND == H5Tget_class(stream->mem_type))
+            if (NULL == (stream->bkg = HDcalloc((size_t)slab_nelmts, stream->file_size)))
+                goto done;
+    } /* end if */
+
+    /* Hold on to the dataset and the transfer properties */
+    if (H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    if ((stream->dxpl_id = H5Pcopy(dxpl_id)) < 0)
+        goto done;
+    if (H5Iinc_ref(dset_id) < 0)
+        goto done;
+    stream->dset_id = dset_id;
+
+    if ((ret_value = H5Iregister(H5DO_stream_id_type, stream)) < 0)
+        goto done;
+    H5DO_stream_count++;
+    stream = NULL;
+
+done:
+    if (space_id != FAIL && H5Sclose(space_id) < 0)
+        ret_value = FAIL;
+    if (dcpl_id != FAIL && H5Pclose(dcpl_id) < 0)
+        ret_value = FAIL;
+    if (stream)
+        H5DO_stream_release(stream);
+
+    return ret_value;
+} /* H5DOstream_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DOstream_append()
+ *
+ * Purpose:     To append elements to an append stream.
+ *
+ *      stream_id:  the stream
+ *      extension:  the # of elements to append for the stream's axis
+ *      buf:        buffer with data for the append, laid out as for
+ *                  H5DOappend()
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DOstream_append(hid_t stream_id, size_t extension, const void *buf)
+{
+    H5DO_stream_t *      stream;
+    const unsigned char *src  = (const unsigned char *)buf; /* Data to append */
+    size_t               done = 0; /* # of records copied so far */
+
+    if (NULL == (stream = (H5DO_stream_t *)H5Iobject_verify(stream_id, H5DO_stream_id_type)))
+        return FAIL;
+    if (extension > 0 && NULL == buf)
+        return FAIL;
+
+    while (done < extension) {
+        size_t row = stream->inner * stream->mem_size; /* Bytes in a record of one outer row */
+        size_t cap; /* # of records that fit before the next chunk boundary */
+        size_t n;   /* # of records to copy */
+        size_t o;   /* Local index variable */
+
+        cap = (size_t)(stream->chunk[stream->axis] -
+                       (stream->dims[stream->axis] % stream->chunk[stream->axis]));
+        n   = MIN(extension - done, cap - stream->nbuf);
+
+        /* Copy the records into the slab, one outer row at a time */
+        for (o = 0; o < stream->outer; o++)
+            HDmemcpy(stream->slab + ((o * (size_t)stream->chunk[stream->axis]) + stream->nbuf) * row,
+                     src + ((o * extension) + done) * row, n * row);
+        stream->nbuf += n;
+        done += n;
+
+        /* Write the slab once it reaches a chunk boundary */
+        if (stream->nbuf == cap && H5DO_stream_write(stream) < 0)
+            return FAIL;
+    } /* end while */
+
+    return SUCCEED;
+} /* H5DOstream_append() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DOstream_flush()
+ *
+ * Purpose:     Writes the records an append stream buffers, even if they
+ *              don't fill a chunk, and flushes the dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DOstream_flush(hid_t stream_id)
+{
+    H5DO_stream_t *stream;
+
+    if (NULL == (stream = (H5DO_stream_t *)H5Iobject_verify(stream_id, H5DO_stream_id_type)))
+        return FAIL;
+
+    return H5DO_stream_write(stream);
+} /* H5DOstream_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5DOstream_close()
+ *
+ * Purpose:     Writes the records an append stream buffers and closes it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DOstream_close(hid_t stream_id)
+{
+    H5DO_stream_t *stream;
+    herr_t         ret_value = SUCCEED;
+
+    if (NULL == (stream = (H5DO_stream_t *)H5Iremove_verify(stream_id, H5DO_stream_id_type)))
+        return FAIL;
+
+    if (H5DO_stream_write(stream) < 0)
+        ret_value = FAIL;
+    if (H5DO_stream_release(stream) < 0)
+        ret_value = FAIL;
+
+    /* Remove the stream ID type once no streams are open */
+    if (--H5DO_stream_count == 0) {
+        H5Idestroy_type(H5DO_stream_id_type);
+        H5DO_stream_id_type = H5I_UNINIT;
+    }
+
+    return ret_value;
+} /* H5DOstream_close() */
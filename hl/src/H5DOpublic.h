@@ -28,6 +28,12 @@ extern "C" {
 H5_HLDLL herr_t H5DOappend(hid_t dset_id, hid_t dxpl_id, unsigned axis, size_t extension, hid_t memtype,
                            const void *buf);
 
+/* Append streams, which write whole chunks at a time */
+H5_HLDLL hid_t  H5DOstream_open(hid_t dset_id, hid_t dxpl_id, unsigned axis, hid_t memtype);
+H5_HLDLL herr_t H5DOstream_append(hid_t stream_id, size_t extension, const void *buf);
+H5_HLDLL herr_t H5DOstream_flush(hid_t stream_id);
+H5_HLDLL herr_t H5DOstream_close(hid_t stream_id);
+
 /* Symbols defined for compatibility with previous versions of the HDF5 API.
  *
  * Use of these symbols is deprecated.
@@ -24,6 +24,13 @@ static herr_t H5LD_get_dset_dims(hid_t did, hsize_t *cur_dims);
 static size_t H5LD_get_dset_type_size(hid_t did, const char *fields);
 static herr_t H5LD_get_dset_elmts(hid_t did, const hsize_t *prev_dims, const hsize_t *cur_dims,
                                   const char *fields, void *buf);
+static herr_t H5LD_get_dset_chunk_elmts(hid_t did, const hsize_t *prev_dims, hsize_t *cur_dims,
+                                        const char *fields, void *buf);
+static herr_t H5LD_wait_dset_dims(hid_t did, const hsize_t *prev_dims, double timeout, hsize_t *cur_dims);
+
+/* Pauses between polls of H5LD_wait_dset_dims(), in microseconds */
+#define H5LD_WAIT_MIN_PAUSE 1000
+#define H5LD_WAIT_MAX_PAUSE 100000
 
 /*-------------------------------------------------------------------------
  * Function: H5LD_clean_vector
@@ -562,6 +569,163 @@ done:
     return (ret_value);
 } /* H5LD_get_dset_elmts() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5LD_get_dset_chunk_elmts
+ *
+ * Purpose: To retrieve the data appended to a chunked dataset along one
+ *	    dimension, up to the last chunk boundary in "cur_dims"
+ *
+ *	    Exactly one dimension of "cur_dims" may be greater than in
+ *	    "prev_dims".  That dimension of "cur_dims" is rounded down to
+ *	    a multiple of the chunk size (but not below "prev_dims") and
+ *	    the elements between "prev_dims" and the rounded "cur_dims"
+ *	    are read, so chunks still being filled by the writer are
+ *	    left alone.  The rounded dimensions are returned in
+ *	    "cur_dims" to be passed as "prev_dims" on the next call.
+ *
+ * Return: Success: 0
+ *	   Failure: negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5LD_get_dset_chunk_elmts(hid_t did, const hsize_t *prev_dims, hsize_t *cur_dims, const char *fields,
+                          void *buf)
+{
+    hid_t   sid = -1, dcpl = -1;        /* Dataspace and creation property list ids */
+    hsize_t chunk_dims[H5S_MAX_RANK];   /* Chunk dimensions */
+    hsize_t boundary;                   /* Last chunk boundary in the grown dimension */
+    int     ndims;                      /* Number of dimensions for the dataset */
+    int     axis = -1;                  /* The dimension that grew */
+    int     i;                          /* Local index variable */
+    herr_t  ret_value = FAIL;           /* Return value */
+
+    /* Verify parameters */
+    if (prev_dims == NULL || cur_dims == NULL)
+        goto done;
+
+    /* Get the number of dimensions and the chunk dimensions */
+    if ((sid = H5Dget_space(did)) < 0)
+        goto done;
+    if ((ndims = H5Sget_simple_extent_ndims(sid)) <= 0)
+        goto done;
+    if ((dcpl = H5Dget_create_plist(did)) < 0)
+        goto done;
+    if (H5Pget_layout(dcpl) != H5D_CHUNKED)
+        goto done;
+    if (H5Pget_chunk(dcpl, ndims, chunk_dims) != ndims)
+        goto done;
+
+    /* Find the one dimension that grew */
+    for (i = 0; i < ndims; i++)
+        if (cur_dims[i] > prev_dims[i]) {
+            if (axis >= 0)
+                goto done;
+            axis = i;
+        } /* end if */
+        else if (cur_dims[i] != prev_dims[i])
+            goto done;
+    if (axis < 0)
+        goto done;
+
+    /* Stop at the last full chunk */
+    boundary       = (cur_dims[axis] / chunk_dims[axis]) * chunk_dims[axis];
+    cur_dims[axis] = MAX(boundary, prev_dims[axis]);
+
+    /* Read the new elements, if any */
+    if (cur_dims[axis] > prev_dims[axis]) {
+        if (buf == NULL)
+            goto done;
+        if (H5LD_get_dset_elmts(did, prev_dims, cur_dims, fields, buf) < 0)
+            goto done;
+    } /* end if */
+
+    /* Indicate success */
+    ret_value = SUCCEED;
+
+done:
+    H5E_BEGIN_TRY
+    H5Sclose(sid);
+    H5Pclose(dcpl);
+    H5E_END_TRY
+
+    return (ret_value);
+} /* H5LD_get_dset_chunk_elmts() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5LD_wait_dset_dims
+ *
+ * Purpose: To wait until the dimension sizes of a dataset differ from
+ *	    "prev_dims", or until "timeout" seconds have passed
+ *
+ *	    The dataset is refreshed and its dimension sizes checked,
+ *	    pausing between the checks for 1 millisecond at first and
+ *	    twice as long each time after, up to 100 milliseconds.  A
+ *	    negative "timeout" waits until the sizes change.  The current
+ *	    sizes are returned in "cur_dims"; on timeout they are the same
+ *	    as "prev_dims".  Files opened with H5Pset_light_refresh() make
+ *	    the refreshes that find nothing new cheap.
+ *
+ * Return: Success: 0
+ *	   Failure: negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5LD_wait_dset_dims(hid_t did, const hsize_t *prev_dims, double timeout, hsize_t *cur_dims)
+{
+    hid_t    sid = -1;                   /* Dataspace id */
+    int      ndims;                      /* Number of dimensions for the dataset */
+    int      i;                          /* Local index variable */
+    uint64_t start;                      /* When the wait started, in microseconds */
+    uint64_t pause = H5LD_WAIT_MIN_PAUSE; /* Pause before the next check, in microseconds */
+    herr_t   ret_value = FAIL;           /* Return value */
+
+    /* Verify parameters */
+    if (prev_dims == NULL || cur_dims == NULL)
+        goto done;
+
+    /* Get the number of dimensions */
+    if ((sid = H5Dget_space(did)) < 0)
+        goto done;
+    if ((ndims = H5Sget_simple_extent_ndims(sid)) < 0)
+        goto done;
+
+    start = H5_now_usec();
+    for (;;) {
+        double elapsed; /* Seconds waited so far */
+
+        /* Get the dataset's current dimension sizes */
+        if (H5Drefresh(did) < 0)
+            goto done;
+        if (H5LD_get_dset_dims(did, cur_dims) < 0)
+            goto done;
+        for (i = 0; i < ndims; i++)
+            if (cur_dims[i] != prev_dims[i])
+                break;
+        if (i < ndims)
+            break;
+
+        /* Give up when the time is up */
+        elapsed = (double)(H5_now_usec() - start) / 1.0e6;
+        if (timeout >= 0.0 && elapsed >= timeout)
+            break;
+
+        H5_nanosleep(pause * 1000);
+        pause = MIN(2 * pause, H5LD_WAIT_MAX_PAUSE);
+    } /* end for */
+
+    /* Indicate success */
+    ret_value = SUCCEED;
+
+done:
+    H5E_BEGIN_TRY
+    H5Sclose(sid);
+    H5E_END_TRY
+
+    return (ret_value);
+} /* H5LD_wait_dset_dims() */
+
 /*-------------------------------------------------------------------------
  *
  * Public functions
@@ -623,3 +787,36 @@ H5LDget_dset_elmts(hid_t did, const hsize_t *prev_dims, const hsize_t *cur_dims,
 {
     return (H5LD_get_dset_elmts(did, prev_dims, cur_dims, fields, buf));
 } /* H5LDget_dset_elmts() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5LDget_dset_chunk_elmts
+ *
+ * Purpose: To retrieve the data appended to a dataset in whole chunks
+ *
+ * Return: Success: 0
+ *	   Failure: negative value
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5LDget_dset_chunk_elmts(hid_t did, const hsize_t *prev_dims, hsize_t *cur_dims, const char *fields,
+                         void *buf)
+{
+    return (H5LD_get_dset_chunk_elmts(did, prev_dims, cur_dims, fields, buf));
+} /* H5LDget_dset_chunk_elmts() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5LDwait_dset_dims
+ *
+ * Purpose: To wait for the dimension sizes of a dataset to change
+ *
+ * Return: Success: 0
+ *	   Failure: negative value
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5LDwait_dset_dims(hid_t did, const hsize_t *prev_dims, double timeout, hsize_t *cur_dims)
+{
+    return (H5LD_wait_dset_dims(did, prev_dims, timeout, cur_dims));
+} /* H5LDwait_dset_dims() */
@@ -17,10 +17,15 @@
 /*  Packet Table private data */
 
 typedef struct {
-    hid_t   dset_id;       /* The ID of the dataset containing this table */
-    hid_t   type_id;       /* The ID of the packet table's native datatype */
-    hsize_t current_index; /* The index of the packet that get_next_packet will read next */
-    hsize_t size;          /* The number of packets currently contained in this table */
+    hid_t          dset_id;       /* The ID of the dataset containing this table */
+    hid_t          type_id;       /* The ID of the packet table's native datatype */
+    hsize_t        current_index; /* The index of the packet that get_next_packet will read next */
+    hsize_t        size;          /* The number of packets currently contained in this table,
+                                     including those still in the append buffer */
+    unsigned char *wbuf;          /* Packets appended but not yet written, or NULL */
+    size_t         wbuf_nrecords; /* The number of packets the append buffer holds */
+    size_t         wbuf_used;     /* The number of packets in the append buffer */
+    size_t         rec_size;      /* The size of one packet in memory */
 } htbl_t;
 
 static hsize_t    H5PT_ptable_count   = 0;
@@ -34,6 +39,8 @@ static herr_t H5PT_close(htbl_t *table);
 static herr_t H5PT_create_index(htbl_t *table_id);
 static herr_t H5PT_set_index(htbl_t *table_id, hsize_t pt_index);
 static herr_t H5PT_get_index(htbl_t *table_id, hsize_t *pt_index);
+static herr_t H5PT_flush_buffer(htbl_t *table);
+static htri_t H5PT_is_fixed_type(hid_t type_id);
 
 /*-------------------------------------------------------------------------
  *
@@ -96,8 +103,11 @@ H5PTcreate(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chunk_si
     if (table == NULL) {
         goto error;
     }
-    table->dset_id = H5I_INVALID_HID;
-    table->type_id = H5I_INVALID_HID;
+    table->dset_id       = H5I_INVALID_HID;
+    table->type_id       = H5I_INVALID_HID;
+    table->wbuf          = NULL;
+    table->wbuf_nrecords = 0;
+    table->wbuf_used     = 0;
 
     /* Create a simple data space with unlimited size */
     dims[0]       = 0;
@@ -217,8 +227,11 @@ H5PTcreate_fl(hid_t loc_id, const char *dset_name, hid_t dtype_id, hsize_t chunk
     if (table == NULL) {
         goto error;
     }
-    table->dset_id = H5I_INVALID_HID;
-    table->type_id = H5I_INVALID_HID;
+    table->dset_id       = H5I_INVALID_HID;
+    table->type_id       = H5I_INVALID_HID;
+    table->wbuf          = NULL;
+    table->wbuf_nrecords = 0;
+    table->wbuf_used     = 0;
 
     /* Create a simple data space with unlimited size */
     dims[0]       = 0;
@@ -331,8 +344,11 @@ H5PTopen(hid_t loc_id, const char *dset_name)
     if (table == NULL) {
         goto error;
     }
-    table->dset_id = H5I_INVALID_HID;
-    table->type_id = H5I_INVALID_HID;
+    table->dset_id       = H5I_INVALID_HID;
+    table->type_id       = H5I_INVALID_HID;
+    table->wbuf          = NULL;
+    table->wbuf_nrecords = 0;
+    table->wbuf_used     = 0;
 
     /* Open the dataset */
     if ((table->dset_id = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
@@ -433,6 +449,10 @@ H5PT_close(htbl_t *table)
     if (table == NULL)
         goto error;
 
+    /* Write any packets left in the append buffer */
+    if (H5PT_flush_buffer(table) < 0)
+        goto error;
+
     /* Close the dataset */
     if (H5Dclose(table->dset_id) < 0)
         goto error;
@@ -441,6 +461,7 @@ H5PT_close(htbl_t *table)
     if (H5Tclose(table->type_id) < 0)
         goto error;
 
+    HDfree(table->wbuf);
     HDfree(table);
 
     return SUCCEED;
@@ -451,6 +472,7 @@ error:
         H5Dclose(table->dset_id);
         H5Tclose(table->type_id);
         H5E_END_TRY
+        HDfree(table->wbuf);
         HDfree(table);
     }
     return FAIL;
@@ -542,6 +564,34 @@ H5PTappend(hid_t table_id, size_t nrecords, const void *data)
     if (nrecords == 0)
         return SUCCEED;
 
+    if (table->wbuf) {
+        /* Make room in the append buffer */
+        if (table->wbuf_used + nrecords > table->wbuf_nrecords)
+            if (H5PT_flush_buffer(table) < 0)
+                goto error;
+
+        /* Packets that fill the buffer by themselves are written directly */
+        if (nrecords >= table->wbuf_nrecords) {
+            if ((H5TB_common_append_records(table->dset_id, table->type_id, nrecords, table->size, data)) <
+                0)
+                goto error;
+        }
+        else {
+            HDmemcpy(table->wbuf + table->wbuf_used * table->rec_size, data, nrecords * table->rec_size);
+            table->wbuf_used += nrecords;
+        }
+
+        /* Update table size */
+        table->size += nrecords;
+
+        /* Write the buffer out as soon as it is full */
+        if (table->wbuf_used == table->wbuf_nrecords)
+            if (H5PT_flush_buffer(table) < 0)
+                goto error;
+
+        return SUCCEED;
+    }
+
     if ((H5TB_common_append_records(table->dset_id, table->type_id, nrecords, table->size, data)) < 0)
         goto error;
 
@@ -553,6 +603,191 @@ error:
     return FAIL;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: H5PTset_append_buffer
+ *
+ * Purpose: Sets the number of packets H5PTappend collects in memory
+ *          before writing them to the packet table.  Buffered packets
+ *          are written with a single extent change and write when the
+ *          buffer fills, and by H5PTflush, H5PTclose and any function
+ *          that reads the table.  A buffer size of 0 turns buffering
+ *          off.  A multiple of the table's chunk size works best.
+ *
+ *          Only tables of fixed-size packets can be buffered, since
+ *          variable-length data and references point into memory owned
+ *          by the caller.
+ *
+ * Return: Success: SUCCEED, Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PTset_append_buffer(hid_t table_id, size_t nrecords)
+{
+    htbl_t *       table;
+    unsigned char *wbuf;
+    size_t         rec_size;
+
+    /* Find the table struct from its ID */
+    if ((table = (htbl_t *)H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
+        goto error;
+
+    /* Write out the packets in the current buffer */
+    if (H5PT_flush_buffer(table) < 0)
+        goto error;
+
+    if (nrecords == 0) {
+        HDfree(table->wbuf);
+        table->wbuf          = NULL;
+        table->wbuf_nrecords = 0;
+        return SUCCEED;
+    }
+
+    if (H5PT_is_fixed_type(table->type_id) <= 0)
+        goto error;
+    if ((rec_size = H5Tget_size(table->type_id)) == 0)
+        goto error;
+    if (nrecords > ((size_t)-1) / rec_size)
+        goto error;
+
+    if ((wbuf = (unsigned char *)HDrealloc(table->wbuf, nrecords * rec_size)) == NULL)
+        goto error;
+    table->wbuf          = wbuf;
+    table->wbuf_nrecords = nrecords;
+    table->rec_size      = rec_size;
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PTflush
+ *
+ * Purpose: Writes the packets in the append buffer to the packet table,
+ *          and flushes the table's dataset to the file
+ *
+ * Return: Success: SUCCEED, Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PTflush(hid_t table_id)
+{
+    htbl_t *table;
+
+    /* Find the table struct from its ID */
+    if ((table = (htbl_t *)H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
+        goto error;
+
+    if (H5PT_flush_buffer(table) < 0)
+        goto error;
+
+    if (H5Dflush(table->dset_id) < 0)
+        goto error;
+
+    return SUCCEED;
+
+error:
+    return FAIL;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_flush_buffer
+ *
+ * Purpose: Writes the packets in the append buffer to the end of the
+ *          packet table's dataset
+ *
+ * Return: Success: SUCCEED, Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PT_flush_buffer(htbl_t *table)
+{
+    if (table->wbuf_used == 0)
+        return SUCCEED;
+
+    if ((H5TB_common_append_records(table->dset_id, table->type_id, table->wbuf_used,
+                                    table->size - table->wbuf_used, table->wbuf)) < 0)
+        return FAIL;
+
+    table->wbuf_used = 0;
+
+    return SUCCEED;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: H5PT_is_fixed_type
+ *
+ * Purpose: Checks that packets of a datatype can be copied byte for
+ *          byte, i.e. that they contain no variable-length data or
+ *          references
+ *
+ * Return: True: 1, False: 0, Failure: FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5PT_is_fixed_type(hid_t type_id)
+{
+    hid_t  member_id = H5I_INVALID_HID;
+    htri_t ret_value = FALSE;
+    int    nmembers;
+    int    i;
+
+    switch (H5Tget_class(type_id)) {
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_TIME:
+        case H5T_BITFIELD:
+        case H5T_OPAQUE:
+        case H5T_ENUM:
+            ret_value = TRUE;
+            break;
+
+        case H5T_STRING:
+            if ((ret_value = H5Tis_variable_str(type_id)) >= 0)
+                ret_value = !ret_value;
+            break;
+
+        case H5T_COMPOUND:
+            if ((nmembers = H5Tget_nmembers(type_id)) < 0)
+                return FAIL;
+            ret_value = TRUE;
+            for (i = 0; i < nmembers && ret_value > 0; i++) {
+                if ((member_id = H5Tget_member_type(type_id, (unsigned)i)) < 0)
+                    return FAIL;
+                ret_value = H5PT_is_fixed_type(member_id);
+                if (H5Tclose(member_id) < 0)
+                    return FAIL;
+            }
+            break;
+
+        case H5T_ARRAY:
+            if ((member_id = H5Tget_super(type_id)) < 0)
+                return FAIL;
+            ret_value = H5PT_is_fixed_type(member_id);
+            if (H5Tclose(member_id) < 0)
+                return FAIL;
+            break;
+
+        case H5T_NO_CLASS:
+            ret_value = FAIL;
+            break;
+
+        case H5T_REFERENCE:
+        case H5T_VLEN:
+        case H5T_NCLASSES:
+        default:
+            ret_value = FALSE;
+            break;
+    }
+
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  *
  * Read functions
@@ -593,6 +828,10 @@ H5PTget_next(hid_t table_id, size_t nrecords, void *data)
     if (nrecords == 0)
         return SUCCEED;
 
+    /* Make buffered packets readable */
+    if (H5PT_flush_buffer(table) < 0)
+        goto error;
+
     if ((H5TB_common_read_records(table->dset_id, table->type_id, table->current_index, nrecords, table->size,
                                   data)) < 0)
         goto error;
@@ -638,6 +877,10 @@ H5PTread_packets(hid_t table_id, hsize_t start, size_t nrecords, void *data)
     if (nrecords == 0)
         return SUCCEED;
 
+    /* Make buffered packets readable */
+    if (H5PT_flush_buffer(table) < 0)
+        goto error;
+
     if (H5TB_common_read_records(table->dset_id, table->type_id, start, nrecords, table->size, data) < 0)
         goto error;
 
@@ -972,6 +1215,10 @@ H5PTget_dataset(hid_t table_id)
     if ((table = (htbl_t *)H5Iobject_verify(table_id, H5PT_ptable_id_type)) == NULL)
         goto error;
 
+    /* The caller may access the dataset directly, so write buffered packets */
+    if (H5PT_flush_buffer(table) < 0)
+        goto error;
+
     ret_value = table->dset_id;
 
 error:
@@ -41,6 +41,10 @@ H5_HLDLL hid_t H5PTcreate_fl(hid_t loc_id, const char *dset_name, hid_t dtype_id
  */
 H5_HLDLL herr_t H5PTappend(hid_t table_id, size_t nrecords, const void *data);
 
+H5_HLDLL herr_t H5PTset_append_buffer(hid_t table_id, size_t nrecords);
+
+H5_HLDLL herr_t H5PTflush(hid_t table_id);
+
 /*-------------------------------------------------------------------------
  * Read functions
  *-------------------------------------------------------------------------
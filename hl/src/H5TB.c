@@ -14,6 +14,32 @@
 #include "H5LTprivate.h"
 #include "H5TBprivate.h"
 
+/*-------------------------------------------------------------------------
+ *
+ * internal types
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/* Name of the attribute holding the number of records in a summary block */
+#define H5TB_SUMMARY_BLOCK_ATTR "SUMMARY_BLOCK"
+
+/* Records read at a time by queries, and in a summary block of a
+ * contiguous dataset */
+#define H5TB_QUERY_BLOCK 65536
+
+/* Keeps summary attributes under the 64 KB limit of compact storage */
+#define H5TB_SUMMARY_MAX_BLOCKS 4000
+
+/* State of a query scan */
+typedef struct H5TB_query_t {
+    size_t   nslots;          /* Number of distinct fields the terms use */
+    size_t * term_slot;       /* Field slot of each term */
+    hsize_t  summary_block;   /* Records in a summary block, or 0 */
+    hsize_t *summary_nblocks; /* Summarized blocks of each slot */
+    double **summary;         /* Min/max pairs of each slot, or NULL */
+} H5TB_query_t;
+
 /*-------------------------------------------------------------------------
  *
  * internal functions
@@ -29,6 +55,15 @@ static herr_t H5TB_attach_attributes(const char *table_title, hid_t loc_id, cons
 static hid_t H5TB_create_type(hid_t loc_id, const char *dset_name, size_t type_size,
                               const size_t *field_offset, const size_t *field_sizes, hid_t ftype_id);
 
+static herr_t H5TB_query_field(hid_t ftype_id, const char *field_name, int *field_idx);
+
+static hsize_t H5TB_query_block_size(hid_t did);
+
+static herr_t H5TB_drop_summaries(hid_t did);
+
+static herr_t H5TB_query_scan(hid_t did, size_t nterms, const H5TB_query_term_t *terms, hsize_t max_hits,
+                              hsize_t *nhits, hsize_t *indices);
+
 /*-------------------------------------------------------------------------
  *
  * Create functions
@@ -351,6 +386,10 @@ H5TBwrite_records(hid_t loc_id, const char *dset_name, hsize_t start, hsize_t nr
     if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
         goto out;
 
+    /* the records change, so the query summaries would be out of date */
+    if (H5TB_drop_summaries(did) < 0)
+        goto out;
+
     /* get the datatype */
     if ((tid = H5Dget_type(did)) < 0)
         goto out;
@@ -457,6 +496,10 @@ H5TBwrite_fields_name(hid_t loc_id, const char *dset_name, const char *field_nam
     if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
         goto out;
 
+    /* the records change, so the query summaries would be out of date */
+    if (H5TB_drop_summaries(did) < 0)
+        goto out;
+
     /* get the datatype */
     if ((tid = H5Dget_type(did)) < 0)
         goto out;
@@ -612,6 +655,10 @@ H5TBwrite_fields_index(hid_t loc_id, const char *dset_name, hsize_t nfields, con
     if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
         goto out;
 
+    /* the records change, so the query summaries would be out of date */
+    if (H5TB_drop_summaries(did) < 0)
+        goto out;
+
     /* get the datatype */
     if ((tid = H5Dget_type(did)) < 0)
         goto out;
@@ -1243,6 +1290,10 @@ H5TBdelete_record(hid_t loc_id, const char *dset_name, hsize_t start, hsize_t nr
     if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
         goto out;
 
+    /* the records change, so the query summaries would be out of date */
+    if (H5TB_drop_summaries(did) < 0)
+        goto out;
+
     /*-------------------------------------------------------------------------
      * read the records after the deleted one(s)
      *-------------------------------------------------------------------------
@@ -1393,6 +1444,10 @@ H5TBinsert_record(hid_t loc_id, const char *dset_name, hsize_t start, hsize_t nr
     if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
         goto out;
 
+    /* the records change, so the query summaries would be out of date */
+    if (H5TB_drop_summaries(did) < 0)
+        goto out;
+
     /* get the datatype */
     if ((tid = H5Dget_type(did)) < 0)
         goto out;
@@ -3139,6 +3194,379 @@ out:
     return ret_val;
 } /* end H5TBget_field_info() */
 
+/*-------------------------------------------------------------------------
+ *
+ * Query functions
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/*-------------------------------------------------------------------------
+ * Function: H5TBquery_records
+ *
+ * Purpose: Finds the records that satisfy a query
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ * Comments: The terms compare integer or floating-point fields with
+ *           constants, and are combined left to right with AND or OR.
+ *           The indices of the first max_hits matching records are
+ *           stored in indices, in increasing order, and the number of
+ *           all matching records in nhits.  indices may be NULL to only
+ *           count the matches.
+ *
+ *           The dataset is scanned one chunk at a time, reading only
+ *           the fields the query uses.  Chunks whose summaries, made by
+ *           H5TBbuild_summary, show they can not match are skipped.
+ *
+ *           The dataset may also be a 1-D dataset of numbers, in which
+ *           case the field names of the terms must be NULL.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5TBquery_records(hid_t loc_id, const char *dset_name, size_t nterms, const H5TB_query_term_t *terms,
+                  hsize_t max_hits, hsize_t *nhits, hsize_t *indices)
+{
+    hid_t  did     = H5I_BADID;
+    herr_t ret_val = -1;
+
+    /* check the arguments */
+    if (dset_name == NULL)
+        goto out;
+    if (nhits == NULL)
+        goto out;
+
+    /* open the dataset. */
+    if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
+        goto out;
+
+    if (H5TB_query_scan(did, nterms, terms, max_hits, nhits, indices) < 0)
+        goto out;
+
+    ret_val = 0;
+
+out:
+    if (did > 0)
+        if (H5Dclose(did) < 0)
+            ret_val = -1;
+
+    return ret_val;
+} /* end H5TBquery_records() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5TBquery_read_records
+ *
+ * Purpose: Reads the records that satisfy a query
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ * Comments: Evaluates the query like H5TBquery_records, and reads the
+ *           first max_hits matching records into buf, laid out as for
+ *           H5TBread_records.  The number of all matching records is
+ *           stored in nhits.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5TBquery_read_records(hid_t loc_id, const char *dset_name, size_t nterms, const H5TB_query_term_t *terms,
+                       hsize_t max_hits, size_t type_size, const size_t *field_offset,
+                       const size_t *field_sizes, hsize_t *nhits, void *buf)
+{
+    hid_t    did         = H5I_BADID;
+    hid_t    ftype_id    = H5I_BADID;
+    hid_t    mem_type_id = H5I_BADID;
+    hid_t    sid         = H5I_BADID;
+    hid_t    m_sid       = H5I_BADID;
+    hsize_t *indices     = NULL;
+    hsize_t  mem_size[1];
+    herr_t   ret_val = -1;
+
+    /* check the arguments */
+    if (dset_name == NULL)
+        goto out;
+    if (nhits == NULL)
+        goto out;
+
+    /* open the dataset. */
+    if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
+        goto out;
+
+    /* get the datatype */
+    if ((ftype_id = H5Dget_type(did)) < 0)
+        goto out;
+
+    if ((mem_type_id = H5TB_create_type(loc_id, dset_name, type_size, field_offset, field_sizes, ftype_id)) <
+        0)
+        goto out;
+
+    if (max_hits > 0)
+        if (NULL == (indices = (hsize_t *)HDmalloc((size_t)max_hits * sizeof(hsize_t))))
+            goto out;
+
+    if (H5TB_query_scan(did, nterms, terms, max_hits, nhits, indices) < 0)
+        goto out;
+
+    /* read the matching records */
+    mem_size[0] = MIN(*nhits, max_hits);
+    if (mem_size[0] > 0) {
+        if ((sid = H5Dget_space(did)) < 0)
+            goto out;
+        if (H5Sselect_elements(sid, H5S_SELECT_SET, (size_t)mem_size[0], indices) < 0)
+            goto out;
+        if ((m_sid = H5Screate_simple(1, mem_size, NULL)) < 0)
+            goto out;
+        if (H5Dread(did, mem_type_id, m_sid, sid, H5P_DEFAULT, buf) < 0)
+            goto out;
+    } /* end if */
+
+    ret_val = 0;
+
+out:
+    if (indices)
+        HDfree(indices);
+    if (m_sid > 0)
+        if (H5Sclose(m_sid) < 0)
+            ret_val = -1;
+    if (sid > 0)
+        if (H5Sclose(sid) < 0)
+            ret_val = -1;
+    if (mem_type_id > 0)
+        if (H5Tclose(mem_type_id) < 0)
+            ret_val = -1;
+    if (ftype_id > 0)
+        if (H5Tclose(ftype_id) < 0)
+            ret_val = -1;
+    if (did > 0)
+        if (H5Dclose(did) < 0)
+            ret_val = -1;
+
+    return ret_val;
+} /* end H5TBquery_read_records() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5TBbuild_summary
+ *
+ * Purpose: Stores the minimum and maximum of a field for each block of
+ *          records, so that queries can skip blocks
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ * Comments: A block is a chunk of the dataset, or several chunks for
+ *           datasets with many chunks.  Only full blocks are
+ *           summarized, so appending records keeps the summary valid.
+ *           Functions of this API that change existing records remove
+ *           the summaries of the table; records changed by other means
+ *           require the summary to be built again.  field_name is NULL
+ *           for a 1-D dataset of numbers.
+ *
+ *           The summary of field n is the attribute FIELD_n_SUMMARY, a
+ *           nblocks by 2 array of doubles, and the number of records
+ *           in a block is the attribute SUMMARY_BLOCK.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5TBbuild_summary(hid_t loc_id, const char *dset_name, const char *field_name)
+{
+    hid_t    did         = H5I_BADID;
+    hid_t    ftype_id    = H5I_BADID;
+    hid_t    mem_type_id = H5I_BADID;
+    hid_t    sid         = H5I_BADID;
+    hid_t    m_sid       = H5I_BADID;
+    hid_t    aid         = H5I_BADID;
+    hid_t    a_sid       = H5I_BADID;
+    hsize_t  dims[1];
+    hsize_t  a_dims[2];
+    hsize_t  offset[1];
+    hsize_t  count[1];
+    hsize_t  block;
+    hsize_t  nblocks;
+    hsize_t  start;
+    hsize_t  i;
+    double * values  = NULL;
+    double * summary = NULL;
+    char     attr_name[255];
+    int      field_idx;
+    htri_t   has_block;
+    htri_t   has_summary;
+    herr_t   ret_val = -1;
+
+    /* check the arguments */
+    if (dset_name == NULL)
+        goto out;
+
+    /* open the dataset. */
+    if ((did = H5Dopen2(loc_id, dset_name, H5P_DEFAULT)) < 0)
+        goto out;
+
+    /* get the datatype */
+    if ((ftype_id = H5Dget_type(did)) < 0)
+        goto out;
+
+    /* find the field and make a memory type that reads it as a double */
+    if (H5TB_query_field(ftype_id, field_name, &field_idx) < 0)
+        goto out;
+    if (field_idx >= 0) {
+        if ((mem_type_id = H5Tcreate(H5T_COMPOUND, sizeof(double))) < 0)
+            goto out;
+        if (H5Tinsert(mem_type_id, field_name, (size_t)0, H5T_NATIVE_DOUBLE) < 0)
+            goto out;
+        HDsnprintf(attr_name, sizeof(attr_name), "FIELD_%d_SUMMARY", field_idx);
+    } /* end if */
+    else {
+        if ((mem_type_id = H5Tcopy(H5T_NATIVE_DOUBLE)) < 0)
+            goto out;
+        HDstrcpy(attr_name, "SUMMARY");
+    } /* end else */
+
+    /* get the number of records */
+    if ((sid = H5Dget_space(did)) < 0)
+        goto out;
+    if (H5Sget_simple_extent_ndims(sid) != 1)
+        goto out;
+    if (H5Sget_simple_extent_dims(sid, dims, NULL) < 0)
+        goto out;
+
+    /* all summaries of a dataset use the same block size, chosen when the
+     * first one is built */
+    if ((has_block = H5Aexists(did, H5TB_SUMMARY_BLOCK_ATTR)) < 0)
+        goto out;
+    if (has_block) {
+        if ((aid = H5Aopen(did, H5TB_SUMMARY_BLOCK_ATTR, H5P_DEFAULT)) < 0)
+            goto out;
+        if (H5Aread(aid, H5T_NATIVE_HSIZE, &block) < 0)
+            goto out;
+        if (H5Aclose(aid) < 0)
+            goto out;
+        aid = H5I_BADID;
+        if (block == 0)
+            goto out;
+    } /* end if */
+    else {
+        hsize_t nchunks;
+
+        if (0 == (block = H5TB_query_block_size(did)))
+            goto out;
+        nchunks = (dims[0] + block - 1) / block;
+        if (nchunks > H5TB_SUMMARY_MAX_BLOCKS)
+            block *= (nchunks + H5TB_SUMMARY_MAX_BLOCKS - 1) / H5TB_SUMMARY_MAX_BLOCKS;
+
+        if ((a_sid = H5Screate(H5S_SCALAR)) < 0)
+            goto out;
+        if ((aid = H5Acreate2(did, H5TB_SUMMARY_BLOCK_ATTR, H5T_NATIVE_HSIZE, a_sid, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+            goto out;
+        if (H5Awrite(aid, H5T_NATIVE_HSIZE, &block) < 0)
+            goto out;
+        if (H5Aclose(aid) < 0)
+            goto out;
+        aid = H5I_BADID;
+        if (H5Sclose(a_sid) < 0)
+            goto out;
+        a_sid = H5I_BADID;
+    } /* end else */
+
+    /* remove the old summary of the field */
+    if ((has_summary = H5Aexists(did, attr_name)) < 0)
+        goto out;
+    if (has_summary)
+        if (H5Adelete(did, attr_name) < 0)
+            goto out;
+
+    /* only full blocks are summarized */
+    if (0 == (nblocks = dims[0] / block)) {
+        ret_val = 0;
+        goto out;
+    } /* end if */
+
+    if (NULL == (summary = (double *)HDmalloc((size_t)nblocks * 2 * sizeof(double))))
+        goto out;
+    if (NULL == (values = (double *)HDmalloc((size_t)MIN(block, H5TB_QUERY_BLOCK) * sizeof(double))))
+        goto out;
+    for (i = 0; i < nblocks; i++) {
+        summary[2 * i]     = HUGE_VAL;
+        summary[2 * i + 1] = -HUGE_VAL;
+    } /* end for */
+
+    /* read the field and find the minimum and maximum of each block */
+    for (start = 0; start < nblocks * block; start += count[0]) {
+        hsize_t b = start / block;
+
+        count[0] = MIN(nblocks * block - start, H5TB_QUERY_BLOCK);
+        count[0] = MIN(count[0], (b + 1) * block - start);
+
+        offset[0] = start;
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, NULL, count, NULL) < 0)
+            goto out;
+        if ((m_sid = H5Screate_simple(1, count, NULL)) < 0)
+            goto out;
+        if (H5Dread(did, mem_type_id, m_sid, sid, H5P_DEFAULT, values) < 0)
+            goto out;
+        if (H5Sclose(m_sid) < 0)
+            goto out;
+        m_sid = H5I_BADID;
+
+        for (i = 0; i < count[0]; i++) {
+            double v = values[i];
+
+            /* a NaN makes the block match anything, so that NE terms still
+             * find it */
+            if (HDisnan(v)) {
+                summary[2 * b]     = -HUGE_VAL;
+                summary[2 * b + 1] = HUGE_VAL;
+            } /* end if */
+            else {
+                if (v < summary[2 * b])
+                    summary[2 * b] = v;
+                if (v > summary[2 * b + 1])
+                    summary[2 * b + 1] = v;
+            } /* end else */
+        }     /* end for */
+    }         /* end for */
+
+    /* store the summary */
+    a_dims[0] = nblocks;
+    a_dims[1] = 2;
+    if ((a_sid = H5Screate_simple(2, a_dims, NULL)) < 0)
+        goto out;
+    if ((aid = H5Acreate2(did, attr_name, H5T_NATIVE_DOUBLE, a_sid, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        goto out;
+    if (H5Awrite(aid, H5T_NATIVE_DOUBLE, summary) < 0)
+        goto out;
+
+    ret_val = 0;
+
+out:
+    if (values)
+        HDfree(values);
+    if (summary)
+        HDfree(summary);
+    if (aid > 0)
+        if (H5Aclose(aid) < 0)
+            ret_val = -1;
+    if (a_sid > 0)
+        if (H5Sclose(a_sid) < 0)
+            ret_val = -1;
+    if (m_sid > 0)
+        if (H5Sclose(m_sid) < 0)
+            ret_val = -1;
+    if (sid > 0)
+        if (H5Sclose(sid) < 0)
+            ret_val = -1;
+    if (mem_type_id > 0)
+        if (H5Tclose(mem_type_id) < 0)
+            ret_val = -1;
+    if (ftype_id > 0)
+        if (H5Tclose(ftype_id) < 0)
+            ret_val = -1;
+    if (did > 0)
+        if (H5Dclose(did) < 0)
+            ret_val = -1;
+
+    return ret_val;
+} /* end H5TBbuild_summary() */
+
 /*-------------------------------------------------------------------------
  *
  * internal functions
@@ -3146,6 +3574,527 @@ out:
  *-------------------------------------------------------------------------
  */
 
+/*-------------------------------------------------------------------------
+ * Function: H5TB_query_field
+ *
+ * Purpose: Private function that finds the field a query term or
+ *          summary refers to, and checks that it is a number
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ * Comments: field_idx is set to the member index of the field, or to -1
+ *           for a dataset of numbers, where field_name must be NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5TB_query_field(hid_t ftype_id, const char *field_name, int *field_idx)
+{
+    hid_t       mtype_id = H5I_BADID;
+    H5T_class_t type_class;
+    herr_t      ret_val = -1;
+
+    if ((type_class = H5Tget_class(ftype_id)) < 0)
+        goto out;
+
+    if (type_class == H5T_COMPOUND) {
+        if (field_name == NULL)
+            goto out;
+        if ((*field_idx = H5Tget_member_index(ftype_id, field_name)) < 0)
+            goto out;
+        if ((mtype_id = H5Tget_member_type(ftype_id, (unsigned)*field_idx)) < 0)
+            goto out;
+        if ((type_class = H5Tget_class(mtype_id)) < 0)
+            goto out;
+    } /* end if */
+    else {
+        if (field_name != NULL)
+            goto out;
+        *field_idx = -1;
+    } /* end else */
+
+    if (type_class != H5T_INTEGER && type_class != H5T_FLOAT)
+        goto out;
+
+    ret_val = 0;
+
+out:
+    if (mtype_id > 0)
+        if (H5Tclose(mtype_id) < 0)
+            ret_val = -1;
+
+    return ret_val;
+} /* end H5TB_query_field() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5TB_query_block_size
+ *
+ * Purpose: Private function that returns the number of records a query
+ *          reads at a time: the chunk size of a chunked dataset, or
+ *          H5TB_QUERY_BLOCK
+ *
+ * Return: Success: the number of records, Failure: 0
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5TB_query_block_size(hid_t did)
+{
+    hid_t   plist_id = H5I_BADID;
+    hsize_t dims[1];
+    hsize_t ret_val = 0;
+
+    if ((plist_id = H5Dget_create_plist(did)) < 0)
+        goto out;
+
+    if (H5Pget_layout(plist_id) == H5D_CHUNKED) {
+        if (H5Pget_chunk(plist_id, 1, dims) != 1)
+            goto out;
+        ret_val = dims[0];
+    } /* end if */
+    else
+        ret_val = H5TB_QUERY_BLOCK;
+
+out:
+    if (plist_id > 0)
+        if (H5Pclose(plist_id) < 0)
+            ret_val = 0;
+
+    return ret_val;
+} /* end H5TB_query_block_size() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5TB_drop_summaries
+ *
+ * Purpose: Private function that removes the query summaries of a
+ *          dataset whose records are about to change
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5TB_drop_summaries(hid_t did)
+{
+    hid_t  tid = H5I_BADID;
+    char   attr_name[255];
+    int    nfields;
+    int    i;
+    htri_t has_attr;
+    herr_t ret_val = -1;
+
+    /* no summary was built when the block size was never chosen */
+    if ((has_attr = H5Aexists(did, H5TB_SUMMARY_BLOCK_ATTR)) < 0)
+        goto out;
+    if (!has_attr)
+        return 0;
+
+    if ((tid = H5Dget_type(did)) < 0)
+        goto out;
+
+    if (H5Tget_class(tid) == H5T_COMPOUND) {
+        if ((nfields = H5Tget_nmembers(tid)) < 0)
+            goto out;
+    } /* end if */
+    else
+        nfields = 0;
+
+    for (i = -1; i < nfields; i++) {
+        if (i < 0)
+            HDstrcpy(attr_name, "SUMMARY");
+        else
+            HDsnprintf(attr_name, sizeof(attr_name), "FIELD_%d_SUMMARY", i);
+        if ((has_attr = H5Aexists(did, attr_name)) < 0)
+            goto out;
+        if (has_attr)
+            if (H5Adelete(did, attr_name) < 0)
+                goto out;
+    } /* end for */
+
+    if (H5Adelete(did, H5TB_SUMMARY_BLOCK_ATTR) < 0)
+        goto out;
+
+    ret_val = 0;
+
+out:
+    if (tid > 0)
+        if (H5Tclose(tid) < 0)
+            ret_val = -1;
+
+    return ret_val;
+} /* end H5TB_drop_summaries() */
+
+/* The query terms compare doubles exactly, as the application asked */
+H5_GCC_DIAG_OFF("float-equal")
+
+/*-------------------------------------------------------------------------
+ * Function: H5TB_query_term_match
+ *
+ * Purpose: Private function that evaluates a query term for a value
+ *
+ * Return: TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_PURE static hbool_t
+H5TB_query_term_match(const H5TB_query_term_t *term, double v)
+{
+    switch (term->op) {
+        case H5TB_QUERY_EQ:
+            return (hbool_t)(v == term->value);
+        case H5TB_QUERY_NE:
+            return (hbool_t)(v != term->value);
+        case H5TB_QUERY_LT:
+            return (hbool_t)(v < term->value);
+        case H5TB_QUERY_LE:
+            return (hbool_t)(v <= term->value);
+        case H5TB_QUERY_GT:
+            return (hbool_t)(v > term->value);
+        case H5TB_QUERY_GE:
+            return (hbool_t)(v >= term->value);
+        case H5TB_QUERY_RANGE:
+            return (hbool_t)(v >= term->value && v <= term->value2);
+        default:
+            return FALSE;
+    } /* end switch */
+} /* end H5TB_query_term_match() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5TB_query_term_may_match
+ *
+ * Purpose: Private function that checks whether a query term can be
+ *          true for some value between min and max
+ *
+ * Return: TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_PURE static hbool_t
+H5TB_query_term_may_match(const H5TB_query_term_t *term, double min, double max)
+{
+    switch (term->op) {
+        case H5TB_QUERY_EQ:
+            return (hbool_t)(min <= term->value && term->value <= max);
+        case H5TB_QUERY_NE:
+            return (hbool_t)!(min == term->value && max == term->value);
+        case H5TB_QUERY_LT:
+            return (hbool_t)(min < term->value);
+        case H5TB_QUERY_LE:
+            return (hbool_t)(min <= term->value);
+        case H5TB_QUERY_GT:
+            return (hbool_t)(max > term->value);
+        case H5TB_QUERY_GE:
+            return (hbool_t)(max >= term->value);
+        case H5TB_QUERY_RANGE:
+            return (hbool_t)(min <= term->value2 && max >= term->value);
+        default:
+            return TRUE;
+    } /* end switch */
+} /* end H5TB_query_term_may_match() */
+
+H5_GCC_DIAG_ON("float-equal")
+
+/*-------------------------------------------------------------------------
+ * Function: H5TB_query_may_match
+ *
+ * Purpose: Private function that checks, from the summaries, whether any
+ *          record in [start, end) can satisfy a query
+ *
+ * Return: TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5TB_query_may_match(const H5TB_query_t *query, size_t nterms, const H5TB_query_term_t *terms,
+                     hsize_t start, hsize_t end)
+{
+    hbool_t ret_val = TRUE;
+    size_t  t;
+
+    for (t = 0; t < nterms; t++) {
+        size_t        slot    = query->term_slot[t];
+        const double *summary = query->summary[slot];
+        hbool_t       may     = TRUE;
+
+        if (summary) {
+            hsize_t first = start / query->summary_block;
+            hsize_t last  = (end - 1) / query->summary_block;
+
+            /* records past the summarized blocks may be anything */
+            if (last < query->summary_nblocks[slot]) {
+                double  min = summary[2 * first];
+                double  max = summary[2 * first + 1];
+                hsize_t b;
+
+                for (b = first + 1; b <= last; b++) {
+                    min = MIN(min, summary[2 * b]);
+                    max = MAX(max, summary[2 * b + 1]);
+                } /* end for */
+                may = H5TB_query_term_may_match(&terms[t], min, max);
+            } /* end if */
+        }     /* end if */
+
+        if (t == 0)
+            ret_val = may;
+        else if (terms[t].combine == H5TB_QUERY_OR)
+            ret_val = (hbool_t)(ret_val || may);
+        else
+            ret_val = (hbool_t)(ret_val && may);
+    } /* end for */
+
+    return ret_val;
+} /* end H5TB_query_may_match() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5TB_query_scan
+ *
+ * Purpose: Private function that evaluates a query over a dataset
+ *
+ * Return: Success: 0, Failure: -1
+ *
+ * Comments: Reads runs of blocks that the summaries can not rule out,
+ *           converting only the fields the terms use to doubles, and
+ *           evaluates the terms for each record.  Used by
+ *           H5TBquery_records and H5TBquery_read_records.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5TB_query_scan(hid_t did, size_t nterms, const H5TB_query_term_t *terms, hsize_t max_hits, hsize_t *nhits,
+                hsize_t *indices)
+{
+    H5TB_query_t query;
+    hid_t        ftype_id    = H5I_BADID;
+    hid_t        mem_type_id = H5I_BADID;
+    hid_t        sid         = H5I_BADID;
+    hid_t        m_sid       = H5I_BADID;
+    hid_t        aid         = H5I_BADID;
+    hid_t        a_sid       = H5I_BADID;
+    int *        slot_field  = NULL;
+    double *     values      = NULL;
+    hsize_t      dims[1];
+    hsize_t      a_dims[2];
+    hsize_t      offset[1];
+    hsize_t      count[1];
+    hsize_t      block;
+    hsize_t      run_max;
+    hsize_t      pos;
+    hsize_t      i;
+    char         attr_name[255];
+    size_t       t, u;
+    htri_t       has_attr;
+    herr_t       ret_val = -1;
+
+    HDmemset(&query, 0, sizeof(query));
+
+    /* check the arguments */
+    if (nterms == 0 || terms == NULL)
+        goto out;
+    for (t = 0; t < nterms; t++)
+        if ((int)terms[t].op < (int)H5TB_QUERY_EQ || (int)terms[t].op > (int)H5TB_QUERY_RANGE)
+            goto out;
+
+    *nhits = 0;
+
+    /* get the datatype */
+    if ((ftype_id = H5Dget_type(did)) < 0)
+        goto out;
+
+    /* map the terms to the distinct fields they use */
+    if (NULL == (query.term_slot = (size_t *)HDmalloc(nterms * sizeof(size_t))))
+        goto out;
+    if (NULL == (slot_field = (int *)HDmalloc(nterms * sizeof(int))))
+        goto out;
+    for (t = 0; t < nterms; t++) {
+        int field_idx;
+
+        if (H5TB_query_field(ftype_id, terms[t].field_name, &field_idx) < 0)
+            goto out;
+        for (u = 0; u < query.nslots; u++)
+            if (slot_field[u] == field_idx)
+                break;
+        if (u == query.nslots)
+            slot_field[query.nslots++] = field_idx;
+        query.term_slot[t] = u;
+    } /* end for */
+
+    /* make a memory type that reads those fields as doubles */
+    if (slot_field[0] >= 0) {
+        if ((mem_type_id = H5Tcreate(H5T_COMPOUND, query.nslots * sizeof(double))) < 0)
+            goto out;
+        for (u = 0; u < query.nslots; u++) {
+            char *member_name;
+
+            if (NULL == (member_name = H5Tget_member_name(ftype_id, (unsigned)slot_field[u])))
+                goto out;
+            if (H5Tinsert(mem_type_id, member_name, u * sizeof(double), H5T_NATIVE_DOUBLE) < 0) {
+                H5free_memory(member_name);
+                goto out;
+            } /* end if */
+            H5free_memory(member_name);
+        } /* end for */
+    }     /* end if */
+    else if ((mem_type_id = H5Tcopy(H5T_NATIVE_DOUBLE)) < 0)
+        goto out;
+
+    /* get the number of records */
+    if ((sid = H5Dget_space(did)) < 0)
+        goto out;
+    if (H5Sget_simple_extent_ndims(sid) != 1)
+        goto out;
+    if (H5Sget_simple_extent_dims(sid, dims, NULL) < 0)
+        goto out;
+
+    /* load the summaries of the fields, if there are any */
+    if (NULL == (query.summary = (double **)HDcalloc(query.nslots, sizeof(double *))))
+        goto out;
+    if (NULL == (query.summary_nblocks = (hsize_t *)HDcalloc(query.nslots, sizeof(hsize_t))))
+        goto out;
+    if ((has_attr = H5Aexists(did, H5TB_SUMMARY_BLOCK_ATTR)) < 0)
+        goto out;
+    if (has_attr) {
+        if ((aid = H5Aopen(did, H5TB_SUMMARY_BLOCK_ATTR, H5P_DEFAULT)) < 0)
+            goto out;
+        if (H5Aread(aid, H5T_NATIVE_HSIZE, &query.summary_block) < 0)
+            goto out;
+        if (H5Aclose(aid) < 0)
+            goto out;
+        aid = H5I_BADID;
+    } /* end if */
+    for (u = 0; u < query.nslots && query.summary_block > 0; u++) {
+        if (slot_field[u] >= 0)
+            HDsnprintf(attr_name, sizeof(attr_name), "FIELD_%d_SUMMARY", slot_field[u]);
+        else
+            HDstrcpy(attr_name, "SUMMARY");
+        if ((has_attr = H5Aexists(did, attr_name)) < 0)
+            goto out;
+        if (!has_attr)
+            continue;
+
+        if ((aid = H5Aopen(did, attr_name, H5P_DEFAULT)) < 0)
+            goto out;
+        if ((a_sid = H5Aget_space(aid)) < 0)
+            goto out;
+        if (H5Sget_simple_extent_ndims(a_sid) != 2)
+            goto out;
+        if (H5Sget_simple_extent_dims(a_sid, a_dims, NULL) < 0)
+            goto out;
+        if (a_dims[1] != 2)
+            goto out;
+        if (NULL == (query.summary[u] = (double *)HDmalloc((size_t)a_dims[0] * 2 * sizeof(double))))
+            goto out;
+        if (H5Aread(aid, H5T_NATIVE_DOUBLE, query.summary[u]) < 0)
+            goto out;
+        query.summary_nblocks[u] = a_dims[0];
+        if (H5Sclose(a_sid) < 0)
+            goto out;
+        a_sid = H5I_BADID;
+        if (H5Aclose(aid) < 0)
+            goto out;
+        aid = H5I_BADID;
+    } /* end for */
+
+    /* read whole blocks, several at a time when they are small */
+    if (0 == (block = H5TB_query_block_size(did)))
+        goto out;
+    run_max = MAX(block, (H5TB_QUERY_BLOCK / block) * block);
+    if (NULL == (values = (double *)HDmalloc((size_t)MAX(1, MIN(run_max, dims[0])) * query.nslots *
+                                             sizeof(double))))
+        goto out;
+
+    pos = 0;
+    while (pos < dims[0]) {
+        hsize_t run_start;
+
+        /* skip the blocks the summaries rule out */
+        while (pos < dims[0] && !H5TB_query_may_match(&query, nterms, terms, pos, MIN(pos + block, dims[0])))
+            pos += block;
+        if (pos >= dims[0])
+            break;
+
+        /* extend the run over the blocks that follow and may match */
+        run_start = pos;
+        pos       = MIN(pos + block, dims[0]);
+        while (pos < dims[0] && pos - run_start + block <= run_max &&
+               H5TB_query_may_match(&query, nterms, terms, pos, MIN(pos + block, dims[0])))
+            pos = MIN(pos + block, dims[0]);
+
+        /* read the fields of the run */
+        offset[0] = run_start;
+        count[0]  = pos - run_start;
+        if (H5Sselect_hyperslab(sid, H5S_SELECT_SET, offset, NULL, count, NULL) < 0)
+            goto out;
+        if ((m_sid = H5Screate_simple(1, count, NULL)) < 0)
+            goto out;
+        if (H5Dread(did, mem_type_id, m_sid, sid, H5P_DEFAULT, values) < 0)
+            goto out;
+        if (H5Sclose(m_sid) < 0)
+            goto out;
+        m_sid = H5I_BADID;
+
+        /* evaluate the terms for each record */
+        for (i = 0; i < count[0]; i++) {
+            const double *rec   = values + i * query.nslots;
+            hbool_t       match = FALSE;
+
+            for (t = 0; t < nterms; t++) {
+                hbool_t term_match = H5TB_query_term_match(&terms[t], rec[query.term_slot[t]]);
+
+                if (t == 0)
+                    match = term_match;
+                else if (terms[t].combine == H5TB_QUERY_OR)
+                    match = (hbool_t)(match || term_match);
+                else
+                    match = (hbool_t)(match && term_match);
+            } /* end for */
+
+            if (match) {
+                if (indices && *nhits < max_hits)
+                    indices[*nhits] = run_start + i;
+                (*nhits)++;
+            } /* end if */
+        }     /* end for */
+    }         /* end while */
+
+    ret_val = 0;
+
+out:
+    if (values)
+        HDfree(values);
+    if (query.summary) {
+        for (u = 0; u < query.nslots; u++)
+            if (query.summary[u])
+                HDfree(query.summary[u]);
+        HDfree(query.summary);
+    } /* end if */
+    if (query.summary_nblocks)
+        HDfree(query.summary_nblocks);
+    if (query.term_slot)
+        HDfree(query.term_slot);
+    if (slot_field)
+        HDfree(slot_field);
+    if (aid > 0)
+        if (H5Aclose(aid) < 0)
+            ret_val = -1;
+    if (a_sid > 0)
+        if (H5Sclose(a_sid) < 0)
+            ret_val = -1;
+    if (m_sid > 0)
+        if (H5Sclose(m_sid) < 0)
+            ret_val = -1;
+    if (sid > 0)
+        if (H5Sclose(sid) < 0)
+            ret_val = -1;
+    if (mem_type_id > 0)
+        if (H5Tclose(mem_type_id) < 0)
+            ret_val = -1;
+    if (ftype_id > 0)
+        if (H5Tclose(ftype_id) < 0)
+            ret_val = -1;
+
+    return ret_val;
+} /* end H5TB_query_scan() */
+
 /*-------------------------------------------------------------------------
  * Function: H5TB_find_field
  *
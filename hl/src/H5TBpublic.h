@@ -88,6 +88,50 @@ H5_HLDLL herr_t H5TBget_table_info(hid_t loc_id, const char *dset_name, hsize_t
 H5_HLDLL herr_t H5TBget_field_info(hid_t loc_id, const char *dset_name, char *field_names[],
                                    size_t *field_sizes, size_t *field_offsets, size_t *type_size);
 
+/*-------------------------------------------------------------------------
+ *
+ * Query functions
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/* Comparison of a query term */
+typedef enum H5TB_query_op_t {
+    H5TB_QUERY_EQ,   /* field == value */
+    H5TB_QUERY_NE,   /* field != value */
+    H5TB_QUERY_LT,   /* field <  value */
+    H5TB_QUERY_LE,   /* field <= value */
+    H5TB_QUERY_GT,   /* field >  value */
+    H5TB_QUERY_GE,   /* field >= value */
+    H5TB_QUERY_RANGE /* value <= field <= value2 */
+} H5TB_query_op_t;
+
+/* How a query term is combined with the result of the terms before it */
+typedef enum H5TB_query_combine_t { H5TB_QUERY_AND, H5TB_QUERY_OR } H5TB_query_combine_t;
+
+/* One term of a query.  Terms are evaluated left to right, so
+ * {A, OR B, AND C} means ((A OR B) AND C).  Field values are compared as
+ * doubles.  field_name is NULL for a 1-D dataset of numbers.
+ */
+typedef struct H5TB_query_term_t {
+    H5TB_query_combine_t combine;    /* Ignored for the first term */
+    const char *         field_name; /* Integer or floating-point field */
+    H5TB_query_op_t      op;
+    double               value;
+    double               value2; /* Upper bound for H5TB_QUERY_RANGE */
+} H5TB_query_term_t;
+
+H5_HLDLL herr_t H5TBquery_records(hid_t loc_id, const char *dset_name, size_t nterms,
+                                  const H5TB_query_term_t *terms, hsize_t max_hits, hsize_t *nhits,
+                                  hsize_t *indices);
+
+H5_HLDLL herr_t H5TBquery_read_records(hid_t loc_id, const char *dset_name, size_t nterms,
+                                       const H5TB_query_term_t *terms, hsize_t max_hits, size_t type_size,
+                                       const size_t *dst_offset, const size_t *dst_sizes, hsize_t *nhits,
+                                       void *buf);
+
+H5_HLDLL herr_t H5TBbuild_summary(hid_t loc_id, const char *dset_name, const char *field_name);
+
 /*-------------------------------------------------------------------------
  *
  * Manipulation functions
@@ -13,6 +13,7 @@
 
 #include "h5hltest.h"
 #include "H5DOpublic.h"
+#include "H5LDpublic.h"
 
 #if defined(H5_HAVE_ZLIB_H) && !defined(H5_ZLIB_HEADER)
 #define H5_ZLIB_HEADER "zlib.h"
@@ -30,6 +31,8 @@
 #define DNAME_COLUMN "dataset_column"
 #define DBUGNAME1    "dataset_bug1"
 #define DBUGNAME2    "dataset_bug2"
+#define DNAME_STREAM "dataset_stream"
+#define DNAME_CONV   "dataset_stream_conv"
 
 /*-------------------------------------------------------------------------
  * Function:    test_dataset_append_notset
@@ -1217,6 +1220,176 @@ error:
     return 1;
 } /* test_dataset_append_vary() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_dataset_append_stream
+ *
+ * Purpose:     Verify that an append stream writes whole chunks, flushes
+ *              only at chunk boundaries, and that H5LDget_dset_chunk_elmts()
+ *              reads back only the full chunks.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_dataset_append_stream(hid_t fid)
+{
+    hid_t did    = -1; /* Dataset ID */
+    hid_t sid    = -1; /* Dataspace ID */
+    hid_t dcpl   = -1; /* A copy of dataset creation property */
+    hid_t ffapl  = -1; /* The file's file access property list */
+    hid_t stream = -1; /* Append stream ID */
+
+    hsize_t dims[2]       = {6, 0};             /* Current dimension sizes */
+    hsize_t maxdims[2]    = {6, H5S_UNLIMITED}; /* Maximum dimension sizes */
+    hsize_t chunk_dims[2] = {4, 5};             /* Chunk dimension sizes */
+    hsize_t prev_dims[2]  = {6, 0};             /* Dimensions already read */
+    hsize_t cur_dims[2];                        /* Dimensions to read up to */
+    hsize_t dims1    = 0;                       /* Current size of the 1-D dataset */
+    hsize_t maxdims1 = H5S_UNLIMITED;           /* Maximum size of the 1-D dataset */
+    hsize_t chunk1   = 4;                       /* Chunk size of the 1-D dataset */
+    int     cbuf[6][3];                         /* The data appended at a time */
+    int     buf[6][12], rbuf[6][12];            /* The data buffers */
+    short   sval;                               /* Value appended to the 1-D dataset */
+    int     ibuf[10];                           /* Data read from the 1-D dataset */
+    int     i, j, k;                            /* Local index variables */
+
+    unsigned *flush_ptr; /* Points to the flush counter */
+
+    HL_TESTING2("Append stream with H5DOstream_append()");
+
+    /* Get the file's file access property list */
+    if ((ffapl = H5Fget_access_plist(fid)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pget_object_flush_cb(ffapl, NULL, (void **)&flush_ptr) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Create a chunked dataset with edge chunks in the fixed dimension */
+    if ((sid = H5Screate_simple(2, dims, maxdims)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, DNAME_STREAM, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    if ((stream = H5DOstream_open(did, H5P_DEFAULT, 1, H5T_NATIVE_INT)) < 0)
+        TEST_ERROR;
+
+    /* Append 12 columns, 3 at a time */
+    for (k = 0; k < 4; k++) {
+        for (i = 0; i < 6; i++)
+            for (j = 0; j < 3; j++)
+                cbuf[i][j] = buf[i][(k * 3) + j] = (i * 100) + (k * 3) + j;
+        if (H5DOstream_append(stream, (size_t)3, cbuf) < 0)
+            TEST_ERROR;
+
+        /* Only whole chunks are visible */
+        if (H5LDget_dset_dims(did, cur_dims) < 0)
+            TEST_ERROR;
+        if (cur_dims[1] != (hsize_t)(((k + 1) * 3) / 5) * 5)
+            TEST_ERROR;
+    } /* end for */
+
+    /* The dataset was flushed once per chunk boundary */
+    if (*flush_ptr != 2)
+        TEST_ERROR;
+
+    /* Read the full chunks with the tailing reader */
+    cur_dims[0] = 6;
+    cur_dims[1] = 12;
+    if (H5LDget_dset_chunk_elmts(did, prev_dims, cur_dims, NULL, rbuf) < 0)
+        TEST_ERROR;
+    if (cur_dims[1] != 10)
+        TEST_ERROR;
+    for (i = 0; i < 6; i++)
+        for (j = 0; j < 10; j++)
+            if (((int *)rbuf)[(i * 10) + j] != buf[i][j])
+                TEST_ERROR;
+
+    /* Nothing new until the next chunk is complete */
+    prev_dims[1] = cur_dims[1];
+    cur_dims[1]  = 12;
+    if (H5LDget_dset_chunk_elmts(did, prev_dims, cur_dims, NULL, rbuf) < 0)
+        TEST_ERROR;
+    if (cur_dims[1] != 10)
+        TEST_ERROR;
+
+    /* Closing the stream writes the rest */
+    if (H5DOstream_close(stream) < 0)
+        TEST_ERROR;
+    stream = -1;
+    if (*flush_ptr != 3)
+        TEST_ERROR;
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < 6; i++)
+        for (j = 0; j < 12; j++)
+            if (buf[i][j] != rbuf[i][j])
+                TEST_ERROR;
+
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Append values that need converting, one at a time */
+    if ((sid = H5Screate_simple(1, &dims1, &maxdims1)) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pset_chunk(dcpl, 1, &chunk1) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, DNAME_CONV, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((stream = H5DOstream_open(did, H5P_DEFAULT, 0, H5T_NATIVE_SHORT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < 10; i++) {
+        sval = (short)(-i);
+        if (H5DOstream_append(stream, (size_t)1, &sval) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5LDget_dset_dims(did, &dims1) < 0)
+        TEST_ERROR;
+    if (dims1 != 8)
+        TEST_ERROR;
+    if (H5DOstream_close(stream) < 0)
+        TEST_ERROR;
+    stream = -1;
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, ibuf) < 0)
+        FAIL_STACK_ERROR;
+    for (i = 0; i < 10; i++)
+        if (ibuf[i] != -i)
+            TEST_ERROR;
+
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR;
+    if (H5Pclose(ffapl) < 0)
+        FAIL_STACK_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5DOstream_close(stream);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Pclose(ffapl);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* test_dataset_append_stream() */
+
 /*-------------------------------------------------------------------------
  * Function:    Main function
  *
@@ -1281,6 +1454,9 @@ main(void)
     flush_ct = 0; /* Reset flush counter */
     nerrors += test_dataset_append_vary(fid);
 
+    flush_ct = 0; /* Reset flush counter */
+    nerrors += test_dataset_append_stream(fid);
+
     /* Closing */
     if (H5Pclose(fapl) < 0)
         FAIL_STACK_ERROR;
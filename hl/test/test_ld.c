@@ -150,6 +150,7 @@ int twotests[TWO_TESTS][2] = {{2, 2}, {2, -1}, {2, 0}, {-1, 2}, {0, 2}};
 
 static herr_t test_LD_dims_params(const char *file);
 static herr_t test_LD_dims(const char *file);
+static herr_t test_LD_wait(const char *file);
 
 static herr_t test_LD_size(const char *file);
 
@@ -481,6 +482,87 @@ error:
 
 } /* test_LD_dims() */
 
+/*
+ *********************************************************************************
+ *
+ * Testing for the High Level public routine: H5LDwait_dset_dims()
+ *    Verify that it returns the unchanged dimension sizes once the timeout
+ *    passes, and the new sizes as soon as the dataset is extended
+ *
+ *********************************************************************************
+ */
+static herr_t
+test_LD_wait(const char *file)
+{
+    hid_t   fid = -1;     /* file identifier */
+    hid_t   did = -1;     /* dataset identifier */
+    hsize_t prev_dims[2]; /* original dimension sizes */
+    hsize_t cur_dims[2];  /* current dimension sizes */
+    hsize_t ext_dims[2];  /* extended dimension sizes */
+
+    HL_TESTING2("H5LDwait_dset_dims");
+
+    /* Make a copy of the test file */
+    if (h5_make_local_copy(file, COPY_FILENAME) < 0)
+        TEST_ERROR
+
+    /* Open the copied file and the two-dimensional dataset */
+    if ((fid = H5Fopen(COPY_FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dopen2(fid, DSET_TWO, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5LDget_dset_dims(did, prev_dims) < 0)
+        FAIL_STACK_ERROR
+
+    /* Verify failure for invalid parameters */
+    H5E_BEGIN_TRY
+    {
+        if (H5LDwait_dset_dims(did, NULL, 0.0, cur_dims) >= 0)
+            TEST_ERROR
+        if (H5LDwait_dset_dims(did, prev_dims, 0.0, NULL) >= 0)
+            TEST_ERROR
+    }
+    H5E_END_TRY;
+
+    /* Nothing changes: the sizes come back as they were */
+    if (H5LDwait_dset_dims(did, prev_dims, 0.01, cur_dims) < 0)
+        FAIL_STACK_ERROR
+    VERIFY_EQUAL(cur_dims[0], prev_dims[0])
+    VERIFY_EQUAL(cur_dims[1], prev_dims[1])
+
+    /* The new sizes are returned without waiting for the timeout */
+    ext_dims[0] = prev_dims[0];
+    ext_dims[1] = prev_dims[1] + 2;
+    if (H5Dset_extent(did, ext_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5LDwait_dset_dims(did, prev_dims, -1.0, cur_dims) < 0)
+        FAIL_STACK_ERROR
+    VERIFY_EQUAL(cur_dims[0], ext_dims[0])
+    VERIFY_EQUAL(cur_dims[1], ext_dims[1])
+
+    /* Close the dataset and the file */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Remove the copied file */
+    HDremove(COPY_FILENAME);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return (-1);
+
+} /* test_LD_wait() */
+
 /*
  **********************************************************************************
  *
@@ -1359,6 +1441,7 @@ main(void)
      */
     nerrors += test_LD_dims_params(FILE);
     nerrors += test_LD_dims(FILE);
+    nerrors += test_LD_wait(FILE);
 
     /*
      * Testing H5LDget_dset_type_size()
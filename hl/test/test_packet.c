@@ -498,6 +498,122 @@ error:
     return FAIL;
 }
 
+/*-------------------------------------------------------------------------
+ * test_append_buffer
+ *
+ * Tests appending packets through the append buffer set by
+ * H5PTset_append_buffer, and that buffered packets are written by
+ * reads, H5PTflush and H5PTclose.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_append_buffer(hid_t fid)
+{
+    herr_t     err;
+    hid_t      table  = H5I_INVALID_HID;
+    hid_t      dset   = H5I_INVALID_HID;
+    hid_t      space  = H5I_INVALID_HID;
+    hid_t      part_t = H5I_INVALID_HID;
+    hssize_t   npoints;
+    size_t     c;
+    particle_t readPart;
+    hsize_t    count;
+
+    HL_TESTING2("H5PTset_append_buffer and H5PTflush");
+
+    /* Create a datatype for the particle struct */
+    part_t = make_particle_type();
+
+    HDassert(part_t != -1);
+
+    /* Create a new table and give it a buffer of two chunks */
+    table = H5PTcreate(fid, "Buffered Packet Table", part_t, (hsize_t)16, H5P_DEFAULT);
+    if (H5Tclose(part_t) < 0)
+        goto error;
+    if (H5PTis_valid(table) < 0)
+        goto error;
+    if (H5PTset_append_buffer(table, (size_t)32) < 0)
+        goto error;
+
+    /* Append packets in groups of 1 and 3 */
+    for (c = 0; c < 24; c += 4) {
+        if (H5PTappend(table, (size_t)1, &(testPart[c % NRECORDS])) < 0)
+            goto error;
+        if (H5PTappend(table, (size_t)3, &(testPart[(c + 1) % NRECORDS])) < 0)
+            goto error;
+    }
+
+    /* The buffered packets are counted, but not yet in the dataset */
+    err = H5PTget_num_packets(table, &count);
+    if (err < 0 || count != 24)
+        goto error;
+    if ((dset = H5Dopen2(fid, "Buffered Packet Table", H5P_DEFAULT)) < 0)
+        goto error;
+    if ((space = H5Dget_space(dset)) < 0)
+        goto error;
+    if ((npoints = H5Sget_simple_extent_npoints(space)) != 0)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+
+    /* Flushing writes them out */
+    if (H5PTflush(table) < 0)
+        goto error;
+    if ((space = H5Dget_space(dset)) < 0)
+        goto error;
+    if ((npoints = H5Sget_simple_extent_npoints(space)) != 24)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+
+    /* Append more than the buffer holds, then a few buffered packets */
+    for (c = 0; c < 5; c++)
+        if (H5PTappend(table, (size_t)8, &(testPart[0])) < 0)
+            goto error;
+    if (H5PTappend(table, (size_t)4, &(testPart[0])) < 0)
+        goto error;
+
+    /* Reading makes all packets visible */
+    for (c = 0; c < 68; c++) {
+        err = H5PTget_next(table, (size_t)1, &readPart);
+        if (err < 0)
+            goto error;
+        if (cmp_par(c % NRECORDS, 0, testPart, &readPart) != 0)
+            goto error;
+    }
+
+    /* Packets still in the buffer are written when the table is closed */
+    if (H5PTappend(table, (size_t)2, &(testPart[0])) < 0)
+        goto error;
+    err = H5PTclose(table);
+    if (err < 0)
+        goto error;
+    if ((space = H5Dget_space(dset)) < 0)
+        goto error;
+    if ((npoints = H5Sget_simple_extent_npoints(space)) != 70)
+        goto error;
+    if (H5Sclose(space) < 0)
+        goto error;
+    if (H5Dclose(dset) < 0)
+        goto error;
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5_FAILED();
+    H5E_BEGIN_TRY
+    {
+        H5Sclose(space);
+        H5Dclose(dset);
+    }
+    H5E_END_TRY;
+    if (H5PTis_valid(table) > 0)
+        H5PTclose(table);
+    return FAIL;
+}
+
 /*-------------------------------------------------------------------------
  * test_opaque
  *
@@ -957,6 +1073,7 @@ test_packet_table(hid_t fid)
     test_read(fid);
     test_get_next(fid);
     test_big_table(fid);
+    test_append_buffer(fid);
     test_rw_nonnative_dt(fid);
     test_opaque(fid);
     test_compress();
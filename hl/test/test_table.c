@@ -39,6 +39,9 @@
  * H5TBdelete_field
  * H5TBget_table_info
  * H5TBget_field_info
+ * H5TBquery_records
+ * H5TBquery_read_records
+ * H5TBbuild_summary
  *
  *-------------------------------------------------------------------------
  */
@@ -1498,6 +1501,270 @@ out:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * a record of the query test table
+ *-------------------------------------------------------------------------
+ */
+typedef struct query_rec_t {
+    int    id;
+    double value;
+    int    group;
+} query_rec_t;
+
+#define QUERY_NRECORDS 1000
+
+/*-------------------------------------------------------------------------
+ * function that checks the result of a query against a brute force scan
+ *-------------------------------------------------------------------------
+ */
+static int
+check_query(hid_t fid, const char *dset_name, size_t nterms, const H5TB_query_term_t *terms,
+            const query_rec_t *recs)
+{
+    hsize_t *indices = NULL;
+    hsize_t  nhits;
+    hsize_t  nexpected = 0;
+    hsize_t  i;
+    size_t   t;
+    int      ret_value = -1;
+
+    if (NULL == (indices = (hsize_t *)HDmalloc(QUERY_NRECORDS * sizeof(hsize_t))))
+        goto out;
+    if (H5TBquery_records(fid, dset_name, nterms, terms, (hsize_t)QUERY_NRECORDS, &nhits, indices) < 0)
+        goto out;
+
+    for (i = 0; i < QUERY_NRECORDS; i++) {
+        hbool_t match = FALSE;
+
+        for (t = 0; t < nterms; t++) {
+            double  v = HDstrcmp(terms[t].field_name, "group") ? recs[i].value : (double)recs[i].group;
+            hbool_t m;
+
+            switch (terms[t].op) {
+                case H5TB_QUERY_EQ:
+                    m = H5_DBL_ABS_EQUAL(v, terms[t].value);
+                    break;
+                case H5TB_QUERY_NE:
+                    m = !H5_DBL_ABS_EQUAL(v, terms[t].value);
+                    break;
+                case H5TB_QUERY_LT:
+                    m = v < terms[t].value;
+                    break;
+                case H5TB_QUERY_LE:
+                    m = v <= terms[t].value;
+                    break;
+                case H5TB_QUERY_GT:
+                    m = v > terms[t].value;
+                    break;
+                case H5TB_QUERY_GE:
+                    m = v >= terms[t].value;
+                    break;
+                case H5TB_QUERY_RANGE:
+                default:
+                    m = v >= terms[t].value && v <= terms[t].value2;
+                    break;
+            }
+            if (t == 0)
+                match = m;
+            else if (terms[t].combine == H5TB_QUERY_OR)
+                match = match || m;
+            else
+                match = match && m;
+        }
+
+        if (match) {
+            if (nexpected >= nhits || indices[nexpected] != i)
+                goto out;
+            nexpected++;
+        }
+    }
+
+    if (nexpected == nhits)
+        ret_value = 0;
+
+out:
+    HDfree(indices);
+    return ret_value;
+}
+
+/*-------------------------------------------------------------------------
+ * test the query functions
+ *-------------------------------------------------------------------------
+ */
+static int
+test_query(hid_t fid)
+{
+    query_rec_t *      recs   = NULL;
+    query_rec_t        rbuf[20];
+    const char *       names[3]   = {"id", "value", "group"};
+    hid_t              types[3]   = {H5T_NATIVE_INT, H5T_NATIVE_DOUBLE, H5T_NATIVE_INT};
+    size_t             offsets[3] = {HOFFSET(query_rec_t, id), HOFFSET(query_rec_t, value),
+                         HOFFSET(query_rec_t, group)};
+    size_t             sizes[3]   = {sizeof(int), sizeof(double), sizeof(int)};
+    H5TB_query_term_t  range_and[2];
+    H5TB_query_term_t  lt_or_ge[2];
+    H5TB_query_term_t  ne[1];
+    H5TB_query_term_t  plain[1];
+    hsize_t            indices[4];
+    hsize_t            nhits;
+    hsize_t            dims[1] = {QUERY_NRECORDS};
+    int *              ints    = NULL;
+    hid_t              did     = H5I_INVALID_HID;
+    herr_t             status;
+    int                i;
+
+    HL_TESTING2("querying records");
+
+    if (NULL == (recs = (query_rec_t *)HDcalloc(QUERY_NRECORDS, sizeof(query_rec_t))))
+        goto out;
+    for (i = 0; i < QUERY_NRECORDS; i++) {
+        recs[i].id    = i;
+        recs[i].value = (double)i;
+        recs[i].group = i % 7;
+    }
+
+    if (H5TBmake_table("Query", fid, "query", (hsize_t)3, (hsize_t)QUERY_NRECORDS, sizeof(query_rec_t),
+                       names, offsets, types, (hsize_t)50, NULL, 0, recs) < 0)
+        goto out;
+
+    /* (100 <= value <= 199) AND group == 3 */
+    HDmemset(range_and, 0, sizeof(range_and));
+    range_and[0].field_name = "value";
+    range_and[0].op         = H5TB_QUERY_RANGE;
+    range_and[0].value      = 100.0;
+    range_and[0].value2     = 199.0;
+    range_and[1].combine    = H5TB_QUERY_AND;
+    range_and[1].field_name = "group";
+    range_and[1].op         = H5TB_QUERY_EQ;
+    range_and[1].value      = 3.0;
+
+    /* value < 10 OR value >= 990 */
+    HDmemset(lt_or_ge, 0, sizeof(lt_or_ge));
+    lt_or_ge[0].field_name = "value";
+    lt_or_ge[0].op         = H5TB_QUERY_LT;
+    lt_or_ge[0].value      = 10.0;
+    lt_or_ge[1].combine    = H5TB_QUERY_OR;
+    lt_or_ge[1].field_name = "value";
+    lt_or_ge[1].op         = H5TB_QUERY_GE;
+    lt_or_ge[1].value      = 990.0;
+
+    /* group != 0 */
+    HDmemset(ne, 0, sizeof(ne));
+    ne[0].field_name = "group";
+    ne[0].op         = H5TB_QUERY_NE;
+    ne[0].value      = 0.0;
+
+    /* without summaries */
+    if (check_query(fid, "query", 2, range_and, recs) < 0)
+        goto out;
+    if (check_query(fid, "query", 2, lt_or_ge, recs) < 0)
+        goto out;
+    if (check_query(fid, "query", 1, ne, recs) < 0)
+        goto out;
+
+    /* counting only, and fewer indices than matches */
+    if (H5TBquery_records(fid, "query", 2, lt_or_ge, (hsize_t)0, &nhits, NULL) < 0)
+        goto out;
+    if (nhits != 20)
+        goto out;
+    if (H5TBquery_records(fid, "query", 2, lt_or_ge, (hsize_t)4, &nhits, indices) < 0)
+        goto out;
+    if (nhits != 20 || indices[0] != 0 || indices[3] != 3)
+        goto out;
+
+    /* with summaries */
+    if (H5TBbuild_summary(fid, "query", "value") < 0)
+        goto out;
+    if (H5TBbuild_summary(fid, "query", "group") < 0)
+        goto out;
+    if (check_query(fid, "query", 2, range_and, recs) < 0)
+        goto out;
+    if (check_query(fid, "query", 2, lt_or_ge, recs) < 0)
+        goto out;
+    if (check_query(fid, "query", 1, ne, recs) < 0)
+        goto out;
+
+    /* reading the matching records */
+    if (H5TBquery_read_records(fid, "query", 2, lt_or_ge, (hsize_t)20, sizeof(query_rec_t), offsets, sizes,
+                               &nhits, rbuf) < 0)
+        goto out;
+    if (nhits != 20)
+        goto out;
+    for (i = 0; i < 20; i++)
+        if (rbuf[i].id != (i < 10 ? i : 980 + i) || rbuf[i].group != rbuf[i].id % 7)
+            goto out;
+
+    /* changing records removes the summaries */
+    for (i = 0; i < 50; i++) {
+        recs[150 + i].value = 5.0;
+        recs[150 + i].group = 3;
+    }
+    if (H5TBwrite_records(fid, "query", (hsize_t)150, (hsize_t)50, sizeof(query_rec_t), offsets, sizes,
+                          recs + 150) < 0)
+        goto out;
+    if ((did = H5Dopen2(fid, "query", H5P_DEFAULT)) < 0)
+        goto out;
+    if (H5Aexists(did, "SUMMARY_BLOCK") != 0)
+        goto out;
+    if (H5Dclose(did) < 0)
+        goto out;
+    did = H5I_INVALID_HID;
+    if (check_query(fid, "query", 2, lt_or_ge, recs) < 0)
+        goto out;
+
+    /* appending records keeps the summaries of the full blocks */
+    if (H5TBbuild_summary(fid, "query", "value") < 0)
+        goto out;
+    if (H5TBappend_records(fid, "query", (hsize_t)1, sizeof(query_rec_t), offsets, sizes, recs) < 0)
+        goto out;
+    if (H5TBquery_records(fid, "query", 1, lt_or_ge, (hsize_t)4, &nhits, indices) < 0)
+        goto out;
+    if (nhits != 61 || indices[0] != 0)
+        goto out;
+
+    /* a 1-D dataset of numbers */
+    if (NULL == (ints = (int *)HDmalloc(QUERY_NRECORDS * sizeof(int))))
+        goto out;
+    for (i = 0; i < QUERY_NRECORDS; i++)
+        ints[i] = QUERY_NRECORDS - i;
+    if (H5LTmake_dataset_int(fid, "query_ints", 1, dims, ints) < 0)
+        goto out;
+    HDmemset(plain, 0, sizeof(plain));
+    plain[0].field_name = NULL;
+    plain[0].op         = H5TB_QUERY_LE;
+    plain[0].value      = 2.0;
+    if (H5TBbuild_summary(fid, "query_ints", NULL) < 0)
+        goto out;
+    if (H5TBquery_records(fid, "query_ints", 1, plain, (hsize_t)4, &nhits, indices) < 0)
+        goto out;
+    if (nhits != 2 || indices[0] != QUERY_NRECORDS - 2 || indices[1] != QUERY_NRECORDS - 1)
+        goto out;
+
+    /* a field name that does not exist */
+    plain[0].field_name = "nothing";
+    H5E_BEGIN_TRY
+    {
+        status = H5TBquery_records(fid, "query", 1, plain, (hsize_t)4, &nhits, indices);
+    }
+    H5E_END_TRY;
+    if (status >= 0)
+        goto out;
+
+    HDfree(recs);
+    HDfree(ints);
+
+    PASSED();
+    return 0;
+
+out:
+    if (did > 0)
+        H5Dclose(did);
+    HDfree(recs);
+    HDfree(ints);
+    H5_FAILED();
+    return -1;
+}
+
 /*-------------------------------------------------------------------------
  * the main program
  *-------------------------------------------------------------------------
@@ -1523,6 +1790,10 @@ main(void)
     if (test_table(fid, 1) < 0)
         goto out;
 
+    /* test the query functions */
+    if (test_query(fid) < 0)
+        goto out;
+
     /* close */
     H5Fclose(fid);
 
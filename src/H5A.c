@@ -33,6 +33,8 @@
 #include "H5Sprivate.h"  /* Dataspace functions                      */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
 
+#include "H5VLnative_private.h" /* Native VOL connector                     */
+
 /****************/
 /* Local Macros */
 /****************/
@@ -1087,6 +1089,81 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Aread_async() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5Aread_multi
+ PURPOSE
+    Read in data from several attributes of one object
+ USAGE
+    herr_t H5Aread_multi (loc_id, count, attr_names, mem_type_ids, bufs,
+                          names_out, type_ids_out)
+        hid_t loc_id;               IN: Object the attributes are attached to
+        size_t count;               IN: Number of attributes to read
+        const char *attr_names[];   IN: Names of the attributes to read, or
+                                        NULL to read the first COUNT
+                                        attributes in name order
+        const hid_t mem_type_ids[]; IN: Memory datatype of each buffer
+        void *bufs[];               OUT: Buffer for each attribute's data,
+                                         or NULL to read no data
+        char *names_out[];          OUT: Name of each attribute, or NULL
+        hid_t type_ids_out[];       OUT: Datatype of each attribute, or NULL
+ RETURNS
+    Non-negative on success/Negative on failure
+
+ DESCRIPTION
+        This function reads several complete attributes from disk, locating
+    all of them with a single pass over the object header (or a single open
+    of the dense attribute storage) instead of one lookup per attribute.
+    No attribute IDs are created.  To read into one contiguous buffer, make
+    the BUFS entries point at successive offsets within it.  The names
+    returned in NAMES_OUT must be released with H5free_memory and the
+    datatypes returned in TYPE_IDS_OUT with H5Tclose.
+--------------------------------------------------------------------------*/
+herr_t
+H5Aread_multi(hid_t loc_id, size_t count, const char *attr_names[], const hid_t mem_type_ids[],
+              void *bufs[] /*out*/, char *names_out[] /*out*/, hid_t type_ids_out[] /*out*/)
+{
+    H5VL_object_t *   vol_obj;             /* Object of loc_id */
+    H5VL_loc_params_t loc_params;          /* Location parameters for object access */
+    size_t            u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iz**s*ixxx", loc_id, count, attr_names, mem_type_ids, bufs, names_out, type_ids_out);
+
+    /* Check arguments */
+    if (H5I_ATTR == H5I_get_type(loc_id))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location is not valid for an attribute")
+    if (0 == count)
+        HGOTO_DONE(SUCCEED)
+    if (!bufs && !names_out && !type_ids_out)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no output buffers given")
+    if (bufs && !mem_type_ids)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no memory datatypes given")
+    for (u = 0; u < count; u++) {
+        if (attr_names && (!attr_names[u] || !*attr_names[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no attribute name")
+        if (bufs && NULL == bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null attribute buffer")
+    } /* end for */
+
+    /* Get the location object */
+    if (NULL == (vol_obj = H5VL_vol_object(loc_id)))
+        HGOTO_ERROR(H5E_ATTR, H5E_BADTYPE, FAIL, "invalid location identifier")
+
+    /* Set location parameters */
+    loc_params.type     = H5VL_OBJECT_BY_SELF;
+    loc_params.obj_type = H5I_get_type(loc_id);
+
+    /* Read the attribute data */
+    if (H5VL_attr_optional(vol_obj, H5VL_NATIVE_ATTR_READ_MULTI, H5P_DATASET_XFER_DEFAULT, H5_REQUEST_NULL,
+                           &loc_params, count, attr_names, mem_type_ids, bufs, names_out, type_ids_out) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Aread_multi() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5Aget_space
@@ -332,6 +332,9 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
         aux_ptr->write_done          = NULL;
         aux_ptr->sync_point_done     = NULL;
         aux_ptr->p0_image_len        = 0;
+        aux_ptr->nonblocking_flush   = f->shared->nonblocking_md_flush && H5FD_MPIO == H5F_DRIVER_ID(f);
+        aux_ptr->flush_pending       = FALSE;
+        aux_ptr->evictions_enabled   = TRUE;
 
         HDsprintf(prefix, "%d:", mpi_rank);
 
@@ -1118,10 +1121,17 @@ H5AC_move_entry(H5F_t *f, const H5AC_class_t *type, haddr_t old_addr, haddr_t ne
     HDassert(H5F_addr_ne(old_addr, new_addr));
 
 #ifdef H5_HAVE_PARALLEL
-    /* Log moving the entry */
-    if (NULL != (aux_ptr = (H5AC_aux_t *)H5C_get_aux_ptr(f->shared->cache)))
+    if (NULL != (aux_ptr = (H5AC_aux_t *)H5C_get_aux_ptr(f->shared->cache))) {
+        /* The old space of the entry may be reused before the next sync
+         * point, so a write of the entry still in progress must complete
+         */
+        if (H5AC_complete_flush(f) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't complete nonblocking flush")
+
+        /* Log moving the entry */
         if (H5AC__log_moved_entry(f, old_addr, new_addr) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTUNPROTECT, FAIL, "can't log moved entry")
+    }  /* end if */
 #endif /* H5_HAVE_PARALLEL */
 
     if (H5C_move_entry(f->shared->cache, type, old_addr, new_addr) < 0)
@@ -1671,6 +1681,12 @@ H5AC_unprotect(H5F_t *f, const H5AC_class_t *type, haddr_t addr, void *thing, un
             if (H5AC__log_dirtied_entry((H5AC_info_t *)thing) < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTUNPROTECT, FAIL, "can't log dirtied entry")
 
+        /* The space of a deleted entry may be reused before the next sync
+         * point, so a write of the entry still in progress must complete
+         */
+        if (deleted && H5AC_complete_flush(f) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't complete nonblocking flush")
+
         if (deleted && aux_ptr->mpi_rank == 0)
             if (H5AC__log_deleted_entry((H5AC_info_t *)thing) < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTUNPROTECT, FAIL, "H5AC__log_deleted_entry() failed")
@@ -2398,6 +2414,69 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_evict_tagged_metadata() */
 
+/*------------------------------------------------------------------------------
+ * Function:    H5AC_tagged_metadata_changed()
+ *
+ * Purpose:     Wrapper for cache level function which checks whether any
+ *              metadata that contains the specific tag changed in the file.
+ *
+ * Return:      SUCCEED on success, FAIL otherwise.
+ *
+ *------------------------------------------------------------------------------
+ */
+herr_t
+H5AC_tagged_metadata_changed(H5F_t *f, haddr_t metadata_tag, hbool_t match_global, hbool_t *changed)
+{
+    /* Variable Declarations */
+    herr_t ret_value = SUCCEED;
+
+    /* Function Enter Macro */
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Assertions */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(changed);
+
+    /* Call cache level function to compare metadata entries with specified tag */
+    if (H5C_tagged_entries_changed(f, metadata_tag, match_global, changed) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "Cannot check metadata for changes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_tagged_metadata_changed() */
+
+/*------------------------------------------------------------------------------
+ * Function:    H5AC_evict_changed_tagged_metadata()
+ *
+ * Purpose:     Wrapper for cache level function which evicts the metadata
+ *              that contains the specific tag and changed in the file.
+ *
+ * Return:      SUCCEED on success, FAIL otherwise.
+ *
+ *------------------------------------------------------------------------------
+ */
+herr_t
+H5AC_evict_changed_tagged_metadata(H5F_t *f, haddr_t metadata_tag, hbool_t match_global)
+{
+    /* Variable Declarations */
+    herr_t ret_value = SUCCEED;
+
+    /* Function Enter Macro */
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Assertions */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Call cache level function to evict changed metadata entries with specified tag */
+    if (H5C_evict_changed_tagged_entries(f, metadata_tag, match_global) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Cannot evict changed metadata")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_evict_changed_tagged_metadata() */
+
 /*------------------------------------------------------------------------------
  * Function:    H5AC_expunge_tag_type_metadata()
  *
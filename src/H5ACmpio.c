@@ -28,6 +28,7 @@
 /****************/
 
 #include "H5ACmodule.h" /* This source code file is part of the H5AC module */
+#define H5C_FRIEND      /*suppress error about including H5Cpkg	  */
 #define H5F_FRIEND      /*suppress error about including H5Fpkg	  */
 
 /***********/
@@ -35,10 +36,11 @@
 /***********/
 #include "H5private.h"   /* Generic Functions			*/
 #include "H5ACpkg.h"     /* Metadata cache			*/
-#include "H5Cprivate.h"  /* Cache                                */
+#include "H5Cpkg.h"      /* Cache                                */
 #include "H5CXprivate.h" /* API Contexts                         */
 #include "H5Eprivate.h"  /* Error handling		  	*/
 #include "H5Fpkg.h"      /* Files				*/
+#include "H5FDprivate.h" /* File drivers                         */
 #include "H5MMprivate.h" /* Memory management                    */
 
 #ifdef H5_HAVE_PARALLEL
@@ -240,6 +242,50 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_add_candidate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_complete_flush()
+ *
+ * Purpose:     Complete the last flush of the file if it was nonblocking
+ *		and its metadata writes may still be in progress: wait for
+ *		the writes of all processes, run the truncation and sync the
+ *		flush put off, and enable evictions again.
+ *
+ *		This function is collective, and does nothing when no
+ *		flush is pending.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_complete_flush(H5F_t *f)
+{
+    H5AC_t *    cache_ptr;
+    H5AC_aux_t *aux_ptr;
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f != NULL);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr != NULL);
+    aux_ptr = (H5AC_aux_t *)H5C_get_aux_ptr(cache_ptr);
+
+    if (aux_ptr && aux_ptr->flush_pending) {
+        HDassert(aux_ptr->magic == H5AC__H5AC_AUX_T_MAGIC);
+
+        if (H5FD_mpio_complete_flush(f->shared->lf) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't complete nonblocking flush")
+
+        aux_ptr->flush_pending       = FALSE;
+        cache_ptr->evictions_enabled = aux_ptr->evictions_enabled;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_complete_flush() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5AC__broadcast_candidate_list()
@@ -1669,13 +1715,22 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
          *
          * When flushing from within the close operation from a file,
          * it's possible to skip this barrier (on the second flush of the cache).
+         *
+         * If the previous flush is still pending, completing it includes
+         * a barrier, which serves as this one.
          */
-        if (!H5CX_get_mpi_file_flushing())
+        if (aux_ptr->flush_pending) {
+            if (H5AC_complete_flush(f) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't complete previous flush.")
+        } /* end if */
+        else if (!H5CX_get_mpi_file_flushing())
             if (MPI_SUCCESS != (mpi_result = MPI_Barrier(aux_ptr->mpi_comm)))
                 HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_result)
 
         /* Enable writes during this operation */
         aux_ptr->write_permitted = TRUE;
+        if (aux_ptr->nonblocking_flush)
+            H5CX_set_mpi_nonblocking_writes(TRUE);
 
         /* Apply the candidate list */
         result = H5C_apply_candidate_list(f, cache_ptr, num_entries, haddr_buf_ptr, aux_ptr->mpi_rank,
@@ -1683,6 +1738,8 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
 
         /* Disable writes again */
         aux_ptr->write_permitted = FALSE;
+        if (aux_ptr->nonblocking_flush)
+            H5CX_set_mpi_nonblocking_writes(FALSE);
 
         /* Check for error on the write operation */
         if (result < 0)
@@ -1695,8 +1752,21 @@ H5AC__rsp__dist_md_write__flush(H5F_t *f)
         if (aux_ptr->write_done)
             (aux_ptr->write_done)();
 
+        /* In a nonblocking flush, the writes may still be in progress.
+         * Leave the final barrier to H5AC_complete_flush(), and keep
+         * every entry in the cache until then, so that no process reads
+         * back an entry another process is still writing.
+         */
+        if (aux_ptr->nonblocking_flush) {
+            if (H5FD_mpio_defer_flush(f->shared->lf) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't defer flush.")
+
+            aux_ptr->flush_pending       = TRUE;
+            aux_ptr->evictions_enabled   = cache_ptr->evictions_enabled;
+            cache_ptr->evictions_enabled = FALSE;
+        } /* end if */
         /* final sync point barrier */
-        if (MPI_SUCCESS != (mpi_result = MPI_Barrier(aux_ptr->mpi_comm)))
+        else if (MPI_SUCCESS != (mpi_result = MPI_Barrier(aux_ptr->mpi_comm)))
             HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_result)
 
         /* if this is process zero, tidy up the dirtied,
@@ -2106,6 +2176,16 @@ H5AC__run_sync_point(H5F_t *f, int sync_point_op)
               aux_ptr->rename_dirty_bytes_updates);
 #endif /* H5AC_DEBUG_DIRTY_BYTES_CREATION */
 
+    /* Complete a pending nonblocking flush before any other sync point
+     * writes metadata.  Flushes do so themselves, and only when they have
+     * entries to write, so that closing a file after a nonblocking flush
+     * doesn't wait for it.
+     */
+    if (sync_point_op == H5AC_SYNC_POINT_OP__FLUSH_TO_MIN_CLEAN ||
+        aux_ptr->metadata_write_strategy == H5AC_METADATA_WRITE_STRATEGY__PROCESS_0_ONLY)
+        if (H5AC_complete_flush(f) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "H5AC_complete_flush() failed.")
+
     /* clear collective access flag on half of the entries in the
        cache and mark them as independent in case they need to be
        evicted later. All ranks are guaranteed to mark the same entries
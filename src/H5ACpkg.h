@@ -350,6 +350,23 @@ H5FL_EXTERN(H5AC_aux_t);
  *		image constructed by MPI process 0.  This field should be 0
  *		if the value is unknown, or if cache image is not enabled.
  *
+ * The following fields support nonblocking flushes.
+ *
+ * nonblocking_flush: Boolean flag indicating whether sync points triggered
+ *		by a flush post their metadata writes and return without
+ *		the final barrier.  Set when the file is opened with
+ *		H5Pset_nonblocking_metadata_flush() and the MPI-IO driver.
+ *
+ * flush_pending: Boolean flag indicating that the metadata writes of the
+ *		last flush may still be in progress on some process.  While
+ *		it is set, evictions are disabled, so that no process reads
+ *		back an entry another process is still writing.  The flag is
+ *		cleared by H5AC_complete_flush().
+ *
+ * evictions_enabled: Value of the cache's evictions_enabled field saved
+ *		when evictions were disabled for a pending flush, and
+ *		restored when the flush completes.
+ *
  ****************************************************************************/
 
 #ifdef H5_HAVE_PARALLEL
@@ -400,6 +417,12 @@ typedef struct H5AC_aux_t {
 
     unsigned p0_image_len;
 
+    hbool_t nonblocking_flush;
+
+    hbool_t flush_pending;
+
+    hbool_t evictions_enabled;
+
 } H5AC_aux_t; /* struct H5AC_aux_t */
 
 /* Typedefs for debugging function pointers */
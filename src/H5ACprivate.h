@@ -423,6 +423,9 @@ H5_DLL herr_t  H5AC_get_mdc_image_info(H5AC_t *cache_ptr, haddr_t *image_addr, h
 H5_DLL void   H5AC_tag(haddr_t metadata_tag, haddr_t *prev_tag);
 H5_DLL herr_t H5AC_flush_tagged_metadata(H5F_t *f, haddr_t metadata_tag);
 H5_DLL herr_t H5AC_evict_tagged_metadata(H5F_t *f, haddr_t metadata_tag, hbool_t match_global);
+H5_DLL herr_t H5AC_tagged_metadata_changed(H5F_t *f, haddr_t metadata_tag, hbool_t match_global,
+                                           hbool_t *changed);
+H5_DLL herr_t H5AC_evict_changed_tagged_metadata(H5F_t *f, haddr_t metadata_tag, hbool_t match_global);
 H5_DLL herr_t H5AC_retag_copied_metadata(const H5F_t *f, haddr_t metadata_tag);
 H5_DLL herr_t H5AC_ignore_tags(const H5F_t *f);
 H5_DLL herr_t H5AC_cork(H5F_t *f, haddr_t obj_addr, unsigned action, hbool_t *corked);
@@ -443,6 +446,7 @@ H5_DLL herr_t              H5AC_proxy_entry_dest(H5AC_proxy_entry_t *pentry);
 
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5AC_add_candidate(H5AC_t *cache_ptr, haddr_t addr);
+H5_DLL herr_t H5AC_complete_flush(H5F_t *f);
 #endif /* H5_HAVE_PARALLEL */
 
 /* Debugging functions */
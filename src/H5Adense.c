@@ -333,13 +333,8 @@ done:
 H5A_t *
 H5A__dense_open(H5F_t *f, const H5O_ainfo_t *ainfo, const char *name)
 {
-    H5A_bt2_ud_common_t udata;               /* User data for v2 B-tree modify */
-    H5HF_t *            fheap        = NULL; /* Fractal heap handle */
-    H5HF_t *            shared_fheap = NULL; /* Fractal heap handle for shared header messages */
-    H5B2_t *            bt2_name     = NULL; /* v2 B-tree handle for name index */
-    htri_t              attr_sharable;       /* Flag indicating attributes are sharable */
-    hbool_t             attr_exists;         /* Attribute exists in v2 B-tree */
-    H5A_t *             ret_value = NULL;    /* Return value */
+    H5A_t *attr      = NULL; /* Attribute opened */
+    H5A_t *ret_value = NULL; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -348,13 +343,62 @@ H5A__dense_open(H5F_t *f, const H5O_ainfo_t *ainfo, const char *name)
     HDassert(ainfo);
     HDassert(name);
 
+    if (H5A__dense_open_multi(f, ainfo, (size_t)1, &name, &attr) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "can't open attribute")
+
+    /* Set return value */
+    ret_value = attr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A__dense_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5A__dense_open_multi
+ *
+ * Purpose:     Open several attributes in dense storage structures for an
+ *              object.  The fractal heap(s) and the name index v2 B-tree
+ *              are opened once for all of the lookups.
+ *
+ *              Entries of ATTRS that are already set on entry are skipped.
+ *              On failure, the attributes opened by this call are closed
+ *              and their entries in ATTRS are reset to NULL.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5A__dense_open_multi(H5F_t *f, const H5O_ainfo_t *ainfo, size_t count, const char *names[], H5A_t *attrs[])
+{
+    H5A_bt2_ud_common_t udata;                 /* User data for v2 B-tree modify */
+    H5HF_t *            fheap        = NULL;   /* Fractal heap handle */
+    H5HF_t *            shared_fheap = NULL;   /* Fractal heap handle for shared header messages */
+    H5B2_t *            bt2_name     = NULL;   /* v2 B-tree handle for name index */
+    htri_t              attr_sharable;         /* Flag indicating attributes are sharable */
+    hbool_t *           opened = NULL;         /* Which attributes were opened by this call */
+    size_t              u;                     /* Local index variable */
+    herr_t              ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check arguments */
+    HDassert(f);
+    HDassert(ainfo);
+    HDassert(names);
+    HDassert(attrs);
+
+    /* Keep track of the attributes opened here, for cleanup on error */
+    if (NULL == (opened = (hbool_t *)H5MM_calloc(count * sizeof(hbool_t))))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't allocate attribute tracking array")
+
     /* Open the fractal heap */
     if (NULL == (fheap = H5HF_open(f, ainfo->fheap_addr)))
-        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "unable to open fractal heap")
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
 
     /* Check if attributes are shared in this file */
     if ((attr_sharable = H5SM_type_shared(f, H5O_ATTR_ID)) < 0)
-        HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't determine if attributes are shared")
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't determine if attributes are shared")
 
     /* Get handle for shared message heap, if attributes are sharable */
     if (attr_sharable) {
@@ -362,49 +406,69 @@ H5A__dense_open(H5F_t *f, const H5O_ainfo_t *ainfo, const char *name)
 
         /* Retrieve the address of the shared message's fractal heap */
         if (H5SM_get_fheap_addr(f, H5O_ATTR_ID, &shared_fheap_addr) < 0)
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get shared message heap address")
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get shared message heap address")
 
         /* Check if there are any shared messages currently */
         if (H5F_addr_defined(shared_fheap_addr)) {
             /* Open the fractal heap for shared header messages */
             if (NULL == (shared_fheap = H5HF_open(f, shared_fheap_addr)))
-                HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "unable to open fractal heap")
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
         } /* end if */
     }     /* end if */
 
     /* Open the name index v2 B-tree */
     if (NULL == (bt2_name = H5B2_open(f, ainfo->name_bt2_addr, NULL)))
-        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "unable to open v2 B-tree for name index")
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
 
     /* Create the "udata" information for v2 B-tree record find */
-    udata.f             = f;
-    udata.fheap         = fheap;
-    udata.shared_fheap  = shared_fheap;
-    udata.name          = name;
-    udata.name_hash     = H5_checksum_lookup3(name, HDstrlen(name), 0);
-    udata.flags         = 0;
-    udata.corder        = 0;
-    udata.found_op      = H5A__dense_fnd_cb; /* v2 B-tree comparison callback */
-    udata.found_op_data = &ret_value;
-
-    /* Find & copy the attribute in the 'name' index */
-    attr_exists = FALSE;
-    if (H5B2_find(bt2_name, &udata, &attr_exists, NULL, NULL) < 0)
-        HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, NULL, "can't search for attribute in name index")
-    if (attr_exists == FALSE)
-        HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, NULL, "can't locate attribute in name index")
+    udata.f            = f;
+    udata.fheap        = fheap;
+    udata.shared_fheap = shared_fheap;
+    udata.flags        = 0;
+    udata.corder       = 0;
+    udata.found_op     = H5A__dense_fnd_cb; /* v2 B-tree comparison callback */
+
+    for (u = 0; u < count; u++) {
+        hbool_t attr_exists; /* Attribute exists in v2 B-tree */
+
+        /* Skip attributes the caller already has */
+        if (attrs[u])
+            continue;
+
+        udata.name          = names[u];
+        udata.name_hash     = H5_checksum_lookup3(names[u], HDstrlen(names[u]), 0);
+        udata.found_op_data = &attrs[u];
+
+        /* Find & copy the attribute in the 'name' index */
+        attr_exists = FALSE;
+        if (H5B2_find(bt2_name, &udata, &attr_exists, NULL, NULL) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "can't search for attribute in name index")
+        if (attr_exists == FALSE)
+            HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "can't locate attribute in name index: '%s'", names[u])
+        opened[u] = TRUE;
+    } /* end for */
 
 done:
     /* Release resources */
     if (shared_fheap && H5HF_close(shared_fheap) < 0)
-        HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, NULL, "can't close fractal heap")
+        HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
     if (fheap && H5HF_close(fheap) < 0)
-        HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, NULL, "can't close fractal heap")
+        HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
     if (bt2_name && H5B2_close(bt2_name) < 0)
-        HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, NULL, "can't close v2 B-tree for name index")
+        HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+
+    /* Close the attributes opened here, on error */
+    if (ret_value < 0 && opened)
+        for (u = 0; u < count; u++)
+            if (opened[u]) {
+                if (H5A__close(attrs[u]) < 0)
+                    HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close attribute")
+                attrs[u] = NULL;
+            } /* end if */
+    H5MM_xfree(opened);
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5A__dense_open() */
+} /* end H5A__dense_open_multi() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5A__dense_insert
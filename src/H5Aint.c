@@ -832,6 +832,101 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* H5A__read() */
 
+/*--------------------------------------------------------------------------
+ NAME
+    H5A__read_multi
+ PURPOSE
+    Read several attributes of an object at once
+ USAGE
+    herr_t H5A__read_multi(loc, count, attr_names, mem_types, bufs, names_out,
+                           type_ids_out)
+        const H5G_loc_t *loc;        IN: Location of object the attributes belong to
+        size_t count;                IN: Number of attributes to read
+        const char *attr_names[];    IN: Names of attributes to read, or NULL
+        const H5T_t *mem_types[];    IN: Memory datatypes of buffers
+        void *bufs[];                IN: Buffers for data to read, or NULL
+        char *names_out[];           OUT: Names of the attributes, or NULL
+        hid_t type_ids_out[];        OUT: Datatypes of the attributes, or NULL
+ RETURNS
+    Non-negative on success/Negative on failure
+
+ DESCRIPTION
+    This function reads COUNT complete attributes of an object, locating
+    all of them with a single pass over the object's header (or a single
+    opening of its dense attribute storage).  When ATTR_NAMES is NULL, the
+    first COUNT attributes of the object in increasing name order are read.
+    The name and a copy of the file datatype of each attribute are returned
+    in NAMES_OUT and TYPE_IDS_OUT when they are not NULL; on failure none
+    are returned.
+--------------------------------------------------------------------------*/
+herr_t
+H5A__read_multi(const H5G_loc_t *loc, size_t count, const char *attr_names[], const H5T_t *mem_types[],
+                void *bufs[], char *names_out[], hid_t type_ids_out[])
+{
+    H5A_t **attrs = NULL;        /* Attributes opened */
+    size_t  u;                   /* Local index variable */
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(loc);
+    HDassert(!bufs || mem_types);
+
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (attrs = (H5A_t **)H5MM_calloc(count * sizeof(H5A_t *))))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't allocate attribute array")
+    for (u = 0; u < count; u++) {
+        if (names_out)
+            names_out[u] = NULL;
+        if (type_ids_out)
+            type_ids_out[u] = H5I_INVALID_HID;
+    } /* end for */
+
+    /* Read in the attributes from the object header */
+    if (H5O__attr_open_multi(loc->oloc, count, attr_names, attrs) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "unable to load attribute info from object header")
+
+    for (u = 0; u < count; u++) {
+        /* Finish initializing attribute */
+        if (H5A__open_common(loc, attrs[u]) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "unable to initialize attribute")
+
+        /* Read the data */
+        if (bufs && H5A__read(attrs[u], mem_types[u], bufs[u]) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attribute '%s'",
+                        attrs[u]->shared->name)
+
+        /* Return the name and datatype of the attribute */
+        if (names_out && NULL == (names_out[u] = H5MM_xstrdup(attrs[u]->shared->name)))
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't copy attribute name")
+        if (type_ids_out && (type_ids_out[u] = H5A__get_type(attrs[u])) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute datatype")
+    } /* end for */
+
+done:
+    if (ret_value < 0 && attrs)
+        for (u = 0; u < count; u++) {
+            if (names_out)
+                names_out[u] = (char *)H5MM_xfree(names_out[u]);
+            if (type_ids_out && type_ids_out[u] >= 0) {
+                if (H5I_dec_app_ref(type_ids_out[u]) < 0)
+                    HDONE_ERROR(H5E_ATTR, H5E_CANTDEC, FAIL, "can't close datatype")
+                type_ids_out[u] = H5I_INVALID_HID;
+            } /* end if */
+        }     /* end for */
+    if (attrs) {
+        for (u = 0; u < count; u++)
+            if (attrs[u] && H5A__close(attrs[u]) < 0)
+                HDONE_ERROR(H5E_ATTR, H5E_CANTCLOSEOBJ, FAIL, "can't close attribute")
+        H5MM_xfree(attrs);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5A__read_multi() */
+
 /*--------------------------------------------------------------------------
  NAME
     H5A__write
@@ -207,11 +207,16 @@ H5_DLL herr_t  H5A__exists_by_name(H5G_loc_t loc, const char *obj_name, const ch
                                    hbool_t *attr_exists);
 H5_DLL herr_t  H5A__write(H5A_t *attr, const H5T_t *mem_type, const void *buf);
 H5_DLL herr_t  H5A__read(const H5A_t *attr, const H5T_t *mem_type, void *buf);
+H5_DLL herr_t  H5A__read_multi(const H5G_loc_t *loc, size_t count, const char *attr_names[],
+                               const H5T_t *mem_types[], void *bufs[], char *names_out[],
+                               hid_t type_ids_out[]);
 H5_DLL ssize_t H5A__get_name(H5A_t *attr, size_t buf_size, char *buf);
 
 /* Attribute "dense" storage routines */
 H5_DLL herr_t H5A__dense_create(H5F_t *f, H5O_ainfo_t *ainfo);
 H5_DLL H5A_t *H5A__dense_open(H5F_t *f, const H5O_ainfo_t *ainfo, const char *name);
+H5_DLL herr_t H5A__dense_open_multi(H5F_t *f, const H5O_ainfo_t *ainfo, size_t count, const char *names[],
+                                    H5A_t *attrs[]);
 H5_DLL herr_t H5A__dense_insert(H5F_t *f, const H5O_ainfo_t *ainfo, H5A_t *attr);
 H5_DLL herr_t H5A__dense_write(H5F_t *f, const H5O_ainfo_t *ainfo, H5A_t *attr);
 H5_DLL herr_t H5A__dense_rename(H5F_t *f, const H5O_ainfo_t *ainfo, const char *old_name,
@@ -237,6 +242,7 @@ H5_DLL herr_t H5A__attr_release_table(H5A_attr_table_t *atable);
 /* Attribute operations */
 H5_DLL herr_t H5O__attr_create(const H5O_loc_t *loc, H5A_t *attr);
 H5_DLL H5A_t *H5O__attr_open_by_name(const H5O_loc_t *loc, const char *name);
+H5_DLL herr_t H5O__attr_open_multi(const H5O_loc_t *loc, size_t count, const char *names[], H5A_t *attrs[]);
 H5_DLL H5A_t *H5O__attr_open_by_idx(const H5O_loc_t *loc, H5_index_t idx_type, H5_iter_order_t order,
                                     hsize_t n);
 H5_DLL herr_t H5O__attr_update_shared(H5F_t *f, H5O_t *oh, H5A_t *attr, H5O_shared_t *sh_mesg);
@@ -945,6 +945,56 @@ H5_DLL hid_t H5Aopen_by_name_async(const char *app_file, const char *app_func, u
  *
  */
 H5_DLL herr_t H5Aread(hid_t attr_id, hid_t type_id, void *buf);
+/*--------------------------------------------------------------------------*/
+/**
+ * \ingroup H5A
+ *
+ * \brief Reads several attributes of one object in a single call
+ *
+ * \fgdt_loc_id
+ * \param[in]  count        Number of attributes to read
+ * \param[in]  attr_names   Names of the attributes to read, or NULL
+ * \param[in]  mem_type_ids Memory datatype of each buffer
+ * \param[out] bufs         Buffer for each attribute's data, or NULL
+ * \param[out] names_out    Name of each attribute read, or NULL
+ * \param[out] type_ids_out Datatype of each attribute read, or NULL
+ *
+ * \return \herr_t
+ *
+ * \details H5Aread_multi() reads \p count complete attributes attached to
+ *          the object specified with \p loc_id. Attribute \c i is read into
+ *          \p bufs[i] using the in-memory datatype \p mem_type_ids[i].
+ *          If \p bufs is NULL, no data is read and \p mem_type_ids may be
+ *          NULL; this allows the names and datatypes of the attributes to
+ *          be retrieved before allocating the buffers.
+ *
+ *          If \p names_out is not NULL, \p names_out[i] is set to the name
+ *          of attribute \c i, which must be released with H5free_memory().
+ *          If \p type_ids_out is not NULL, \p type_ids_out[i] is set to a
+ *          copy of the datatype of attribute \c i as stored in the file, as
+ *          returned by H5Aget_type(), which must be released with H5Tclose().
+ *
+ *          All attributes are located with a single pass over the object
+ *          header, or a single open of the object's dense attribute storage,
+ *          and no attribute identifiers are created. This is considerably
+ *          cheaper than calling H5Aopen() and H5Aread() once per attribute
+ *          on objects with many attributes.
+ *
+ *          If \p attr_names is NULL, the first \p count attributes of the
+ *          object in increasing name order are read; the call fails if the
+ *          object has fewer than \p count attributes. \p names_out and
+ *          \p type_ids_out tell which attribute each buffer holds.
+ *
+ *          To read into one contiguous buffer, point the entries of \p bufs
+ *          at successive offsets within that buffer.
+ *
+ * \since 1.13.0
+ *
+ * \see H5Aread()
+ *
+ */
+H5_DLL herr_t H5Aread_multi(hid_t loc_id, size_t count, const char *attr_names[], const hid_t mem_type_ids[],
+                            void *bufs[], char *names_out[], hid_t type_ids_out[]);
 /*-------------------------------------------------------------------------*/
 /**
  * \ingroup H5A
@@ -422,6 +422,9 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->coll_head_ptr   = NULL;
     cache_ptr->coll_tail_ptr   = NULL;
     cache_ptr->coll_write_list = NULL;
+    cache_ptr->coll_read_buf   = NULL;
+    cache_ptr->coll_read_addr  = HADDR_UNDEF;
+    cache_ptr->coll_read_len   = 0;
 #endif /* H5_HAVE_PARALLEL */
 
 #if H5C_MAINTAIN_CLEAN_AND_DIRTY_LRU_LISTS
@@ -517,6 +520,9 @@ H5C_create(size_t max_cache_size, size_t min_clean_size, int max_type_id,
     cache_ptr->num_entries_in_image = 0;
     cache_ptr->image_entries        = NULL;
     cache_ptr->image_buffer         = NULL;
+    cache_ptr->prev_image_buffer    = NULL;
+    cache_ptr->prev_image_addr      = HADDR_UNDEF;
+    cache_ptr->prev_image_len       = 0;
 
     /* initialize free space manager related fields: */
     cache_ptr->rdfsm_settled = FALSE;
@@ -904,6 +910,14 @@ H5C_dest(H5F_t *f)
         H5MM_xfree(cache_ptr->log_info);
     }
 
+    /* Discard the copy of the previous cache image, if it wasn't used */
+    cache_ptr->prev_image_buffer = H5MM_xfree(cache_ptr->prev_image_buffer);
+
+#ifdef H5_HAVE_PARALLEL
+    /* Discard the region kept for collective metadata reads */
+    cache_ptr->coll_read_buf = (uint8_t *)H5MM_xfree(cache_ptr->coll_read_buf);
+#endif /* H5_HAVE_PARALLEL */
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
 
@@ -7118,17 +7132,12 @@ H5C__load_entry(H5F_t *f,
 #endif /* H5_HAVE_PARALLEL */
                 const H5C_class_t *type, haddr_t addr, void *udata)
 {
-    hbool_t            dirty = FALSE; /* Flag indicating whether thing was dirtied during deserialize */
-    uint8_t *          image = NULL;  /* Buffer for disk image                    */
-    void *             thing = NULL;  /* Pointer to thing loaded                  */
-    H5C_cache_entry_t *entry = NULL;  /* Alias for thing loaded, as cache entry   */
-    size_t             len;           /* Size of image in file                    */
-#ifdef H5_HAVE_PARALLEL
-    int      mpi_rank = 0;             /* MPI process rank                         */
-    MPI_Comm comm     = MPI_COMM_NULL; /* File MPI Communicator                    */
-    int      mpi_code;                 /* MPI error code                           */
-#endif                                 /* H5_HAVE_PARALLEL */
-    void *ret_value = NULL;            /* Return value                             */
+    hbool_t            dirty     = FALSE; /* Flag indicating whether thing was dirtied during deserialize */
+    uint8_t *          image     = NULL;  /* Buffer for disk image                    */
+    void *             thing     = NULL;  /* Pointer to thing loaded                  */
+    H5C_cache_entry_t *entry     = NULL;  /* Alias for thing loaded, as cache entry   */
+    size_t             len;               /* Size of image in file                    */
+    void *             ret_value = NULL;  /* Return value                             */
 
     FUNC_ENTER_STATIC
 
@@ -7167,15 +7176,6 @@ H5C__load_entry(H5F_t *f,
     H5MM_memcpy(image + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
 
-#ifdef H5_HAVE_PARALLEL
-    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
-        if ((mpi_rank = H5F_mpi_get_rank(f)) < 0)
-            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "Can't get MPI rank")
-        if ((comm = H5F_mpi_get_comm(f)) == MPI_COMM_NULL)
-            HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "get_comm request failed")
-    }  /* end if */
-#endif /* H5_HAVE_PARALLEL */
-
     /* Get the on-disk entry image */
     if (0 == (type->flags & H5C__CLASS_SKIP_READS)) {
         unsigned tries, max_tries;   /* The # of read attempts               */
@@ -7207,24 +7207,21 @@ H5C__load_entry(H5F_t *f,
             } /* end if */
 
 #ifdef H5_HAVE_PARALLEL
-            if (!coll_access || 0 == mpi_rank) {
-#endif /* H5_HAVE_PARALLEL */
-                if (H5F_block_read(f, type->mem_type, addr, len, image) < 0)
-                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
-#ifdef H5_HAVE_PARALLEL
-            } /* end if */
             /* if the collective metadata read optimization is turned on,
-             * bcast the metadata read from process 0 to all ranks in the file
-             * communicator
+             * process 0 reads the metadata and bcasts it to all ranks in the
+             * file communicator
              */
             if (coll_access) {
-                int buf_size;
-
-                H5_CHECKED_ASSIGN(buf_size, int, len, size_t);
-                if (MPI_SUCCESS != (mpi_code = MPI_Bcast(image, buf_size, MPI_BYTE, 0, comm)))
-                    HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
+                if (H5C__collective_read(f, type->mem_type, addr, len, image) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
             } /* end if */
-#endif        /* H5_HAVE_PARALLEL */
+            else {
+#endif /* H5_HAVE_PARALLEL */
+                if (H5F_block_read(f, type->mem_type, addr, len, image) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, NULL, "Can't read image*")
+#ifdef H5_HAVE_PARALLEL
+            } /* end else */
+#endif /* H5_HAVE_PARALLEL */
 
             /* If the entry could be read speculatively and the length is still
              *  changing, check for updating the actual size
@@ -7249,31 +7246,25 @@ H5C__load_entry(H5F_t *f,
                     H5MM_memcpy(image + actual_len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
 
+                    /* If the thing's image needs to be bigger for a speculatively
+                     * loaded thing, go get the on-disk image again (the extra portion).
+                     */
                     if (actual_len > len) {
 #ifdef H5_HAVE_PARALLEL
-                        if (!coll_access || 0 == mpi_rank) {
+                        if (coll_access) {
+                            if (H5C__collective_read(f, type->mem_type, addr + len, actual_len - len,
+                                                     image + len) < 0)
+                                HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't read image")
+                        } /* end if */
+                        else {
 #endif /* H5_HAVE_PARALLEL */
-                            /* If the thing's image needs to be bigger for a speculatively
-                             * loaded thing, go get the on-disk image again (the extra portion).
-                             */
-                            if (H5F_block_read(f, type->mem_type, addr + len, actual_len - len, image + len) <
-                                0)
+                            if (H5F_block_read(f, type->mem_type, addr + len, actual_len - len,
+                                               image + len) < 0)
                                 HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "can't read image")
 #ifdef H5_HAVE_PARALLEL
-                        }
-                        /* If the collective metadata read optimization is turned on,
-                         * Bcast the metadata read from process 0 to all ranks in the file
-                         * communicator */
-                        if (coll_access) {
-                            int buf_size;
-
-                            H5_CHECKED_ASSIGN(buf_size, int, actual_len - len, size_t);
-                            if (MPI_SUCCESS !=
-                                (mpi_code = MPI_Bcast(image + len, buf_size, MPI_BYTE, 0, comm)))
-                                HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
-                        } /* end if */
-#endif                    /* H5_HAVE_PARALLEL */
-                    }     /* end if */
+                        } /* end else */
+#endif /* H5_HAVE_PARALLEL */
+                    } /* end if */
                 }         /* end if (actual_len != len) */
                 else {
                     /* The length has stabilized */
@@ -208,12 +208,13 @@ typedef struct H5CX_t {
 
 #ifdef H5_HAVE_PARALLEL
     /* Internal: Parallel I/O settings */
-    hbool_t      coll_metadata_read; /* Whether to use collective I/O for metadata read */
-    MPI_Datatype btype;              /* MPI datatype for buffer, when using collective I/O */
-    MPI_Datatype ftype;              /* MPI datatype for file, when using collective I/O */
-    hbool_t      mpi_file_flushing;  /* Whether an MPI-opened file is being flushed */
-    hbool_t      rank0_bcast;        /* Whether a dataset meets read-with-rank0-and-bcast requirements */
-#endif                               /* H5_HAVE_PARALLEL */
+    hbool_t      coll_metadata_read;     /* Whether to use collective I/O for metadata read */
+    MPI_Datatype btype;                  /* MPI datatype for buffer, when using collective I/O */
+    MPI_Datatype ftype;                  /* MPI datatype for file, when using collective I/O */
+    hbool_t      mpi_file_flushing;      /* Whether an MPI-opened file is being flushed */
+    hbool_t      mpi_nonblocking_writes; /* Whether metadata writes may complete after they return */
+    hbool_t      rank0_bcast;            /* Whether a dataset meets read-with-rank0-and-bcast requirements */
+#endif                                   /* H5_HAVE_PARALLEL */
 
     /* Cached DXPL properties */
     size_t    max_temp_buf;            /* Maximum temporary buffer size */
@@ -1810,6 +1811,29 @@ H5CX_get_mpi_file_flushing(void)
     FUNC_LEAVE_NOAPI((*head)->ctx.mpi_file_flushing)
 } /* end H5CX_get_mpi_file_flushing() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_get_mpi_nonblocking_writes
+ *
+ * Purpose:     Retrieves the "nonblocking metadata writes" flag for the current API call context.
+ *
+ * Return:      TRUE / FALSE on success / <can't fail>
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5CX_get_mpi_nonblocking_writes(void)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    FUNC_LEAVE_NOAPI((*head)->ctx.mpi_nonblocking_writes)
+} /* end H5CX_get_mpi_nonblocking_writes() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_get_mpio_rank0_bcast
  *
@@ -3044,6 +3068,31 @@ H5CX_set_mpi_file_flushing(hbool_t flushing)
     FUNC_LEAVE_NOAPI_VOID
 } /* end H5CX_set_mpi_file_flushing() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5CX_set_mpi_nonblocking_writes
+ *
+ * Purpose:     Sets the "nonblocking metadata writes" flag for the current API call context.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5CX_set_mpi_nonblocking_writes(hbool_t nonblocking)
+{
+    H5CX_node_t **head =
+        H5CX_get_my_context(); /* Get the pointer to the head of the API context, for this thread */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(head && *head);
+
+    (*head)->ctx.mpi_nonblocking_writes = nonblocking;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5CX_set_mpi_nonblocking_writes() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5CX_set_mpio_rank0_bcast
  *
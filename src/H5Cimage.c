@@ -81,6 +81,11 @@
 /* Maximum ring allowed in image */
 #define H5C_MAX_RING_IN_IMAGE H5C_RING_MDFSM
 
+/* Granularity at which a new cache image is compared against the previous
+ * one, when only the changed parts of the image block are written
+ */
+#define H5C__MDCI_WRITE_PAGE_SIZE 4096
+
 /******************/
 /* Local Typedefs */
 /******************/
@@ -110,7 +115,9 @@ static herr_t H5C__reconstruct_cache_contents(H5F_t *f, H5C_t *cache_ptr);
 static H5C_cache_entry_t *H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr, const uint8_t **buf);
 static herr_t             H5C__write_cache_image_superblock_msg(H5F_t *f, hbool_t create);
 static herr_t             H5C__read_cache_image(H5F_t *f, H5C_t *cache_ptr);
-static herr_t             H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr);
+static herr_t             H5C__write_cache_image(H5F_t *f, H5C_t *cache_ptr);
+static herr_t H5C__write_cache_image_changes(H5F_t *f, const H5C_t *cache_ptr, const uint8_t *prev_image,
+                                             hsize_t prev_len);
 static herr_t             H5C__construct_cache_image_buffer(H5F_t *f, H5C_t *cache_ptr);
 static herr_t             H5C__free_image_entries_array(H5C_t *cache_ptr);
 
@@ -206,6 +213,42 @@ H5C_cache_image_status(H5F_t *f, hbool_t *load_ci_ptr, hbool_t *write_ci_ptr)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5C_cache_image_status() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5C_cache_image_invalidate_range()
+ *
+ * Purpose:     Note that the bytes in [addr, addr + size) of the file are
+ *              about to be overwritten, or are no longer in the file.
+ *              If they overlap the metadata cache image block read on
+ *              open, discard the copy of that block kept for incremental
+ *              writes of the next cache image.
+ *
+ *              A size of HSIZE_UNDEF extends the range to the end of
+ *              the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5C_cache_image_invalidate_range(H5C_t *cache_ptr, haddr_t addr, hsize_t size)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if (cache_ptr->prev_image_buffer &&
+        H5F_addr_lt(addr, cache_ptr->prev_image_addr + cache_ptr->prev_image_len) &&
+        (size == HSIZE_UNDEF || H5F_addr_gt(addr + size, cache_ptr->prev_image_addr))) {
+        cache_ptr->prev_image_buffer = H5MM_xfree(cache_ptr->prev_image_buffer);
+        cache_ptr->prev_image_addr   = HADDR_UNDEF;
+        cache_ptr->prev_image_len    = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C_cache_image_invalidate_range() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5C__construct_cache_image_buffer()
  *
@@ -1088,8 +1131,26 @@ H5C__load_cache_image(H5F_t *f)
         if (H5C__reconstruct_cache_contents(f, cache_ptr) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "Can't reconstruct cache contents from image block")
 
-        /* Free the image buffer */
-        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+        /* If the image block is about to be freed, keep its contents, so
+         * that a new image allocated at the same address on close only
+         * needs the changed pages written.  Only process 0 writes the
+         * image in the parallel case, and it can't see writes to the
+         * block by other processes, so don't do this there.
+         */
+        if (cache_ptr->delete_image
+#ifdef H5_HAVE_PARALLEL
+            && NULL == cache_ptr->aux_ptr
+#endif /* H5_HAVE_PARALLEL */
+        ) {
+            HDassert(cache_ptr->prev_image_buffer == NULL);
+            cache_ptr->prev_image_buffer = cache_ptr->image_buffer;
+            cache_ptr->prev_image_addr   = cache_ptr->image_addr;
+            cache_ptr->prev_image_len    = cache_ptr->image_len;
+            cache_ptr->image_buffer      = NULL;
+        } /* end if */
+        else
+            /* Free the image buffer */
+            cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
 
         /* Update stats -- must do this now, as we are about
          * to discard the size of the cache image.
@@ -3453,9 +3514,11 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr)
+H5C__write_cache_image(H5F_t *f, H5C_t *cache_ptr)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    uint8_t *prev_image = NULL;      /* Copy of the image block read on open */
+    hsize_t  prev_len   = 0;         /* Length of prev_image */
+    herr_t   ret_value  = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
@@ -3466,6 +3529,23 @@ H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr)
     HDassert(cache_ptr->image_len > 0);
     HDassert(cache_ptr->image_buffer);
 
+    /* If the new image goes where the image read on open was, and that
+     * block is still intact in the file, take its copy.  Detach it first,
+     * as writing the new image would otherwise discard it.
+     */
+    if (cache_ptr->prev_image_buffer) {
+        if (H5F_addr_eq(cache_ptr->prev_image_addr, cache_ptr->image_addr)) {
+            prev_image = (uint8_t *)cache_ptr->prev_image_buffer;
+            prev_len   = cache_ptr->prev_image_len;
+
+            cache_ptr->prev_image_buffer = NULL;
+        } /* end if */
+        else
+            cache_ptr->prev_image_buffer = H5MM_xfree(cache_ptr->prev_image_buffer);
+        cache_ptr->prev_image_addr = HADDR_UNDEF;
+        cache_ptr->prev_image_len  = 0;
+    } /* end if */
+
 #ifdef H5_HAVE_PARALLEL
     {
         H5AC_aux_t *aux_ptr = (H5AC_aux_t *)cache_ptr->aux_ptr;
@@ -3474,15 +3554,80 @@ H5C__write_cache_image(H5F_t *f, const H5C_t *cache_ptr)
             HDassert((NULL == aux_ptr) || (aux_ptr->magic == H5AC__H5AC_AUX_T_MAGIC));
 #endif /* H5_HAVE_PARALLEL */
 
-            /* Write the buffer (if serial access, or rank 0 for parallel access) */
-            if (H5F_block_write(f, H5FD_MEM_SUPER, cache_ptr->image_addr, cache_ptr->image_len,
-                                cache_ptr->image_buffer) < 0)
-                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write metadata cache image block to file")
+            if (prev_image) {
+                /* Write only the parts of the image that changed */
+                if (H5C__write_cache_image_changes(f, cache_ptr, prev_image, prev_len) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL,
+                                "can't write metadata cache image block changes to file")
+            } /* end if */
+            else {
+                /* Write the buffer (if serial access, or rank 0 for parallel access) */
+                if (H5F_block_write(f, H5FD_MEM_SUPER, cache_ptr->image_addr, cache_ptr->image_len,
+                                    cache_ptr->image_buffer) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL,
+                                "can't write metadata cache image block to file")
+            } /* end else */
 #ifdef H5_HAVE_PARALLEL
         } /* end if */
     }     /* end block */
 #endif    /* H5_HAVE_PARALLEL */
 
 done:
+    H5MM_xfree(prev_image);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__write_cache_image() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__write_cache_image_changes
+ *
+ * Purpose:     Write the metadata cache image to a block that still holds
+ *              the image read on open, skipping the pages that are the
+ *              same in both.  Adjacent changed pages are written together.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__write_cache_image_changes(H5F_t *f, const H5C_t *cache_ptr, const uint8_t *prev_image, hsize_t prev_len)
+{
+    const uint8_t *image     = (const uint8_t *)cache_ptr->image_buffer;
+    hsize_t        run_start = 0;     /* Start of the current run of changed pages */
+    hbool_t        in_run    = FALSE; /* Whether a run of changed pages is open */
+    hsize_t        offset;            /* Offset of the page being compared */
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(image);
+    HDassert(prev_image);
+
+    for (offset = 0; offset < cache_ptr->image_len; offset += H5C__MDCI_WRITE_PAGE_SIZE) {
+        size_t  len = (size_t)MIN(H5C__MDCI_WRITE_PAGE_SIZE, cache_ptr->image_len - offset);
+        hbool_t changed;
+
+        changed = (offset + len > prev_len) || HDmemcmp(image + offset, prev_image + offset, len) != 0;
+
+        if (changed && !in_run) {
+            run_start = offset;
+            in_run    = TRUE;
+        } /* end if */
+        else if (!changed && in_run) {
+            if (H5F_block_write(f, H5FD_MEM_SUPER, cache_ptr->image_addr + run_start,
+                                (size_t)(offset - run_start), image + run_start) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write metadata cache image pages to file")
+            in_run = FALSE;
+        } /* end else-if */
+    }     /* end for */
+
+    if (in_run)
+        if (H5F_block_write(f, H5FD_MEM_SUPER, cache_ptr->image_addr + run_start,
+                            (size_t)(cache_ptr->image_len - run_start), image + run_start) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "can't write metadata cache image pages to file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__write_cache_image_changes() */
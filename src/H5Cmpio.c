@@ -216,7 +216,11 @@ H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, ha
     HDfprintf(stdout, "%s", tbl_buf);
 #endif /* H5C_APPLY_CANDIDATE_LIST__DEBUG */
 
-    if (f->shared->coll_md_write) {
+    /* Write the entries collectively if requested, except in a nonblocking
+     * flush: its writes are still in progress when this function returns,
+     * and the file view used by collective writes can't change then.
+     */
+    if (f->shared->coll_md_write && !H5CX_get_mpi_nonblocking_writes()) {
         /* Sanity check */
         HDassert(NULL == cache_ptr->coll_write_list);
 
@@ -382,9 +386,7 @@ H5C_apply_candidate_list(H5F_t *f, H5C_t *cache_ptr, unsigned num_candidates, ha
         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "flush candidates failed")
 
     /* If we've deferred writing to do it collectively, take care of that now */
-    if (f->shared->coll_md_write) {
-        /* Sanity check */
-        HDassert(cache_ptr->coll_write_list);
+    if (cache_ptr->coll_write_list) {
 
         /* Write collective list */
         if (H5C__collective_write(f) < 0)
@@ -911,6 +913,13 @@ H5C_clear_coll_entries(H5C_t *cache_ptr, hbool_t partial)
 
     FUNC_ENTER_NOAPI_NOINIT
 
+    /* The file may be written before the next collective read, so drop
+     * the region kept for collective reads as well.  This happens on all
+     * ranks at the same point, so they keep agreeing on its contents.
+     */
+    cache_ptr->coll_read_addr = HADDR_UNDEF;
+    cache_ptr->coll_read_len  = 0;
+
     entry_ptr = cache_ptr->coll_tail_ptr;
     clear_cnt = (partial ? cache_ptr->coll_list_len / 2 : cache_ptr->coll_list_len);
     while (entry_ptr && clear_cnt > 0) {
@@ -934,6 +943,111 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_clear_coll_entries */
 
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__collective_read
+ *
+ * Purpose:     Read a piece of metadata collectively: process 0 reads it
+ *              from the file and broadcasts it to the other processes.
+ *
+ *              When the file's collective metadata read size is set,
+ *              process 0 reads and broadcasts the whole region of that
+ *              size around the piece instead, and every process keeps
+ *              it.  Later collective reads that fall in the region are
+ *              copied from it with no I/O or communication.  Since
+ *              collective reads are made in the same order on all
+ *              processes, they all find the same pieces in the region.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__collective_read(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t len, void *buf)
+{
+    H5C_t *  cache_ptr;
+    size_t   read_size;
+    haddr_t  eoa;
+    int      mpi_rank;
+    MPI_Comm comm;
+    int      buf_size;
+    int      mpi_code;
+    herr_t   ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(len > 0);
+    HDassert(buf);
+
+    cache_ptr = f->shared->cache;
+    read_size = f->shared->coll_md_read_size;
+
+    if ((mpi_rank = H5F_mpi_get_rank(f)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "Can't get MPI rank")
+    if ((comm = H5F_mpi_get_comm(f)) == MPI_COMM_NULL)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "get_comm request failed")
+    if (HADDR_UNDEF == (eoa = H5F_get_eoa(f, type)))
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "unable to get EOA for file")
+
+    /* Read and broadcast just this piece if it can't go through the region
+     * (reads past the EOA are left to fail as before)
+     */
+    if (len > read_size || H5F_addr_gt(addr + len, eoa)) {
+        if (0 == mpi_rank)
+            if (H5F_block_read(f, type, addr, len, buf) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read metadata")
+        H5_CHECKED_ASSIGN(buf_size, int, len, size_t);
+        if (MPI_SUCCESS != (mpi_code = MPI_Bcast(buf, buf_size, MPI_BYTE, 0, comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Refill the region if it doesn't hold this piece */
+    if (!H5F_addr_defined(cache_ptr->coll_read_addr) || H5F_addr_lt(addr, cache_ptr->coll_read_addr) ||
+        H5F_addr_gt(addr + len, cache_ptr->coll_read_addr + cache_ptr->coll_read_len)) {
+        haddr_t start;      /* Address of the new region */
+        size_t  region_len; /* Length of the new region */
+
+        /* Start the region at a multiple of its size, to catch the metadata
+         * just before this piece as well, unless the piece would then end
+         * outside it
+         */
+        start = addr - (addr % read_size);
+        if (H5F_addr_gt(addr + len, start + read_size))
+            start = addr;
+        region_len = (size_t)MIN(read_size, eoa - start);
+
+        cache_ptr->coll_read_addr = HADDR_UNDEF;
+        cache_ptr->coll_read_len  = 0;
+        if (NULL == cache_ptr->coll_read_buf)
+            if (NULL == (cache_ptr->coll_read_buf = (uint8_t *)H5MM_malloc(read_size)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL,
+                            "memory allocation failed for collective read region")
+
+        /* Read the region on process 0 and broadcast it */
+        if (0 == mpi_rank)
+            if (H5F_block_read(f, type, start, region_len, cache_ptr->coll_read_buf) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read collective read region")
+        H5_CHECKED_ASSIGN(buf_size, int, region_len, size_t);
+        if (MPI_SUCCESS != (mpi_code = MPI_Bcast(cache_ptr->coll_read_buf, buf_size, MPI_BYTE, 0, comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+
+        cache_ptr->coll_read_addr = start;
+        cache_ptr->coll_read_len  = region_len;
+    } /* end if */
+
+    /* Copy the piece from the region */
+    H5MM_memcpy(buf, cache_ptr->coll_read_buf + (addr - cache_ptr->coll_read_addr), len);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__collective_read */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5C__collective_write
@@ -4443,6 +4443,22 @@ typedef struct H5C_tag_info_t {
  *        image_len in which the metadata cache image is assembled,
  *        or NULL if that    buffer does not exist.
  *
+ * prev_image_buffer: Pointer to the dynamically allocated copy of the
+ *        metadata cache image block read on a R/W open, or NULL if
+ *        there is no such copy.  The block is freed when it is loaded,
+ *        but its contents stay in the file until something else is
+ *        written there or the file is truncated below its end.  While
+ *        they do, a new cache image allocated at the same address only
+ *        needs the pages that differ from this copy written.  Any
+ *        write or truncation that touches the block discards the copy
+ *        (see H5C_cache_image_invalidate_range()).
+ *
+ * prev_image_addr: haddr_t containing the base address of the metadata
+ *        cache image block copied in prev_image_buffer, or HADDR_UNDEF.
+ *
+ * prev_image_len: hsize_t containing the length of prev_image_buffer,
+ *        or zero.
+ *
  *
  * Free Space Manager Related fields:
  *
@@ -4908,6 +4924,11 @@ struct H5C_t {
 
     /* Fields for collective metadata writes */
     H5SL_t *                    coll_write_list;
+
+    /* Fields for the file region kept for collective metadata reads */
+    uint8_t *                   coll_read_buf;
+    haddr_t                     coll_read_addr;
+    size_t                      coll_read_len;
 #endif /* H5_HAVE_PARALLEL */
 
     /* Fields for automatic cache size adjustment */
@@ -4951,6 +4972,9 @@ struct H5C_t {
     uint32_t            num_entries_in_image;
     H5C_image_entry_t *        image_entries;
     void *                      image_buffer;
+    void *                      prev_image_buffer;
+    haddr_t                     prev_image_addr;
+    hsize_t                     prev_image_len;
 
     /* Free Space Manager Related fields */
     hbool_t             rdfsm_settled;
@@ -5081,6 +5105,12 @@ H5_DLL herr_t H5C__serialize_cache(H5F_t *f);
 H5_DLL herr_t H5C__iter_tagged_entries(H5C_t *cache, haddr_t tag, hbool_t match_global,
     H5C_tag_iter_cb_t cb, void *cb_ctx);
 
+/* Collective metadata read routines */
+#ifdef H5_HAVE_PARALLEL
+H5_DLL herr_t H5C__collective_read(H5F_t *f, H5FD_mem_t type, haddr_t addr,
+    size_t len, void *buf);
+#endif /* H5_HAVE_PARALLEL */
+
 /* Routines for operating on entry tags */
 H5_DLL herr_t H5C__tag_entry(H5C_t * cache_ptr, H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__untag_entry(H5C_t *cache, H5C_cache_entry_t *entry);
@@ -40,6 +40,7 @@
 #include "H5Eprivate.h"  /* Error handling		  	*/
 #include "H5Fpkg.h"      /* Files				*/
 #include "H5Iprivate.h"  /* IDs			  		*/
+#include "H5MMprivate.h" /* Memory management			*/
 #include "H5Pprivate.h"  /* Property lists                       */
 
 /****************/
@@ -67,6 +68,17 @@ typedef struct {
                                           */
 } H5C_tag_iter_evict_ctx_t;
 
+/* Typedef for tagged entry iterator callback context - find changed entries */
+typedef struct {
+    H5F_t *             f;          /* File pointer for reading entry images */
+    hbool_t             collect;    /* Whether to collect the changed entries */
+    uint8_t *           image;      /* Buffer for an entry's image in the file */
+    size_t              image_size; /* Size of the image buffer */
+    size_t              nchanged;   /* # of entries whose image in the file changed */
+    size_t              nalloc;     /* # of entries the 'changed' array can hold */
+    H5C_cache_entry_t **changed;    /* Entries whose image in the file changed */
+} H5C_tag_iter_changed_ctx_t;
+
 /* Typedef for tagged entry iterator callback context - expunge tag type metadata */
 typedef struct {
     H5F_t *  f;       /* File pointer for evicting entry */
@@ -568,6 +580,196 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_evict_tagged_entries() */
 
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__changed_tagged_entries_cb
+ *
+ * Purpose:     Callback for finding tagged entries whose image in the file
+ *              differs from the image they were loaded from.  Entries
+ *              without an up-to-date image, or whose class doesn't read
+ *              from the file, are counted as changed.
+ *
+ * Return:      H5_ITER_ERROR if error is detected, H5_ITER_CONT otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__changed_tagged_entries_cb(H5C_cache_entry_t *entry, void *_ctx)
+{
+    H5C_tag_iter_changed_ctx_t *ctx     = (H5C_tag_iter_changed_ctx_t *)_ctx; /* Iterator context */
+    hbool_t                     changed = TRUE;          /* Whether the entry changed */
+    int                         ret_value = H5_ITER_CONT; /* Return value */
+
+    /* Function enter macro */
+    FUNC_ENTER_STATIC
+
+    /* Santify checks */
+    HDassert(entry);
+    HDassert(ctx);
+
+    /* When only detecting changes, the first one is enough */
+    if (!ctx->collect && ctx->nchanged > 0)
+        HGOTO_DONE(H5_ITER_CONT)
+
+    /* Compare the entry's image with the one in the file */
+    if (!entry->is_dirty && entry->image_ptr && entry->image_up_to_date &&
+        !(entry->type->flags & H5C__CLASS_SKIP_READS)) {
+        if (entry->size > ctx->image_size) {
+            if (NULL == (ctx->image = (uint8_t *)H5MM_realloc(ctx->image, entry->size)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, H5_ITER_ERROR, "can't allocate image buffer")
+            ctx->image_size = entry->size;
+        } /* end if */
+        if (H5F_block_read(ctx->f, entry->type->mem_type, entry->addr, entry->size, ctx->image) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, H5_ITER_ERROR, "can't read entry's image")
+        changed = (0 != HDmemcmp(ctx->image, entry->image_ptr, entry->size));
+    } /* end if */
+
+    if (changed) {
+        if (ctx->collect) {
+            if (ctx->nchanged == ctx->nalloc) {
+                size_t              nalloc = MAX(16, 2 * ctx->nalloc);
+                H5C_cache_entry_t **tmp;
+
+                if (NULL == (tmp = (H5C_cache_entry_t **)H5MM_realloc(ctx->changed,
+                                                                      nalloc * sizeof(H5C_cache_entry_t *))))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, H5_ITER_ERROR, "can't grow changed entry list")
+                ctx->changed = tmp;
+                ctx->nalloc  = nalloc;
+            } /* end if */
+            ctx->changed[ctx->nchanged] = entry;
+        } /* end if */
+        ctx->nchanged++;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__changed_tagged_entries_cb() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C_tagged_entries_changed
+ *
+ * Purpose:     Determines whether the image in the file of any entry with
+ *              the specified tag differs from the image it was loaded
+ *              from, i.e. whether another process changed the entry.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_tagged_entries_changed(H5F_t *f, haddr_t tag, hbool_t match_global, hbool_t *changed)
+{
+    H5C_tag_iter_changed_ctx_t ctx;                 /* Context for iterator callbacks */
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    /* Function enter macro */
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+    HDassert(changed);
+
+    /* Construct context for iterator callbacks */
+    HDmemset(&ctx, 0, sizeof(ctx));
+    ctx.f = f;
+
+    /* Look for a changed entry */
+    if (H5C__iter_tagged_entries(f->shared->cache, tag, match_global, H5C__changed_tagged_entries_cb, &ctx) <
+        0)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADITER, FAIL, "Iteration of tagged entries failed")
+
+    *changed = (ctx.nchanged > 0);
+
+done:
+    H5MM_xfree(ctx.image);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_tagged_entries_changed() */
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C_evict_changed_tagged_entries
+ *
+ * Purpose:     Evicts the entries with the specified tag whose image in
+ *              the file differs from the image they were loaded from,
+ *              leaving the unchanged entries in the cache.
+ *
+ *              An entry that other entries in the cache depend on is
+ *              pinned by them and can't be evicted on its own, as they
+ *              point at it.  If a changed entry is still pinned once the
+ *              other changed entries are gone, all entries with the tag
+ *              are evicted instead.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_evict_changed_tagged_entries(H5F_t *f, haddr_t tag, hbool_t match_global)
+{
+    H5C_tag_iter_changed_ctx_t ctx;                 /* Context for iterator callbacks */
+    size_t                     nleft;               /* # of changed entries not evicted yet */
+    hbool_t                    evicted;             /* Whether an entry was evicted in the last pass */
+    size_t                     u;                   /* Local index variable */
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    /* Function enter macro */
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+
+    /* Construct context for iterator callbacks */
+    HDmemset(&ctx, 0, sizeof(ctx));
+    ctx.f       = f;
+    ctx.collect = TRUE;
+
+    /* Collect the changed entries */
+    if (H5C__iter_tagged_entries(f->shared->cache, tag, match_global, H5C__changed_tagged_entries_cb, &ctx) <
+        0)
+        HGOTO_ERROR(H5E_CACHE, H5E_BADITER, FAIL, "Iteration of tagged entries failed")
+
+    /* Evict them, repeating while evicting entries unpins others */
+    nleft = ctx.nchanged;
+    do {
+        evicted = FALSE;
+        for (u = 0; u < ctx.nchanged; u++) {
+            H5C_cache_entry_t *entry = ctx.changed[u];
+
+            if (NULL == entry || entry->is_pinned || entry->prefetched_dirty)
+                continue;
+            if (entry->is_protected)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Cannot evict protected entry")
+            if (entry->is_dirty)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Cannot evict dirty entry")
+
+            if (H5C__flush_single_entry(f, entry,
+                                        H5C__FLUSH_INVALIDATE_FLAG | H5C__FLUSH_CLEAR_ONLY_FLAG |
+                                            H5C__DEL_FROM_SLIST_ON_DESTROY_FLAG) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Entry eviction failed.")
+            ctx.changed[u] = NULL;
+            nleft--;
+            evicted = TRUE;
+        } /* end for */
+    } while (evicted && nleft > 0);
+
+    /* Fall back to evicting everything with the tag */
+    if (nleft > 0)
+        if (H5C_evict_tagged_entries(f, tag, match_global) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Cannot evict tagged entries")
+
+done:
+    H5MM_xfree(ctx.image);
+    H5MM_xfree(ctx.changed);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_evict_changed_tagged_entries() */
+
 /*-------------------------------------------------------------------------
  *
  * Function:    H5C__mark_tagged_entries_cb
@@ -239,6 +239,115 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dcreate_async() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Dcreate_multi
+ *
+ * Purpose:     Creates COUNT new datasets in a single call.  Dataset I
+ *              is named NAMES[I] relative to LOC_ID and is created with
+ *              TYPE_IDS[I], SPACE_IDS[I] and DCPL_IDS[I] (or the default
+ *              dataset creation property list when DCPL_IDS is NULL).
+ *              LCPL_ID and DAPL_ID are shared by all of the datasets.
+ *
+ *              With the native VOL connector, the group at LOC_ID is
+ *              prepared for the new links before any dataset is created
+ *              and the new object headers are allocated from a single
+ *              contiguous metadata block.
+ *
+ *              On success, the new dataset IDs are returned in DSET_IDS.
+ *              On failure, any datasets created so far remain in the
+ *              file, but their IDs are closed and all entries in
+ *              DSET_IDS are set to H5I_INVALID_HID.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dcreate_multi(hid_t loc_id, size_t count, const char *names[], const hid_t type_ids[],
+                const hid_t space_ids[], hid_t lcpl_id, const hid_t dcpl_ids[], hid_t dapl_id,
+                hid_t dset_ids[] /*out*/)
+{
+    H5VL_object_t *   vol_obj = NULL;        /* Object for loc_id */
+    H5VL_loc_params_t loc_params;            /* Location parameters for object access */
+    hbool_t           is_native_vol_obj;     /* Whether the location is a native VOL object */
+    hbool_t           batch_begun = FALSE;   /* Whether the native batch setup was performed */
+    hsize_t           block_size  = 0;       /* Previous metadata block size */
+    size_t            u;                     /* Local index variable */
+    herr_t            ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE9("e", "iz**s*i*ii*iix", loc_id, count, names, type_ids, space_ids, lcpl_id, dcpl_ids, dapl_id,
+             dset_ids);
+
+    /* Check arguments */
+    if (count == 0)
+        HGOTO_DONE(SUCCEED)
+    if (!names)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "names parameter cannot be NULL")
+    if (!type_ids)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "type_ids parameter cannot be NULL")
+    if (!space_ids)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "space_ids parameter cannot be NULL")
+    if (!dset_ids)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dset_ids parameter cannot be NULL")
+    for (u = 0; u < count; u++)
+        dset_ids[u] = H5I_INVALID_HID;
+    if (H5I_is_file_object(loc_id) != TRUE)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "loc_id is not a file object")
+
+    /* Get the location object */
+    if (NULL == (vol_obj = H5VL_vol_object(loc_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid location identifier")
+
+    /* Let the native connector prepare the file for the whole batch */
+    if (H5VL_object_is_native(vol_obj, &is_native_vol_obj) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL,
+                    "can't determine if VOL object is native connector object")
+    if (is_native_vol_obj) {
+        size_t  nlinks = 0; /* # of links inserted directly into loc_id */
+        hsize_t hdr_space;  /* Estimated space for the new object headers */
+
+        /* Only names without a path component land in loc_id's group */
+        for (u = 0; u < count; u++)
+            if (names[u] && NULL == HDstrchr(names[u], '/'))
+                nlinks++;
+
+        hdr_space = MIN((hsize_t)count * H5D_MINHDR_SIZE, H5D_MULTI_CREATE_MAX_HDR_RESERVE);
+
+        loc_params.type     = H5VL_OBJECT_BY_SELF;
+        loc_params.obj_type = H5I_get_type(loc_id);
+
+        if (H5VL_object_optional(vol_obj, H5VL_NATIVE_OBJECT_BEGIN_BATCH_CREATE, H5P_DATASET_XFER_DEFAULT,
+                                 H5_REQUEST_NULL, &loc_params, nlinks, hdr_space, &block_size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to prepare location for dataset creation")
+        batch_begun = TRUE;
+    } /* end if */
+
+    /* Create the datasets */
+    for (u = 0; u < count; u++)
+        if ((dset_ids[u] = H5D__create_api_common(loc_id, names[u], type_ids[u], space_ids[u], lcpl_id,
+                                                  dcpl_ids ? dcpl_ids[u] : H5P_DEFAULT, dapl_id, NULL,
+                                                  NULL)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "unable to create dataset '%s'",
+                        names[u] ? names[u] : "(null)")
+
+done:
+    if (batch_begun)
+        if (H5VL_object_optional(vol_obj, H5VL_NATIVE_OBJECT_END_BATCH_CREATE, H5P_DATASET_XFER_DEFAULT,
+                                 H5_REQUEST_NULL, &loc_params, block_size) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRESET, FAIL, "unable to finish batch dataset creation")
+
+    if (ret_value < 0 && dset_ids)
+        for (u = 0; u < count; u++)
+            if (dset_ids[u] >= 0) {
+                if (H5I_dec_app_ref_always_close(dset_ids[u]) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataset ID")
+                dset_ids[u] = H5I_INVALID_HID;
+            } /* end if */
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dcreate_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Dcreate_anon
  *
@@ -2142,3 +2251,89 @@ H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *offset, unsigned *filte
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dget_chunk_info_by_coord() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dget_chunk_stats
+ *
+ * Purpose:     Retrieves the minimum and maximum values of a chunk of a
+ *              dataset created with H5Pset_chunk_stats.
+ *
+ * Parameters:
+ *              hid_t dset_id;              IN: Chunked dataset ID
+ *              hsize_t *offset             IN: Logical position of the chunk's
+ *                                               first element in the dataspace
+ *              H5D_chunk_stats_t *stats    OUT: Statistics of the chunk
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_stats(hid_t dset_id, const hsize_t *offset, H5D_chunk_stats_t *stats /*out*/)
+{
+    H5VL_object_t *vol_obj   = NULL; /* Dataset for this operation */
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*hx", dset_id, offset, stats);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+    if (NULL == offset)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid argument (null)")
+    if (NULL == stats)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid argument (null)")
+
+    /* Get the statistics of the chunk */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_GET_CHUNK_STATS, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, offset, stats) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_stats() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Dget_chunks_in_range
+ *
+ * Purpose:     Finds the chunks of a dataset created with
+ *              H5Pset_chunk_stats that may hold values in [MIN, MAX].
+ *
+ * Parameters:
+ *              hid_t dset_id;          IN: Chunked dataset ID
+ *              double min, max         IN: Range of values
+ *              size_t max_chunks       IN: Number of chunks OFFSETS can hold
+ *              hsize_t *offsets        OUT: Logical positions of the chunks
+ *              hsize_t *nchunks        OUT: Number of chunks found
+ *
+ * Return:      Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunks_in_range(hid_t dset_id, double min, double max, size_t max_chunks, hsize_t *offsets /*out*/,
+                       hsize_t *nchunks /*out*/)
+{
+    H5VL_object_t *vol_obj   = NULL; /* Dataset for this operation */
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "iddzxx", dset_id, min, max, max_chunks, offsets, nchunks);
+
+    /* Check arguments */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid dataset identifier")
+    if (NULL == nchunks)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid argument (null)")
+    if (HDisnan(min) || HDisnan(max) || min > max)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid range of values")
+
+    /* Find the chunks */
+    if (H5VL_dataset_optional(vol_obj, H5VL_NATIVE_DATASET_GET_CHUNKS_IN_RANGE, H5P_DATASET_XFER_DEFAULT,
+                              H5_REQUEST_NULL, min, max, max_chunks, offsets, nchunks) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't find chunks in range")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunks_in_range() */
@@ -309,6 +309,7 @@ static herr_t   H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_
                                   void *chunk, uint32_t naccessed);
 static herr_t   H5D__chunk_cache_prune(const H5D_t *dset, size_t size);
 static herr_t   H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk);
+static herr_t   H5D__chunk_file_check_size(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *new_chunk);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, H5D_chunk_coll_info_t *chunk_info,
                                          size_t chunk_size, const void *fill_buf);
@@ -396,6 +397,15 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
         /* Allocate storage */
         if (H5D__alloc_storage(&io_info, H5D_ALLOC_WRITE, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
+
+        /* A dataset with an empty extent gets no index above, but a chunk
+         * may still be written at the current extent before extending it */
+        if (!H5D__chunk_is_space_alloc(&layout->storage)) {
+            if (H5D__chunk_create(dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize chunked storage")
+            if (H5D__mark(dset, H5D_MARK_LAYOUT) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to mark layout as dirty")
+        } /* end if */
     }
 
     /* Calculate the index of this chunk */
@@ -455,6 +465,17 @@ H5D__chunk_direct_write(const H5D_t *dset, uint32_t filters, hsize_t *offset, ui
             HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
     } /* end if */
 
+    /* Keep the chunk's statistics, which can only be computed when the
+     * whole chunk is given unfiltered */
+    if (dset->shared->cstats) {
+        if (0 == idx_info.pline->nused && (hsize_t)data_size == layout->u.chunk.size) {
+            if (H5D__cstats_update(dset, scaled, buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTUPDATE, FAIL, "unable to update chunk statistics")
+        } /* end if */
+        else if (H5D__cstats_invalidate(dset, scaled) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTUPDATE, FAIL, "unable to invalidate chunk statistics")
+    } /* end if */
+
     /* Write the data to the file */
     if (H5F_shared_block_write(H5F_SHARED(dset->oloc.file), H5FD_MEM_DRAW, udata.chunk_block.offset,
                                data_size, buf) < 0)
@@ -2384,7 +2405,9 @@ H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr, hbool_t write_
             has_filters = TRUE;
     } /* end if */
 
-    if (has_filters)
+    /* Chunk statistics are computed from the whole chunk when it is
+     * flushed, so all writes must go through the cache too. */
+    if (has_filters || (write_op && dataset->shared->cstats))
         ret_value = TRUE;
     else {
 #ifdef H5_HAVE_PARALLEL
@@ -2785,10 +2808,49 @@ H5D__chunk_flush(H5D_t *dset)
     if (nerrors)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
+    /* Write out the statistics of the chunks just flushed */
+    if (dset->shared->cstats && H5D__cstats_flush(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush chunk statistics")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_flush() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_clear
+ *
+ * Purpose:     Writes out and evicts all the chunks in the dataset's chunk
+ *              cache, and forgets the last chunk looked up, so that later
+ *              accesses get them from the file again.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_cache_clear(const H5D_t *dset)
+{
+    H5D_rdcc_t *    rdcc = &(dset->shared->cache.chunk); /* Dataset's chunk cache */
+    H5D_rdcc_ent_t *ent, *next;                           /* Pointer to current & next cache entries */
+    herr_t          ret_value = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dset->oloc.addr)
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+
+    for (ent = rdcc->head; ent; ent = next) {
+        next = ent->next;
+        if (H5D__chunk_cache_evict(dset, ent, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to evict chunk")
+    } /* end for */
+    H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5D__chunk_cache_clear() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_io_term
  *
@@ -2890,6 +2952,10 @@ H5D__chunk_dest(H5D_t *dset)
     idx_info.layout  = &dset->shared->layout.u.chunk;
     idx_info.storage = sc;
 
+    /* Release the chunk statistics */
+    if (H5D__cstats_dest(dset) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk statistics")
+
     /* Free any index structures */
     if (sc->ops->dest && (sc->ops->dest)(&idx_info) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk index info")
@@ -3311,6 +3377,10 @@ H5D__chunk_flush_entry(const H5D_t *dset, H5D_rdcc_ent_t *ent, hbool_t reset)
         hbool_t            must_alloc  = FALSE; /* Whether the chunk must be allocated */
         hbool_t            need_insert = FALSE; /* Whether the chunk needs to be inserted into the index */
 
+        /* Update the chunk's statistics while it is still unfiltered */
+        if (dset->shared->cstats && H5D__cstats_update(dset, ent->scaled, ent->chunk) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTUPDATE, FAIL, "unable to update chunk statistics")
+
         /* Set up user data for index callbacks */
         udata.common.layout      = &dset->shared->layout.u.chunk;
         udata.common.storage     = sc;
@@ -5618,6 +5688,10 @@ H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim)
     /* Reset any cached chunk info for this dataset */
     H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
 
+    /* Forget the statistics of the chunks removed */
+    if (dset->shared->cstats && H5D__cstats_prune(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTUPDATE, FAIL, "unable to prune chunk statistics")
+
 done:
     /* Release resources */
     if (chunk_space && H5S_close(chunk_space) < 0)
@@ -6813,6 +6887,45 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_is_partial_edge_chunk() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_file_check_size
+ *
+ * Purpose:     Check that the size of a filtered chunk can still be
+ *              encoded in the chunk index.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_file_check_size(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *new_chunk)
+{
+    unsigned allow_chunk_size_len; /* Allowed size of encoded chunk size */
+    unsigned new_chunk_size_len;   /* Size of encoded chunk size */
+    herr_t   ret_value = SUCCEED;  /* Return value         */
+
+    FUNC_ENTER_STATIC
+
+    /* Compute the size required for encoding the size of a chunk, allowing
+     * for an extra byte, in case the filter makes the chunk larger.
+     */
+    allow_chunk_size_len = 1 + ((H5VM_log2_gen((uint64_t)(idx_info->layout->size)) + 8) / 8);
+    if (allow_chunk_size_len > 8)
+        allow_chunk_size_len = 8;
+
+    /* Compute encoded size of chunk */
+    new_chunk_size_len = (H5VM_log2_gen((uint64_t)(new_chunk->length)) + 8) / 8;
+    if (new_chunk_size_len > 8)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "encoded chunk size is more than 8 bytes?!?")
+
+    /* Check if the chunk became too large to be encoded */
+    if (new_chunk_size_len > allow_chunk_size_len)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_file_check_size() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_file_alloc()
  *
@@ -6851,26 +6964,8 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
     if (idx_info->pline->nused > 0) {
         /* Sanity/error checking block */
         HDassert(idx_info->storage->idx_type != H5D_CHUNK_IDX_NONE);
-        {
-            unsigned allow_chunk_size_len; /* Allowed size of encoded chunk size */
-            unsigned new_chunk_size_len;   /* Size of encoded chunk size */
-
-            /* Compute the size required for encoding the size of a chunk, allowing
-             * for an extra byte, in case the filter makes the chunk larger.
-             */
-            allow_chunk_size_len = 1 + ((H5VM_log2_gen((uint64_t)(idx_info->layout->size)) + 8) / 8);
-            if (allow_chunk_size_len > 8)
-                allow_chunk_size_len = 8;
-
-            /* Compute encoded size of chunk */
-            new_chunk_size_len = (H5VM_log2_gen((uint64_t)(new_chunk->length)) + 8) / 8;
-            if (new_chunk_size_len > 8)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "encoded chunk size is more than 8 bytes?!?")
-
-            /* Check if the chunk became too large to be encoded */
-            if (new_chunk_size_len > allow_chunk_size_len)
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
-        } /* end block */
+        if (H5D__chunk_file_check_size(idx_info, new_chunk) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
 
         if (old_chunk && H5F_addr_defined(old_chunk->offset)) {
             /* Sanity check */
@@ -6946,6 +7041,112 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_file_alloc() */
 
+#ifdef H5_HAVE_PARALLEL
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_file_alloc_batch()
+ *
+ * Purpose:     Allocate file space for a list of filtered chunks at once.
+ *
+ *              Chunks that keep their size stay where they are; all the
+ *              others are carved, in list order, out of a single block
+ *              obtained with one call to H5MF_alloc().  Chunks that are
+ *              next to each other in the list therefore end up next to
+ *              each other in the file.  Since the allocation is
+ *              deterministic, every process of a collective operation
+ *              must pass the same list.
+ *
+ *              When the file has an alignment or uses paged aggregation,
+ *              which both apply to each allocation, the chunks are
+ *              allocated one at a time with H5D__chunk_file_alloc().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_file_alloc_batch(const H5D_chk_idx_info_t *idx_info, size_t nchunks,
+                            const H5F_block_t *old_chunks[], H5F_block_t *new_chunks[],
+                            const hsize_t *scaled[])
+{
+    hsize_t total_size = 0;       /* Size of the block holding the chunks that need space */
+    haddr_t block_addr;           /* Address of that block */
+    size_t  u;                    /* Local index variable */
+    herr_t  ret_value = SUCCEED;  /* Return value         */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(idx_info);
+    HDassert(idx_info->f);
+    HDassert(idx_info->pline);
+    HDassert(idx_info->layout);
+    HDassert(idx_info->storage);
+    HDassert(nchunks == 0 || (old_chunks && new_chunks && scaled));
+
+    /* Fall back to allocating each chunk on its own when batching does not apply */
+    if (nchunks < 2 || idx_info->pline->nused == 0 || idx_info->storage->idx_type == H5D_CHUNK_IDX_NONE ||
+        H5F_ALIGNMENT(idx_info->f) > 1 || H5F_use_paged_aggr(idx_info->f)) {
+        for (u = 0; u < nchunks; u++) {
+            hbool_t need_insert;
+
+            if (H5D__chunk_file_alloc(idx_info, old_chunks[u], new_chunks[u], &need_insert, scaled[u]) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+        } /* end for */
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Release the chunks that changed size and add up the space needed */
+    for (u = 0; u < nchunks; u++) {
+        const H5F_block_t *old_chunk = old_chunks[u];
+        H5F_block_t *      new_chunk = new_chunks[u];
+
+        if (H5D__chunk_file_check_size(idx_info, new_chunk) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk size can't be encoded")
+
+        if (old_chunk && H5F_addr_defined(old_chunk->offset)) {
+            /* Sanity check */
+            HDassert(!H5F_addr_defined(new_chunk->offset) ||
+                     H5F_addr_eq(new_chunk->offset, old_chunk->offset));
+
+            /* Keep chunks that are the same size in place */
+            if (new_chunk->length == old_chunk->length) {
+                new_chunk->offset = old_chunk->offset;
+                continue;
+            } /* end if */
+
+            /* Release previous chunk, unless doing SWMR writes */
+            if (!(H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE))
+                if (H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, old_chunk->offset, old_chunk->length) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+        } /* end if */
+        else
+            HDassert(!H5F_addr_defined(new_chunk->offset));
+
+        HDassert(new_chunk->length > 0);
+        new_chunk->offset = HADDR_UNDEF;
+        total_size += new_chunk->length;
+    } /* end for */
+
+    /* Nothing to allocate if all the chunks kept their size */
+    if (0 == total_size)
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate space for all the chunks at once and hand it out in list order */
+    if (HADDR_UNDEF == (block_addr = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, total_size)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+    for (u = 0; u < nchunks; u++)
+        if (!H5F_addr_defined(new_chunks[u]->offset)) {
+            new_chunks[u]->offset = block_addr;
+            block_addr += new_chunks[u]->length;
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_file_alloc_batch() */
+#endif /* H5_HAVE_PARALLEL */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_format_convert_cb
  *
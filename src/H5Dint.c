@@ -219,6 +219,8 @@ H5D__init_package(void)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't retrieve fill value")
     if (H5P_get(def_dcpl, H5O_CRT_PIPELINE_NAME, &H5D_def_dset.dcpl_cache.pline) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't retrieve pipeline filter")
+    if (H5P_get(def_dcpl, H5D_CRT_CHUNK_STATS_NAME, &H5D_def_dset.dcpl_cache.chunk_stats) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't retrieve chunk statistics flag")
 
     /* Mark "top" of interface as initialized, too */
     H5D_top_package_initialize_s = TRUE;
@@ -1312,6 +1314,8 @@ H5D__create(H5F_t *file, hid_t type_id, const H5S_t *space, hid_t dcpl_id, hid_t
         if (H5P_get(dc_plist, H5D_CRT_EXT_FILE_LIST_NAME, efl) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't retrieve external file list")
         efl_copied = TRUE;
+        if (H5P_get(dc_plist, H5D_CRT_CHUNK_STATS_NAME, &new_dset->shared->dcpl_cache.chunk_stats) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't retrieve chunk statistics flag")
 
         if (FALSE == ignore_filters) {
             /* Check that chunked layout is used if filters are enabled */
@@ -1326,6 +1330,11 @@ H5D__create(H5F_t *file, hid_t type_id, const H5S_t *space, hid_t dcpl_id, hid_t
         /* Don't allow compact datasets to allocate space later */
         if (layout->type == H5D_COMPACT && fill->alloc_time != H5D_ALLOC_TIME_EARLY)
             HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, NULL, "compact dataset must have early space allocation")
+
+        /* Chunk statistics are only kept for chunked datasets */
+        if (new_dset->shared->dcpl_cache.chunk_stats && H5D_CHUNKED != layout->type)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, NULL,
+                        "chunk statistics can only be used with chunked layout")
     } /* end if */
 
     /* Set the version for the I/O pipeline message */
@@ -3967,6 +3976,24 @@ H5D__refresh(hid_t dset_id, H5D_t *dset)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to refresh VDS source datasets")
     } /* end if */
 
+    /* A light refresh leaves the dataset open if its metadata didn't
+     * change, but its raw data may have been rewritten in place, so drop
+     * the raw data cached for it
+     */
+    if (H5F_LIGHT_REFRESH(dset->oloc.file) && !(H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR)) {
+        if (dset->shared->layout.type == H5D_CHUNKED) {
+            if (H5D__chunk_cache_clear(dset) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to clear chunk cache")
+        } /* end if */
+        else if (dset->shared->layout.type == H5D_CONTIGUOUS && dset->shared->cache.contig.sieve_buf) {
+            dset->shared->cache.contig.sieve_buf =
+                (unsigned char *)H5FL_BLK_FREE(sieve_buf, dset->shared->cache.contig.sieve_buf);
+            dset->shared->cache.contig.sieve_loc   = HADDR_UNDEF;
+            dset->shared->cache.contig.sieve_size  = 0;
+            dset->shared->cache.contig.sieve_dirty = FALSE;
+        } /* end if */
+    }     /* end if */
+
     /* Refresh dataset object */
     if ((H5O_refresh_metadata(dset_id, dset->oloc)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to refresh dataset")
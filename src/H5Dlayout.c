@@ -485,6 +485,10 @@ H5D__layout_oh_create(H5F_t *file, H5O_t *oh, H5D_t *dset, hid_t dapl_id)
     /* Indicate that the layout information was initialized */
     layout_init = TRUE;
 
+    /* Set up per-chunk statistics, if requested */
+    if (dset->shared->dcpl_cache.chunk_stats && H5D__cstats_create(file, oh, dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up chunk statistics")
+
     /*
      * Allocate storage if space allocate time is early; otherwise delay
      * allocation until later.
@@ -663,6 +667,15 @@ H5D__layout_oh_read(H5D_t *dataset, hid_t dapl_id, H5P_genplist_t *plist)
         if (H5D__chunk_set_sizes(dataset) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unable to set chunk sizes")
 
+    /* Load per-chunk statistics, if the dataset keeps them */
+    if (H5D_CHUNKED == dataset->shared->layout.type) {
+        if (H5D__cstats_open(dataset) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load chunk statistics")
+        if (dataset->shared->cstats &&
+            H5P_set(plist, H5D_CRT_CHUNK_STATS_NAME, &dataset->shared->dcpl_cache.chunk_stats) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set chunk statistics")
+    } /* end if */
+
 done:
     if (ret_value < 0 && layout_copied)
         if (H5O_msg_reset(H5O_LAYOUT_ID, &dataset->shared->layout) < 0)
@@ -42,9 +42,20 @@
 #include "H5Pprivate.h"  /* Property lists    */
 #include "H5Sprivate.h"  /* Dataspaces        */
 #include "H5VMprivate.h" /* Vector            */
+#include "H5Zprivate.h"  /* Data filters      */
 
 #ifdef H5_HAVE_PARALLEL
 
+/* The filter pipeline can only run on several threads when the memory
+ * allocation sanity checks, the function stack and the filter statistics,
+ * which all keep unprotected global state, are disabled.
+ */
+#if defined(H5_HAVE_LIBPTHREAD) && !defined(H5_MEMORY_ALLOC_SANITY_CHECK) &&                                 \
+    !defined(H5_HAVE_CODESTACK) && !defined(H5Z_DEBUG)
+#define H5D_MPIO_FILTER_THREADS
+#include <pthread.h>
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
@@ -135,6 +146,8 @@ typedef enum H5D_mpio_no_rank0_bcast_cause_t {
  *   buf - A pointer which serves the dual purpose of holding either the chunk data which is to be
  *         written to the file or the chunk data which has been read from the file.
  *
+ *   buf_size - The size of the buffer pointed to by buf, which may grow when the chunk is filtered.
+ *
  *   chunk_states - In the case of dataset writes only, this struct is used to track a chunk's size and
  *                  address in the file before and after the filtering operation has occurred.
  *
@@ -189,6 +202,7 @@ typedef struct H5D_filtered_collective_io_info_t {
     size_t  num_writers;
     size_t  io_size;
     void *  buf;
+    size_t  buf_size;
 
     struct {
         H5F_block_t chunk_current;
@@ -210,6 +224,25 @@ typedef struct H5D_filtered_collective_io_info_t {
 /* Function pointer typedef for sort function */
 typedef int (*H5D_mpio_sort_func_cb_t)(const void *, const void *);
 
+/* The work shared by the threads running the filter pipeline on a list
+ * of chunks. Each thread repeatedly takes the next chunk of the list.
+ */
+typedef struct H5D_mpio_filter_work_t {
+    H5D_filtered_collective_io_info_t **entries;     /* The chunks to filter                   */
+    size_t                              num_entries; /* # of chunks to filter                  */
+    const H5O_pline_t *                 pline;       /* The filter pipeline                    */
+    unsigned                            flags;       /* H5Z_FLAG_REVERSE to unfilter           */
+    H5Z_EDC_t                           err_detect;  /* Error detection info                   */
+    H5Z_cb_t                            filter_cb;   /* I/O filter callback function           */
+#ifdef H5D_MPIO_FILTER_THREADS
+    const H5Z_class2_t *fclass[H5Z_MAX_NFILTERS]; /* The class of each filter of the pipeline */
+    pthread_mutex_t     mutex;                    /* Protects the fields below              */
+#endif
+    size_t   next;        /* Index of the next chunk to filter      */
+    hbool_t  failed;      /* Whether the pipeline failed on a chunk */
+    unsigned filter_mask; /* Optional filters skipped on any chunk  */
+} H5D_mpio_filter_work_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -249,14 +282,32 @@ static herr_t H5D__mpio_array_gatherv(void *local_array, size_t local_array_num_
                                       size_t array_entry_size, void **gathered_array,
                                       size_t *gathered_array_num_entries, hbool_t allgather, int root,
                                       MPI_Comm comm, int (*sort_func)(const void *, const void *));
+static herr_t H5D__mpio_collective_filtered_chunk_alloc(const H5D_chk_idx_info_t *        index_info,
+                                                       H5D_filtered_collective_io_info_t *chunk_list,
+                                                       size_t                             num_entries);
 static herr_t H5D__mpio_filtered_collective_write_type(H5D_filtered_collective_io_info_t *chunk_list,
                                                        size_t num_entries, MPI_Datatype *new_mem_type,
                                                        hbool_t *mem_type_derived, MPI_Datatype *new_file_type,
                                                        hbool_t *file_type_derived);
-static herr_t H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk_entry,
-                                                      const H5D_io_info_t *              io_info,
-                                                      const H5D_type_info_t *            type_info,
-                                                      const H5D_chunk_map_t *            fm);
+static herr_t H5D__filtered_collective_chunk_list_io(H5D_filtered_collective_io_info_t *chunk_list,
+                                                     size_t num_entries, const H5D_io_info_t *io_info,
+                                                     const H5D_type_info_t *type_info,
+                                                     const H5D_chunk_map_t *fm, int mpi_rank);
+static herr_t H5D__filtered_collective_chunk_entry_read(H5D_filtered_collective_io_info_t *chunk_entry,
+                                                        const H5D_io_info_t *              io_info,
+                                                        const H5D_type_info_t *            type_info,
+                                                        const H5D_chunk_map_t *fm, hbool_t *was_read);
+static herr_t H5D__filtered_collective_chunk_entry_update(H5D_filtered_collective_io_info_t *chunk_entry,
+                                                          const H5D_io_info_t *              io_info,
+                                                          const H5D_type_info_t *            type_info,
+                                                          const H5D_chunk_map_t *            fm);
+static herr_t H5D__mpio_filter_chunks(H5D_filtered_collective_io_info_t **entries, size_t num_entries,
+                                      const H5D_io_info_t *io_info, unsigned flags);
+#ifdef H5D_MPIO_FILTER_THREADS
+static void * H5D__mpio_filter_worker(void *_work);
+static herr_t H5D__mpio_filter_chunk(const H5D_mpio_filter_work_t *work,
+                                     H5D_filtered_collective_io_info_t *chunk_entry, unsigned *filter_mask);
+#endif
 static int    H5D__cmp_chunk_addr(const void *chunk_addr_info1, const void *chunk_addr_info2);
 static int    H5D__cmp_filtered_collective_io_info_entry(const void *filtered_collective_io_info_entry1,
                                                          const void *filtered_collective_io_info_entry2);
@@ -699,7 +750,7 @@ H5D__contig_collective_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_
     FUNC_ENTER_PACKAGE
 
     /* Sanity check */
-    HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
+    HDassert(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_HAS_MPI));
 
     /* Call generic internal collective I/O routine */
     if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
@@ -738,7 +789,7 @@ H5D__contig_collective_write(H5D_io_info_t *io_info, const H5D_type_info_t *type
     FUNC_ENTER_PACKAGE
 
     /* Sanity check */
-    HDassert(H5FD_MPIO == H5F_DRIVER_ID(io_info->dset->oloc.file));
+    HDassert(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_HAS_MPI));
 
     /* Call generic internal collective I/O routine */
     if (H5D__inter_collective_io(io_info, type_info, file_space, mem_space) < 0)
@@ -1401,10 +1452,9 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
          * updating each chunk with the data modifications from other processes,
          * then re-filtering the chunk.
          */
-        for (i = 0; i < chunk_list_num_entries; i++)
-            if (mpi_rank == chunk_list[i].owners.new_owner)
-                if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
+        if (H5D__filtered_collective_chunk_list_io(chunk_list, chunk_list_num_entries, io_info, type_info, fm,
+                                                   mpi_rank) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entries")
 
         /* Gather the new chunk sizes to all processes for a collective reallocation
          * of the chunks in the file.
@@ -1416,14 +1466,9 @@ H5D__link_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_in
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGATHER, FAIL, "couldn't gather new chunk sizes")
 
         /* Collectively re-allocate the modified chunks (from each process) in the file */
-        for (i = 0; i < collective_chunk_list_num_entries; i++) {
-            hbool_t insert;
-
-            if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[i].chunk_states.chunk_current,
-                                      &collective_chunk_list[i].chunk_states.new_chunk, &insert,
-                                      collective_chunk_list[i].scaled) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
-        } /* end for */
+        if (H5D__mpio_collective_filtered_chunk_alloc(&index_info, collective_chunk_list,
+                                                      collective_chunk_list_num_entries) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
 
         if (NULL == (num_chunks_selected_array = (size_t *)H5MM_malloc((size_t)mpi_size * sizeof(size_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate num chunks selected array")
@@ -1833,9 +1878,9 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
     io_info->store = &store;
 
     if (io_info->op_type == H5D_IO_OP_READ) { /* Filtered collective read */
-        for (i = 0; i < chunk_list_num_entries; i++)
-            if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "couldn't process chunk entry")
+        if (H5D__filtered_collective_chunk_list_io(chunk_list, chunk_list_num_entries, io_info, type_info, fm,
+                                                   mpi_rank) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "couldn't process chunk entries")
     }      /* end if */
     else { /* Filtered collective write */
         H5D_chk_idx_info_t index_info;
@@ -1878,6 +1923,13 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
         if (NULL == (mem_type_is_derived_array = (hbool_t *)H5MM_calloc(max_num_chunks * sizeof(hbool_t))))
             HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate mem type is derived array")
 
+        /* Update and re-filter all the chunks owned by this process up front, so
+         * that the filter pipeline can process them together.
+         */
+        if (H5D__filtered_collective_chunk_list_io(chunk_list, chunk_list_num_entries, io_info, type_info, fm,
+                                                   mpi_rank) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entries")
+
         /* Iterate over the max number of chunks among all processes, as this process could
          * have no chunks left to work on, but it still needs to participate in the collective
          * re-allocation and re-insertion of chunks modified by other processes.
@@ -1887,10 +1939,6 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
             hbool_t have_chunk_to_process =
                 (i < chunk_list_num_entries) && (mpi_rank == chunk_list[i].owners.new_owner);
 
-            if (have_chunk_to_process)
-                if (H5D__filtered_collective_chunk_entry_io(&chunk_list[i], io_info, type_info, fm) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "couldn't process chunk entry")
-
             /* Gather the new chunk sizes to all processes for a collective re-allocation
              * of the chunks in the file
              */
@@ -1903,14 +1951,9 @@ H5D__multi_chunk_filtered_collective_io(H5D_io_info_t *io_info, const H5D_type_i
             /* Participate in the collective re-allocation of all chunks modified
              * in this iteration.
              */
-            for (j = 0; j < collective_chunk_list_num_entries; j++) {
-                hbool_t insert = FALSE;
-
-                if (H5D__chunk_file_alloc(&index_info, &collective_chunk_list[j].chunk_states.chunk_current,
-                                          &collective_chunk_list[j].chunk_states.new_chunk, &insert,
-                                          chunk_list[j].scaled) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
-            } /* end for */
+            if (H5D__mpio_collective_filtered_chunk_alloc(&index_info, collective_chunk_list,
+                                                          collective_chunk_list_num_entries) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
 
             if (NULL ==
                 (has_chunk_selected_array = (hbool_t *)H5MM_malloc((size_t)mpi_size * sizeof(hbool_t))))
@@ -3065,6 +3108,66 @@ done:
 } /* end H5D__chunk_redistribute_shared_chunks() */
 #endif
 
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_collective_filtered_chunk_alloc
+ *
+ * Purpose:     Collectively (re-)allocates file space for the filtered
+ *              chunks gathered from all processes. The space for every
+ *              chunk that needs a new location is obtained with a single
+ *              file space allocation and handed out in the order of the
+ *              gathered list, so the chunks written by each process end
+ *              up contiguous in the file and the following collective
+ *              write is made of a few large requests.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_collective_filtered_chunk_alloc(const H5D_chk_idx_info_t *        index_info,
+                                          H5D_filtered_collective_io_info_t *chunk_list, size_t num_entries)
+{
+    const H5F_block_t **old_chunks = NULL; /* Current chunk locations */
+    H5F_block_t **      new_chunks = NULL; /* New chunk locations */
+    const hsize_t **    scaled     = NULL; /* Scaled coordinates of the chunks */
+    size_t              i;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(index_info);
+    HDassert(chunk_list || 0 == num_entries);
+
+    if (0 == num_entries)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (old_chunks = (const H5F_block_t **)H5MM_malloc(num_entries * sizeof(H5F_block_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate old chunk array")
+    if (NULL == (new_chunks = (H5F_block_t **)H5MM_malloc(num_entries * sizeof(H5F_block_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate new chunk array")
+    if (NULL == (scaled = (const hsize_t **)H5MM_malloc(num_entries * sizeof(hsize_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate chunk coordinates array")
+
+    for (i = 0; i < num_entries; i++) {
+        old_chunks[i] = &chunk_list[i].chunk_states.chunk_current;
+        new_chunks[i] = &chunk_list[i].chunk_states.new_chunk;
+        scaled[i]     = chunk_list[i].scaled;
+    } /* end for */
+
+    if (H5D__chunk_file_alloc_batch(index_info, num_entries, old_chunks, new_chunks, scaled) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunks")
+
+done:
+    if (old_chunks)
+        H5MM_free(old_chunks);
+    if (new_chunks)
+        H5MM_free(new_chunks);
+    if (scaled)
+        H5MM_free(scaled);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_collective_filtered_chunk_alloc() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5D__mpio_filtered_collective_write_type
  *
@@ -3088,6 +3191,8 @@ H5D__mpio_filtered_collective_write_type(H5D_filtered_collective_io_info_t *chun
     MPI_Aint *write_buf_array   = NULL; /* Relative displacements of filtered chunk data buffers */
     MPI_Aint *file_offset_array = NULL; /* Chunk offsets in the file */
     int *     length_array      = NULL; /* Filtered Chunk lengths */
+    int *     file_length_array = NULL; /* Lengths of the contiguous blocks in the file */
+    size_t    num_file_blocks   = 0;    /* Number of contiguous blocks in the file */
     herr_t    ret_value         = SUCCEED;
 
     FUNC_ENTER_STATIC
@@ -3115,6 +3220,9 @@ H5D__mpio_filtered_collective_write_type(H5D_filtered_collective_io_info_t *chun
         if (NULL == (file_offset_array = (MPI_Aint *)H5MM_malloc((size_t)num_entries * sizeof(MPI_Aint))))
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                         "memory allocation failed for collective write offset array")
+        if (NULL == (file_length_array = (int *)H5MM_malloc((size_t)num_entries * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                        "memory allocation failed for collective write file length array")
 
         /* Ensure the list is sorted in ascending order of offset in the file */
         HDqsort(chunk_list, num_entries, sizeof(H5D_filtered_collective_io_info_t),
@@ -3122,12 +3230,29 @@ H5D__mpio_filtered_collective_write_type(H5D_filtered_collective_io_info_t *chun
 
         base_buf = chunk_list[0].buf;
         for (i = 0; i < num_entries; i++) {
-            /* Set up the offset in the file, the length of the chunk data, and the relative
-             * displacement of the chunk data write buffer
+            MPI_Aint chunk_offset = (MPI_Aint)chunk_list[i].chunk_states.new_chunk.offset;
+
+            /* Set up the length of the chunk data and the relative displacement
+             * of the chunk data write buffer
              */
-            file_offset_array[i] = (MPI_Aint)chunk_list[i].chunk_states.new_chunk.offset;
-            length_array[i]      = (int)chunk_list[i].chunk_states.new_chunk.length;
-            write_buf_array[i]   = (MPI_Aint)chunk_list[i].buf - (MPI_Aint)base_buf;
+            length_array[i]    = (int)chunk_list[i].chunk_states.new_chunk.length;
+            write_buf_array[i] = (MPI_Aint)chunk_list[i].buf - (MPI_Aint)base_buf;
+
+            /* Set up the offset in the file, merging chunks that are adjacent in
+             * the file into a single block so the write is issued as one
+             * contiguous request. The memory type keeps one block per chunk
+             * data buffer.
+             */
+            if (num_file_blocks > 0 &&
+                file_offset_array[num_file_blocks - 1] + file_length_array[num_file_blocks - 1] ==
+                    chunk_offset &&
+                file_length_array[num_file_blocks - 1] <= INT_MAX - length_array[i])
+                file_length_array[num_file_blocks - 1] += length_array[i];
+            else {
+                file_offset_array[num_file_blocks] = chunk_offset;
+                file_length_array[num_file_blocks] = length_array[i];
+                num_file_blocks++;
+            } /* end else */
         } /* end for */
 
         /* Create memory MPI type */
@@ -3139,7 +3264,7 @@ H5D__mpio_filtered_collective_write_type(H5D_filtered_collective_io_info_t *chun
             HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
 
         /* Create file MPI type */
-        if (MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed((int)num_entries, length_array,
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed((int)num_file_blocks, file_length_array,
                                                                 file_offset_array, MPI_BYTE, new_file_type)))
             HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
         *file_type_derived = TRUE;
@@ -3154,18 +3279,105 @@ done:
         H5MM_free(file_offset_array);
     if (length_array)
         H5MM_free(length_array);
+    if (file_length_array)
+        H5MM_free(file_length_array);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__mpio_filtered_collective_write_type() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__filtered_collective_chunk_entry_io
+ * Function:    H5D__filtered_collective_chunk_list_io
  *
- * Purpose:     Given an entry for a filtered chunk, performs the necessary
- *              steps for updating the chunk data during a collective
- *              write, or for reading the chunk from file during a
+ * Purpose:     Performs the necessary steps for updating the chunk data
+ *              of the entries owned by this process during a collective
+ *              write, or for reading all the entries from file during a
  *              collective read.
  *
+ *              The chunks are first all read from the file, then
+ *              unfiltered, then updated with the modifications from this
+ *              and the other processes (or scattered to the application
+ *              buffer when reading), and finally re-filtered when
+ *              writing. Only the filtering steps may be run on several
+ *              threads; see H5D__mpio_filter_chunks().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_chunk_list_io(H5D_filtered_collective_io_info_t *chunk_list, size_t num_entries,
+                                       const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                       const H5D_chunk_map_t *fm, int mpi_rank)
+{
+    H5D_filtered_collective_io_info_t **entries      = NULL; /* Entries processed by this process */
+    H5D_filtered_collective_io_info_t **read_entries = NULL; /* Entries read from the file */
+    size_t                              num_processed = 0;
+    size_t                              num_read      = 0;
+    size_t                              i;
+    herr_t                              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(chunk_list || 0 == num_entries);
+    HDassert(io_info);
+    HDassert(type_info);
+    HDassert(fm);
+
+    if (0 == num_entries)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (entries = (H5D_filtered_collective_io_info_t **)H5MM_malloc(
+                     num_entries * sizeof(H5D_filtered_collective_io_info_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate chunk entry array")
+    if (NULL == (read_entries = (H5D_filtered_collective_io_info_t **)H5MM_malloc(
+                     num_entries * sizeof(H5D_filtered_collective_io_info_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate chunk entry array")
+
+    /* Read the chunks from the file */
+    for (i = 0; i < num_entries; i++)
+        if (io_info->op_type == H5D_IO_OP_READ || mpi_rank == chunk_list[i].owners.new_owner) {
+            hbool_t was_read = FALSE;
+
+            if (H5D__filtered_collective_chunk_entry_read(&chunk_list[i], io_info, type_info, fm, &was_read) <
+                0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "couldn't read chunk entry")
+
+            entries[num_processed++] = &chunk_list[i];
+            if (was_read)
+                read_entries[num_read++] = &chunk_list[i];
+        } /* end if */
+
+    /* Unfilter the chunks that were read */
+    if (H5D__mpio_filter_chunks(read_entries, num_read, io_info, H5Z_FLAG_REVERSE) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't unfilter chunk for modifying")
+
+    /* Update the chunks, or scatter them to the read buffer */
+    for (i = 0; i < num_processed; i++)
+        if (H5D__filtered_collective_chunk_entry_update(entries[i], io_info, type_info, fm) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTUPDATE, FAIL, "couldn't process chunk entry")
+
+    /* Filter the updated chunks */
+    if (io_info->op_type == H5D_IO_OP_WRITE)
+        if (H5D__mpio_filter_chunks(entries, num_processed, io_info, 0) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
+
+done:
+    if (read_entries)
+        H5MM_free(read_entries);
+    if (entries)
+        H5MM_free(entries);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_chunk_list_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_chunk_entry_read
+ *
+ * Purpose:     Given an entry for a filtered chunk, allocates the chunk
+ *              data buffer and reads the chunk from the file, unless the
+ *              chunk is being fully overwritten. The chunk is left
+ *              filtered; WAS_READ tells whether it was read.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  Jordan Henderson
@@ -3174,29 +3386,14 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk_entry,
-                                        const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-                                        const H5D_chunk_map_t *fm)
+H5D__filtered_collective_chunk_entry_read(H5D_filtered_collective_io_info_t *chunk_entry,
+                                          const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                          const H5D_chunk_map_t *fm, hbool_t *was_read)
 {
     H5D_chunk_info_t *chunk_info = NULL;
-    H5S_sel_iter_t *  mem_iter   = NULL; /* Memory iterator for H5D__scatter_mem/H5D__gather_mem */
-    H5S_sel_iter_t *  file_iter  = NULL;
-    H5Z_EDC_t         err_detect; /* Error detection info */
-    H5Z_cb_t          filter_cb;  /* I/O filter callback function */
-    unsigned          filter_mask = 0;
-    hsize_t           iter_nelmts; /* Number of points to iterate over for the chunk IO operation */
     hssize_t          extent_npoints;
     hsize_t           true_chunk_size;
-    hbool_t           mem_iter_init  = FALSE;
-    hbool_t           file_iter_init = FALSE;
-    size_t            buf_size;
-    size_t            i;
-    H5S_t *           dataspace    = NULL; /* Other process' dataspace for the chunk */
-    void *            tmp_gath_buf = NULL; /* Temporary gather buffer to gather into from application buffer
-                                              before scattering out to the chunk data buffer (when writing data),
-                                              or vice versa (when reading data) */
-    int    mpi_code;
-    herr_t ret_value = SUCCEED;
+    herr_t            ret_value = SUCCEED;
 
     FUNC_ENTER_STATIC
 
@@ -3204,12 +3401,7 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     HDassert(io_info);
     HDassert(type_info);
     HDassert(fm);
-
-    /* Retrieve filter settings from API context */
-    if (H5CX_get_err_detect(&err_detect) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
-    if (H5CX_get_filter_cb(&filter_cb) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+    HDassert(was_read);
 
     /* Look up the chunk and get its file and memory dataspaces */
     if (NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_entry->index)))
@@ -3224,9 +3416,9 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
      * whole filtered chunk. Otherwise, allocate a buffer equal to the size of the
      * chunk so that the unfiltering operation doesn't have to grow the buffer.
      */
-    buf_size = MAX(chunk_entry->chunk_states.chunk_current.length, true_chunk_size);
+    chunk_entry->buf_size = MAX(chunk_entry->chunk_states.chunk_current.length, true_chunk_size);
 
-    if (NULL == (chunk_entry->buf = H5MM_malloc(buf_size)))
+    if (NULL == (chunk_entry->buf = H5MM_malloc(chunk_entry->buf_size)))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate chunk data buffer")
 
     /* If this is not a full chunk overwrite or this is a read operation, the chunk must be
@@ -3258,15 +3450,63 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
         if (H5CX_set_io_xfer_mode(xfer_mode) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set MPI-I/O transfer mode")
 
-        if (H5Z_pipeline(&io_info->dset->shared->dcpl_cache.pline, H5Z_FLAG_REVERSE, &filter_mask, err_detect,
-                         filter_cb, (size_t *)&chunk_entry->chunk_states.new_chunk.length, &buf_size,
-                         &chunk_entry->buf) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, FAIL, "couldn't unfilter chunk for modifying")
+        *was_read = TRUE;
     } /* end if */
     else {
         chunk_entry->chunk_states.new_chunk.length = true_chunk_size;
+        *was_read                                  = FALSE;
     } /* end else */
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__filtered_collective_chunk_entry_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__filtered_collective_chunk_entry_update
+ *
+ * Purpose:     Given an entry for an unfiltered chunk, updates the chunk
+ *              data with the modifications from the current process and
+ *              from the other processes during a collective write, or
+ *              scatters the chunk data to the application buffer during
+ *              a collective read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Jordan Henderson
+ *              Wednesday, January 18, 2017
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__filtered_collective_chunk_entry_update(H5D_filtered_collective_io_info_t *chunk_entry,
+                                            const H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+                                            const H5D_chunk_map_t *fm)
+{
+    H5D_chunk_info_t *chunk_info = NULL;
+    H5S_sel_iter_t *  mem_iter   = NULL; /* Memory iterator for H5D__scatter_mem/H5D__gather_mem */
+    H5S_sel_iter_t *  file_iter  = NULL;
+    hsize_t           iter_nelmts; /* Number of points to iterate over for the chunk IO operation */
+    hbool_t           mem_iter_init  = FALSE;
+    hbool_t           file_iter_init = FALSE;
+    size_t            i;
+    H5S_t *           dataspace    = NULL; /* Other process' dataspace for the chunk */
+    void *            tmp_gath_buf = NULL; /* Temporary gather buffer to gather into from application buffer
+                                              before scattering out to the chunk data buffer (when writing
+                                              data), or vice versa (when reading data) */
+    int    mpi_code;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(chunk_entry);
+    HDassert(io_info);
+    HDassert(type_info);
+    HDassert(fm);
+
+    /* Look up the chunk and get its file and memory dataspaces */
+    if (NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_entry->index)))
+        HGOTO_ERROR(H5E_DATASPACE, H5E_NOTFOUND, FAIL, "can't locate chunk in skip list")
+
     /* Initialize iterator for memory selection */
     if (NULL == (mem_iter = (H5S_sel_iter_t *)H5MM_malloc(sizeof(H5S_sel_iter_t))))
         HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "couldn't allocate memory iterator")
@@ -3278,8 +3518,7 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
     /* If this is a read operation, scatter the read chunk data to the user's buffer.
      *
      * If this is a write operation, update the chunk data buffer with the modifications
-     * from the current process, then apply any modifications from other processes. Finally,
-     * filter the newly-updated chunk.
+     * from the current process, then apply any modifications from other processes.
      */
     switch (io_info->op_type) {
         case H5D_IO_OP_READ:
@@ -3376,17 +3615,6 @@ H5D__filtered_collective_chunk_entry_io(H5D_filtered_collective_io_info_t *chunk
                 H5MM_free(chunk_entry->async_info.receive_buffer_array[i]);
             } /* end for */
 
-            /* Filter the chunk */
-            if (H5Z_pipeline(&io_info->dset->shared->dcpl_cache.pline, 0, &filter_mask, err_detect, filter_cb,
-                             (size_t *)&chunk_entry->chunk_states.new_chunk.length, &buf_size,
-                             &chunk_entry->buf) < 0)
-                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
-
-#if H5_SIZEOF_SIZE_T > 4
-            /* Check for the chunk expanding too much to encode in a 32-bit value */
-            if (chunk_entry->chunk_states.new_chunk.length > ((size_t)0xffffffff))
-                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
-#endif
             break;
 
         default:
@@ -3413,5 +3641,226 @@ done:
             HDONE_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "can't close dataspace")
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__filtered_collective_chunk_entry_io() */
+} /* end H5D__filtered_collective_chunk_entry_update() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_filter_chunks
+ *
+ * Purpose:     Runs the filter pipeline of the dataset over a list of
+ *              chunk entries, in the direction given by FLAGS.
+ *
+ *              When the file access property list asked for more than one
+ *              filter thread (H5Pset_coll_filter_threads), the chunks are
+ *              spread over that many threads, the calling thread being
+ *              one of them. The threads only run the pipeline; all I/O
+ *              and MPI communication stays on the calling thread.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_filter_chunks(H5D_filtered_collective_io_info_t **entries, size_t num_entries,
+                        const H5D_io_info_t *io_info, unsigned flags)
+{
+    H5D_mpio_filter_work_t work;                /* Work shared by the filter threads */
+    size_t                 nthreads;            /* # of threads to filter with */
+    size_t                 i;                   /* Local index variable */
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(entries || 0 == num_entries);
+    HDassert(io_info);
+
+    if (0 == num_entries)
+        HGOTO_DONE(SUCCEED)
+
+    /* Retrieve filter settings from API context */
+    if (H5CX_get_err_detect(&work.err_detect) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get error detection info")
+    if (H5CX_get_filter_cb(&work.filter_cb) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get I/O filter callback function")
+    work.entries     = entries;
+    work.num_entries = num_entries;
+    work.pline       = &io_info->dset->shared->dcpl_cache.pline;
+    work.flags       = flags;
+    work.next        = 0;
+    work.failed      = FALSE;
+    work.filter_mask = 0;
+
+    nthreads = MIN(H5F_coll_filter_threads(io_info->dset->oloc.file), num_entries);
+
+#ifdef H5D_MPIO_FILTER_THREADS
+    /* The threads call the filter callbacks directly, so look up the class
+     * of every filter before starting them, which may load plugins. If a
+     * filter is missing, or the application set a filter callback, the
+     * pipeline is run on this thread instead.
+     */
+    if (work.filter_cb.func)
+        nthreads = 1;
+    for (i = 0; nthreads > 1 && i < work.pline->nused; i++)
+        if (H5Z_filter_avail(work.pline->filter[i].id) <= 0)
+            nthreads = 1;
+    /* Registering a plugin may move the filter table, so look up the
+     * classes only once all the filters are available
+     */
+    for (i = 0; nthreads > 1 && i < work.pline->nused; i++)
+        if (NULL == (work.fclass[i] = H5Z_find(work.pline->filter[i].id)))
+            HGOTO_ERROR(H5E_PLINE, H5E_NOTFOUND, FAIL, "required filter is not registered")
+
+    if (nthreads > 1) {
+        pthread_t *threads  = NULL; /* The threads started */
+        size_t     nstarted = 0;    /* # of threads started */
+
+        if (NULL == (threads = (pthread_t *)H5MM_malloc((nthreads - 1) * sizeof(pthread_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "couldn't allocate filter threads")
+        if (pthread_mutex_init(&work.mutex, NULL) != 0) {
+            H5MM_free(threads);
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize mutex")
+        } /* end if */
+
+        /* The filters may push errors on any of the threads, which the
+         * error stacks don't allow, so discard them until the threads are
+         * done and report a single error for a failed chunk
+         */
+        H5E_pause_push(TRUE);
+
+        /* Start the threads; if fewer can be started, use the ones which were */
+        for (nstarted = 0; nstarted < nthreads - 1; nstarted++)
+            if (pthread_create(&threads[nstarted], NULL, H5D__mpio_filter_worker, &work) != 0)
+                break;
+
+        /* The calling thread filters chunks too */
+        H5D__mpio_filter_worker(&work);
+
+        for (i = 0; i < nstarted; i++)
+            pthread_join(threads[i], NULL);
+        pthread_mutex_destroy(&work.mutex);
+        H5MM_free(threads);
+
+        H5E_pause_push(FALSE);
+        if (work.failed)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "filter pipeline failed on a chunk")
+    } /* end if */
+    else
+#endif /* H5D_MPIO_FILTER_THREADS */
+        for (i = 0; i < num_entries; i++) {
+            H5D_filtered_collective_io_info_t *chunk_entry = entries[i];
+            unsigned                           filter_mask = 0;
+
+            if (H5Z_pipeline(work.pline, flags, &filter_mask, work.err_detect, work.filter_cb,
+                             (size_t *)&chunk_entry->chunk_states.new_chunk.length,
+                             &chunk_entry->buf_size, &chunk_entry->buf) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "filter pipeline failed on a chunk")
+        } /* end for */
+
+#if H5_SIZEOF_SIZE_T > 4
+    /* Check for the chunks expanding too much to encode in a 32-bit value */
+    if (!(flags & H5Z_FLAG_REVERSE))
+        for (i = 0; i < num_entries; i++)
+            if (entries[i]->chunk_states.new_chunk.length > ((size_t)0xffffffff))
+                HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "chunk too large for 32-bit length")
+#endif
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__mpio_filter_chunks() */
+
+#ifdef H5D_MPIO_FILTER_THREADS
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_filter_worker
+ *
+ * Purpose:     The body of a filter thread: runs the filter pipeline on
+ *              the next chunk of the list until all the chunks have been
+ *              filtered or the pipeline failed on one of them.
+ *
+ *              This runs outside of the library's API lock, so it must
+ *              not use the function enter/leave macros or touch the error
+ *              stack, and the errors pushed by the filters are discarded
+ *              (see H5E_pause_push); failures and skipped optional filters
+ *              are recorded in WORK for the calling thread to report.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__mpio_filter_worker(void *_work)
+{
+    H5D_mpio_filter_work_t *work = (H5D_mpio_filter_work_t *)_work;
+
+    for (;;) {
+        H5D_filtered_collective_io_info_t *chunk_entry;
+        unsigned                           filter_mask = 0;
+        herr_t                             status;
+
+        pthread_mutex_lock(&work->mutex);
+        if (work->failed || work->next == work->num_entries) {
+            pthread_mutex_unlock(&work->mutex);
+            break;
+        } /* end if */
+        chunk_entry = work->entries[work->next++];
+        pthread_mutex_unlock(&work->mutex);
+
+        status = H5D__mpio_filter_chunk(work, chunk_entry, &filter_mask);
+
+        if (status < 0 || filter_mask) {
+            pthread_mutex_lock(&work->mutex);
+            if (status < 0)
+                work->failed = TRUE;
+            work->filter_mask |= filter_mask;
+            pthread_mutex_unlock(&work->mutex);
+        } /* end if */
+    }     /* end for */
+
+    return NULL;
+} /* end H5D__mpio_filter_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__mpio_filter_chunk
+ *
+ * Purpose:     Runs the filter pipeline of WORK on one chunk on a filter
+ *              thread, calling the filter callbacks looked up beforehand.
+ *              This follows H5Z_pipeline without a filter callback
+ *              function, but leaves the error stack alone. The optional
+ *              filters which failed are returned in FILTER_MASK.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__mpio_filter_chunk(const H5D_mpio_filter_work_t *work, H5D_filtered_collective_io_info_t *chunk_entry,
+                       unsigned *filter_mask)
+{
+    const H5O_pline_t *pline  = work->pline;
+    size_t *           nbytes = (size_t *)&chunk_entry->chunk_states.new_chunk.length;
+    size_t             new_nbytes;
+    unsigned           flags;
+    size_t             i, idx;
+
+    for (i = 0; i < pline->nused; i++) {
+        idx = (work->flags & H5Z_FLAG_REVERSE) ? pline->nused - i - 1 : i;
+
+        flags = work->flags | pline->filter[idx].flags;
+        if ((work->flags & H5Z_FLAG_REVERSE) && work->err_detect == H5Z_DISABLE_EDC)
+            flags |= H5Z_FLAG_SKIP_EDC;
+
+        new_nbytes = (work->fclass[idx]->filter)(flags, pline->filter[idx].cd_nelmts,
+                                                 pline->filter[idx].cd_values, *nbytes,
+                                                 &chunk_entry->buf_size, &chunk_entry->buf);
+        if (0 == new_nbytes) {
+            /* Only optional filters may fail, and only when writing */
+            if ((work->flags & H5Z_FLAG_REVERSE) || 0 == (pline->filter[idx].flags & H5Z_FLAG_OPTIONAL))
+                return FAIL;
+            *filter_mask |= (unsigned)1 << idx;
+        } /* end if */
+        else
+            *nbytes = new_nbytes;
+    } /* end for */
+
+    return SUCCEED;
+} /* end H5D__mpio_filter_chunk() */
+#endif /* H5D_MPIO_FILTER_THREADS */
 #endif /* H5_HAVE_PARALLEL */
@@ -44,6 +44,10 @@
 /* Set the minimum object header size to create objects with */
 #define H5D_MINHDR_SIZE 256
 
+/* Upper bound on the metadata space reserved up front for new object headers
+ * by H5Dcreate_multi() */
+#define H5D_MULTI_CREATE_MAX_HDR_RESERVE (16 * 1024 * 1024)
+
 /* [Simple] Macro to construct a H5D_io_info_t from it's components */
 #define H5D_BUILD_IO_INFO_WRT(io_info, ds, str, buf)                                                         \
     (io_info)->dset    = ds;                                                                                 \
@@ -438,6 +442,27 @@ typedef struct H5D_rdcdc_t {
  * created once for a given dataset.  Thus, if a dataset is opened twice,
  * there will be two IDs and two H5D_t structs, both sharing one H5D_shared_t.
  */
+/* Value statistics of one chunk (see H5Dstats.c) */
+typedef struct H5D_cstats_ent_t {
+    hsize_t key;       /* Linear position of the chunk in the statistics grid */
+    hsize_t count;     /* Number of elements summarized */
+    hsize_t nan_count; /* Number of NaN elements */
+    double  min;       /* Smallest non-NaN value */
+    double  max;       /* Largest non-NaN value */
+} H5D_cstats_ent_t;
+
+/* Per-chunk value statistics of a dataset */
+typedef struct H5D_cstats_t {
+    H5SL_t *     entries;                /* Skip list of H5D_cstats_ent_t's, keyed by 'key' */
+    hsize_t      stride[H5S_MAX_RANK];   /* Multiplier of each scaled coordinate in a chunk's key */
+    unsigned     order[H5S_MAX_RANK];    /* Dimensions, in order of decreasing stride */
+    H5T_path_t * tpath;                  /* Conversion path from the dataset's datatype to double */
+    size_t       type_size;              /* Size of the dataset's datatype */
+    uint8_t *    conv_buf;               /* Buffer for converting a strip of a chunk to double */
+    hbool_t      dirty;                  /* Whether the entries differ from the stored block */
+    H5O_cstats_t mesg;                   /* Location of the stored block */
+} H5D_cstats_t;
+
 struct H5D_shared_t {
     size_t           fo_count;        /* Reference count */
     hbool_t          closing;         /* Flag to indicate dataset is closing */
@@ -469,6 +494,7 @@ struct H5D_shared_t {
     H5D_append_flush_t append_flush;   /* Append flush property information */
     char *             extfile_prefix; /* expanded external file prefix */
     char *             vds_prefix;     /* expanded vds prefix */
+    H5D_cstats_t *     cstats;         /* Per-chunk value statistics, if maintained */
 };
 
 struct H5D_t {
@@ -640,8 +666,12 @@ H5_DLL herr_t  H5D__chunk_prune_by_extent(H5D_t *dset, const hsize_t *old_dim);
 H5_DLL herr_t  H5D__chunk_set_sizes(H5D_t *dset);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
+H5_DLL herr_t H5D__chunk_file_alloc_batch(const H5D_chk_idx_info_t *idx_info, size_t nchunks,
+                                          const H5F_block_t *old_chunks[], H5F_block_t *new_chunks[],
+                                          const hsize_t *scaled[]);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset);
+H5_DLL herr_t H5D__chunk_cache_clear(const H5D_t *dset);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src, H5O_layout_chunk_t *layout_src,
                               H5F_t *f_dst, H5O_storage_chunk_t *storage_dst,
                               const H5S_extent_t *ds_extent_src, const H5T_t *dt_src,
@@ -657,6 +687,18 @@ H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hsize_t *offset, uint32_
 H5_DLL herr_t H5D__chunk_stats(const H5D_t *dset, hbool_t headers);
 #endif /* H5D_CHUNK_DEBUG */
 
+/* Functions that maintain per-chunk value statistics */
+H5_DLL herr_t H5D__cstats_create(H5F_t *f, H5O_t *oh, H5D_t *dset);
+H5_DLL herr_t H5D__cstats_open(H5D_t *dset);
+H5_DLL herr_t H5D__cstats_update(const H5D_t *dset, const hsize_t *scaled, const void *chunk);
+H5_DLL herr_t H5D__cstats_invalidate(const H5D_t *dset, const hsize_t *scaled);
+H5_DLL herr_t H5D__cstats_prune(const H5D_t *dset);
+H5_DLL herr_t H5D__cstats_flush(H5D_t *dset);
+H5_DLL herr_t H5D__cstats_dest(H5D_t *dset);
+H5_DLL herr_t H5D__cstats_get(H5D_t *dset, const hsize_t *offset, H5D_chunk_stats_t *stats);
+H5_DLL herr_t H5D__cstats_query(H5D_t *dset, double min, double max, size_t max_chunks, hsize_t *offsets,
+                                hsize_t *nchunks);
+
 /* format convert */
 H5_DLL herr_t H5D__chunk_format_convert(H5D_t *dset, H5D_chk_idx_info_t *idx_info,
                                         H5D_chk_idx_info_t *new_idx_info);
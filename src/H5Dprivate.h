@@ -45,6 +45,7 @@
 #define H5D_CRT_ALLOC_TIME_STATE_NAME  "alloc_time_state" /* Space allocation time state */
 #define H5D_CRT_EXT_FILE_LIST_NAME     "efl"              /* External file list */
 #define H5D_CRT_MIN_DSET_HDR_SIZE_NAME "dset_oh_minimize" /* Minimize object header */
+#define H5D_CRT_CHUNK_STATS_NAME       "chunk_stats"      /* Maintain per-chunk value statistics */
 
 /* ========  Dataset access property names ======== */
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME "rdcc_nslots"          /* Size of raw data chunk cache(slots) */
@@ -129,9 +130,10 @@ typedef struct H5D_t H5D_t;
 
 /* Typedef for cached dataset creation property list information */
 typedef struct H5D_dcpl_cache_t {
-    H5O_fill_t  fill;  /* Fill value info (H5D_CRT_FILL_VALUE_NAME) */
-    H5O_pline_t pline; /* I/O pipeline info (H5O_CRT_PIPELINE_NAME) */
-    H5O_efl_t   efl;   /* External file list info (H5D_CRT_EXT_FILE_LIST_NAME) */
+    H5O_fill_t  fill;        /* Fill value info (H5D_CRT_FILL_VALUE_NAME) */
+    H5O_pline_t pline;       /* I/O pipeline info (H5O_CRT_PIPELINE_NAME) */
+    H5O_efl_t   efl;         /* External file list info (H5D_CRT_EXT_FILE_LIST_NAME) */
+    hbool_t     chunk_stats; /* Per-chunk value statistics (H5D_CRT_CHUNK_STATS_NAME) */
 } H5D_dcpl_cache_t;
 
 /* Callback information for copying datasets */
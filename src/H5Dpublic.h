@@ -105,6 +105,18 @@ typedef enum H5D_vds_view_t {
 /* Callback for H5Pset_append_flush() in a dataset access property list */
 typedef herr_t (*H5D_append_cb_t)(hid_t dataset_id, hsize_t *cur_dims, void *op_data);
 
+/**
+ * Value statistics of a single chunk, as kept for datasets created with
+ * H5Pset_chunk_stats() and returned by H5Dget_chunk_stats()
+ */
+typedef struct H5D_chunk_stats_t {
+    hbool_t known;     /**< Whether statistics are known for the chunk */
+    double  min;       /**< Smallest value in the chunk, NaN values excepted */
+    double  max;       /**< Largest value in the chunk, NaN values excepted */
+    hsize_t count;     /**< Number of elements summarized */
+    hsize_t nan_count; /**< Number of NaN elements (floating-point datatypes only) */
+} H5D_chunk_stats_t;
+
 /** Define the operator function pointer for H5Diterate() */
 //! [H5D_operator_t_snip]
 typedef herr_t (*H5D_operator_t)(void *elem, hid_t type_id, unsigned ndim, const hsize_t *point,
@@ -228,6 +240,54 @@ H5_DLL hid_t H5Dcreate_async(const char *app_file, const char *app_func, unsigne
                              const char *name, hid_t type_id, hid_t space_id, hid_t lcpl_id, hid_t dcpl_id,
                              hid_t dapl_id, hid_t es_id);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Creates several new datasets and links them into the file
+ *
+ * \fgdta_loc_id
+ * \param[in] count     Number of datasets to create
+ * \param[in] names     Names of the datasets to create
+ * \param[in] type_ids  Datatype identifiers, one per dataset
+ * \param[in] space_ids Dataspace identifiers, one per dataset
+ * \lcpl_id
+ * \param[in] dcpl_ids  Dataset creation property list identifiers, one per
+ *                      dataset, or NULL to use #H5P_DEFAULT for all of them
+ * \dapl_id
+ * \param[out] dset_ids Identifiers of the new datasets
+ *
+ * \return \herr_t
+ *
+ * \details H5Dcreate_multi() creates \p count datasets at the location
+ *          specified by \p loc_id, as if H5Dcreate2() were called once for
+ *          each element of \p names, \p type_ids, \p space_ids and
+ *          \p dcpl_ids.  The link creation property list \p lcpl_id and the
+ *          dataset access property list \p dapl_id are shared by all of
+ *          the new datasets.  The identifiers of the opened datasets are
+ *          returned in \p dset_ids, which must have room for \p count
+ *          elements.
+ *
+ *          Creating many small datasets this way is faster than calling
+ *          H5Dcreate2() repeatedly: the native VOL connector prepares the
+ *          link storage of the group at \p loc_id for all of the new links
+ *          before any of them is inserted, and allocates the new object
+ *          headers from one contiguous block of file space.
+ *
+ *          If the creation of any dataset fails, the identifiers of the
+ *          datasets already created are closed and every element of
+ *          \p dset_ids is set to #H5I_INVALID_HID.  The datasets created
+ *          before the failure remain in the file.
+ *
+ * \since 1.13.0
+ *
+ * \see H5Dcreate2(), H5Dclose()
+ *
+ */
+H5_DLL herr_t H5Dcreate_multi(hid_t loc_id, size_t count, const char *names[], const hid_t type_ids[],
+                              const hid_t space_ids[], hid_t lcpl_id, const hid_t dcpl_ids[], hid_t dapl_id,
+                              hid_t dset_ids[] /*out*/);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
@@ -627,6 +687,71 @@ H5_DLL herr_t H5Dget_num_chunks(hid_t dset_id, hid_t fspace_id, hsize_t *nchunks
 H5_DLL herr_t H5Dget_chunk_info_by_coord(hid_t dset_id, const hsize_t *offset, unsigned *filter_mask,
                                          haddr_t *addr, hsize_t *size);
 
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Retrieves the value statistics of a chunk
+ *
+ * \dset_id
+ * \param[in]  offset Logical position of the chunk’s first element
+ * \param[out] stats  Statistics of the chunk
+ *
+ * \return \herr_t
+ *
+ * \details H5Dget_chunk_stats() retrieves the minimum, maximum, element
+ *          count and NaN count of the chunk at \p offset in a dataset
+ *          created with H5Pset_chunk_stats().  Statistics reflect the
+ *          chunk as last flushed from the chunk cache, which the call
+ *          flushes first.  If no statistics are known for the chunk, for
+ *          example because it has never been written, \p stats->known is
+ *          set to FALSE and the other fields are not meaningful.  If all
+ *          the elements of the chunk are NaN, \p stats->min is greater
+ *          than \p stats->max.
+ *
+ *          \p offset is a pointer to a one-dimensional array with a size
+ *          equal to the dataset’s rank. Each element is the logical
+ *          position of the chunk’s first element in a dimension.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Dget_chunk_stats(hid_t dset_id, const hsize_t *offset, H5D_chunk_stats_t *stats);
+
+/**
+ * --------------------------------------------------------------------------
+ * \ingroup H5D
+ *
+ * \brief Lists the chunks that may hold values in a range
+ *
+ * \dset_id
+ * \param[in]  min        Lower bound of the range
+ * \param[in]  max        Upper bound of the range
+ * \param[in]  max_chunks Number of chunks \p offsets has room for
+ * \param[out] offsets    Logical positions of the chunks’ first elements
+ * \param[out] nchunks    Number of chunks that may hold values in the range
+ *
+ * \return \herr_t
+ *
+ * \details H5Dget_chunks_in_range() uses the per-chunk statistics of a
+ *          dataset created with H5Pset_chunk_stats() to find the chunks
+ *          within the dataset's current extent that may hold a value \c v
+ *          with \p min <= \c v <= \p max.  A chunk is listed when the
+ *          interval between its minimum and maximum intersects the range,
+ *          or when no statistics are known for it.  Chunks are listed in
+ *          row-major order of their positions.
+ *
+ *          The total number of chunks found is returned in \p nchunks.
+ *          The offsets of the first \p max_chunks of them are stored in
+ *          \p offsets, one rank-sized group of coordinates per chunk.
+ *          \p offsets may be NULL to only count the chunks.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Dget_chunks_in_range(hid_t dset_id, double min, double max, size_t max_chunks,
+                                     hsize_t *offsets, hsize_t *nchunks);
+
 /**
  * --------------------------------------------------------------------------
  * \ingroup H5D
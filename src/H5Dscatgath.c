@@ -731,6 +731,12 @@ done:
  *              The optimization is simply moving data to the appropriate
  *              places in the buffer.
  *
+ *              When the common members are in a different order or at
+ *              different offsets (H5T_SUBSET_PROJECT), only the bytes
+ *              of the common members are copied, one run of adjacent
+ *              members at a time.  This is the usual case when reading
+ *              a few fields of a wide table.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Raymond Lu
@@ -742,14 +748,16 @@ static herr_t
 H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_t *type_info,
                        void *user_buf /*out*/)
 {
-    uint8_t *ubuf = (uint8_t *)user_buf; /* Cast for pointer arithmetic	*/
-    uint8_t *xdbuf;                      /* Pointer into dataset buffer */
-    hsize_t *off = NULL;                 /* Pointer to sequence offsets */
-    size_t * len = NULL;                 /* Pointer to sequence lengths */
-    size_t   src_stride, dst_stride, copy_size;
-    size_t   dxpl_vec_size;       /* Vector length from API context's DXPL */
-    size_t   vec_size;            /* Vector length */
-    herr_t   ret_value = SUCCEED; /* Return value		*/
+    uint8_t *               ubuf = (uint8_t *)user_buf; /* Cast for pointer arithmetic	*/
+    uint8_t *               xdbuf;                      /* Pointer into dataset buffer */
+    hsize_t *               off = NULL;                 /* Pointer to sequence offsets */
+    size_t *                len = NULL;                 /* Pointer to sequence lengths */
+    size_t                  src_stride, dst_stride, copy_size;
+    const H5T_subset_run_t *runs;                /* Runs of members to copy, for projections */
+    size_t                  nruns;               /* Number of runs */
+    size_t                  dxpl_vec_size;       /* Vector length from API context's DXPL */
+    size_t                  vec_size;            /* Vector length */
+    herr_t                  ret_value = SUCCEED; /* Return value		*/
 
     FUNC_ENTER_STATIC
 
@@ -759,7 +767,8 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
     HDassert(type_info);
     HDassert(type_info->cmpd_subset);
     HDassert(H5T_SUBSET_SRC == type_info->cmpd_subset->subset ||
-             H5T_SUBSET_DST == type_info->cmpd_subset->subset);
+             H5T_SUBSET_DST == type_info->cmpd_subset->subset ||
+             H5T_SUBSET_PROJECT == type_info->cmpd_subset->subset);
     HDassert(user_buf);
 
     /* Get info from API context */
@@ -780,8 +789,10 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
     src_stride = type_info->src_type_size;
     dst_stride = type_info->dst_type_size;
 
-    /* Get the size, in bytes, to copy for each element */
+    /* Get the size, in bytes, to copy for each element, or the runs to copy */
     copy_size = type_info->cmpd_subset->copy_size;
+    runs      = type_info->cmpd_subset->runs;
+    nruns     = type_info->cmpd_subset->nruns;
 
     /* Loop until all elements are written */
     xdbuf = type_info->tconv_buf;
@@ -812,13 +823,25 @@ H5D__compound_opt_read(size_t nelmts, H5S_sel_iter_t *iter, const H5D_type_info_
             xubuf       = ubuf + curr_off;
 
             /* Copy the data into the right place. */
-            for (i = 0; i < curr_nelmts; i++) {
-                HDmemmove(xubuf, xdbuf, copy_size);
-
-                /* Update pointers */
-                xdbuf += src_stride;
-                xubuf += dst_stride;
-            } /* end for */
+            if (H5T_SUBSET_PROJECT == type_info->cmpd_subset->subset)
+                for (i = 0; i < curr_nelmts; i++) {
+                    size_t r; /* Local index variable */
+
+                    for (r = 0; r < nruns; r++)
+                        HDmemcpy(xubuf + runs[r].dst_offset, xdbuf + runs[r].src_offset, runs[r].size);
+
+                    /* Update pointers */
+                    xdbuf += src_stride;
+                    xubuf += dst_stride;
+                } /* end for */
+            else
+                for (i = 0; i < curr_nelmts; i++) {
+                    HDmemmove(xubuf, xdbuf, copy_size);
+
+                    /* Update pointers */
+                    xdbuf += src_stride;
+                    xubuf += dst_stride;
+                } /* end for */
         }     /* end for */
 
         /* Decrement number of elements left to process */
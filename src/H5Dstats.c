@@ -0,0 +1,918 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	Per-chunk value statistics for chunked datasets.
+ *
+ *		When a dataset is created with H5Pset_chunk_stats(), the
+ *		minimum, maximum and NaN count of every chunk are computed
+ *		from the unfiltered chunk as it is flushed from the chunk
+ *		cache (H5D__chunk_flush_entry) and kept in a skip list.  The
+ *		list is written to a single block in the file when the dataset
+ *		is flushed, and a "chunk statistics" object header message
+ *		records the block's location.
+ *
+ *		A chunk is identified by its linear position in a grid that
+ *		covers the maximum dimensions of the dataset.  The unlimited
+ *		dimension, if there is one, is the slowest changing one, so
+ *		the positions stay valid as the dataset is extended.
+ *
+ *		The block has this layout, all values little-endian:
+ *
+ *		    "CSTB" signature (4 bytes)
+ *		    version (1 byte), rank (1 byte), reserved (2 bytes)
+ *		    number of entries (8 bytes)
+ *		    for each entry: key, count, NaN count (8 bytes each),
+ *		                    min, max (IEEE doubles, 8 bytes each)
+ *		    checksum (4 bytes)
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Dmodule.h" /* This source code file is part of the H5D module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Dpkg.h"      /* Datasets                                 */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5FDprivate.h" /* File drivers                             */
+#include "H5FLprivate.h" /* Free Lists                               */
+#include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MFprivate.h" /* File space management                    */
+#include "H5Oprivate.h"  /* Object headers                           */
+#include "H5VMprivate.h" /* Vector functions                         */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Statistics block signature and version */
+#define H5D_CSTATS_MAGIC   "CSTB"
+#define H5D_CSTATS_VERSION 0
+
+/* Size of the fixed part of the block and of each entry */
+#define H5D_CSTATS_PREFIX_SIZE (H5_SIZEOF_MAGIC + 4 + 8)
+#define H5D_CSTATS_ENTRY_SIZE  (5 * 8)
+
+/* Number of elements converted to double at a time */
+#define H5D_CSTATS_STRIP_NELMTS 4096
+
+/********************/
+/* Local Prototypes */
+/********************/
+static herr_t H5D__cstats_new(H5D_t *dset);
+static hsize_t H5D__cstats_key(const H5D_cstats_t *cstats, unsigned ndims, const hsize_t *scaled);
+static herr_t  H5D__cstats_load(const H5D_t *dset);
+static herr_t  H5D__cstats_accum(const H5D_t *dset, const uint8_t *src, size_t nelmts, hsize_t *nan_count,
+                                 double *min, double *max);
+static herr_t  H5D__cstats_free_cb(void *item, void *key, void *op_data);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare free lists to manage the statistics table and its entries */
+H5FL_DEFINE_STATIC(H5D_cstats_t);
+H5FL_DEFINE_STATIC(H5D_cstats_ent_t);
+
+/* Declare a free list to manage the conversion buffers and encoded blocks */
+H5FL_BLK_DEFINE_STATIC(cstats_buf);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_new
+ *
+ * Purpose:     Set up the in-memory statistics table for a chunked
+ *              dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__cstats_new(H5D_t *dset)
+{
+    H5D_cstats_t *cstats = NULL;     /* New statistics table */
+    const H5T_t * dbl_type;          /* Native double datatype */
+    H5T_class_t   type_class;        /* Class of the dataset's datatype */
+    unsigned      ndims;             /* Rank of the dataset */
+    int           unlim_dim = -1;    /* Unlimited dimension, if any */
+    hsize_t       acc       = 1;     /* Running product of grid dimensions */
+    unsigned      u, v;              /* Local index variables */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(NULL == dset->shared->cstats);
+
+    /* Check that statistics can be kept for this dataset */
+    if (H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk statistics can only be used with chunked layout")
+    type_class = H5T_get_class(dset->shared->type, FALSE);
+    if (H5T_INTEGER != type_class && H5T_FLOAT != type_class)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL,
+                    "chunk statistics require an integer or floating-point datatype")
+    ndims = dset->shared->ndims;
+    for (u = 0; u < ndims; u++)
+        if (H5S_UNLIMITED == dset->shared->max_dims[u]) {
+            if (unlim_dim >= 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
+                            "chunk statistics support at most one unlimited dimension")
+            unlim_dim = (int)u;
+        } /* end if */
+
+    /* Allocate the table */
+    if (NULL == (cstats = H5FL_CALLOC(H5D_cstats_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    cstats->mesg.addr = HADDR_UNDEF;
+    if (NULL == (cstats->entries = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk statistics")
+
+    /* Compute the multiplier of each scaled coordinate, with the unlimited
+     * dimension (if any) varying slowest, then the others in row-major order.
+     */
+    v = 0;
+    if (unlim_dim >= 0)
+        cstats->order[v++] = (unsigned)unlim_dim;
+    for (u = 0; u < ndims; u++)
+        if ((int)u != unlim_dim)
+            cstats->order[v++] = u;
+    for (u = ndims; u > 0; u--) {
+        unsigned dim = cstats->order[u - 1];
+
+        cstats->stride[dim] = acc;
+        if (u > 1 || unlim_dim < 0) {
+            hsize_t nchunks; /* Number of chunks along the maximum extent of the dimension */
+
+            nchunks = (dset->shared->max_dims[dim] + dset->shared->layout.u.chunk.dim[dim] - 1) /
+                      dset->shared->layout.u.chunk.dim[dim];
+            if (0 == nchunks)
+                nchunks = 1;
+            if (acc > (HSIZET_MAX / nchunks))
+                HGOTO_ERROR(H5E_DATASET, H5E_OVERFLOW, FAIL, "too many chunks for chunk statistics")
+            acc *= nchunks;
+        } /* end if */
+    }     /* end for */
+
+    /* Set up the conversion to double */
+    if (NULL == (dbl_type = (const H5T_t *)H5I_object(H5T_NATIVE_DOUBLE)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_BADTYPE, FAIL, "not a datatype")
+    if (NULL == (cstats->tpath = H5T_path_find(dset->shared->type, dbl_type)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert dataset's datatype to double")
+    cstats->type_size = H5T_get_size(dset->shared->type);
+    if (NULL == (cstats->conv_buf = H5FL_BLK_MALLOC(
+                     cstats_buf, H5D_CSTATS_STRIP_NELMTS * MAX(cstats->type_size, sizeof(double)))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for conversion buffer")
+
+    dset->shared->cstats = cstats;
+
+done:
+    if (ret_value < 0 && cstats) {
+        if (cstats->entries)
+            H5SL_close(cstats->entries);
+        if (cstats->conv_buf)
+            cstats->conv_buf = H5FL_BLK_FREE(cstats_buf, cstats->conv_buf);
+        cstats = H5FL_FREE(H5D_cstats_t, cstats);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_new() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_key
+ *
+ * Purpose:     Compute the key of a chunk from its scaled coordinates.
+ *
+ * Return:      The key (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5D__cstats_key(const H5D_cstats_t *cstats, unsigned ndims, const hsize_t *scaled)
+{
+    hsize_t  key = 0; /* Return value */
+    unsigned u;       /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < ndims; u++)
+        key += scaled[u] * cstats->stride[u];
+
+    FUNC_LEAVE_NOAPI(key)
+} /* end H5D__cstats_key() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_create
+ *
+ * Purpose:     Set up per-chunk statistics for a dataset being created and
+ *              add the (empty) chunk statistics message to its object
+ *              header.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_create(H5F_t *f, H5O_t *oh, H5D_t *dset)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(dset);
+
+    /* Chunks are written without going through the chunk cache in parallel */
+    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "chunk statistics are not supported in parallel")
+
+    /* Set up the table */
+    if (H5D__cstats_new(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up chunk statistics")
+
+    /* Older versions of the library would leave the statistics stale, so
+     * don't let them modify the dataset.
+     */
+    if (H5O_msg_append_oh(f, oh, H5O_CSTATS_ID, H5O_MSG_FLAG_FAIL_IF_UNKNOWN_AND_OPEN_FOR_WRITE, 0,
+                          &dset->shared->cstats->mesg) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to add chunk statistics message")
+
+done:
+    if (ret_value < 0 && dset->shared->cstats)
+        if (H5D__cstats_dest(dset) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release chunk statistics")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_open
+ *
+ * Purpose:     Load the per-chunk statistics of a dataset being opened,
+ *              if it has any.
+ *
+ *              When the file is opened for writing with an MPI file
+ *              driver, chunks will be written without going through the
+ *              chunk cache, so the statistics are removed instead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_open(H5D_t *dset)
+{
+    H5F_t *f;                   /* File containing the dataset */
+    htri_t msg_exists;          /* Whether the message exists */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dset);
+
+    f = dset->oloc.file;
+
+    if ((msg_exists = H5O_msg_exists(&dset->oloc, H5O_CSTATS_ID)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check if message exists")
+    if (!msg_exists)
+        HGOTO_DONE(SUCCEED)
+
+    if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI) && (H5F_INTENT(f) & H5F_ACC_RDWR)) {
+        if (H5O_msg_remove(&dset->oloc, H5O_CSTATS_ID, H5O_ALL, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to remove chunk statistics message")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Set up the table */
+    if (H5D__cstats_new(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set up chunk statistics")
+    dset->shared->dcpl_cache.chunk_stats = TRUE;
+
+    /* Read the location of the stored block and its contents */
+    if (NULL == H5O_msg_read(&dset->oloc, H5O_CSTATS_ID, &dset->shared->cstats->mesg))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't read chunk statistics message")
+    if (H5D__cstats_load(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTLOAD, FAIL, "unable to load chunk statistics")
+
+done:
+    if (ret_value < 0 && dset->shared->cstats)
+        if (H5D__cstats_dest(dset) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release chunk statistics")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_load
+ *
+ * Purpose:     Read and decode the stored statistics block of a dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__cstats_load(const H5D_t *dset)
+{
+    H5D_cstats_t *    cstats = dset->shared->cstats;
+    H5D_cstats_ent_t *ent    = NULL;  /* Entry being decoded */
+    uint8_t *         block  = NULL;  /* Encoded block */
+    const uint8_t *   p;              /* Pointer into block */
+    size_t            size;           /* Size of block */
+    uint64_t          nentries;       /* Number of entries in block */
+    uint32_t          stored_chksum;  /* Checksum stored in block */
+    uint64_t          u;              /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cstats);
+
+    if (!H5F_addr_defined(cstats->mesg.addr))
+        HGOTO_DONE(SUCCEED)
+
+    H5_CHECKED_ASSIGN(size, size_t, cstats->mesg.size, hsize_t);
+    if (size < H5D_CSTATS_PREFIX_SIZE + H5_SIZEOF_CHKSUM)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk statistics block is too small")
+    if (NULL == (block = (uint8_t *)H5FL_BLK_MALLOC(cstats_buf, size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if (H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, cstats->mesg.addr, size, block) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read chunk statistics block")
+
+    /* Check the signature, version and checksum */
+    p = block;
+    if (HDmemcmp(p, H5D_CSTATS_MAGIC, (size_t)H5_SIZEOF_MAGIC) != 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "wrong chunk statistics block signature")
+    p += H5_SIZEOF_MAGIC;
+    if (*p++ != H5D_CSTATS_VERSION)
+        HGOTO_ERROR(H5E_DATASET, H5E_VERSION, FAIL, "wrong chunk statistics block version")
+    if (*p++ != (uint8_t)dset->shared->ndims)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk statistics block has the wrong rank")
+    p += 2;
+    UINT64DECODE(p, nentries);
+    if (nentries > (size - H5D_CSTATS_PREFIX_SIZE - H5_SIZEOF_CHKSUM) / H5D_CSTATS_ENTRY_SIZE)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk statistics block is too small")
+    {
+        const uint8_t *chk_p = block + size - H5_SIZEOF_CHKSUM; /* Pointer to the stored checksum */
+
+        UINT32DECODE(chk_p, stored_chksum);
+    }
+    if (stored_chksum != H5_checksum_metadata(block, size - H5_SIZEOF_CHKSUM, 0))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "incorrect checksum for chunk statistics block")
+
+    /* Decode the entries */
+    for (u = 0; u < nentries; u++) {
+        if (NULL == (ent = H5FL_MALLOC(H5D_cstats_ent_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        UINT64DECODE(p, ent->key);
+        UINT64DECODE(p, ent->count);
+        UINT64DECODE(p, ent->nan_count);
+        H5_DECODE_DOUBLE(p, ent->min);
+        H5_DECODE_DOUBLE(p, ent->max);
+        if (H5SL_insert(cstats->entries, ent, &ent->key) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert chunk statistics")
+        ent = NULL;
+    } /* end for */
+
+done:
+    if (ent)
+        ent = H5FL_FREE(H5D_cstats_ent_t, ent);
+    if (block)
+        block = H5FL_BLK_FREE(cstats_buf, block);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_load() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_accum
+ *
+ * Purpose:     Accumulate the statistics of NELMTS contiguous elements of
+ *              a chunk, starting at SRC.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__cstats_accum(const H5D_t *dset, const uint8_t *src, size_t nelmts, hsize_t *nan_count, double *min,
+                  double *max)
+{
+    H5D_cstats_t *cstats    = dset->shared->cstats;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Convert the elements to double a strip at a time and accumulate */
+    while (nelmts > 0) {
+        size_t        n = MIN(nelmts, H5D_CSTATS_STRIP_NELMTS); /* Elements in this strip */
+        const double *vals;                                       /* Values in this strip */
+        size_t        u;                                          /* Local index variable */
+
+        if (H5T_path_noop(cstats->tpath))
+            vals = (const double *)((const void *)src);
+        else {
+            H5MM_memcpy(cstats->conv_buf, src, n * cstats->type_size);
+            if (H5T_convert(cstats->tpath, dset->shared->type_id, H5T_NATIVE_DOUBLE, n, (size_t)0, (size_t)0,
+                            cstats->conv_buf, NULL) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+            vals = (const double *)((void *)cstats->conv_buf);
+        } /* end else */
+
+        for (u = 0; u < n; u++) {
+            double v = vals[u];
+
+            if (HDisnan(v))
+                (*nan_count)++;
+            else {
+                if (v < *min)
+                    *min = v;
+                if (v > *max)
+                    *max = v;
+            } /* end else */
+        }     /* end for */
+
+        src += n * cstats->type_size;
+        nelmts -= n;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_accum() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_update
+ *
+ * Purpose:     Recompute the statistics of a chunk from its unfiltered
+ *              contents.  Only the elements inside the current extent of
+ *              the dataset are summarized; the rest of an edge chunk
+ *              holds fill values.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_update(const H5D_t *dset, const hsize_t *scaled, const void *chunk)
+{
+    H5D_cstats_t *    cstats = dset->shared->cstats;
+    H5D_cstats_ent_t *ent;                              /* Statistics of the chunk */
+    hbool_t           new_ent = FALSE;                  /* Whether the entry was just allocated */
+    const uint8_t *   src     = (const uint8_t *)chunk; /* Elements of the chunk */
+    const uint32_t *  chunk_dims;                       /* Dimensions of the chunk */
+    hsize_t           edge_dims[H5O_LAYOUT_NDIMS];      /* Dimensions of the part inside the extent */
+    hsize_t           idx[H5O_LAYOUT_NDIMS];            /* Position of the current row */
+    hbool_t           edge = FALSE;                     /* Whether the chunk crosses the extent */
+    hsize_t           key;                              /* Key of the chunk */
+    hsize_t           count     = 1;                    /* Number of elements summarized */
+    hsize_t           nan_count = 0;                    /* Number of NaN values */
+    double            min       = HUGE_VAL;             /* Smallest value */
+    double            max       = -HUGE_VAL;            /* Largest value */
+    unsigned          ndims;                            /* Rank of the dataset */
+    unsigned          u;                                /* Local index variable */
+    herr_t            ret_value = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(cstats);
+    HDassert(scaled);
+    HDassert(chunk);
+
+    /* Clip the chunk to the extent of the dataset */
+    ndims      = dset->shared->ndims;
+    chunk_dims = dset->shared->layout.u.chunk.dim;
+    for (u = 0; u < ndims; u++) {
+        hsize_t start = scaled[u] * chunk_dims[u];
+
+        edge_dims[u] = start < dset->shared->curr_dims[u]
+                           ? MIN(chunk_dims[u], dset->shared->curr_dims[u] - start)
+                           : 0;
+        if (edge_dims[u] != chunk_dims[u])
+            edge = TRUE;
+        count *= edge_dims[u];
+    } /* end for */
+
+    if (!edge) {
+        if (H5D__cstats_accum(dset, src, (size_t)count, &nan_count, &min, &max) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "can't summarize chunk")
+    } /* end if */
+    else if (count > 0) {
+        hsize_t nrows = count / edge_dims[ndims - 1]; /* Rows of the fastest dimension to summarize */
+        hsize_t r;                                    /* Local index variable */
+
+        /* Summarize the part of each row inside the extent */
+        HDmemset(idx, 0, sizeof(idx));
+        for (r = 0; r < nrows; r++) {
+            hsize_t offset = 0; /* Offset of the row in the chunk, in elements */
+
+            for (u = 0; u < ndims; u++)
+                offset = offset * chunk_dims[u] + idx[u];
+            if (H5D__cstats_accum(dset, src + offset * cstats->type_size, (size_t)edge_dims[ndims - 1],
+                                  &nan_count, &min, &max) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "can't summarize chunk")
+
+            /* Move to the next row */
+            for (u = ndims - 1; u > 0; u--) {
+                if (++idx[u - 1] < edge_dims[u - 1])
+                    break;
+                idx[u - 1] = 0;
+            } /* end for */
+        }     /* end for */
+    }         /* end if */
+
+    /* Store the statistics */
+    key = H5D__cstats_key(cstats, dset->shared->ndims, scaled);
+    if (NULL == (ent = (H5D_cstats_ent_t *)H5SL_search(cstats->entries, &key))) {
+        if (NULL == (ent = H5FL_MALLOC(H5D_cstats_ent_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        ent->key = key;
+        new_ent  = TRUE;
+    } /* end if */
+    ent->count     = count;
+    ent->nan_count = nan_count;
+    ent->min       = min;
+    ent->max       = max;
+    if (new_ent && H5SL_insert(cstats->entries, ent, &ent->key) < 0) {
+        ent = H5FL_FREE(H5D_cstats_ent_t, ent);
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert chunk statistics")
+    } /* end if */
+    cstats->dirty = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_update() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_invalidate
+ *
+ * Purpose:     Forget the statistics of a chunk that was written without
+ *              going through the chunk cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_invalidate(const H5D_t *dset, const hsize_t *scaled)
+{
+    H5D_cstats_t *    cstats = dset->shared->cstats;
+    H5D_cstats_ent_t *ent;     /* Statistics of the chunk */
+    hsize_t           key;     /* Key of the chunk */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(cstats);
+
+    key = H5D__cstats_key(cstats, dset->shared->ndims, scaled);
+    if (NULL != (ent = (H5D_cstats_ent_t *)H5SL_remove(cstats->entries, &key))) {
+        ent           = H5FL_FREE(H5D_cstats_ent_t, ent);
+        cstats->dirty = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__cstats_invalidate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_prune
+ *
+ * Purpose:     Forget the statistics of chunks that are entirely outside
+ *              the (shrunken) extent of a dataset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_prune(const H5D_t *dset)
+{
+    H5D_cstats_t *cstats = dset->shared->cstats;
+    H5SL_node_t * node;    /* Current skip list node */
+    unsigned      ndims;   /* Rank of the dataset */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(cstats);
+
+    ndims = dset->shared->ndims;
+    node  = H5SL_first(cstats->entries);
+    while (node) {
+        H5D_cstats_ent_t *ent = (H5D_cstats_ent_t *)H5SL_item(node);
+        hsize_t           rem = ent->key; /* Remainder of the key */
+        hbool_t           outside = FALSE;
+        unsigned          u;              /* Local index variable */
+
+        node = H5SL_next(node);
+
+        /* Recover the chunk's coordinates from its key */
+        for (u = 0; u < ndims; u++) {
+            unsigned dim    = cstats->order[u];
+            hsize_t  scaled = rem / cstats->stride[dim];
+
+            rem %= cstats->stride[dim];
+            if (scaled * dset->shared->layout.u.chunk.dim[dim] >= dset->shared->curr_dims[dim])
+                outside = TRUE;
+        } /* end for */
+
+        if (outside) {
+            (void)H5SL_remove(cstats->entries, &ent->key);
+            ent           = H5FL_FREE(H5D_cstats_ent_t, ent);
+            cstats->dirty = TRUE;
+        } /* end if */
+    }     /* end while */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__cstats_prune() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_flush
+ *
+ * Purpose:     Write the statistics of a dataset to the file, if they
+ *              changed since they were last written.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_flush(H5D_t *dset)
+{
+    H5D_cstats_t *cstats = dset->shared->cstats;
+    H5F_t *       f      = dset->oloc.file;
+    H5O_cstats_t  mesg;                /* New message */
+    uint8_t *     block = NULL;        /* Encoded block */
+    uint8_t *     p;                   /* Pointer into block */
+    size_t        nentries;            /* Number of entries */
+    size_t        size = 0;            /* Size of block */
+    H5SL_node_t * node;                /* Current skip list node */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(cstats);
+
+    if (!cstats->dirty)
+        HGOTO_DONE(SUCCEED)
+
+    mesg      = cstats->mesg;
+    nentries  = H5SL_count(cstats->entries);
+    mesg.nentries = (hsize_t)nentries;
+
+    if (nentries > 0) {
+        uint32_t chksum; /* Checksum of block */
+
+        /* Encode the block */
+        size = H5D_CSTATS_PREFIX_SIZE + (nentries * H5D_CSTATS_ENTRY_SIZE) + H5_SIZEOF_CHKSUM;
+        if (NULL == (block = (uint8_t *)H5FL_BLK_MALLOC(cstats_buf, size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        p = block;
+        H5MM_memcpy(p, H5D_CSTATS_MAGIC, (size_t)H5_SIZEOF_MAGIC);
+        p += H5_SIZEOF_MAGIC;
+        *p++ = H5D_CSTATS_VERSION;
+        *p++ = (uint8_t)dset->shared->ndims;
+        *p++ = 0;
+        *p++ = 0;
+        UINT64ENCODE(p, (uint64_t)nentries);
+        for (node = H5SL_first(cstats->entries); node; node = H5SL_next(node)) {
+            const H5D_cstats_ent_t *ent = (const H5D_cstats_ent_t *)H5SL_item(node);
+
+            UINT64ENCODE(p, ent->key);
+            UINT64ENCODE(p, ent->count);
+            UINT64ENCODE(p, ent->nan_count);
+            H5_ENCODE_DOUBLE(p, ent->min);
+            H5_ENCODE_DOUBLE(p, ent->max);
+        } /* end for */
+        chksum = H5_checksum_metadata(block, (size_t)(p - block), 0);
+        UINT32ENCODE(p, chksum);
+        HDassert((size_t)(p - block) == size);
+    } /* end if */
+
+    /* Release the old block if it can't be rewritten in place */
+    if (H5F_addr_defined(mesg.addr) && mesg.size != (hsize_t)size) {
+        if (H5MF_xfree(f, H5FD_MEM_DRAW, mesg.addr, mesg.size) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk statistics block")
+        mesg.addr = HADDR_UNDEF;
+        mesg.size = 0;
+    } /* end if */
+
+    /* Write the new block */
+    if (nentries > 0) {
+        if (!H5F_addr_defined(mesg.addr)) {
+            if (HADDR_UNDEF == (mesg.addr = H5MF_alloc(f, H5FD_MEM_DRAW, (hsize_t)size)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk statistics block")
+            mesg.size = (hsize_t)size;
+        } /* end if */
+        if (H5F_block_write(f, H5FD_MEM_DRAW, mesg.addr, size, block) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write chunk statistics block")
+    } /* end if */
+
+    /* Update the message */
+    if (H5O_msg_write(&dset->oloc, H5O_CSTATS_ID, H5O_MSG_FLAG_FAIL_IF_UNKNOWN_AND_OPEN_FOR_WRITE, 0, &mesg) <
+        0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTUPDATE, FAIL, "unable to update chunk statistics message")
+    cstats->mesg  = mesg;
+    cstats->dirty = FALSE;
+
+done:
+    if (block)
+        block = H5FL_BLK_FREE(cstats_buf, block);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_free_cb
+ *
+ * Purpose:     Skip list callback to release a statistics entry.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__cstats_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(item);
+
+    item = H5FL_FREE(H5D_cstats_ent_t, item);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5D__cstats_free_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_dest
+ *
+ * Purpose:     Release the in-memory statistics of a dataset.  Anything
+ *              not yet flushed is lost.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_dest(H5D_t *dset)
+{
+    H5D_cstats_t *cstats    = dset->shared->cstats;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if (cstats) {
+        if (cstats->entries && H5SL_destroy(cstats->entries, H5D__cstats_free_cb, NULL) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk statistics")
+        if (cstats->conv_buf)
+            cstats->conv_buf = H5FL_BLK_FREE(cstats_buf, cstats->conv_buf);
+        dset->shared->cstats = H5FL_FREE(H5D_cstats_t, cstats);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_dest() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_get
+ *
+ * Purpose:     Retrieve the statistics of the chunk at a logical offset.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_get(H5D_t *dset, const hsize_t *offset, H5D_chunk_stats_t *stats)
+{
+    const H5D_cstats_ent_t *ent;                    /* Statistics of the chunk */
+    hsize_t                 scaled[H5S_MAX_RANK];   /* Scaled coordinates of the chunk */
+    hsize_t                 key;                    /* Key of the chunk */
+    unsigned                u;                      /* Local index variable */
+    herr_t                  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(offset);
+    HDassert(stats);
+
+    if (NULL == dset->shared->cstats)
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dataset does not keep chunk statistics")
+
+    /* Check that the offset is the first element of a chunk in the dataset */
+    for (u = 0; u < dset->shared->ndims; u++) {
+        if (offset[u] >= dset->shared->curr_dims[u])
+            HGOTO_ERROR(H5E_DATASET, H5E_BADRANGE, FAIL, "offset exceeds dimensions of dataset")
+        if (offset[u] % dset->shared->layout.u.chunk.dim[u])
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "offset is not on a chunk boundary")
+    } /* end for */
+
+    /* Bring the statistics up to date with the chunk cache */
+    if (dset->shared->layout.ops->flush && (dset->shared->layout.ops->flush)(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush raw data")
+
+    H5VM_chunk_scaled(dset->shared->ndims, offset, dset->shared->layout.u.chunk.dim, scaled);
+    key = H5D__cstats_key(dset->shared->cstats, dset->shared->ndims, scaled);
+    HDmemset(stats, 0, sizeof(*stats));
+    if (NULL != (ent = (const H5D_cstats_ent_t *)H5SL_search(dset->shared->cstats->entries, &key))) {
+        stats->known     = TRUE;
+        stats->min       = ent->min;
+        stats->max       = ent->max;
+        stats->count     = ent->count;
+        stats->nan_count = ent->nan_count;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__cstats_query
+ *
+ * Purpose:     Find the chunks in the current extent of a dataset that may
+ *              hold values in [MIN, MAX]: those whose statistics
+ *              intersect the range and those without statistics.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__cstats_query(H5D_t *dset, double min, double max, size_t max_chunks, hsize_t *offsets,
+                  hsize_t *nchunks)
+{
+    H5D_cstats_t *cstats;                      /* Statistics of the dataset */
+    hsize_t       nscaled[H5S_MAX_RANK];       /* Number of chunks in each dimension */
+    hsize_t       scaled[H5S_MAX_RANK];        /* Scaled coordinates of the current chunk */
+    hsize_t       total = 1;                   /* Number of chunks in the extent */
+    hsize_t       found = 0;                   /* Number of chunks found */
+    hsize_t       n;                           /* Local index variable */
+    unsigned      ndims;                       /* Rank of the dataset */
+    unsigned      u;                           /* Local index variable */
+    herr_t        ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity check */
+    HDassert(dset);
+    HDassert(nchunks);
+
+    if (NULL == (cstats = dset->shared->cstats))
+        HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dataset does not keep chunk statistics")
+
+    /* Bring the statistics up to date with the chunk cache */
+    if (dset->shared->layout.ops->flush && (dset->shared->layout.ops->flush)(dset) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush raw data")
+
+    ndims = dset->shared->ndims;
+    for (u = 0; u < ndims; u++) {
+        nscaled[u] = (dset->shared->curr_dims[u] + dset->shared->layout.u.chunk.dim[u] - 1) /
+                     dset->shared->layout.u.chunk.dim[u];
+        total *= nscaled[u];
+        scaled[u] = 0;
+    } /* end for */
+
+    /* Visit the chunks in row-major order */
+    H5_GCC_DIAG_OFF("float-equal")
+    for (n = 0; n < total; n++) {
+        const H5D_cstats_ent_t *ent;  /* Statistics of the chunk */
+        hsize_t                 key;  /* Key of the chunk */
+
+        key = H5D__cstats_key(cstats, ndims, scaled);
+        ent = (const H5D_cstats_ent_t *)H5SL_search(cstats->entries, &key);
+        if (NULL == ent || (ent->count > ent->nan_count && ent->min <= max && ent->max >= min)) {
+            if (offsets && found < (hsize_t)max_chunks)
+                for (u = 0; u < ndims; u++)
+                    offsets[found * ndims + u] = scaled[u] * dset->shared->layout.u.chunk.dim[u];
+            found++;
+        } /* end if */
+
+        /* Advance to the next chunk */
+        for (u = ndims; u > 0; u--) {
+            if (++scaled[u - 1] < nscaled[u - 1])
+                break;
+            scaled[u - 1] = 0;
+        } /* end for */
+    }     /* end for */
+    H5_GCC_DIAG_ON("float-equal")
+
+    *nchunks = found;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__cstats_query() */
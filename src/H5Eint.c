@@ -93,6 +93,9 @@ hid_t H5E_ERR_CLS_g = FAIL;
 /* Local Variables */
 /*******************/
 
+/* Whether errors are discarded instead of pushed (see H5E_pause_push) */
+static hbool_t H5E_push_paused_g = FALSE;
+
 #ifdef H5_HAVE_PARALLEL
 /*
  * variables used for MPI error reporting
@@ -670,6 +673,10 @@ H5E_printf_stack(H5E_t *estack, const char *file, const char *func, unsigned lin
     HDassert(min_id > 0);
     HDassert(fmt);
 
+    /* Check whether pushing is paused */
+    if (H5E_push_paused_g)
+        HGOTO_DONE(SUCCEED)
+
     /* Note that the variable-argument parsing for the format is identical in
      *      the H5Epush2() routine - correct errors and make changes in both
      *      places. -QAK
@@ -739,6 +746,10 @@ H5E__push_stack(H5E_t *estack, const char *file, const char *func, unsigned line
     HDassert(maj_id > 0);
     HDassert(min_id > 0);
 
+    /* Check whether pushing is paused */
+    if (H5E_push_paused_g)
+        HGOTO_DONE(SUCCEED)
+
     /* Check for 'default' error stack */
     if (estack == NULL)
         if (NULL == (estack = H5E__get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in
@@ -909,6 +920,30 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E__pop() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5E_pause_push
+ *
+ * Purpose:     Private function to start or stop discarding the errors
+ *              pushed on any error stack.  The error stacks and the
+ *              reference counts of the error IDs are not protected, so
+ *              pushing is paused while the library runs code that may
+ *              fail on several threads at once, and the caller reports
+ *              the failures once the threads are done.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5E_pause_push(hbool_t paused)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5E_push_paused_g = paused;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5E_pause_push() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5E_dump_api_stack
  *
@@ -500,6 +500,8 @@ H5FD_sb_load(H5FD_t *file, const char *name, const uint8_t *buf)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "family driver should be used")
     if (!HDstrncmp(name, "NCSAmult", (size_t)8) && HDstrcmp(file->cls->name, "multi") != 0)
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "multi driver should be used")
+    if (!HDstrncmp(name, "HDF5strp", (size_t)8) && HDstrcmp(file->cls->name, "stripe") != 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "stripe driver should be used")
 
     /* Decode driver information */
     if (H5FD__sb_decode(file, name, buf) < 0)
@@ -34,6 +34,12 @@
 
 #ifdef H5_HAVE_DIRECT
 
+/* Use POSIX asynchronous I/O to overlap bounce buffer copies with transfers */
+#if defined(H5_HAVE_AIO_H) && defined(H5_HAVE_AIO_READ)
+#include <aio.h>
+#define H5FD_DIRECT_USE_AIO
+#endif
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_DIRECT_g = 0;
 
@@ -53,6 +59,24 @@ typedef struct H5FD_direct_fapl_t {
     hbool_t must_align; /* Decides if data alignment is required        */
 } H5FD_direct_fapl_t;
 
+/* Number of aligned bounce buffers kept by each file.  Two are enough to copy
+ * one piece of a request while the transfer of the next is in flight.
+ */
+#define H5FD_DIRECT_NBOUNCE 2
+
+/* An aligned bounce buffer and the transfer (if any) that is using it */
+typedef struct H5FD_direct_bounce_t {
+    void *  buf;     /* cbsize bytes from posix_memalign, allocated on first use */
+    hbool_t pending; /* Whether a transfer must still be completed    */
+    hbool_t writing; /* Direction of the transfer                     */
+    size_t  len;     /* Length of the transfer                        */
+    haddr_t addr;    /* File address of the transfer                  */
+#ifdef H5FD_DIRECT_USE_AIO
+    hbool_t      async; /* Whether `cb' was queued with aio_read/aio_write */
+    struct aiocb cb;    /* Control block of the queued transfer          */
+#endif
+} H5FD_direct_bounce_t;
+
 /*
  * The description of a file belonging to this driver. The `eoa' and `eof'
  * determine the amount of hdf5 address space in use and the high-water mark
@@ -66,14 +90,15 @@ typedef struct H5FD_direct_fapl_t {
  * occurs), and `op' will be set to H5F_OP_UNKNOWN.
  */
 typedef struct H5FD_direct_t {
-    H5FD_t             pub; /*public stuff, must be first  */
-    int                fd;  /*the unix file      */
-    haddr_t            eoa; /*end of allocated region  */
-    haddr_t            eof; /*end of file; current file size*/
-    haddr_t            pos; /*current file I/O position  */
-    int                op;  /*last operation    */
-    H5FD_direct_fapl_t fa;  /*file access properties  */
-    hbool_t            ignore_disabled_file_locks;
+    H5FD_t               pub; /*public stuff, must be first  */
+    int                  fd;  /*the unix file      */
+    haddr_t              eoa; /*end of allocated region  */
+    haddr_t              eof; /*end of file; current file size*/
+    haddr_t              pos; /*current file I/O position  */
+    int                  op;  /*last operation    */
+    H5FD_direct_fapl_t   fa;  /*file access properties  */
+    hbool_t              ignore_disabled_file_locks;
+    H5FD_direct_bounce_t bounce[H5FD_DIRECT_NBOUNCE]; /*aligned buffers for unaligned I/O */
 #ifndef H5_HAVE_WIN32_API
     /*
      * On most systems the combination of device and i-node number uniquely
@@ -138,6 +163,14 @@ static herr_t  H5FD__direct_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closi
 static herr_t  H5FD__direct_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__direct_unlock(H5FD_t *_file);
 
+static herr_t H5FD__direct_alloc_bounce(H5FD_direct_t *file);
+static herr_t H5FD__direct_pread(H5FD_direct_t *file, void *buf, size_t len, haddr_t addr);
+static herr_t H5FD__direct_pwrite(H5FD_direct_t *file, const void *buf, size_t len, haddr_t addr);
+static herr_t H5FD__direct_submit(H5FD_direct_t *file, H5FD_direct_bounce_t *b, hbool_t writing, size_t len,
+                                  haddr_t addr);
+static herr_t H5FD__direct_complete(H5FD_direct_t *file, H5FD_direct_bounce_t *b);
+static void   H5FD__direct_drain(H5FD_direct_t *file);
+
 static const H5FD_class_t H5FD_direct_g = {
     "direct",                   /* name                 */
     MAXADDR,                    /* maxaddr              */
@@ -604,11 +637,19 @@ done:
 static herr_t
 H5FD__direct_close(H5FD_t *_file)
 {
-    H5FD_direct_t *file      = (H5FD_direct_t *)_file;
+    H5FD_direct_t *file = (H5FD_direct_t *)_file;
+    unsigned       u;
     herr_t         ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_STATIC
 
+    /* Release the bounce buffers.  Free with HDfree since they came from
+     * posix_memalign. */
+    H5FD__direct_drain(file);
+    for (u = 0; u < H5FD_DIRECT_NBOUNCE; u++)
+        if (file->bounce[u].buf)
+            HDfree(file->bounce[u].buf);
+
     if (HDclose(file->fd) < 0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
 
@@ -826,6 +867,281 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_alloc_bounce
+ *
+ * Purpose:     Allocates the file's pool of aligned bounce buffers, if
+ *              that hasn't been done yet.  Files that only see aligned
+ *              requests never pay for the pool.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_alloc_bounce(H5FD_direct_t *file)
+{
+    unsigned u;
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* NOTE: The buffers are released with HDfree in H5FD__direct_close to
+     *       ensure compatibility with HDposix_memalign.
+     */
+    for (u = 0; u < H5FD_DIRECT_NBOUNCE; u++)
+        if (NULL == file->bounce[u].buf &&
+            HDposix_memalign(&file->bounce[u].buf, file->fa.mboundary, file->fa.cbsize) != 0) {
+            file->bounce[u].buf = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+        }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_alloc_bounce() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_pread
+ *
+ * Purpose:     Reads LEN bytes at the block-aligned address ADDR into the
+ *              aligned buffer BUF, handling interrupted system calls and
+ *              partial results.  A short read can only happen at the end
+ *              of the file, after which O_DIRECT can't continue from the
+ *              (possibly unaligned) position, so the rest of the buffer
+ *              is zero-filled.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_pread(H5FD_direct_t *file, void *buf, size_t len, haddr_t addr)
+{
+    ssize_t nbytes;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(0 == addr % file->fa.fbsize);
+
+    while (len > 0) {
+        do {
+            nbytes = HDpread(file->fd, buf, len, (HDoff_t)addr);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        HDassert((size_t)nbytes <= len);
+        if (0 == nbytes || 0 != (size_t)nbytes % file->fa.fbsize) {
+            /* end of file but not end of format address space */
+            HDmemset((unsigned char *)buf + nbytes, 0, len - (size_t)nbytes);
+            break;
+        }
+        len -= (size_t)nbytes;
+        addr += (haddr_t)nbytes;
+        buf = (unsigned char *)buf + nbytes;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_pread() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_pwrite
+ *
+ * Purpose:     Writes LEN bytes from the aligned buffer BUF to the
+ *              block-aligned address ADDR, handling interrupted system
+ *              calls and partial results.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_pwrite(H5FD_direct_t *file, const void *buf, size_t len, haddr_t addr)
+{
+    ssize_t nbytes;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(0 == addr % file->fa.fbsize);
+
+    while (len > 0) {
+        do {
+            nbytes = HDpwrite(file->fd, buf, len, (HDoff_t)addr);
+        } while (-1 == nbytes && EINTR == errno);
+        if (-1 == nbytes) /* error */
+            HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        HDassert(nbytes > 0);
+        HDassert((size_t)nbytes <= len);
+        len -= (size_t)nbytes;
+        addr += (haddr_t)nbytes;
+        buf = (const unsigned char *)buf + nbytes;
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_pwrite() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_submit
+ *
+ * Purpose:     Starts moving LEN bytes between bounce buffer B and the
+ *              block-aligned address ADDR.  When POSIX asynchronous I/O
+ *              is available the transfer is queued and the caller can
+ *              work on another buffer until H5FD__direct_complete is
+ *              called; otherwise (or when the system is out of
+ *              asynchronous I/O resources) the transfer is done here.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_submit(H5FD_direct_t *file, H5FD_direct_bounce_t *b, hbool_t writing, size_t len, haddr_t addr)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(b->buf);
+    HDassert(!b->pending);
+    HDassert(len > 0 && len <= file->fa.cbsize);
+
+    b->writing = writing;
+    b->len     = len;
+    b->addr    = addr;
+
+#ifdef H5FD_DIRECT_USE_AIO
+    HDmemset(&b->cb, 0, sizeof(b->cb));
+    b->cb.aio_fildes                = file->fd;
+    b->cb.aio_buf                   = b->buf;
+    b->cb.aio_nbytes                = len;
+    b->cb.aio_offset                = (HDoff_t)addr;
+    b->cb.aio_sigevent.sigev_notify = SIGEV_NONE;
+    if (0 == (writing ? aio_write(&b->cb) : aio_read(&b->cb))) {
+        b->async   = TRUE;
+        b->pending = TRUE;
+        HGOTO_DONE(SUCCEED)
+    }
+    b->async = FALSE;
+#endif /* H5FD_DIRECT_USE_AIO */
+
+    if (writing) {
+        if (H5FD__direct_pwrite(file, b->buf, len, addr) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write bounce buffer")
+    }
+    else if (H5FD__direct_pread(file, b->buf, len, addr) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read bounce buffer")
+    b->pending = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_submit() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_complete
+ *
+ * Purpose:     Waits for the transfer started on bounce buffer B (if any)
+ *              to finish, so that the buffer can be used again.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__direct_complete(H5FD_direct_t *file, H5FD_direct_bounce_t *b)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (!b->pending)
+        HGOTO_DONE(SUCCEED)
+    b->pending = FALSE;
+
+#ifdef H5FD_DIRECT_USE_AIO
+    if (b->async) {
+        const struct aiocb *list[1];
+        ssize_t             nbytes;
+        int                 err;
+
+        b->async = FALSE;
+        list[0]  = &b->cb;
+        while (EINPROGRESS == (err = aio_error(&b->cb)))
+            (void)aio_suspend(list, 1, NULL);
+        nbytes = aio_return(&b->cb);
+        if (0 != err) {
+            errno = err;
+            if (b->writing)
+                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "asynchronous file write failed")
+            else
+                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "asynchronous file read failed")
+        }
+
+        /* Finish a partial transfer synchronously */
+        HDassert(nbytes >= 0 && (size_t)nbytes <= b->len);
+        if ((size_t)nbytes < b->len) {
+            unsigned char *rest     = (unsigned char *)b->buf + nbytes;
+            size_t         rest_len = b->len - (size_t)nbytes;
+
+            if (b->writing) {
+                if (H5FD__direct_pwrite(file, rest, rest_len, b->addr + (haddr_t)nbytes) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write bounce buffer")
+            }
+            else if (0 == nbytes || 0 != (size_t)nbytes % file->fa.fbsize)
+                /* end of file but not end of format address space */
+                HDmemset(rest, 0, rest_len);
+            else if (H5FD__direct_pread(file, rest, rest_len, b->addr + (haddr_t)nbytes) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read bounce buffer")
+        }
+    }
+#else  /* H5FD_DIRECT_USE_AIO */
+    (void)file;
+#endif /* H5FD_DIRECT_USE_AIO */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__direct_complete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__direct_drain
+ *
+ * Purpose:     Waits for every transfer still in flight, ignoring their
+ *              results.  Used when a request fails part way through, so
+ *              that no queued transfer outlives the buffers it uses.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__direct_drain(H5FD_direct_t *file)
+{
+    unsigned u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for (u = 0; u < H5FD_DIRECT_NBOUNCE; u++) {
+#ifdef H5FD_DIRECT_USE_AIO
+        H5FD_direct_bounce_t *b = &file->bounce[u];
+
+        if (b->pending && b->async) {
+            const struct aiocb *list[1];
+
+            list[0] = &b->cb;
+            while (EINPROGRESS == aio_error(&b->cb))
+                (void)aio_suspend(list, 1, NULL);
+            (void)aio_return(&b->cb);
+            b->async = FALSE;
+        }
+#endif /* H5FD_DIRECT_USE_AIO */
+        file->bounce[u].pending = FALSE;
+    }
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__direct_drain() */
+
 /*-------------------------------------------------------------------------
  * Function:  H5FD__direct_read
  *
@@ -851,14 +1167,9 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     ssize_t        nbytes;
     hbool_t        _must_align = TRUE;
     herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void *         copy_buf = NULL, *p2;
     size_t         _boundary;
     size_t         _fbsize;
     size_t         _cbsize;
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to read when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the requested data */
 
     FUNC_ENTER_STATIC
 
@@ -912,92 +1223,93 @@ H5FD__direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
             addr += (haddr_t)nbytes;
             buf = (char *)buf + nbytes;
         }
+
+        /* Update current position */
+        file->pos = addr;
+        file->op  = OP_READ;
     }
     else {
-        /* Calculate where we will begin copying from the copy buffer */
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer. */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        HDassert(!(alloc_size % _fbsize));
-        if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
-
-        /* look for the aligned position for reading the data */
-        HDassert(!(((addr / _fbsize) * _fbsize) % _fbsize));
-        if (HDlseek(file->fd, (HDoff_t)((addr / _fbsize) * _fbsize), SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-        /*
-         * Read the aligned data in file into aligned buffer first, then copy the data
-         * into the final buffer.  If the data size is bigger than maximal copy buffer
-         * size, do the reading by segment (the outer while loop).  If not, do one step
-         * reading.
-         */
-        do {
-            /* Read the aligned data in file first.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE. */
-            HDmemset(copy_buf, 0, alloc_size);
-
-            /* Calculate how much data we have to read in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                read_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                read_size = alloc_size;
-
-            HDassert(!(read_size % _fbsize));
-            do {
-                nbytes = HDread(file->fd, copy_buf, read_size);
-            } while (-1 == nbytes && EINTR == errno);
-
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+        haddr_t end     = addr + size;                             /* End of the requested data */
+        haddr_t core_lo = ((addr + _fbsize - 1) / _fbsize) * _fbsize; /* First whole block */
+        haddr_t core_hi = (end / _fbsize) * _fbsize;                /* End of the last whole block */
+
+        /* The pool is only needed once a request isn't aligned.  The
+         * positioned reads below don't move the file offset, so `pos' and
+         * `op' stay valid. */
+        if (H5FD__direct_alloc_bounce(file) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate bounce buffers")
+
+        if (core_lo < core_hi && 0 == (size_t)((unsigned char *)buf + (core_lo - addr)) % _boundary) {
+            H5FD_direct_bounce_t *head = NULL; /* Buffer for the partial first block */
+            H5FD_direct_bounce_t *tail = NULL; /* Buffer for the partial last block */
+
+            /* The whole blocks land at an aligned place in the caller's
+             * buffer, so read them there directly and only bounce the
+             * partial blocks at either end, which are queued first so
+             * that they are read while the aligned core is.
+             */
+            if (addr < core_lo) {
+                head = &file->bounce[0];
+                if (H5FD__direct_submit(file, head, FALSE, _fbsize, core_lo - _fbsize) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read first block")
+            }
+            if (core_hi < end) {
+                tail = &file->bounce[1];
+                if (H5FD__direct_submit(file, tail, FALSE, _fbsize, core_hi) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read last block")
+            }
+            if (H5FD__direct_pread(file, (unsigned char *)buf + (core_lo - addr), (size_t)(core_hi - core_lo),
+                                   core_lo) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read aligned blocks")
+            if (head) {
+                if (H5FD__direct_complete(file, head) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read first block")
+                H5MM_memcpy(buf, (unsigned char *)head->buf + (addr - head->addr), (size_t)(core_lo - addr));
+            }
+            if (tail) {
+                if (H5FD__direct_complete(file, tail) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read last block")
+                H5MM_memcpy((unsigned char *)buf + (core_hi - addr), tail->buf, (size_t)(end - core_hi));
+            }
+        }
+        else {
+            haddr_t  piece    = (addr / _fbsize) * _fbsize;                  /* Start of current piece */
+            haddr_t  span_end = ((end + _fbsize - 1) / _fbsize) * _fbsize; /* End of the last block */
+            unsigned cur      = 0;                                         /* Buffer of current piece */
 
-            /* Copy the needed data from the copy buffer to the output
-             * buffer, and update copy_size.  If the copy buffer does not
-             * contain the rest of the data, just copy what's in the copy
-             * buffer and also update read_addr and copy_offset to read the
-             * next section of data. */
-            p2 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(buf, p2, copy_size);
-                buf       = (unsigned char *)buf + copy_size;
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(buf, p2, alloc_size - copy_offset);
-                buf = (unsigned char *)buf + alloc_size - copy_offset;
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
-        } while (copy_size > 0);
-
-        /*Final step: update address*/
-        addr = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
-
-        if (copy_buf) {
-            /* Free with HDfree since it came from posix_memalign */
-            HDfree(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
+            /*
+             * Stream the blocks through the pool in pieces of at most the
+             * copy buffer size.  The read of each piece is queued before
+             * the previous one is copied out, so copying overlaps I/O.
+             */
+            if (H5FD__direct_submit(file, &file->bounce[0], FALSE, (size_t)MIN(_cbsize, span_end - piece),
+                                    piece) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read into bounce buffer")
+            while (piece < span_end) {
+                H5FD_direct_bounce_t *b    = &file->bounce[cur];
+                haddr_t               next = piece + b->len;
+                haddr_t               lo   = MAX(piece, addr);
+                haddr_t               hi   = MIN(next, end);
+
+                if (next < span_end &&
+                    H5FD__direct_submit(file, &file->bounce[1 - cur], FALSE,
+                                        (size_t)MIN(_cbsize, span_end - next), next) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read into bounce buffer")
+                if (H5FD__direct_complete(file, b) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read into bounce buffer")
+                H5MM_memcpy((unsigned char *)buf + (lo - addr), (unsigned char *)b->buf + (lo - piece),
+                            (size_t)(hi - lo));
+
+                piece = next;
+                cur   = 1 - cur;
+            }
+        }
     }
 
-    /* Update current position */
-    file->pos = addr;
-    file->op  = OP_READ;
-
 done:
     if (ret_value < 0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if (copy_buf)
-            HDfree(copy_buf);
+        /* Don't leave queued transfers behind */
+        H5FD__direct_drain(file);
 
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
@@ -1031,17 +1343,9 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
     ssize_t        nbytes;
     hbool_t        _must_align = TRUE;
     herr_t         ret_value   = SUCCEED; /* Return value */
-    size_t         alloc_size;
-    void *         copy_buf = NULL, *p1;
-    const void *   p3;
     size_t         _boundary;
     size_t         _fbsize;
     size_t         _cbsize;
-    haddr_t        write_addr;       /* Address to write copy buffer */
-    haddr_t        write_size;       /* Size to write from copy buffer */
-    haddr_t        read_size;        /* Size to read into copy buffer */
-    size_t         copy_size = size; /* Size remaining to write when using copy buffer */
-    size_t         copy_offset;      /* Offset into copy buffer of the data to write */
 
     FUNC_ENTER_STATIC
 
@@ -1089,144 +1393,118 @@ H5FD__direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_
             addr += (haddr_t)nbytes;
             buf = (const char *)buf + nbytes;
         }
+
+        /* Update current position and eof */
+        file->pos = addr;
+        file->op  = OP_WRITE;
+        if (file->pos > file->eof)
+            file->eof = file->pos;
     }
     else {
-        /* Calculate where we will begin reading from (on disk) and where we
-         * will begin copying from the copy buffer */
-        write_addr  = (addr / _fbsize) * _fbsize;
-        copy_offset = (size_t)(addr % _fbsize);
-
-        /* allocate memory needed for the Direct IO option up to the maximal
-         * copy buffer size. Make a bigger buffer for aligned I/O if size is
-         * smaller than maximal copy buffer.
-         */
-        alloc_size = ((copy_offset + size - 1) / _fbsize + 1) * _fbsize;
-        if (alloc_size > _cbsize)
-            alloc_size = _cbsize;
-        HDassert(!(alloc_size % _fbsize));
-
-        if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
-
-        /* look for the right position for reading or writing the data */
-        if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-
-        p3 = buf;
-        do {
-            /* Calculate how much data we have to write in this iteration
-             * (including unused parts of blocks) */
-            if ((copy_size + copy_offset) < alloc_size)
-                write_size = ((copy_size + copy_offset - 1) / _fbsize + 1) * _fbsize;
-            else
-                write_size = alloc_size;
-
-            /*
-             * Read the aligned data first if the aligned region doesn't fall
-             * entirely in the range to be written.  Not able to handle interrupted
-             * system calls and partial results like sec2 driver does because the
-             * data may no longer be aligned. It's especially true when the data in
-             * file is smaller than ALLOC_SIZE.  Only read the entire section if
-             * both ends are misaligned, otherwise only read the block on the
-             * misaligned end.
-             */
-            HDmemset(copy_buf, 0, _fbsize);
-
-            if (copy_offset > 0) {
-                if ((write_addr + write_size) > (addr + size)) {
-                    HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                    read_size = write_size;
-                    p1        = copy_buf;
-                } /* end if */
-                else {
-                    read_size = _fbsize;
-                    p1        = copy_buf;
-                } /* end else */
-            }     /* end if */
-            else if ((write_addr + write_size) > (addr + size)) {
-                HDassert((write_addr + write_size) - (addr + size) < _fbsize);
-                read_size = _fbsize;
-                p1        = (unsigned char *)copy_buf + write_size - _fbsize;
-
-                /* Seek to the last block, for reading */
-                HDassert(!((write_addr + write_size - _fbsize) % _fbsize));
-                if (HDlseek(file->fd, (HDoff_t)(write_addr + write_size - _fbsize), SEEK_SET) < 0)
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-            } /* end if */
-            else
-                p1 = NULL;
-
-            if (p1) {
-                HDassert(!(read_size % _fbsize));
-                do {
-                    nbytes = HDread(file->fd, p1, read_size);
-                } while (-1 == nbytes && EINTR == errno);
-
-                if (-1 == nbytes) /* error */
-                    HSYS_GOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
-            } /* end if */
-
-            /* look for the right position and append or copy the data to be written to
-             * the aligned buffer.
-             * Consider all possible situations here: file address is not aligned on
-             * file block size; the end of data address is not aligned; the end of data
-             * address is aligned; data size is smaller or bigger than maximal copy size.
+        haddr_t end      = addr + size;                                /* End of the data to write */
+        haddr_t core_lo  = ((addr + _fbsize - 1) / _fbsize) * _fbsize; /* First whole block */
+        haddr_t core_hi  = (end / _fbsize) * _fbsize;                  /* End of the last whole block */
+        haddr_t span_end = ((end + _fbsize - 1) / _fbsize) * _fbsize;  /* End of the last block */
+
+        /* The pool is only needed once a request isn't aligned.  The
+         * positioned writes below don't move the file offset, so `pos' and
+         * `op' stay valid. */
+        if (H5FD__direct_alloc_bounce(file) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate bounce buffers")
+
+        if (core_lo < core_hi && 0 == (size_t)((const unsigned char *)buf + (core_lo - addr)) % _boundary) {
+            H5FD_direct_bounce_t *head = NULL; /* Buffer for the partial first block */
+            H5FD_direct_bounce_t *tail = NULL; /* Buffer for the partial last block */
+
+            /* The whole blocks come from an aligned place in the caller's
+             * buffer, so write them from there directly.  The partial
+             * blocks at either end are read while the aligned core is
+             * written, then patched with the caller's bytes and written
+             * back.
              */
-            p1 = (unsigned char *)copy_buf + copy_offset;
-            if ((copy_size + copy_offset) <= alloc_size) {
-                H5MM_memcpy(p1, p3, copy_size);
-                copy_size = 0;
-            } /* end if */
-            else {
-                H5MM_memcpy(p1, p3, alloc_size - copy_offset);
-                p3 = (const unsigned char *)p3 + (alloc_size - copy_offset);
-                copy_size -= alloc_size - copy_offset;
-                copy_offset = 0;
-            } /* end else */
-
-            /*look for the aligned position for writing the data*/
-            HDassert(!(write_addr % _fbsize));
-            if (HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
-                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+            if (addr < core_lo) {
+                head = &file->bounce[0];
+                if (H5FD__direct_submit(file, head, FALSE, _fbsize, core_lo - _fbsize) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read first block")
+            }
+            if (core_hi < end) {
+                tail = &file->bounce[1];
+                if (H5FD__direct_submit(file, tail, FALSE, _fbsize, core_hi) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read last block")
+            }
+            if (H5FD__direct_pwrite(file, (const unsigned char *)buf + (core_lo - addr),
+                                    (size_t)(core_hi - core_lo), core_lo) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write aligned blocks")
+            if (head) {
+                if (H5FD__direct_complete(file, head) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read first block")
+                H5MM_memcpy((unsigned char *)head->buf + (addr - head->addr), buf, (size_t)(core_lo - addr));
+                if (H5FD__direct_submit(file, head, TRUE, _fbsize, head->addr) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write first block")
+            }
+            if (tail) {
+                if (H5FD__direct_complete(file, tail) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read last block")
+                H5MM_memcpy(tail->buf, (const unsigned char *)buf + (core_hi - addr),
+                            (size_t)(end - core_hi));
+                if (H5FD__direct_submit(file, tail, TRUE, _fbsize, tail->addr) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write last block")
+            }
+        }
+        else {
+            haddr_t  piece = (addr / _fbsize) * _fbsize; /* Start of current piece */
+            unsigned cur   = 0;                          /* Buffer of current piece */
 
             /*
-             * Write the data. It doesn't truncate the extra data introduced by
-             * alignment because that step is done in H5FD_direct_flush.
+             * Stream the blocks through the pool in pieces of at most the
+             * copy buffer size, filling one buffer while the other one is
+             * being written.  Only the partial blocks at either end of the
+             * request are read first, so their other bytes are preserved.
+             * It doesn't truncate the extra data introduced by alignment
+             * because that step is done in H5FD__direct_truncate.
              */
-            HDassert(!(write_size % _fbsize));
-            do {
-                nbytes = HDwrite(file->fd, copy_buf, write_size);
-            } while (-1 == nbytes && EINTR == errno);
-
-            if (-1 == nbytes) /* error */
-                HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-
-            /* update the write address */
-            write_addr += write_size;
-        } while (copy_size > 0);
+            while (piece < span_end) {
+                H5FD_direct_bounce_t *b    = &file->bounce[cur];
+                size_t                len  = (size_t)MIN(_cbsize, span_end - piece);
+                haddr_t               next = piece + len;
+                haddr_t               lo   = MAX(piece, addr);
+                haddr_t               hi   = MIN(next, end);
+
+                /* Wait until the buffer's previous piece is on disk */
+                if (H5FD__direct_complete(file, b) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write bounce buffer")
+
+                if (piece < addr && H5FD__direct_pread(file, b->buf, _fbsize, piece) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read first block")
+                if (end < next && !(piece < addr && next - _fbsize == piece) &&
+                    H5FD__direct_pread(file, (unsigned char *)b->buf + len - _fbsize, _fbsize,
+                                       next - _fbsize) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read last block")
+                H5MM_memcpy((unsigned char *)b->buf + (lo - piece), (const unsigned char *)buf + (lo - addr),
+                            (size_t)(hi - lo));
+                if (H5FD__direct_submit(file, b, TRUE, len, piece) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write bounce buffer")
+
+                piece = next;
+                cur   = 1 - cur;
+            }
+        }
 
-        /*Update the address and size*/
-        addr = write_addr;
-        buf  = (const char *)buf + size;
+        /* Wait for the last pieces */
+        if (H5FD__direct_complete(file, &file->bounce[0]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write bounce buffer")
+        if (H5FD__direct_complete(file, &file->bounce[1]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write bounce buffer")
 
-        if (copy_buf) {
-            /* Free with HDfree since it came from posix_memalign */
-            HDfree(copy_buf);
-            copy_buf = NULL;
-        } /* end if */
+        /* Update eof */
+        if (span_end > file->eof)
+            file->eof = span_end;
     }
 
-    /* Update current position and eof */
-    file->pos = addr;
-    file->op  = OP_WRITE;
-    if (file->pos > file->eof)
-        file->eof = file->pos;
-
 done:
     if (ret_value < 0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if (copy_buf)
-            HDfree(copy_buf);
+        /* Don't leave queued transfers behind */
+        H5FD__direct_drain(file);
 
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
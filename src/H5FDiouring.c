@@ -0,0 +1,1484 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The io_uring file driver is a POSIX driver for Linux that
+ *          performs its I/O through an io_uring submission queue instead
+ *          of one blocking pread()/pwrite() call at a time.  Each read or
+ *          write request is split into segments which are submitted
+ *          together, keeping up to `queue_depth' operations in flight
+ *          with a single system call, so that large raw data transfers
+ *          reach the bandwidth of devices that need a deep queue.
+ *
+ *          The file may optionally be opened with O_DIRECT, in which case
+ *          all I/O goes through aligned staging buffers, which may also be
+ *          registered with the ring.  When the kernel does not provide
+ *          io_uring (or it has been disabled), the driver falls back to
+ *          pread()/pwrite() on the same segments.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"    /* Generic Functions        */
+#include "H5Eprivate.h"   /* Error handling           */
+#include "H5Fprivate.h"   /* File access              */
+#include "H5FDprivate.h"  /* File drivers             */
+#include "H5FDiouring.h"  /* io_uring file driver     */
+#include "H5FLprivate.h"  /* Free Lists               */
+#include "H5Iprivate.h"   /* IDs                      */
+#include "H5MMprivate.h"  /* Memory management        */
+#include "H5Pprivate.h"   /* Property lists           */
+
+#ifdef H5_HAVE_IOURING
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Upper bound on the segment size, so that every operation's length and
+ * result fit in the 32-bit fields of the submission and completion entries
+ */
+#define H5FD_IOURING_SEGMENT_SIZE_MAX ((size_t)1 << 30)
+
+/* Wrappers for the io_uring system calls, which glibc does not provide */
+#define H5FD_IOURING_SETUP(E, P) ((int)syscall(__NR_io_uring_setup, (E), (P)))
+#define H5FD_IOURING_ENTER(FD, S, C, F)                                                                      \
+    ((int)syscall(__NR_io_uring_enter, (FD), (S), (C), (F), NULL, (size_t)0))
+#define H5FD_IOURING_REGISTER(FD, OP, ARG, N) ((int)syscall(__NR_io_uring_register, (FD), (OP), (ARG), (N)))
+
+/* Ordered access to the ring indices shared with the kernel */
+#define H5FD_IOURING_LOAD_ACQUIRE(P)     __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define H5FD_IOURING_STORE_RELEASE(P, V) __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned queue_depth;  /* Max. # of operations in flight            */
+    size_t   segment_size; /* Max. size of one operation                */
+    unsigned flags;        /* H5FD_IOURING_* flags                      */
+} H5FD_iouring_fapl_t;
+
+/* The submission and completion queues shared with the kernel */
+typedef struct H5FD_iouring_ring_t {
+    int fd; /* io_uring file descriptor, or -1 when I/O is synchronous */
+
+    /* Submission queue */
+    unsigned *           sq_head;
+    unsigned *           sq_tail;
+    unsigned *           sq_mask;
+    unsigned *           sq_array;
+    struct io_uring_sqe *sqes;
+
+    /* Completion queue */
+    unsigned *           cq_head;
+    unsigned *           cq_tail;
+    unsigned *           cq_mask;
+    struct io_uring_cqe *cqes;
+
+    /* Mapped regions */
+    void * sq_ptr;
+    size_t sq_len;
+    void * cq_ptr;
+    size_t cq_len;
+    size_t sqes_len;
+} H5FD_iouring_ring_t;
+
+/* One segment of a read or write request */
+typedef struct H5FD_iouring_op_t {
+    HDoff_t      offset;    /* File offset                                  */
+    uint8_t *    buf;       /* Memory buffer                                */
+    size_t       len;       /* # of bytes to transfer                       */
+    int          buf_index; /* Index of the registered buffer, or -1        */
+    struct iovec iov;       /* I/O vector for unregistered buffers          */
+    int          result;    /* Result from the completion queue             */
+} H5FD_iouring_op_t;
+
+/* The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  When the
+ * file is accessed through the staging buffers, writes are rounded out to
+ * whole blocks, so 'eof' may be larger than 'eoa' until the file is
+ * truncated.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub; /* public stuff, must be first      */
+    int                 fd;  /* the filesystem file descriptor   */
+    haddr_t             eoa; /* end of allocated region          */
+    haddr_t             eof; /* end of file; current file size   */
+    H5FD_iouring_fapl_t fa;  /* file access properties           */
+    hbool_t             ignore_disabled_file_locks;
+    char                filename[H5FD_MAX_FILENAME_LEN]; /* Copy of file name from open operation */
+    dev_t               device;                          /* file device number   */
+    ino_t               inode;                           /* file i-node number   */
+
+    H5FD_iouring_ring_t ring;       /* io_uring queues                                  */
+    H5FD_iouring_op_t * ops;        /* Operations of the current batch                  */
+    uint8_t *           stage;      /* Aligned staging buffers, one segment per op      */
+    hbool_t             registered; /* Whether the staging buffers are registered       */
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__iouring_term(void);
+static void *  H5FD__iouring_fapl_get(H5FD_t *file);
+static void *  H5FD__iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__iouring_close(H5FD_t *_file);
+static int     H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__iouring_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  void *buf);
+static herr_t  H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                   const void *buf);
+static herr_t  H5FD__iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__iouring_unlock(H5FD_t *_file);
+
+static hbool_t H5FD__iouring_ring_init(H5FD_iouring_t *file);
+static void    H5FD__iouring_ring_term(H5FD_iouring_t *file);
+static herr_t  H5FD__iouring_sync_read(H5FD_iouring_t *file, HDoff_t offset, uint8_t *buf, size_t len);
+static herr_t  H5FD__iouring_sync_write(H5FD_iouring_t *file, HDoff_t offset, const uint8_t *buf, size_t len);
+static herr_t  H5FD__iouring_run(H5FD_iouring_t *file, unsigned nops, hbool_t is_write);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                   /* name                 */
+    MAXADDR,                     /* maxaddr              */
+    H5F_CLOSE_WEAK,              /* fc_degree            */
+    H5FD__iouring_term,          /* terminate            */
+    NULL,                        /* sb_size              */
+    NULL,                        /* sb_encode            */
+    NULL,                        /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size            */
+    H5FD__iouring_fapl_get,      /* fapl_get             */
+    H5FD__iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                        /* fapl_free            */
+    0,                           /* dxpl_size            */
+    NULL,                        /* dxpl_copy            */
+    NULL,                        /* dxpl_free            */
+    H5FD__iouring_open,          /* open                 */
+    H5FD__iouring_close,         /* close                */
+    H5FD__iouring_cmp,           /* cmp                  */
+    H5FD__iouring_query,         /* query                */
+    NULL,                        /* get_type_map         */
+    NULL,                        /* alloc                */
+    NULL,                        /* free                 */
+    H5FD__iouring_get_eoa,       /* get_eoa              */
+    H5FD__iouring_set_eoa,       /* set_eoa              */
+    H5FD__iouring_get_eof,       /* get_eof              */
+    H5FD__iouring_get_handle,    /* get_handle           */
+    H5FD__iouring_read,          /* read                 */
+    H5FD__iouring_write,         /* write                */
+    NULL,                        /* flush                */
+    H5FD__iouring_truncate,      /* truncate             */
+    H5FD__iouring_lock,          /* lock                 */
+    H5FD__iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY         /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *
+ *              QUEUE_DEPTH is the maximum number of operations kept in
+ *              flight and SEGMENT_SIZE the largest size of one operation;
+ *              zero selects the default for either.  FLAGS is a bitwise OR
+ *              of H5FD_IOURING_DIRECT_IO and H5FD_IOURING_REGISTER_BUFFERS.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, size_t segment_size, unsigned flags)
+{
+    H5P_genplist_t *    plist; /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuzIu", fapl_id, queue_depth, segment_size, flags);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (flags & ~(H5FD_IOURING_DIRECT_IO | H5FD_IOURING_REGISTER_BUFFERS))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown flags")
+
+    HDmemset(&fa, 0, sizeof(H5FD_iouring_fapl_t));
+    fa.queue_depth  = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa.segment_size = segment_size ? segment_size : H5FD_IOURING_SEGMENT_SIZE_DEF;
+    fa.flags        = flags;
+
+    if (fa.segment_size > H5FD_IOURING_SEGMENT_SIZE_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "segment size too large")
+
+    /* Staging buffers must hold whole blocks */
+    if ((flags & (H5FD_IOURING_DIRECT_IO | H5FD_IOURING_REGISTER_BUFFERS)) &&
+        fa.segment_size % H5FD_IOURING_ALIGNMENT != 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "segment size must be a multiple of the alignment")
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access
+ *              property list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/, size_t *segment_size /*out*/,
+                    unsigned *flags /*out*/)
+{
+    H5P_genplist_t *           plist; /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, queue_depth, segment_size, flags);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (queue_depth)
+        *queue_depth = fa->queue_depth;
+    if (segment_size)
+        *segment_size = fa->segment_size;
+    if (flags)
+        *flags = fa->flags;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    void *          ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t *old_fa    = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t *      new_fa    = NULL;
+    void *                     ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_init
+ *
+ * Purpose:     Creates the io_uring instance for a file and maps its
+ *              queues, then registers the staging buffers with it if
+ *              requested.  A kernel without io_uring support (or with it
+ *              disabled) is not an error: the file then uses synchronous
+ *              I/O, and the ring's file descriptor is left at -1.
+ *
+ * Return:      TRUE if the ring can be used, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD__iouring_ring_init(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t *  ring = &file->ring;
+    struct io_uring_params params;
+    hbool_t                ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+    HDassert(ring->fd < 0);
+
+    HDmemset(&params, 0, sizeof(params));
+    if ((ring->fd = H5FD_IOURING_SETUP(file->fa.queue_depth, &params)) < 0)
+        HGOTO_DONE(FALSE)
+
+    /* Map the submission queue, completion queue and submission entries */
+    ring->sq_len   = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_len   = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_len = params.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ring->sq_ptr = HDmmap(NULL, ring->sq_len, PROT_READ | PROT_WRITE,
+                                             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING))) {
+        ring->sq_ptr = NULL;
+        HGOTO_DONE(FALSE)
+    }
+    if (MAP_FAILED == (ring->cq_ptr = HDmmap(NULL, ring->cq_len, PROT_READ | PROT_WRITE,
+                                             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING))) {
+        ring->cq_ptr = NULL;
+        HGOTO_DONE(FALSE)
+    }
+    if (MAP_FAILED == (ring->sqes = (struct io_uring_sqe *)HDmmap(NULL, ring->sqes_len,
+                                                                   PROT_READ | PROT_WRITE,
+                                                                   MAP_SHARED | MAP_POPULATE, ring->fd,
+                                                                   IORING_OFF_SQES))) {
+        ring->sqes = NULL;
+        HGOTO_DONE(FALSE)
+    }
+
+    ring->sq_head  = (unsigned *)(void *)((uint8_t *)ring->sq_ptr + params.sq_off.head);
+    ring->sq_tail  = (unsigned *)(void *)((uint8_t *)ring->sq_ptr + params.sq_off.tail);
+    ring->sq_mask  = (unsigned *)(void *)((uint8_t *)ring->sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)(void *)((uint8_t *)ring->sq_ptr + params.sq_off.array);
+    ring->cq_head  = (unsigned *)(void *)((uint8_t *)ring->cq_ptr + params.cq_off.head);
+    ring->cq_tail  = (unsigned *)(void *)((uint8_t *)ring->cq_ptr + params.cq_off.tail);
+    ring->cq_mask  = (unsigned *)(void *)((uint8_t *)ring->cq_ptr + params.cq_off.ring_mask);
+    ring->cqes     = (struct io_uring_cqe *)(void *)((uint8_t *)ring->cq_ptr + params.cq_off.cqes);
+
+    /* Register the staging buffers, if requested.  Failing to do so (for
+     * instance because of the locked memory limit) only costs the
+     * kernel some work on each operation, so it is not an error.
+     */
+    if (file->stage && (file->fa.flags & H5FD_IOURING_REGISTER_BUFFERS)) {
+        struct iovec *iovs;
+        unsigned      u;
+
+        if (NULL != (iovs = (struct iovec *)H5MM_malloc(file->fa.queue_depth * sizeof(struct iovec)))) {
+            for (u = 0; u < file->fa.queue_depth; u++) {
+                iovs[u].iov_base = file->stage + (size_t)u * file->fa.segment_size;
+                iovs[u].iov_len  = file->fa.segment_size;
+            } /* end for */
+            if (H5FD_IOURING_REGISTER(ring->fd, IORING_REGISTER_BUFFERS, iovs, file->fa.queue_depth) == 0)
+                file->registered = TRUE;
+            H5MM_xfree(iovs);
+        } /* end if */
+    }     /* end if */
+
+    ret_value = TRUE;
+
+done:
+    if (!ret_value)
+        H5FD__iouring_ring_term(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_ring_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_ring_term
+ *
+ * Purpose:     Unmaps the queues of a file's io_uring instance and closes
+ *              it.  Later I/O on the file is synchronous.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__iouring_ring_term(H5FD_iouring_t *file)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    if (ring->sqes)
+        HDmunmap(ring->sqes, ring->sqes_len);
+    if (ring->cq_ptr)
+        HDmunmap(ring->cq_ptr, ring->cq_len);
+    if (ring->sq_ptr)
+        HDmunmap(ring->sq_ptr, ring->sq_len);
+    if (ring->fd >= 0)
+        HDclose(ring->fd);
+
+    HDmemset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->fd         = -1;
+    file->registered = FALSE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__iouring_ring_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t *           file = NULL; /* io_uring VFD info        */
+    int                        fd   = -1;   /* File descriptor          */
+    int                        o_flags;     /* Flags for open() call    */
+    h5_stat_t                  sb;
+    H5P_genplist_t *           plist; /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    H5FD_t *                   ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+    if (fa->flags & H5FD_IOURING_DIRECT_IO)
+        o_flags |= O_DIRECT;
+
+    /* Open the file */
+    if ((fd = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(
+            H5E_FILE, H5E_CANTOPENFILE, NULL,
+            "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x",
+            name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if (HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device  = sb.st_dev;
+    file->inode   = sb.st_ino;
+    file->fa      = *fa;
+    file->ring.fd = -1;
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Allocate the operations for a batch, and the staging buffers they use
+     * for direct or registered I/O
+     */
+    if (NULL == (file->ops = (H5FD_iouring_op_t *)H5MM_calloc(fa->queue_depth * sizeof(H5FD_iouring_op_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate operations")
+    if (fa->flags & (H5FD_IOURING_DIRECT_IO | H5FD_IOURING_REGISTER_BUFFERS)) {
+        void *stage = NULL;
+
+        /* NOTE: Use HDfree to release this buffer, to ensure compatibility
+         *       with HDposix_memalign.
+         */
+        if (HDposix_memalign(&stage, (size_t)H5FD_IOURING_ALIGNMENT,
+                             (size_t)fa->queue_depth * fa->segment_size) != 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate staging buffers")
+        file->stage = (uint8_t *)stage;
+    } /* end if */
+
+    /* Set up the ring, falling back to synchronous I/O if that fails */
+    H5FD__iouring_ring_init(file);
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value) {
+        if (fd >= 0)
+            HDclose(fd);
+        if (file) {
+            if (file->stage)
+                HDfree(file->stage);
+            H5MM_xfree(file->ops);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+    }     /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Shut down the ring before the buffers it may refer to are released */
+    H5FD__iouring_ring_term(file);
+    if (file->stage)
+        HDfree(file->stage);
+    H5MM_xfree(file->ops);
+
+    /* Close the underlying file */
+    if (HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t *f1        = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t *f2        = (const H5FD_iouring_t *)_f2;
+    int                   ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE; /* get_handle callback returns a POSIX file descriptor */
+        *flags |= H5FD_FEAT_DEFAULT_VFD_COMPATIBLE; /* VFD creates a file which can be opened with the default
+                                                       VFD      */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__iouring_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__iouring_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__iouring_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_get_handle
+ *
+ * Purpose:     Returns the file handle of io_uring file driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_sync_read
+ *
+ * Purpose:     Reads LEN bytes at OFFSET into BUF with pread(), being
+ *              careful of interrupted system calls, partial results, and
+ *              the end of the file, which is filled with zeros.  For
+ *              staged I/O a partial result can only be the end of the
+ *              file, and is not retried at the unaligned offset.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_sync_read(H5FD_iouring_t *file, HDoff_t offset, uint8_t *buf, size_t len)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(buf);
+
+    while (len > 0) {
+        h5_posix_io_t     bytes_in   = 0;  /* # of bytes to read       */
+        h5_posix_io_ret_t bytes_read = -1; /* # of bytes actually read */
+
+        /* Trying to read more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if (len > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)len;
+
+        do {
+            bytes_read = HDpread(file->fd, buf, bytes_in, offset);
+        } while (-1 == bytes_read && EINTR == errno);
+
+        if (-1 == bytes_read) { /* error */
+            int myerrno = errno;
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL,
+                        "file read failed: filename = '%s', file descriptor = %d, errno = %d, "
+                        "error message = '%s', buf = %p, size = %llu, offset = %llu",
+                        file->filename, file->fd, myerrno, HDstrerror(myerrno), (void *)buf,
+                        (unsigned long long)len, (unsigned long long)offset);
+        } /* end if */
+
+        HDassert(bytes_read >= 0);
+        HDassert((size_t)bytes_read <= len);
+
+        len -= (size_t)bytes_read;
+        offset += bytes_read;
+        buf += bytes_read;
+
+        if (0 == bytes_read || (file->stage && len > 0)) {
+            /* end of file but not end of format address space */
+            HDmemset(buf, 0, len);
+            break;
+        } /* end if */
+    }     /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_sync_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_sync_write
+ *
+ * Purpose:     Writes LEN bytes from BUF at OFFSET with pwrite(), being
+ *              careful of interrupted system calls and partial results.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_sync_write(H5FD_iouring_t *file, HDoff_t offset, const uint8_t *buf, size_t len)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(buf);
+
+    while (len > 0) {
+        h5_posix_io_t     bytes_in    = 0;  /* # of bytes to write  */
+        h5_posix_io_ret_t bytes_wrote = -1; /* # of bytes written   */
+
+        /* Trying to write more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if (len > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)len;
+
+        do {
+            bytes_wrote = HDpwrite(file->fd, buf, bytes_in, offset);
+        } while (-1 == bytes_wrote && EINTR == errno);
+
+        if (-1 == bytes_wrote) { /* error */
+            int myerrno = errno;
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL,
+                        "file write failed: filename = '%s', file descriptor = %d, errno = %d, "
+                        "error message = '%s', buf = %p, size = %llu, offset = %llu",
+                        file->filename, file->fd, myerrno, HDstrerror(myerrno), (const void *)buf,
+                        (unsigned long long)len, (unsigned long long)offset);
+        } /* end if */
+
+        HDassert(bytes_wrote > 0);
+        HDassert((size_t)bytes_wrote <= len);
+
+        len -= (size_t)bytes_wrote;
+        offset += bytes_wrote;
+        buf += bytes_wrote;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_sync_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_run
+ *
+ * Purpose:     Performs the first NOPS operations in the file's batch.
+ *              With a ring, all of them are queued and submitted with one
+ *              system call which also waits for them to complete; partial
+ *              results are then finished synchronously.  Without a ring,
+ *              each operation is performed with pread() or pwrite().
+ *
+ *              On success every operation has transferred all of its
+ *              bytes, reads beyond the end of the file returning zeros.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_run(H5FD_iouring_t *file, unsigned nops, hbool_t is_write)
+{
+    H5FD_iouring_ring_t *ring = &file->ring;
+    unsigned             submitted;
+    unsigned             completed;
+    unsigned             u;
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(nops > 0 && nops <= file->fa.queue_depth);
+
+    /* Synchronous I/O when the ring isn't available */
+    if (ring->fd < 0) {
+        for (u = 0; u < nops; u++) {
+            H5FD_iouring_op_t *op = &file->ops[u];
+
+            if (is_write) {
+                if (H5FD__iouring_sync_write(file, op->offset, op->buf, op->len) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write segment")
+            } /* end if */
+            else if (H5FD__iouring_sync_read(file, op->offset, op->buf, op->len) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read segment")
+        } /* end for */
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Queue the operations.  This is the only thread using the ring, so the
+     * submission queue always has room for a whole batch.
+     */
+    for (u = 0; u < nops; u++) {
+        H5FD_iouring_op_t *  op    = &file->ops[u];
+        unsigned             tail  = *ring->sq_tail;
+        unsigned             index = tail & *ring->sq_mask;
+        struct io_uring_sqe *sqe   = &ring->sqes[index];
+
+        HDmemset(sqe, 0, sizeof(struct io_uring_sqe));
+        sqe->fd  = file->fd;
+        sqe->off = (uint64_t)op->offset;
+        if (op->buf_index >= 0) {
+            sqe->opcode    = is_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+            sqe->addr      = (uint64_t)(uintptr_t)op->buf;
+            sqe->len       = (uint32_t)op->len;
+            sqe->buf_index = (uint16_t)op->buf_index;
+        } /* end if */
+        else {
+            op->iov.iov_base = op->buf;
+            op->iov.iov_len  = op->len;
+            sqe->opcode      = is_write ? IORING_OP_WRITEV : IORING_OP_READV;
+            sqe->addr        = (uint64_t)(uintptr_t)&op->iov;
+            sqe->len         = 1;
+        } /* end else */
+        sqe->user_data = u;
+
+        ring->sq_array[index] = index;
+        H5FD_IOURING_STORE_RELEASE(ring->sq_tail, tail + 1);
+    } /* end for */
+
+    /* Submit the batch and wait for it with one system call.  The kernel
+     * doesn't wait when it couldn't take every entry, and never consumes
+     * more entries than are queued, so the remainder is simply submitted
+     * again.
+     */
+    submitted = 0;
+    while (submitted < nops) {
+        int ret = H5FD_IOURING_ENTER(ring->fd, nops - submitted, 0 == submitted ? nops : 0,
+                                     IORING_ENTER_GETEVENTS);
+
+        if (ret < 0 && EINTR == errno)
+            continue;
+        if (ret <= 0)
+            HSYS_GOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                            "unable to submit I/O to ring")
+        submitted += (unsigned)ret;
+    } /* end while */
+
+    /* Reap the completions */
+    completed = 0;
+    while (completed < nops) {
+        unsigned             head = *ring->cq_head;
+        struct io_uring_cqe *cqe;
+
+        if (head == H5FD_IOURING_LOAD_ACQUIRE(ring->cq_tail)) {
+            if (H5FD_IOURING_ENTER(ring->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && EINTR != errno)
+                HSYS_GOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                                "unable to wait for I/O completion")
+            continue;
+        } /* end if */
+
+        cqe = &ring->cqes[head & *ring->cq_mask];
+        HDassert(cqe->user_data < nops);
+        file->ops[cqe->user_data].result = cqe->res;
+        H5FD_IOURING_STORE_RELEASE(ring->cq_head, head + 1);
+        completed++;
+    } /* end while */
+
+    /* Check the results, and finish any partial transfers */
+    for (u = 0; u < nops; u++) {
+        H5FD_iouring_op_t *op = &file->ops[u];
+        size_t             done_len;
+
+        if (op->result < 0)
+            HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                        "file %s failed: filename = '%s', error message = '%s', size = %llu, offset = %llu",
+                        is_write ? "write" : "read", file->filename, HDstrerror(-op->result),
+                        (unsigned long long)op->len, (unsigned long long)op->offset)
+
+        done_len = (size_t)op->result;
+        if (done_len < op->len) {
+            if (is_write) {
+                if (H5FD__iouring_sync_write(file, op->offset + (HDoff_t)done_len, op->buf + done_len,
+                                             op->len - done_len) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write segment")
+            } /* end if */
+            else if (0 == done_len || file->stage)
+                /* end of file but not end of format address space */
+                HDmemset(op->buf + done_len, 0, op->len - done_len);
+            else if (H5FD__iouring_sync_read(file, op->offset + (HDoff_t)done_len, op->buf + done_len,
+                                             op->len - done_len) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read segment")
+        } /* end if */
+    }     /* end for */
+
+done:
+    /* The ring's state is unknown after a failure, so don't use it again */
+    if (ret_value < 0 && ring->fd >= 0)
+        H5FD__iouring_ring_term(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ *              The request is split into segments which are read in
+ *              batches of up to `queue_depth'.  Without staging buffers,
+ *              the segments are read directly into BUF; otherwise the
+ *              request is rounded out to whole blocks, read into the
+ *              staging buffers and copied to BUF.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                   size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+    size_t          seg  = file->fa.segment_size;
+    haddr_t         start, end, pos;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Round the request out to whole blocks when staging */
+    if (file->stage) {
+        start = addr - (addr % H5FD_IOURING_ALIGNMENT);
+        end   = ((addr + size + H5FD_IOURING_ALIGNMENT - 1) / H5FD_IOURING_ALIGNMENT) *
+                H5FD_IOURING_ALIGNMENT;
+    } /* end if */
+    else {
+        start = addr;
+        end   = addr + size;
+    } /* end else */
+
+    pos = start;
+    while (pos < end) {
+        unsigned nops;
+        unsigned u;
+
+        /* Set up the next batch of segments */
+        for (nops = 0; nops < file->fa.queue_depth && pos < end; nops++) {
+            H5FD_iouring_op_t *op = &file->ops[nops];
+
+            op->offset = (HDoff_t)pos;
+            op->len    = (size_t)MIN(seg, end - pos);
+            if (file->stage) {
+                op->buf       = file->stage + (size_t)nops * seg;
+                op->buf_index = file->registered ? (int)nops : -1;
+            } /* end if */
+            else {
+                op->buf       = (uint8_t *)buf + (pos - addr);
+                op->buf_index = -1;
+            } /* end else */
+            pos += op->len;
+        } /* end for */
+
+        if (H5FD__iouring_run(file, nops, FALSE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read from file")
+
+        /* Copy the requested part of the staged blocks */
+        if (file->stage)
+            for (u = 0; u < nops; u++) {
+                H5FD_iouring_op_t *op      = &file->ops[u];
+                haddr_t            seg_lo  = (haddr_t)op->offset;
+                haddr_t            seg_hi  = seg_lo + op->len;
+                haddr_t            copy_lo = MAX(seg_lo, addr);
+                haddr_t            copy_hi = MIN(seg_hi, addr + size);
+
+                if (copy_lo < copy_hi)
+                    H5MM_memcpy((uint8_t *)buf + (copy_lo - addr), op->buf + (copy_lo - seg_lo),
+                                (size_t)(copy_hi - copy_lo));
+            } /* end for */
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ *              The request is split into segments which are written in
+ *              batches of up to `queue_depth'.  When staging, the request
+ *              is rounded out to whole blocks, and the partial blocks at
+ *              either end are read back from the file before being
+ *              updated.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                    size_t size, const void *buf)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file;
+    size_t          seg  = file->fa.segment_size;
+    haddr_t         start, end, pos;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size)
+
+    /* Round the request out to whole blocks when staging */
+    if (file->stage) {
+        start = addr - (addr % H5FD_IOURING_ALIGNMENT);
+        end   = ((addr + size + H5FD_IOURING_ALIGNMENT - 1) / H5FD_IOURING_ALIGNMENT) *
+                H5FD_IOURING_ALIGNMENT;
+    } /* end if */
+    else {
+        start = addr;
+        end   = addr + size;
+    } /* end else */
+
+    pos = start;
+    while (pos < end) {
+        unsigned nops;
+
+        /* Set up the next batch of segments */
+        for (nops = 0; nops < file->fa.queue_depth && pos < end; nops++) {
+            H5FD_iouring_op_t *op = &file->ops[nops];
+
+            op->offset = (HDoff_t)pos;
+            op->len    = (size_t)MIN(seg, end - pos);
+            if (file->stage) {
+                haddr_t seg_lo  = pos;
+                haddr_t seg_hi  = pos + op->len;
+                haddr_t copy_lo = MAX(seg_lo, addr);
+                haddr_t copy_hi = MIN(seg_hi, addr + size);
+
+                op->buf       = file->stage + (size_t)nops * seg;
+                op->buf_index = file->registered ? (int)nops : -1;
+
+                /* Read the existing contents of partially written blocks */
+                if (seg_lo < copy_lo)
+                    if (H5FD__iouring_sync_read(file, (HDoff_t)seg_lo, op->buf, H5FD_IOURING_ALIGNMENT) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read partial block")
+                if (copy_hi < seg_hi && (seg_hi - H5FD_IOURING_ALIGNMENT) >= copy_lo)
+                    if (H5FD__iouring_sync_read(file, (HDoff_t)(seg_hi - H5FD_IOURING_ALIGNMENT),
+                                                op->buf + (op->len - H5FD_IOURING_ALIGNMENT),
+                                                H5FD_IOURING_ALIGNMENT) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read partial block")
+
+                H5MM_memcpy(op->buf + (copy_lo - seg_lo), (const uint8_t *)buf + (copy_lo - addr),
+                            (size_t)(copy_hi - copy_lo));
+            } /* end if */
+            else {
+                /* The operation only reads from the buffer */
+                H5_GCC_DIAG_OFF("cast-qual")
+                op->buf = (uint8_t *)buf + (pos - addr);
+                H5_GCC_DIAG_ON("cast-qual")
+                op->buf_index = -1;
+            } /* end else */
+            pos += op->len;
+        } /* end for */
+
+        if (H5FD__iouring_run(file, nops, TRUE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write to file")
+    } /* end while */
+
+    /* Update eof */
+    if (end > file->eof)
+        file->eof = end;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same as the
+ *              end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Extend (or, after staged writes, shrink) the file to the eoa */
+    if (!H5F_addr_eq(file->eoa, file->eof)) {
+        if (-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    int             lock_flags;                     /* file locking flags       */
+    herr_t          ret_value = SUCCEED;            /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if (HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file      = (H5FD_iouring_t *)_file; /* VFD file struct          */
+    herr_t          ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (HDflock(file->fd, LOCK_UN) < 0) {
+        if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+            /* When errno is set to ENOSYS, the file system does not support
+             * locking, so ignore it.
+             */
+            errno = 0;
+        }
+        else
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING */
@@ -0,0 +1,54 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the io_uring driver.
+ */
+#ifndef H5FDiouring_H
+#define H5FDiouring_H
+
+#ifdef H5_HAVE_IOURING
+#define H5FD_IOURING (H5FD_iouring_init())
+#else
+#define H5FD_IOURING (H5I_INVALID_HID)
+#endif /* H5_HAVE_IOURING */
+
+#ifdef H5_HAVE_IOURING
+
+/* Flags for H5Pset_fapl_iouring */
+#define H5FD_IOURING_DIRECT_IO        0x0001u /* Open the file with O_DIRECT                 */
+#define H5FD_IOURING_REGISTER_BUFFERS 0x0002u /* Register the staging buffers with the ring  */
+
+/* Default queue depth and segment size.  Application can set these values
+ * through the function H5Pset_fapl_iouring. */
+#define H5FD_IOURING_QUEUE_DEPTH_DEF  32
+#define H5FD_IOURING_SEGMENT_SIZE_DEF (256 * 1024)
+
+/* Alignment of file offsets, sizes and buffers for direct I/O */
+#define H5FD_IOURING_ALIGNMENT 4096
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t  H5FD_iouring_init(void);
+H5_DLL herr_t H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, size_t segment_size, unsigned flags);
+H5_DLL herr_t H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth /*out*/, size_t *segment_size /*out*/,
+                                  unsigned *flags /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_IOURING */
+
+#endif
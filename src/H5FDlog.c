@@ -131,6 +131,7 @@ typedef struct H5FD_log_t {
     double             total_truncate_time; /* Total time spent in truncate operations              */
     size_t             iosize;              /* Size of I/O information buffers                  */
     FILE *             logfp;               /* Log file pointer                                 */
+    double             trace_base;          /* Time the binary trace was started                */
     H5FD_log_fapl_t    fa;                  /* Driver-specific file access properties           */
 } H5FD_log_t;
 
@@ -177,6 +178,8 @@ static herr_t  H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, ha
 static herr_t  H5FD__log_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t  H5FD__log_lock(H5FD_t *_file, hbool_t rw);
 static herr_t  H5FD__log_unlock(H5FD_t *_file);
+static herr_t  H5FD__log_trace(H5FD_log_t *file, H5FD_log_trace_op_t op, H5FD_mem_t type, haddr_t addr,
+                               hsize_t size, double start);
 
 static const H5FD_class_t H5FD_log_g = {
     "log",                   /* name			*/
@@ -579,8 +582,14 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     HDstrncpy(file->filename, name, sizeof(file->filename));
     file->filename[sizeof(file->filename) - 1] = '\0';
 
-    /* Get the flags for logging */
+    /* Get the flags for logging.  A binary trace takes the whole log file,
+     * so it replaces the text output. */
     file->fa.flags = fa->flags;
+    if (file->fa.flags & H5FD_LOG_TRACE) {
+        if (NULL == fa->logfile)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "a binary trace requires a log file")
+        file->fa.flags = H5FD_LOG_TRACE;
+    } /* end if */
     if (fa->logfile)
         file->fa.logfile = H5MM_strdup(fa->logfile);
     else
@@ -605,7 +614,22 @@ H5FD__log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
         } /* end if */
 
         /* Set the log file pointer */
-        if (fa->logfile)
+        if (file->fa.flags & H5FD_LOG_TRACE) {
+            H5FD_log_trace_header_t header; /* Header of the binary trace */
+
+            if (NULL == (file->logfp = HDfopen(fa->logfile, "wb")))
+                HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open trace file")
+
+            HDmemset(&header, 0, sizeof(header));
+            header.magic    = H5FD_LOG_TRACE_MAGIC;
+            header.version  = H5FD_LOG_TRACE_VERSION;
+            header.rec_size = (uint32_t)sizeof(H5FD_log_trace_rec_t);
+            if (1 != HDfwrite(&header, sizeof(header), 1, file->logfp))
+                HSYS_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, NULL, "unable to write trace header")
+
+            file->trace_base = H5_get_time();
+        } /* end if */
+        else if (fa->logfile)
             file->logfp = HDfopen(fa->logfile, "w");
         else
             file->logfp = stderr;
@@ -654,9 +678,14 @@ done:
     if (NULL == ret_value) {
         if (fd >= 0)
             HDclose(fd);
-        if (file)
+        if (file) {
+            if (file->logfp && file->logfp != stderr)
+                HDfclose(file->logfp);
+            if (file->fa.logfile)
+                H5MM_xfree(file->fa.logfile);
             file = H5FL_FREE(H5FD_log_t, file);
-    } /* end if */
+        } /* end if */
+    }     /* end if */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_open() */
@@ -1179,6 +1208,7 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
     haddr_t       orig_addr  = addr;
     H5_timer_t    read_timer = {{0}, {0}, {0}, FALSE}; /* Timer for read operation */
     H5_timevals_t read_times;                          /* Elapsed time for read operation */
+    double        trace_start = 0.0;                   /* Start time for the binary trace */
 #ifndef H5_HAVE_PREADWRITE
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
@@ -1257,6 +1287,8 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
         H5_timer_init(&read_timer);
         H5_timer_start(&read_timer);
     } /* end if */
+    if (file->fa.flags & H5FD_LOG_TRACE)
+        trace_start = H5_get_time();
 
     /*
      * Read data, being careful of interrupted system calls, partial results,
@@ -1356,6 +1388,11 @@ H5FD__log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
             HDfprintf(file->logfp, "\n");
     } /* end if */
 
+    /* Add the read to the binary trace */
+    if ((file->fa.flags & H5FD_LOG_TRACE) &&
+        H5FD__log_trace(file, H5FD_LOG_TRACE_OP_READ, type, orig_addr, (hsize_t)orig_size, trace_start) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to trace read")
+
     /* Update current position */
     file->pos = addr;
     file->op  = OP_READ;
@@ -1393,6 +1430,7 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
     haddr_t       orig_addr   = addr;
     H5_timer_t    write_timer = {{0}, {0}, {0}, FALSE}; /* Timer for write operation */
     H5_timevals_t write_times;                          /* Elapsed time for write operation */
+    double        trace_start = 0.0;                    /* Start time for the binary trace */
 #ifndef H5_HAVE_PREADWRITE
     H5_timer_t    seek_timer; /* Timer for seek operation */
     H5_timevals_t seek_times; /* Elapsed time for seek operation */
@@ -1479,6 +1517,8 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
         H5_timer_init(&write_timer);
         H5_timer_start(&write_timer);
     } /* end if */
+    if (file->fa.flags & H5FD_LOG_TRACE)
+        trace_start = H5_get_time();
 
     /*
      * Write the data, being careful of interrupted system calls and partial
@@ -1571,6 +1611,11 @@ H5FD__log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, ha
             HDfprintf(file->logfp, "\n");
     } /* end if */
 
+    /* Add the write to the binary trace */
+    if ((file->fa.flags & H5FD_LOG_TRACE) &&
+        H5FD__log_trace(file, H5FD_LOG_TRACE_OP_WRITE, type, orig_addr, (hsize_t)orig_size, trace_start) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to trace write")
+
     /* Update current position and eof */
     file->pos = addr;
     file->op  = OP_WRITE;
@@ -1614,12 +1659,15 @@ H5FD__log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_
     if (!H5F_addr_eq(file->eoa, file->eof)) {
         H5_timer_t    trunc_timer = {{0}, {0}, {0}, FALSE}; /* Timer for truncate operation */
         H5_timevals_t trunc_times;                          /* Elapsed time for truncate operation */
+        double        trace_start = 0.0;                    /* Start time for the binary trace */
 
         /* Start timer for truncate operation */
         if (file->fa.flags & H5FD_LOG_TIME_TRUNCATE) {
             H5_timer_init(&trunc_timer);
             H5_timer_start(&trunc_timer);
         } /* end if */
+        if (file->fa.flags & H5FD_LOG_TRACE)
+            trace_start = H5_get_time();
 
 #ifdef H5_HAVE_WIN32_API
         {
@@ -1682,6 +1730,12 @@ H5FD__log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_
                 HDfprintf(file->logfp, "\n");
         } /* end if */
 
+        /* Add the truncate to the binary trace */
+        if ((file->fa.flags & H5FD_LOG_TRACE) &&
+            H5FD__log_trace(file, H5FD_LOG_TRACE_OP_TRUNCATE, H5FD_MEM_DEFAULT, (haddr_t)0,
+                            (hsize_t)file->eoa, trace_start) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to trace truncate")
+
         /* Update the eof value */
         file->eof = file->eoa;
 
@@ -1694,6 +1748,42 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__log_truncate() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__log_trace
+ *
+ * Purpose:     Appends a record for an operation that started at time
+ *              START and has just finished to the binary trace.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__log_trace(H5FD_log_t *file, H5FD_log_trace_op_t op, H5FD_mem_t type, haddr_t addr, hsize_t size,
+                double start)
+{
+    H5FD_log_trace_rec_t rec;                 /* Trace record */
+    herr_t               ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->fa.flags & H5FD_LOG_TRACE);
+
+    HDmemset(&rec, 0, sizeof(rec));
+    rec.addr    = (uint64_t)addr;
+    rec.size    = (uint64_t)size;
+    rec.start   = start - file->trace_base;
+    rec.elapsed = H5_get_time() - start;
+    rec.op      = (uint8_t)op;
+    rec.type    = (uint8_t)type;
+    if (1 != HDfwrite(&rec, sizeof(rec), 1, file->logfp))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write trace record")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__log_trace() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__log_lock
  *
@@ -60,6 +60,43 @@
 #define H5FD_LOG_ALL                                                                                         \
     (H5FD_LOG_FREE | H5FD_LOG_ALLOC | H5FD_LOG_TIME_IO | H5FD_LOG_NUM_IO | H5FD_LOG_FLAVOR |                 \
      H5FD_LOG_FILE_IO | H5FD_LOG_LOC_IO | H5FD_LOG_META_IO)
+/* Flag for writing a binary trace of the reads, writes and truncates to the
+ * log file (which is required) instead of text.  The other flags are ignored
+ * when this one is set, so it is not part of H5FD_LOG_ALL. */
+#define H5FD_LOG_TRACE 0x00100000
+
+/* The binary trace is an H5FD_log_trace_header_t followed by one
+ * H5FD_log_trace_rec_t per operation, in the byte order of the machine that
+ * wrote it.  A reader can tell a trace from a foreign machine by its magic
+ * number. */
+#define H5FD_LOG_TRACE_MAGIC   0x48354c54 /* "H5LT" */
+#define H5FD_LOG_TRACE_VERSION 1
+
+/* Operations in the binary trace */
+typedef enum H5FD_log_trace_op_t {
+    H5FD_LOG_TRACE_OP_READ = 0, /* H5FD read callback           */
+    H5FD_LOG_TRACE_OP_WRITE,    /* H5FD write callback          */
+    H5FD_LOG_TRACE_OP_TRUNCATE  /* H5FD truncate callback       */
+} H5FD_log_trace_op_t;
+
+/* Header of the binary trace */
+typedef struct H5FD_log_trace_header_t {
+    uint32_t magic;    /* H5FD_LOG_TRACE_MAGIC                       */
+    uint32_t version;  /* H5FD_LOG_TRACE_VERSION                     */
+    uint32_t rec_size; /* Size of each record, in bytes              */
+    uint32_t reserved; /* Zero                                       */
+} H5FD_log_trace_header_t;
+
+/* One record of the binary trace */
+typedef struct H5FD_log_trace_rec_t {
+    uint64_t addr;        /* Address of the I/O                                */
+    uint64_t size;        /* Bytes transferred, or the new EOF for a truncate  */
+    double   start;       /* Seconds from the file open to the operation start */
+    double   elapsed;     /* Seconds the operation took                        */
+    uint8_t  op;          /* H5FD_log_trace_op_t                               */
+    uint8_t  type;        /* H5FD_mem_t of the I/O                             */
+    uint8_t  reserved[6]; /* Zero                                              */
+} H5FD_log_trace_rec_t;
 
 #ifdef __cplusplus
 extern "C" {
@@ -54,6 +54,7 @@ typedef enum H5FD_mpio_collective_opt_t {
 } H5FD_mpio_collective_opt_t;
 
 /* Include all the MPI VFL headers */
-#include "H5FDmpio.h" /* MPI I/O file driver			*/
+#include "H5FDmpio.h"      /* MPI I/O file driver			*/
+#include "H5FDsubfiling.h" /* Subfiling file driver		*/
 
 #endif /* H5FDmpi_H */
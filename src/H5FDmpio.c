@@ -50,6 +50,16 @@ hbool_t H5FD_mpi_opt_types_g = TRUE;
  */
 static char H5FD_mpi_native_g[] = "native";
 
+/*
+ * A metadata write posted with MPI_File_iwrite_at() during a nonblocking
+ * flush, along with the copy of the data it writes.
+ */
+typedef struct H5FD_mpio_req_t {
+    MPI_Request req;  /* Request for the write                        */
+    void *      buf;  /* Copy of the data being written               */
+    int         size; /* Number of bytes being written                */
+} H5FD_mpio_req_t;
+
 /*
  * The description of a file belonging to this driver.
  * The EOF value is only used just after the file is opened in order for the
@@ -67,6 +77,14 @@ typedef struct H5FD_mpio_t {
     haddr_t  eoa;       /* End-of-address marker                        */
     haddr_t  last_eoa;  /* Last known end-of-address marker             */
     haddr_t  local_eof; /* Local end-of-file address for each process   */
+
+    /* Nonblocking flush information */
+    H5FD_mpio_req_t *   reqs;           /* Metadata writes still in progress            */
+    size_t              nreqs;          /* Number of writes still in progress           */
+    size_t              nreqs_alloc;    /* Number of writes the array can hold          */
+    hbool_t             flush_deferred; /* Whether a flush waits for its writes         */
+    hbool_t             sync_deferred;  /* Whether that flush must also sync the file   */
+    struct H5FD_mpio_t *next_closed;    /* Next file closed before its flush completed  */
 } H5FD_mpio_t;
 
 /* Private Prototypes */
@@ -90,6 +108,12 @@ static int      H5FD__mpio_mpi_rank(const H5FD_t *_file);
 static int      H5FD__mpio_mpi_size(const H5FD_t *_file);
 static MPI_Comm H5FD__mpio_communicator(const H5FD_t *_file);
 
+/* Other routines */
+static herr_t H5FD__mpio_wait_writes(H5FD_mpio_t *file);
+static herr_t H5FD__mpio_set_size(H5FD_mpio_t *file, hbool_t barrier);
+static herr_t H5FD__mpio_finish_close(H5FD_mpio_t *file);
+static herr_t H5FD__mpio_finish_closes(MPI_Comm comm);
+
 /* The MPIO file driver information */
 static const H5FD_class_mpi_t H5FD_mpio_g = {
     {
@@ -132,6 +156,14 @@ static const H5FD_class_mpi_t H5FD_mpio_g = {
     H5FD__mpio_communicator    /*get_comm              */
 };
 
+/* Files closed while their last flush was still in progress, oldest first.
+ * They are closed for good by the next open or close of a file on the same
+ * communicator, by H5Fwait_flush() on such a file, or when the library
+ * shuts down.
+ */
+static H5FD_mpio_t *H5FD_mpio_closed_head_g = NULL;
+static H5FD_mpio_t *H5FD_mpio_closed_tail_g = NULL;
+
 #ifdef H5FDmpio_DEBUG
 /* Flags to control debug actions in H5Fmpio.
  * Meant to be indexed by characters.
@@ -254,12 +286,47 @@ done:
 static herr_t
 H5FD__mpio_term(void)
 {
-    FUNC_ENTER_STATIC_NOERR
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Close the files still waiting for their last flush */
+    if (H5FD_mpio_closed_head_g) {
+        int mpi_finalized = 0;
+
+        MPI_Finalized(&mpi_finalized);
+        if (!mpi_finalized) {
+            /* Each attempt takes at least one file off the list, so go on
+             * with the others after a failure
+             */
+            while (H5FD_mpio_closed_head_g)
+                if (H5FD__mpio_finish_closes(MPI_COMM_NULL) < 0)
+                    HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close file with deferred flush")
+        } /* end if */
+        else {
+            /* MPI calls are no longer possible, so the writes can't be
+             * completed: report the loss and release the memory
+             */
+            HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL,
+                        "MPI finalized before the deferred flushes of closed files completed")
+            while (H5FD_mpio_closed_head_g) {
+                H5FD_mpio_t *file = H5FD_mpio_closed_head_g;
+                size_t       u;
+
+                H5FD_mpio_closed_head_g = file->next_closed;
+                for (u = 0; u < file->nreqs; u++)
+                    H5MM_xfree(file->reqs[u].buf);
+                H5MM_xfree(file->reqs);
+                H5MM_xfree(file);
+            } /* end while */
+        }     /* end else */
+        H5FD_mpio_closed_head_g = H5FD_mpio_closed_tail_g = NULL;
+    } /* end if */
 
     /* Reset VFL ID */
     H5FD_MPIO_g = 0;
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__mpio_term() */
 
 /*-------------------------------------------------------------------------
@@ -729,6 +796,119 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_get_mpio_atomicity() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mpio_defer_flush
+ *
+ * Purpose:     Marks the file as flushed with metadata writes that may
+ *              still be in progress.  Until H5FD_mpio_complete_flush() is
+ *              called, the truncation and sync requests that end the
+ *              flush are put off, and closing the file leaves it open
+ *              until the writes of all processes have completed.
+ *
+ *              All processes must call this function together.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_mpio_defer_flush(H5FD_t *_file)
+{
+    H5FD_mpio_t *file = (H5FD_mpio_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+
+    file->flush_deferred = TRUE;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mpio_defer_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mpio_complete_flush
+ *
+ * Purpose:     Completes a flush deferred with H5FD_mpio_defer_flush():
+ *              waits for this process's metadata writes, waits for the
+ *              other processes to do the same, and then truncates and
+ *              syncs the file as the flush requested.  This is
+ *              collective.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_mpio_complete_flush(H5FD_t *_file)
+{
+    H5FD_mpio_t *file = (H5FD_mpio_t *)_file;
+    int          mpi_code; /* MPI return code */
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+
+    if (file->flush_deferred) {
+        if (H5FD__mpio_wait_writes(file) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't complete metadata writes")
+
+        /* Once all processes are past this barrier, all the writes of the
+         * flush have completed.
+         */
+        if (MPI_SUCCESS != (mpi_code = MPI_Barrier(file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_code)
+        file->flush_deferred = FALSE;
+
+        if (H5FD__mpio_set_size(file, FALSE) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "can't set the file's size")
+
+        if (file->sync_deferred) {
+            file->sync_deferred = FALSE;
+            if (MPI_SUCCESS != (mpi_code = MPI_File_sync(file->f)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_sync failed", mpi_code)
+        } /* end if */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mpio_complete_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mpio_wait_closes
+ *
+ * Purpose:     Finishes closing the files whose last flush was still in
+ *              progress when they were closed, if their communicator has
+ *              the same processes as the one of FILE.  This is collective
+ *              over those processes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_mpio_wait_closes(H5FD_t *_file)
+{
+    H5FD_mpio_t *file      = (H5FD_mpio_t *)_file;
+    herr_t       ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+
+    if (H5FD_mpio_closed_head_g && H5FD__mpio_finish_closes(file->comm) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close files with deferred flushes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mpio_wait_closes() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5FD__mpio_open
  *
@@ -806,6 +986,12 @@ H5FD__mpio_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t H5_ATTR
     }     /* end if */
 #endif
 
+    /* Finish closing the files on this communicator whose last flush was
+     * still in progress, in case this opens one of them again.
+     */
+    if (H5FD_mpio_closed_head_g && H5FD__mpio_finish_closes(comm) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, NULL, "can't close files with deferred flushes")
+
     if (MPI_SUCCESS != (mpi_code = MPI_File_open(comm, name, mpi_amode, info, &fh)))
         HMPI_GOTO_ERROR(NULL, "MPI_File_open failed", mpi_code)
     file_opened = TRUE;
@@ -905,6 +1091,27 @@ H5FD__mpio_close(H5FD_t *_file)
     HDassert(file);
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
+    /* Finish closing the earlier files on this communicator whose last
+     * flush was still in progress, so that their failures are reported.
+     * Go on closing this file after a failure.
+     */
+    if (H5FD_mpio_closed_head_g && H5FD__mpio_finish_closes(file->comm) < 0)
+        HDONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close files with deferred flushes")
+
+    /* If the last flush is still in progress, leave the file open until
+     * it completes (see H5FD__mpio_finish_closes)
+     */
+    if (file->flush_deferred) {
+        file->next_closed = NULL;
+        if (H5FD_mpio_closed_tail_g)
+            H5FD_mpio_closed_tail_g->next_closed = file;
+        else
+            H5FD_mpio_closed_head_g = file;
+        H5FD_mpio_closed_tail_g = file;
+
+        HGOTO_DONE(ret_value)
+    } /* end if */
+
     /* MPI_File_close sets argument to MPI_FILE_NULL */
     if (MPI_SUCCESS != (mpi_code = MPI_File_close(&(file->f) /*in,out*/)))
         HMPI_GOTO_ERROR(FAIL, "MPI_File_close failed", mpi_code)
@@ -912,6 +1119,7 @@ H5FD__mpio_close(H5FD_t *_file)
     /* Clean up other stuff */
     H5_mpi_comm_free(&file->comm);
     H5_mpi_info_free(&file->info);
+    H5MM_xfree(file->reqs);
     H5MM_xfree(file);
 
 done:
@@ -1468,6 +1676,44 @@ H5FD__mpio_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, h
                                                          H5FD_mpi_native_g, file->info)))
             HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
     } /* end if */
+    else if (H5CX_get_mpi_nonblocking_writes() && !derived_type) {
+        H5FD_mpio_req_t *req;
+
+        /* Post the write and return without waiting for it.  It completes
+         * in H5FD__mpio_wait_writes(), so write a copy of the data the
+         * caller may reuse right away.
+         */
+        if (file->nreqs == file->nreqs_alloc) {
+            size_t           new_alloc = MAX(16, 2 * file->nreqs_alloc);
+            H5FD_mpio_req_t *new_reqs;
+
+            if (NULL ==
+                (new_reqs = (H5FD_mpio_req_t *)H5MM_realloc(file->reqs, new_alloc * sizeof(H5FD_mpio_req_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't grow the write request array")
+            file->reqs        = new_reqs;
+            file->nreqs_alloc = new_alloc;
+        } /* end if */
+        req = &file->reqs[file->nreqs];
+
+        if (NULL == (req->buf = H5MM_malloc(size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate write buffer")
+        H5MM_memcpy(req->buf, buf, size);
+        req->size = size_i;
+
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_File_iwrite_at(file->f, mpi_off, req->buf, size_i, MPI_BYTE, &req->req))) {
+            req->buf = H5MM_xfree(req->buf);
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_iwrite_at failed", mpi_code)
+        } /* end if */
+        file->nreqs++;
+
+        /* Track the EOF as below, assuming the write succeeds */
+        file->eof = HADDR_UNDEF;
+        if (size && ((addr + size) > file->local_eof))
+            file->local_eof = addr + size;
+
+        HGOTO_DONE(SUCCEED)
+    } /* end else-if */
     else if (MPI_SUCCESS !=
              (mpi_code = MPI_File_write_at(file->f, mpi_off, buf, size_i, buf_type, &mpi_stat)))
         HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at failed", mpi_code)
@@ -1548,10 +1794,16 @@ H5FD__mpio_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing)
     HDassert(file);
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
-    /* Only sync the file if we are not going to immediately close it */
-    if (!closing)
-        if (MPI_SUCCESS != (mpi_code = MPI_File_sync(file->f)))
+    /* Only sync the file if we are not going to immediately close it.  A
+     * sync can't cover metadata writes still in progress, so it waits for
+     * them in H5FD_mpio_complete_flush().
+     */
+    if (!closing) {
+        if (file->flush_deferred)
+            file->sync_deferred = TRUE;
+        else if (MPI_SUCCESS != (mpi_code = MPI_File_sync(file->f)))
             HMPI_GOTO_ERROR(FAIL, "MPI_File_sync failed", mpi_code)
+    } /* end if */
 
 done:
 #ifdef H5FDmpio_DEBUG
@@ -1601,6 +1853,44 @@ H5FD__mpio_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR
     HDassert(file);
     HDassert(H5FD_MPIO == file->pub.driver_id);
 
+    /* The size can't be changed while metadata writes are in progress, so
+     * a deferred flush truncates the file in H5FD_mpio_complete_flush().
+     *
+     * Otherwise, check the "MPI file closing" flag in the API context to
+     * determine if we can skip the barrier.
+     */
+    if (!file->flush_deferred)
+        if (H5FD__mpio_set_size(file, !H5CX_get_mpi_file_flushing()) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTUPDATE, FAIL, "can't set the file's size")
+
+done:
+#ifdef H5FDmpio_DEBUG
+    if (H5FD_mpio_Debug[(int)'t'])
+        HDfprintf(stdout, "%s: Leaving\n", FUNC);
+#endif
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_set_size
+ *
+ * Purpose:     Sets the file's size to its allocated size for
+ *              H5FD__mpio_truncate(), if the EOA has changed since the
+ *              last call.  When BARRIER is false, the caller guarantees
+ *              that the writes of all processes have completed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_set_size(H5FD_mpio_t *file, hbool_t barrier)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
     if (!H5F_addr_eq(file->eoa, file->last_eoa)) {
         int        mpi_code; /* mpi return code */
         MPI_Offset size;
@@ -1614,11 +1904,8 @@ H5FD__mpio_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR
          * In practice, most (all?) truncate calls will come after a barrier
          * and with no interviening writes to the file (with the possible
          * exception of sueprblock / superblock extension message updates).
-         *
-         * Check the "MPI file closing" flag in the API context to determine
-         * if we can skip the barrier.
          */
-        if (!H5CX_get_mpi_file_flushing())
+        if (barrier)
             if (MPI_SUCCESS != (mpi_code = MPI_Barrier(file->comm)))
                 HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_code)
 
@@ -1661,13 +1948,137 @@ H5FD__mpio_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR
     } /* end if */
 
 done:
-#ifdef H5FDmpio_DEBUG
-    if (H5FD_mpio_Debug[(int)'t'])
-        HDfprintf(stdout, "%s: Leaving\n", FUNC);
-#endif
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_set_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_wait_writes
+ *
+ * Purpose:     Waits for the metadata writes this process posted during a
+ *              nonblocking flush and releases their data.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_wait_writes(H5FD_mpio_t *file)
+{
+    size_t u;                   /* Local index variable */
+    int    mpi_code;            /* MPI return code */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Wait for every write, even after a failure, before releasing the data */
+    for (u = 0; u < file->nreqs; u++) {
+        MPI_Status mpi_stat;
+        int        bytes_written;
+
+        /* Portably initialize MPI status variable */
+        HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+
+        if (MPI_SUCCESS != (mpi_code = MPI_Wait(&file->reqs[u].req, &mpi_stat)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Wait failed", mpi_code)
+        else if (MPI_SUCCESS != (mpi_code = MPI_Get_count(&mpi_stat, MPI_BYTE, &bytes_written)))
+            HMPI_DONE_ERROR(FAIL, "MPI_Get_count failed", mpi_code)
+        else if (bytes_written != file->reqs[u].size)
+            HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+        file->reqs[u].buf = H5MM_xfree(file->reqs[u].buf);
+    } /* end for */
+    file->nreqs = 0;
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5FD__mpio_truncate() */
+} /* end H5FD__mpio_wait_writes() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_finish_close
+ *
+ * Purpose:     Closes a file that H5FD__mpio_close() left open because
+ *              its last flush was still in progress.  This is collective.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_finish_close(H5FD_mpio_t *file)
+{
+    int    mpi_code;            /* MPI return code */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (H5FD_mpio_complete_flush((H5FD_t *)file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFLUSH, FAIL, "can't complete flush")
+
+    /* MPI_File_close sets argument to MPI_FILE_NULL */
+    if (MPI_SUCCESS != (mpi_code = MPI_File_close(&(file->f) /*in,out*/)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_File_close failed", mpi_code)
+
+done:
+    /* Clean up other stuff */
+    H5_mpi_comm_free(&file->comm);
+    H5_mpi_info_free(&file->info);
+    H5MM_xfree(file->reqs);
+    H5MM_xfree(file);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_finish_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__mpio_finish_closes
+ *
+ * Purpose:     Finishes closing the files left open by H5FD__mpio_close()
+ *              whose communicator has the same processes as COMM, in the
+ *              order they were closed, or all of them if COMM is
+ *              MPI_COMM_NULL.  This is collective over those processes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__mpio_finish_closes(MPI_Comm comm)
+{
+    H5FD_mpio_t *file;                /* Current file */
+    H5FD_mpio_t *prev = NULL;         /* File before the current one in the list */
+    H5FD_mpio_t *next;                /* File after the current one in the list */
+    int          mpi_code;            /* MPI return code */
+    herr_t       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    for (file = H5FD_mpio_closed_head_g; file; file = next) {
+        next = file->next_closed;
+
+        if (MPI_COMM_NULL != comm) {
+            int result;
+
+            if (MPI_SUCCESS != (mpi_code = MPI_Comm_compare(comm, file->comm, &result)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Comm_compare failed", mpi_code)
+            if (MPI_IDENT != result && MPI_CONGRUENT != result) {
+                prev = file;
+                continue;
+            } /* end if */
+        }     /* end if */
+
+        /* Unlink the file from the list */
+        if (prev)
+            prev->next_closed = next;
+        else
+            H5FD_mpio_closed_head_g = next;
+        if (H5FD_mpio_closed_tail_g == file)
+            H5FD_mpio_closed_tail_g = prev;
+
+        if (H5FD__mpio_finish_close(file) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "can't close file")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__mpio_finish_closes() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__mpio_mpi_rank
@@ -152,6 +152,9 @@ H5_DLL herr_t H5FD_mpio_signal_right_neighbor(H5FD_t *file);
 #endif /* NOT_YET */
 H5_DLL herr_t H5FD_set_mpio_atomicity(H5FD_t *file, hbool_t flag);
 H5_DLL herr_t H5FD_get_mpio_atomicity(H5FD_t *file, hbool_t *flag);
+H5_DLL herr_t H5FD_mpio_defer_flush(H5FD_t *file);
+H5_DLL herr_t H5FD_mpio_complete_flush(H5FD_t *file);
+H5_DLL herr_t H5FD_mpio_wait_closes(H5FD_t *file);
 
 /* Driver specific methods */
 H5_DLL int      H5FD_mpi_get_rank(const H5FD_t *file);
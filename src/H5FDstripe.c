@@ -0,0 +1,1379 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The striping file driver spreads the HDF5 address space over a
+ *          fixed number of member files, RAID-0 fashion: the address space
+ *          is cut into stripe units of `stripe_size' bytes which are
+ *          assigned to the members round-robin, so that unit S lives in
+ *          member S % N at offset (S / N) * stripe_size.  The members are
+ *          meant to be placed on different devices, and are named with a
+ *          printf(3C)-style template in which a single integer format
+ *          (such as "%d") is replaced by the member number, e.g.
+ *          "/mnt/ssd%d/file.h5".
+ *
+ *          The part of a request which belongs to each member is
+ *          transferred by a small pool of threads, so that one large read
+ *          or write keeps all of the devices busy.  The threads perform
+ *          only POSIX I/O on the member file descriptors and never call
+ *          into the library.
+ *
+ *          Unlike the family driver, the number of members is fixed and
+ *          every member grows as the file grows.  The number of members
+ *          and the stripe unit are recorded in the superblock and checked
+ *          when the file is opened.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions        */
+#include "H5Eprivate.h"  /* Error handling           */
+#include "H5Fprivate.h"  /* File access              */
+#include "H5FDprivate.h" /* File drivers             */
+#include "H5FDstripe.h"  /* Striping file driver     */
+#include "H5FLprivate.h" /* Free Lists               */
+#include "H5Iprivate.h"  /* IDs                      */
+#include "H5MMprivate.h" /* Memory management        */
+#include "H5Pprivate.h"  /* Property lists           */
+
+#ifdef H5_HAVE_STRIPE_VFD
+
+#include <pthread.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_STRIPE_g = 0;
+
+/* Whether to ignore file locks when disabled (env var value) */
+static htri_t ignore_disabled_file_locks_s = FAIL;
+
+/* Name and version number of the driver information in the superblock */
+#define H5FD_STRIPE_SB_NAME "HDF5strp"
+
+/* Driver-specific file access properties */
+typedef struct H5FD_stripe_fapl_t {
+    unsigned nmembers;    /* # of member files                         */
+    size_t   stripe_size; /* Size of a stripe unit                     */
+    unsigned nthreads;    /* Max. # of members transferred at once     */
+} H5FD_stripe_fapl_t;
+
+/* The part of the current request which belongs to one member */
+typedef struct H5FD_stripe_task_t {
+    unsigned memb;       /* Member index                                    */
+    int      err;        /* errno of a failed transfer, or 0                */
+    HDoff_t  err_offset; /* Member file offset of the failed transfer       */
+} H5FD_stripe_task_t;
+
+/* The pool of I/O threads.  The calling thread also performs tasks, so
+ * the pool has one thread less than the number of members which may be
+ * transferred at once.
+ */
+typedef struct H5FD_stripe_pool_t {
+    pthread_mutex_t mutex;     /* Protects the fields below                  */
+    pthread_cond_t  work_cond; /* Signaled when tasks are posted             */
+    pthread_cond_t  done_cond; /* Signaled when the last task is finished    */
+    pthread_t *     threads;   /* The threads started                        */
+    unsigned        nthreads;  /* # of threads started                       */
+    unsigned        ntasks;    /* # of tasks in the current request          */
+    unsigned        next;      /* Index of the next task to perform          */
+    unsigned        pending;   /* # of tasks not yet finished                */
+    hbool_t         shutdown;  /* Whether the threads should exit            */
+} H5FD_stripe_pool_t;
+
+/* The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file, as computed from the sizes of the member files.
+ */
+typedef struct H5FD_stripe_t {
+    H5FD_t             pub;  /* public stuff, must be first                  */
+    int *              fds;  /* the member file descriptors                  */
+    haddr_t            eoa;  /* end of allocated region                      */
+    haddr_t            eof;  /* end of file; determined by the member sizes  */
+    H5FD_stripe_fapl_t fa;   /* file access properties                       */
+    hbool_t            ignore_disabled_file_locks;
+    char               filename[H5FD_MAX_FILENAME_LEN]; /* Member name template from open operation */
+    dev_t              device;                          /* member 0 device number   */
+    ino_t              inode;                           /* member 0 i-node number   */
+
+    /* The request being performed, and its tasks */
+    hbool_t             is_write; /* Whether the request is a write             */
+    haddr_t             addr;     /* Address of the request                     */
+    size_t              size;     /* Size of the request                        */
+    uint8_t *           buf;      /* Buffer of the request                      */
+    H5FD_stripe_task_t *tasks;    /* One task per member                        */
+
+    H5FD_stripe_pool_t pool;      /* I/O threads                                */
+    hbool_t            pool_init; /* Whether the pool's mutex and conditions exist */
+} H5FD_stripe_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR          (((haddr_t)1 << (8 * sizeof(HDoff_t) - 1)) - 1)
+#define ADDR_OVERFLOW(A) (HADDR_UNDEF == (A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z) ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A, Z)                                                                                \
+    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) || HADDR_UNDEF == (A) + (Z) || (HDoff_t)((A) + (Z)) < (HDoff_t)(A))
+
+/* Prototypes */
+static herr_t  H5FD__stripe_term(void);
+static void *  H5FD__stripe_fapl_get(H5FD_t *file);
+static void *  H5FD__stripe_fapl_copy(const void *_old_fa);
+static hsize_t H5FD__stripe_sb_size(H5FD_t *_file);
+static herr_t  H5FD__stripe_sb_encode(H5FD_t *_file, char *name /*out*/, unsigned char *buf /*out*/);
+static herr_t  H5FD__stripe_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf);
+static H5FD_t *H5FD__stripe_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t  H5FD__stripe_close(H5FD_t *_file);
+static int     H5FD__stripe_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t  H5FD__stripe_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD__stripe_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__stripe_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD__stripe_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD__stripe_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t  H5FD__stripe_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                 void *buf);
+static herr_t  H5FD__stripe_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr, size_t size,
+                                  const void *buf);
+static herr_t  H5FD__stripe_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t  H5FD__stripe_lock(H5FD_t *_file, hbool_t rw);
+static herr_t  H5FD__stripe_unlock(H5FD_t *_file);
+
+static herr_t H5FD__stripe_pool_start(H5FD_stripe_t *file);
+static void   H5FD__stripe_pool_stop(H5FD_stripe_t *file);
+static herr_t H5FD__stripe_run(H5FD_stripe_t *file, hbool_t is_write, haddr_t addr, size_t size,
+                               uint8_t *buf);
+static void * H5FD__stripe_worker(void *_file);
+static void   H5FD__stripe_do_task(const H5FD_stripe_t *file, H5FD_stripe_task_t *task);
+
+static const H5FD_class_t H5FD_stripe_g = {
+    "stripe",                   /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD__stripe_term,          /* terminate            */
+    H5FD__stripe_sb_size,       /* sb_size              */
+    H5FD__stripe_sb_encode,     /* sb_encode            */
+    H5FD__stripe_sb_decode,     /* sb_decode            */
+    sizeof(H5FD_stripe_fapl_t), /* fapl_size            */
+    H5FD__stripe_fapl_get,      /* fapl_get             */
+    H5FD__stripe_fapl_copy,     /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD__stripe_open,          /* open                 */
+    H5FD__stripe_close,         /* close                */
+    H5FD__stripe_cmp,           /* cmp                  */
+    H5FD__stripe_query,         /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD__stripe_get_eoa,       /* get_eoa              */
+    H5FD__stripe_set_eoa,       /* set_eoa              */
+    H5FD__stripe_get_eof,       /* get_eof              */
+    H5FD__stripe_get_handle,    /* get_handle           */
+    H5FD__stripe_read,          /* read                 */
+    H5FD__stripe_write,         /* write                */
+    NULL,                       /* flush                */
+    H5FD__stripe_truncate,      /* truncate             */
+    H5FD__stripe_lock,          /* lock                 */
+    H5FD__stripe_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+};
+
+/* Declare a free list to manage the H5FD_stripe_t struct */
+H5FL_DEFINE_STATIC(H5FD_stripe_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    char * lock_env_var = NULL; /* Environment variable pointer */
+    herr_t ret_value    = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    /* Check the use disabled file locks environment variable */
+    lock_env_var = HDgetenv("HDF5_USE_FILE_LOCKING");
+    if (lock_env_var && !HDstrcmp(lock_env_var, "BEST_EFFORT"))
+        ignore_disabled_file_locks_s = TRUE; /* Override: Ignore disabled locks */
+    else if (lock_env_var && (!HDstrcmp(lock_env_var, "TRUE") || !HDstrcmp(lock_env_var, "1")))
+        ignore_disabled_file_locks_s = FALSE; /* Override: Don't ignore disabled locks */
+    else
+        ignore_disabled_file_locks_s = FAIL; /* Environment variable not set, or not set correctly */
+
+    if (H5FD_stripe_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize stripe VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_stripe_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the striping driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_stripe_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    if (H5I_VFL != H5I_get_type(H5FD_STRIPE_g))
+        H5FD_STRIPE_g = H5FD_register(&H5FD_stripe_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_STRIPE_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_stripe_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__stripe_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_STRIPE_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_stripe
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_STRIPE driver defined in this source file.
+ *
+ *              NMEMBERS is the number of member files, which must be at
+ *              least two.  STRIPE_SIZE is the size of a stripe unit; zero
+ *              selects the default.  NTHREADS is the largest number of
+ *              members transferred at once; zero transfers all members
+ *              of a request at once and one transfers them one after
+ *              another in the calling thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_stripe(hid_t fapl_id, unsigned nmembers, size_t stripe_size, unsigned nthreads)
+{
+    H5P_genplist_t *   plist; /* Property list pointer */
+    H5FD_stripe_fapl_t fa;
+    herr_t             ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iIuzIu", fapl_id, nmembers, stripe_size, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if (nmembers < 2 || nmembers > H5FD_STRIPE_MAX_MEMBERS)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid number of members")
+
+    HDmemset(&fa, 0, sizeof(H5FD_stripe_fapl_t));
+    fa.nmembers    = nmembers;
+    fa.stripe_size = stripe_size ? stripe_size : H5FD_STRIPE_SIZE_DEF;
+    fa.nthreads    = (nthreads && nthreads < nmembers) ? nthreads : nmembers;
+
+    ret_value = H5P_set_driver(plist, H5FD_STRIPE, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_stripe() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_stripe
+ *
+ * Purpose:     Returns information about the striping file access
+ *              property list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_stripe(hid_t fapl_id, unsigned *nmembers /*out*/, size_t *stripe_size /*out*/,
+                   unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *          plist; /* Property list pointer */
+    const H5FD_stripe_fapl_t *fa;
+    herr_t                    ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, nmembers, stripe_size, nthreads);
+
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_STRIPE != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_stripe_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if (nmembers)
+        *nmembers = fa->nmembers;
+    if (stripe_size)
+        *stripe_size = fa->stripe_size;
+    if (nthreads)
+        *nthreads = fa->nthreads;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_stripe() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__stripe_fapl_get(H5FD_t *_file)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    void *         ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__stripe_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_fapl_copy
+ *
+ * Purpose:     Copies the striping-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__stripe_fapl_copy(const void *_old_fa)
+{
+    const H5FD_stripe_fapl_t *old_fa    = (const H5FD_stripe_fapl_t *)_old_fa;
+    H5FD_stripe_fapl_t *      new_fa    = NULL;
+    void *                    ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (new_fa = (H5FD_stripe_fapl_t *)H5MM_malloc(sizeof(H5FD_stripe_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_stripe_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_sb_size
+ *
+ * Purpose:     Returns the size of the private information to be stored in
+ *              the superblock.
+ *
+ * Return:      Success:    The super block driver data size
+ *              Failure:    never fails
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5FD__stripe_sb_size(H5FD_t H5_ATTR_UNUSED *_file)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* The number of members and the stripe unit, 8 bytes each */
+    FUNC_LEAVE_NOAPI(16)
+} /* end H5FD__stripe_sb_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_sb_encode
+ *
+ * Purpose:     Encode driver information for the superblock. The NAME
+ *              argument is a nine-byte buffer which will be initialized
+ *              with an eight-character name/version number and null
+ *              termination.
+ *
+ *              The encoding is the number of members and the stripe unit.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_sb_encode(H5FD_t *_file, char *name /*out*/, unsigned char *buf /*out*/)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Name and version number */
+    HDstrncpy(name, H5FD_STRIPE_SB_NAME, (size_t)9);
+    name[8] = '\0';
+
+    UINT64ENCODE(buf, (uint64_t)file->fa.nmembers);
+    UINT64ENCODE(buf, (uint64_t)file->fa.stripe_size);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_sb_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_sb_decode
+ *
+ * Purpose:     Decodes the superblock information for this driver, and
+ *              checks that the file is being accessed with the number of
+ *              members and the stripe unit it was created with.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+    uint64_t       nmembers;
+    uint64_t       stripe_size;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (HDstrncmp(name, H5FD_STRIPE_SB_NAME, (size_t)8) != 0)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file was not created with the stripe driver")
+
+    UINT64DECODE(buf, nmembers);
+    UINT64DECODE(buf, stripe_size);
+
+    if (nmembers != (uint64_t)file->fa.nmembers)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL,
+                    "file has %llu stripe members, but the file access property has %u",
+                    (unsigned long long)nmembers, file->fa.nmembers)
+    if (stripe_size != (uint64_t)file->fa.stripe_size)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL,
+                    "file has a stripe size of %llu, but the file access property has %llu",
+                    (unsigned long long)stripe_size, (unsigned long long)file->fa.stripe_size)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_sb_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_pool_start
+ *
+ * Purpose:     Starts the I/O threads of a file.  If fewer threads than
+ *              requested can be started, the file uses the ones which
+ *              were.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_pool_start(H5FD_stripe_t *file)
+{
+    H5FD_stripe_pool_t *pool = &file->pool;
+    unsigned            nthreads;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(!file->pool_init);
+
+    /* The calling thread performs one of the tasks */
+    if ((nthreads = file->fa.nthreads - 1) == 0)
+        HGOTO_DONE(SUCCEED)
+
+    if (NULL == (pool->threads = (pthread_t *)H5MM_malloc(nthreads * sizeof(pthread_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate threads")
+    if (pthread_mutex_init(&pool->mutex, NULL) != 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize mutex")
+    if (pthread_cond_init(&pool->work_cond, NULL) != 0) {
+        pthread_mutex_destroy(&pool->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize condition variable")
+    } /* end if */
+    if (pthread_cond_init(&pool->done_cond, NULL) != 0) {
+        pthread_cond_destroy(&pool->work_cond);
+        pthread_mutex_destroy(&pool->mutex);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize condition variable")
+    } /* end if */
+    file->pool_init = TRUE;
+
+    for (pool->nthreads = 0; pool->nthreads < nthreads; pool->nthreads++)
+        if (pthread_create(&pool->threads[pool->nthreads], NULL, H5FD__stripe_worker, file) != 0)
+            break;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_pool_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_pool_stop
+ *
+ * Purpose:     Stops the I/O threads of a file and releases the pool.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__stripe_pool_stop(H5FD_stripe_t *file)
+{
+    H5FD_stripe_pool_t *pool = &file->pool;
+    unsigned            u;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(file);
+
+    if (file->pool_init) {
+        pthread_mutex_lock(&pool->mutex);
+        pool->shutdown = TRUE;
+        pthread_cond_broadcast(&pool->work_cond);
+        pthread_mutex_unlock(&pool->mutex);
+
+        for (u = 0; u < pool->nthreads; u++)
+            pthread_join(pool->threads[u], NULL);
+
+        pthread_cond_destroy(&pool->done_cond);
+        pthread_cond_destroy(&pool->work_cond);
+        pthread_mutex_destroy(&pool->mutex);
+        file->pool_init = FALSE;
+    } /* end if */
+
+    pool->threads  = (pthread_t *)H5MM_xfree(pool->threads);
+    pool->nthreads = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD__stripe_pool_stop() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_worker
+ *
+ * Purpose:     The body of an I/O thread: performs the tasks of each
+ *              request as they are posted, until the pool is shut down.
+ *
+ *              This runs outside of the library's API lock, so it must
+ *              not use the function enter/leave macros or the error stack.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__stripe_worker(void *_file)
+{
+    H5FD_stripe_t *     file = (H5FD_stripe_t *)_file;
+    H5FD_stripe_pool_t *pool = &file->pool;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        unsigned t;
+
+        while (!pool->shutdown && pool->next >= pool->ntasks)
+            pthread_cond_wait(&pool->work_cond, &pool->mutex);
+        if (pool->shutdown)
+            break;
+
+        t = pool->next++;
+        pthread_mutex_unlock(&pool->mutex);
+
+        H5FD__stripe_do_task(file, &file->tasks[t]);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->pending == 0)
+            pthread_cond_signal(&pool->done_cond);
+    } /* end for */
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+} /* end H5FD__stripe_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_do_task
+ *
+ * Purpose:     Transfers the part of the current request which belongs to
+ *              the task's member.  The pieces of the request in one member
+ *              are contiguous in that member file, but strided in memory.
+ *              Reads beyond the end of a member return zeros.
+ *
+ *              This may run in an I/O thread, so it must not use the
+ *              function enter/leave macros or the error stack; a failure
+ *              is recorded in the task.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD__stripe_do_task(const H5FD_stripe_t *file, H5FD_stripe_task_t *task)
+{
+    haddr_t  unit = (haddr_t)file->fa.stripe_size;
+    haddr_t  n    = (haddr_t)file->fa.nmembers;
+    haddr_t  end  = file->addr + file->size;
+    haddr_t  s;
+    int      fd = file->fds[task->memb];
+
+    task->err = 0;
+
+    /* The first stripe unit of the request in this member */
+    s = file->addr / unit;
+    s += (task->memb + n - (s % n)) % n;
+
+    for (/*void*/; s * unit < end; s += n) {
+        haddr_t  lo     = MAX(s * unit, file->addr);
+        haddr_t  hi     = MIN((s + 1) * unit, end);
+        HDoff_t  offset = (HDoff_t)((s / n) * unit + (lo - s * unit));
+        uint8_t *buf    = file->buf + (lo - file->addr);
+        size_t   len    = (size_t)(hi - lo);
+
+        while (len > 0) {
+            h5_posix_io_t     bytes_in = 0;  /* # of bytes to transfer       */
+            h5_posix_io_ret_t nbytes   = -1; /* # of bytes actually moved    */
+
+            /* Trying to transfer more bytes than the return type can handle
+             * is undefined behavior in POSIX.
+             */
+            if (len > H5_POSIX_MAX_IO_BYTES)
+                bytes_in = H5_POSIX_MAX_IO_BYTES;
+            else
+                bytes_in = (h5_posix_io_t)len;
+
+            do {
+                if (file->is_write)
+                    nbytes = HDpwrite(fd, buf, bytes_in, offset);
+                else
+                    nbytes = HDpread(fd, buf, bytes_in, offset);
+            } while (-1 == nbytes && EINTR == errno);
+
+            if (-1 == nbytes) {
+                task->err        = errno;
+                task->err_offset = offset;
+                return;
+            } /* end if */
+
+            if (0 == nbytes) {
+                /* end of member but not end of format address space */
+                HDassert(!file->is_write);
+                HDmemset(buf, 0, len);
+                break;
+            } /* end if */
+
+            len -= (size_t)nbytes;
+            offset += nbytes;
+            buf += nbytes;
+        } /* end while */
+    }     /* end for */
+} /* end H5FD__stripe_do_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_run
+ *
+ * Purpose:     Transfers SIZE bytes between BUF and the address ADDR, with
+ *              one task per member touched by the request.  The tasks are
+ *              shared between the I/O threads and the calling thread.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_run(H5FD_stripe_t *file, hbool_t is_write, haddr_t addr, size_t size, uint8_t *buf)
+{
+    H5FD_stripe_pool_t *pool = &file->pool;
+    haddr_t             unit = (haddr_t)file->fa.stripe_size;
+    haddr_t             nunits;
+    unsigned            ntasks;
+    unsigned            u;
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(size > 0);
+
+    /* Describe the request */
+    file->is_write = is_write;
+    file->addr     = addr;
+    file->size     = size;
+    file->buf      = buf;
+
+    /* One task per member touched, starting with the first unit's */
+    nunits = (addr + size - 1) / unit - addr / unit + 1;
+    ntasks = (unsigned)MIN(nunits, (haddr_t)file->fa.nmembers);
+    for (u = 0; u < ntasks; u++)
+        file->tasks[u].memb = (unsigned)((addr / unit + u) % file->fa.nmembers);
+
+    if (ntasks > 1 && pool->nthreads > 0) {
+        /* Post the tasks, and take part in them */
+        pthread_mutex_lock(&pool->mutex);
+        pool->ntasks  = ntasks;
+        pool->next    = 0;
+        pool->pending = ntasks;
+        pthread_cond_broadcast(&pool->work_cond);
+        while (pool->next < pool->ntasks) {
+            unsigned t = pool->next++;
+
+            pthread_mutex_unlock(&pool->mutex);
+            H5FD__stripe_do_task(file, &file->tasks[t]);
+            pthread_mutex_lock(&pool->mutex);
+            pool->pending--;
+        } /* end while */
+        while (pool->pending > 0)
+            pthread_cond_wait(&pool->done_cond, &pool->mutex);
+        pthread_mutex_unlock(&pool->mutex);
+    } /* end if */
+    else
+        for (u = 0; u < ntasks; u++)
+            H5FD__stripe_do_task(file, &file->tasks[u]);
+
+    /* Report the first failure */
+    for (u = 0; u < ntasks; u++)
+        if (file->tasks[u].err)
+            HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                        "file %s failed: filename = '%s', member = %u, errno = %d, error message = '%s', "
+                        "offset = %llu",
+                        is_write ? "write" : "read", file->filename, file->tasks[u].memb, file->tasks[u].err,
+                        HDstrerror(file->tasks[u].err), (unsigned long long)file->tasks[u].err_offset)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_run() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_open
+ *
+ * Purpose:     Create and/or opens the member files of a striped file as
+ *              an HDF5 file.  NAME is the member name template, which must
+ *              yield a different name for each member.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+/* Disable warning for "format not a string literal" here */
+/*
+ *      This pragma only needs to surround the snprintf() calls with
+ *      memb_name & temp in the code below, but early (4.4.7, at least) gcc only
+ *      allows diagnostic pragmas to be toggled outside of functions.
+ */
+H5_GCC_DIAG_OFF("format-nonliteral")
+static H5FD_t *
+H5FD__stripe_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_stripe_t *           file = NULL; /* Striping VFD info        */
+    int                       o_flags;     /* Flags for open() call    */
+    char                      memb_name[H5FD_MAX_FILENAME_LEN];
+    char                      temp[H5FD_MAX_FILENAME_LEN];
+    H5P_genplist_t *          plist; /* Property list pointer */
+    const H5FD_stripe_fapl_t *fa;
+    haddr_t                   unit;
+    unsigned                  u;
+    H5FD_t *                  ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if (ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL == (fa = (const H5FD_stripe_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+    unit = (haddr_t)fa->stripe_size;
+
+    /* Check that names are unique */
+    HDsnprintf(memb_name, sizeof(memb_name), name, 0);
+    HDsnprintf(temp, sizeof(temp), name, 1);
+    if (!HDstrcmp(memb_name, temp))
+        HGOTO_ERROR(H5E_FILE, H5E_FILEEXISTS, NULL, "file names not unique")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if (H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if (H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if (H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Create the new file struct */
+    if (NULL == (file = H5FL_CALLOC(H5FD_stripe_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->fa = *fa;
+    if (NULL == (file->fds = (int *)H5MM_malloc(fa->nmembers * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate member descriptors")
+    for (u = 0; u < fa->nmembers; u++)
+        file->fds[u] = -1;
+    if (NULL == (file->tasks = (H5FD_stripe_task_t *)H5MM_calloc(fa->nmembers * sizeof(H5FD_stripe_task_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate tasks")
+
+    /* Open the members.  The end of the file is the address following the
+     * last byte held by any member.
+     */
+    for (u = 0; u < fa->nmembers; u++) {
+        h5_stat_t sb;
+        haddr_t   memb_size;
+
+        HDsnprintf(memb_name, sizeof(memb_name), name, u);
+        if ((file->fds[u] = HDopen(memb_name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+            int myerrno = errno;
+            HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL,
+                        "unable to open member file: name = '%s', errno = %d, error message = '%s', flags = "
+                        "%x, o_flags = %x",
+                        memb_name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+        } /* end if */
+
+        if (HDfstat(file->fds[u], &sb) < 0)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat member file")
+        if (0 == u) {
+            file->device = sb.st_dev;
+            file->inode  = sb.st_ino;
+        } /* end if */
+
+        H5_CHECKED_ASSIGN(memb_size, haddr_t, sb.st_size, h5_stat_size_t);
+        if (memb_size > 0) {
+            /* Address of the member's last byte */
+            haddr_t last = memb_size - 1;
+            haddr_t addr = ((last / unit) * fa->nmembers + u) * unit + last % unit;
+
+            if (addr + 1 > file->eof)
+                file->eof = addr + 1;
+        } /* end if */
+    }     /* end for */
+
+    /* Check the file locking flags in the fapl */
+    if (ignore_disabled_file_locks_s != FAIL)
+        /* The environment variable was set, so use that preferentially */
+        file->ignore_disabled_file_locks = ignore_disabled_file_locks_s;
+    else {
+        /* Use the value in the property list */
+        if (H5P_get(plist, H5F_ACS_IGNORE_DISABLED_FILE_LOCKS_NAME, &file->ignore_disabled_file_locks) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get ignore disabled file locks property")
+    }
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Start the I/O threads */
+    if (H5FD__stripe_pool_start(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to start I/O threads")
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (NULL == ret_value && file) {
+        H5FD__stripe_pool_stop(file);
+        if (file->fds)
+            for (u = 0; u < file->fa.nmembers; u++)
+                if (file->fds[u] >= 0)
+                    HDclose(file->fds[u]);
+        H5MM_xfree(file->fds);
+        H5MM_xfree(file->tasks);
+        file = H5FL_FREE(H5FD_stripe_t, file);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_open() */
+H5_GCC_DIAG_ON("format-nonliteral")
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_close
+ *
+ * Purpose:     Closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, with as many members closed as possible.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_close(H5FD_t *_file)
+{
+    H5FD_stripe_t *file    = (H5FD_stripe_t *)_file;
+    unsigned       nerrors = 0;         /* Number of errors while closing member files */
+    unsigned       u;                   /* Local index variable */
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Stop the I/O threads */
+    H5FD__stripe_pool_stop(file);
+
+    /* Close the member files */
+    for (u = 0; u < file->fa.nmembers; u++)
+        if (HDclose(file->fds[u]) < 0)
+            nerrors++;
+
+    /* Release the file info */
+    H5MM_xfree(file->fds);
+    H5MM_xfree(file->tasks);
+    file = H5FL_FREE(H5FD_stripe_t, file);
+
+    if (nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close member files")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.  Files are identified
+ *              by their first member.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__stripe_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_stripe_t *f1        = (const H5FD_stripe_t *)_f1;
+    const H5FD_stripe_t *f2        = (const H5FD_stripe_t *)_f2;
+    int                  ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if (f1->device < f2->device)
+        HGOTO_DONE(-1)
+    if (f1->device > f2->device)
+        HGOTO_DONE(1)
+#else  /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) < 0)
+        HGOTO_DONE(-1)
+    if (HDmemcmp(&(f1->device), &(f2->device), sizeof(dev_t)) > 0)
+        HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if (f1->inode < f2->inode)
+        HGOTO_DONE(-1)
+    if (f1->inode > f2->inode)
+        HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
+        *flags |= H5FD_FEAT_DATA_SIEVE; /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__stripe_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_stripe_t *file = (const H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__stripe_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__stripe_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the address
+ *              following the last byte held by any member file.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__stripe_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_stripe_t *file = (const H5FD_stripe_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__stripe_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_get_handle
+ *
+ * Purpose:     Returns the file handle of the first member file.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fds[0]);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.  The members touched by the request are read at
+ *              the same time.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                  size_t size, void *buf /*out*/)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    if (size > 0 && H5FD__stripe_run(file, FALSE, addr, size, (uint8_t *)buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read from member files")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.  The members touched by the request are written at
+ *              the same time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                   size_t size, const void *buf)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu",
+                    (unsigned long long)addr, (unsigned long long)size)
+
+    /* The tasks only read from the buffer */
+    H5_GCC_DIAG_OFF("cast-qual")
+    if (size > 0 && H5FD__stripe_run(file, TRUE, addr, size, (uint8_t *)buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write to member files")
+    H5_GCC_DIAG_ON("cast-qual")
+
+    /* Update eof */
+    if (addr + size > file->eof)
+        file->eof = addr + size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_truncate
+ *
+ * Purpose:     Makes sure that the member file sizes are those which hold
+ *              exactly the address space up to the end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file;
+    herr_t         ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    if (!H5F_addr_eq(file->eoa, file->eof)) {
+        haddr_t  unit    = (haddr_t)file->fa.stripe_size;
+        haddr_t  nfull   = file->eoa / unit; /* # of whole stripe units */
+        haddr_t  partial = file->eoa % unit; /* Size of the last, partial unit */
+        unsigned u;
+
+        for (u = 0; u < file->fa.nmembers; u++) {
+            haddr_t memb_size = (nfull / file->fa.nmembers) * unit;
+
+            /* The members before the one holding the partial unit have one
+             * more whole unit
+             */
+            if (u < nfull % file->fa.nmembers)
+                memb_size += unit;
+            else if (u == nfull % file->fa.nmembers)
+                memb_size += partial;
+
+            if (-1 == HDftruncate(file->fds[u], (HDoff_t)memb_size))
+                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to set member file size")
+        } /* end for */
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_lock
+ *
+ * Purpose:     To place an advisory lock on the member files.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_stripe_t *file = (H5FD_stripe_t *)_file; /* VFD file struct          */
+    int            lock_flags;                    /* file locking flags       */
+    unsigned       u;                             /* Local index variable     */
+    herr_t         ret_value = SUCCEED;           /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on each member */
+    for (u = 0; u < file->fa.nmembers; u++)
+        if (HDflock(file->fds[u], lock_flags | LOCK_NB) < 0) {
+            if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+                /* When errno is set to ENOSYS, the file system does not support
+                 * locking, so ignore it.
+                 */
+                errno = 0;
+            }
+            else {
+                int lock_errno = errno;
+
+                /* Release the members already locked */
+                while (u > 0)
+                    HDflock(file->fds[--u], LOCK_UN);
+                errno = lock_errno;
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTLOCKFILE, FAIL, "unable to lock file")
+            }
+        }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_lock() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__stripe_unlock
+ *
+ * Purpose:     To remove the existing locks on the member files
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__stripe_unlock(H5FD_t *_file)
+{
+    H5FD_stripe_t *file      = (H5FD_stripe_t *)_file; /* VFD file struct          */
+    unsigned       u;                                  /* Local index variable     */
+    herr_t         ret_value = SUCCEED;                /* Return value             */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+    for (u = 0; u < file->fa.nmembers; u++)
+        if (HDflock(file->fds[u], LOCK_UN) < 0) {
+            if (file->ignore_disabled_file_locks && ENOSYS == errno) {
+                /* When errno is set to ENOSYS, the file system does not support
+                 * locking, so ignore it.
+                 */
+                errno = 0;
+            }
+            else
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTUNLOCKFILE, FAIL, "unable to unlock file")
+        }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__stripe_unlock() */
+
+#endif /* H5_HAVE_STRIPE_VFD */
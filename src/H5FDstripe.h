@@ -0,0 +1,49 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the striping driver.
+ */
+#ifndef H5FDstripe_H
+#define H5FDstripe_H
+
+#ifdef H5_HAVE_STRIPE_VFD
+#define H5FD_STRIPE (H5FD_stripe_init())
+#else
+#define H5FD_STRIPE (H5I_INVALID_HID)
+#endif /* H5_HAVE_STRIPE_VFD */
+
+#ifdef H5_HAVE_STRIPE_VFD
+
+/* Default stripe unit.  Application can set this value, and the number of
+ * threads, through the function H5Pset_fapl_stripe. */
+#define H5FD_STRIPE_SIZE_DEF (1024 * 1024)
+
+/* Limit on the number of member files */
+#define H5FD_STRIPE_MAX_MEMBERS 1024
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t  H5FD_stripe_init(void);
+H5_DLL herr_t H5Pset_fapl_stripe(hid_t fapl_id, unsigned nmembers, size_t stripe_size, unsigned nthreads);
+H5_DLL herr_t H5Pget_fapl_stripe(hid_t fapl_id, unsigned *nmembers /*out*/, size_t *stripe_size /*out*/,
+                                 unsigned *nthreads /*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_STRIPE_VFD */
+
+#endif
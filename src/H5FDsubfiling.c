@@ -0,0 +1,1931 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The subfiling driver is an MPI driver which stores the HDF5
+ *          address space of a file in several "subfiles", normally one per
+ *          node, instead of in one shared file.  The address space is cut
+ *          into stripe units of `stripe_size' bytes which are assigned to
+ *          the subfiles round-robin, so that unit S lives in subfile S % N
+ *          at offset (S / N) * stripe_size.
+ *
+ *          Each subfile is served by one process, its I/O concentrator.
+ *          In collective transfers the processes send the pieces of their
+ *          requests to the concentrators with MPI, so that each subfile is
+ *          only written and read by the process which serves it.
+ *          Independent transfers, such as most metadata I/O, access the
+ *          subfiles directly.  The subfiles are plain POSIX files.
+ *
+ *          The file named when the file is created or opened is a small
+ *          text map which records the stripe unit and the number of
+ *          subfiles, so the set can later be opened by any number of
+ *          processes, including a single one with MPI_COMM_SELF.  Subfile
+ *          I of N is named "<name>.subfile_<I>_of_<N>".
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+
+#include "H5private.h"   /* Generic Functions                    */
+#include "H5CXprivate.h" /* API Contexts                         */
+#include "H5Eprivate.h"  /* Error handling                       */
+#include "H5Fprivate.h"  /* File access                          */
+#include "H5FDprivate.h" /* File drivers                         */
+#include "H5FDmpi.h"     /* MPI-based file drivers               */
+#include "H5Iprivate.h"  /* IDs                                  */
+#include "H5MMprivate.h" /* Memory management                    */
+#include "H5Pprivate.h"  /* Property lists                       */
+
+#ifdef H5_HAVE_PARALLEL
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_SUBFILING_g = 0;
+
+/* First line of a map file, and the names of the subfiles */
+#define H5FD_SUBFILING_MAP_MAGIC "HDF5 subfiling map 1"
+#define H5FD_SUBFILING_NAME_FMT  "%s.subfile_%u_of_%u"
+
+/* Tags of the messages between the processes and the I/O concentrators */
+#define H5FD_SUBFILING_PIECES_TAG 1
+#define H5FD_SUBFILING_DATA_TAG   2
+
+/* Driver-specific file access properties */
+typedef struct H5FD_subfiling_fapl_t {
+    size_t stripe_size;       /* Size of a stripe unit                              */
+    int    ranks_per_subfile; /* # of processes per subfile, or 0 for one per node  */
+} H5FD_subfiling_fapl_t;
+
+/* A contiguous range of bytes in a flattened MPI datatype */
+typedef struct H5FD_subfiling_seg_t {
+    MPI_Aint disp; /* Displacement of the range                    */
+    size_t   len;  /* Length of the range                          */
+} H5FD_subfiling_seg_t;
+
+/* The ranges of a flattened MPI datatype, in type map order */
+typedef struct H5FD_subfiling_seglist_t {
+    H5FD_subfiling_seg_t *segs;   /* The ranges                              */
+    size_t                nsegs;  /* # of ranges                             */
+    size_t                nalloc; /* # of ranges allocated                   */
+    size_t                nbytes; /* Sum of the range lengths                */
+} H5FD_subfiling_seglist_t;
+
+/* The part of a collective request which lies in one stripe unit, as sent
+ * to the I/O concentrator of its subfile
+ */
+typedef struct H5FD_subfiling_piece_t {
+    uint64_t subfile; /* Subfile holding the piece                 */
+    uint64_t offset;  /* Offset of the piece in the subfile        */
+    uint64_t len;     /* Length of the piece                       */
+} H5FD_subfiling_piece_t;
+
+/*
+ * The description of a file belonging to this driver.  Every process opens
+ * the subfiles it serves when the file is opened, and the others when it
+ * first accesses them.  As with the MPI-IO driver, the EOF is exact only
+ * just after the file is opened; afterwards it only covers the writes made
+ * by this process.
+ */
+typedef struct H5FD_subfiling_t {
+    H5FD_t                pub;       /* Public stuff, must be first                  */
+    MPI_Comm              comm;      /* MPI Communicator                             */
+    MPI_Info              info;      /* MPI info object                              */
+    int                   mpi_rank;  /* This process's rank                          */
+    int                   mpi_size;  /* Total number of processes                    */
+    H5FD_subfiling_fapl_t fa;        /* File access properties; the stripe unit is the file's */
+    unsigned              nsubfiles; /* # of subfiles                                */
+    int *                 iocs;      /* Rank of the I/O concentrator of each subfile */
+    int *                 fds;       /* Subfile descriptors, -1 if not open yet      */
+    int                   o_flags;   /* Flags for opening a subfile on first use     */
+    haddr_t               eof;       /* End-of-file marker                           */
+    haddr_t               eoa;       /* End-of-address marker                        */
+    haddr_t               last_eoa;  /* Last known end-of-address marker             */
+    char                  filename[H5FD_MAX_FILENAME_LEN]; /* Map file name, for the subfile names */
+} H5FD_subfiling_t;
+
+/* Private Prototypes */
+
+/* Callbacks */
+static herr_t   H5FD__subfiling_term(void);
+static void *   H5FD__subfiling_fapl_get(H5FD_t *_file);
+static void *   H5FD__subfiling_fapl_copy(const void *_old_fa);
+static H5FD_t * H5FD__subfiling_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr);
+static herr_t   H5FD__subfiling_close(H5FD_t *_file);
+static herr_t   H5FD__subfiling_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t  H5FD__subfiling_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t   H5FD__subfiling_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t  H5FD__subfiling_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t   H5FD__subfiling_get_handle(H5FD_t *_file, hid_t fapl, void **file_handle);
+static herr_t   H5FD__subfiling_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size,
+                                     void *buf);
+static herr_t   H5FD__subfiling_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+                                      size_t size, const void *buf);
+static herr_t   H5FD__subfiling_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static int      H5FD__subfiling_mpi_rank(const H5FD_t *_file);
+static int      H5FD__subfiling_mpi_size(const H5FD_t *_file);
+static MPI_Comm H5FD__subfiling_communicator(const H5FD_t *_file);
+
+/* Helper routines */
+static herr_t H5FD__subfiling_find_groups(const H5FD_subfiling_t *file, int **leaders, int *nleaders);
+static herr_t H5FD__subfiling_map(const char *name, unsigned flags, const H5FD_subfiling_fapl_t *fa,
+                                  unsigned ngroups, size_t *stripe_size, unsigned *nsubfiles,
+                                  hbool_t *created);
+static herr_t H5FD__subfiling_open_subfile(H5FD_subfiling_t *file, unsigned u, int o_flags);
+static herr_t H5FD__subfiling_pio(H5FD_subfiling_t *file, hbool_t is_write, unsigned u, HDoff_t offset,
+                                  size_t len, uint8_t *buf);
+static herr_t H5FD__subfiling_local_io(H5FD_subfiling_t *file, hbool_t is_write, haddr_t addr, size_t size,
+                                       uint8_t *buf);
+static herr_t H5FD__subfiling_flatten(H5FD_subfiling_seglist_t *list, MPI_Datatype type, MPI_Aint disp,
+                                      MPI_Aint count);
+static herr_t H5FD__subfiling_coll_io(H5FD_subfiling_t *file, hbool_t is_write, haddr_t addr, size_t count,
+                                      void *buf);
+static herr_t H5FD__subfiling_exchange(H5FD_subfiling_t *file, hbool_t is_write, haddr_t addr,
+                                       const H5FD_subfiling_seglist_t *file_segs, uint8_t *data);
+static herr_t H5FD__subfiling_post(void *buf, size_t nbytes, int peer, int tag, hbool_t is_send,
+                                   MPI_Comm comm, MPI_Request *req, MPI_Datatype *type);
+
+/* The subfiling file driver information */
+static const H5FD_class_mpi_t H5FD_subfiling_g = {
+    {
+        /* Start of superclass information */
+        "subfiling",                   /*name			*/
+        HADDR_MAX,                     /*maxaddr		*/
+        H5F_CLOSE_SEMI,                /*fc_degree		*/
+        H5FD__subfiling_term,          /*terminate             */
+        NULL,                          /*sb_size		*/
+        NULL,                          /*sb_encode		*/
+        NULL,                          /*sb_decode		*/
+        sizeof(H5FD_subfiling_fapl_t), /*fapl_size		*/
+        H5FD__subfiling_fapl_get,      /*fapl_get		*/
+        H5FD__subfiling_fapl_copy,     /*fapl_copy		*/
+        NULL,                          /*fapl_free		*/
+        0,                             /*dxpl_size		*/
+        NULL,                          /*dxpl_copy		*/
+        NULL,                          /*dxpl_free		*/
+        H5FD__subfiling_open,          /*open			*/
+        H5FD__subfiling_close,         /*close			*/
+        NULL,                          /*cmp			*/
+        H5FD__subfiling_query,         /*query			*/
+        NULL,                          /*get_type_map		*/
+        NULL,                          /*alloc			*/
+        NULL,                          /*free			*/
+        H5FD__subfiling_get_eoa,       /*get_eoa		*/
+        H5FD__subfiling_set_eoa,       /*set_eoa		*/
+        H5FD__subfiling_get_eof,       /*get_eof		*/
+        H5FD__subfiling_get_handle,    /*get_handle            */
+        H5FD__subfiling_read,          /*read			*/
+        H5FD__subfiling_write,         /*write			*/
+        NULL,                          /*flush			*/
+        H5FD__subfiling_truncate,      /*truncate		*/
+        NULL,                          /*lock                  */
+        NULL,                          /*unlock                */
+        H5FD_FLMAP_DICHOTOMY           /*fl_map                */
+    },                                 /* End of superclass information */
+    H5FD__subfiling_mpi_rank,          /*get_rank              */
+    H5FD__subfiling_mpi_size,          /*get_size              */
+    H5FD__subfiling_communicator       /*get_comm              */
+};
+
+/*--------------------------------------------------------------------------
+NAME
+   H5FD__init_package -- Initialize interface-specific information
+
+USAGE
+    herr_t H5FD__init_package()
+
+RETURNS
+    SUCCEED/FAIL
+
+DESCRIPTION
+    Initializes any interface-specific data or routines.  (Just calls
+    H5FD_subfiling_init currently).
+
+--------------------------------------------------------------------------*/
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (H5FD_subfiling_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize subfiling VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_subfiling_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the subfiling driver
+ *              Failure:    H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_subfiling_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID; /* Return value */
+
+    FUNC_ENTER_NOAPI(H5I_INVALID_HID)
+
+    /* Register the subfiling VFD, if it isn't already */
+    if (H5I_VFL != H5I_get_type(H5FD_SUBFILING_g))
+        H5FD_SUBFILING_g =
+            H5FD_register((const H5FD_class_t *)&H5FD_subfiling_g, sizeof(H5FD_class_mpi_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_SUBFILING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_subfiling_init() */
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_term(void)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Reset VFL ID */
+    H5FD_SUBFILING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__subfiling_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_subfiling
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_SUBFILING driver defined in this source file.  COMM
+ *              and INFO are stored as by H5Pset_fapl_mpio.
+ *
+ *              When a file is created, STRIPE_SIZE is the size of a
+ *              stripe unit (zero selects the default), and
+ *              RANKS_PER_SUBFILE is the number of consecutive processes
+ *              which share a subfile; zero creates one subfile per node.
+ *              When an existing file is opened, its layout is taken from
+ *              its map file and these values are not used.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_subfiling(hid_t fapl_id, MPI_Comm comm, MPI_Info info, size_t stripe_size, int ranks_per_subfile)
+{
+    H5P_genplist_t *      plist; /* Property list pointer */
+    H5FD_subfiling_fapl_t fa;
+    herr_t                ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "iMcMizIs", fapl_id, comm, info, stripe_size, ranks_per_subfile);
+
+    /* Check arguments */
+    if (fapl_id == H5P_DEFAULT)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list")
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if (MPI_COMM_NULL == comm)
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "MPI_COMM_NULL is not a valid communicator")
+    if (ranks_per_subfile < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid number of processes per subfile")
+
+    /* Set the MPI communicator and info object */
+    if (H5P_set(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, &comm) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set MPI communicator")
+    if (H5P_set(plist, H5F_ACS_MPI_PARAMS_INFO_NAME, &info) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set MPI info object")
+
+    HDmemset(&fa, 0, sizeof(H5FD_subfiling_fapl_t));
+    fa.stripe_size       = stripe_size ? stripe_size : H5FD_SUBFILING_STRIPE_SIZE_DEF;
+    fa.ranks_per_subfile = ranks_per_subfile;
+
+    ret_value = H5P_set_driver(plist, H5FD_SUBFILING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_subfiling() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_subfiling
+ *
+ * Purpose:     If the file access property list is set to the
+ *              H5FD_SUBFILING driver then this function returns
+ *              duplicates of the MPI communicator and Info object, which
+ *              the application must free, and the layout used to create
+ *              files.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_subfiling(hid_t fapl_id, MPI_Comm *comm /*out*/, MPI_Info *info /*out*/,
+                      size_t *stripe_size /*out*/, int *ranks_per_subfile /*out*/)
+{
+    H5P_genplist_t *             plist; /* Property list pointer */
+    const H5FD_subfiling_fapl_t *fa;
+    herr_t                       ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "ixxxx", fapl_id, comm, info, stripe_size, ranks_per_subfile);
+
+    /* Set comm and info in case we have problems */
+    if (comm)
+        *comm = MPI_COMM_NULL;
+    if (info)
+        *info = MPI_INFO_NULL;
+
+    /* Check arguments */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADTYPE, FAIL, "not a file access list")
+    if (H5FD_SUBFILING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if (NULL == (fa = (const H5FD_subfiling_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    /* Get the MPI communicator and info object */
+    if (comm)
+        if (H5P_get(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, comm) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI communicator")
+    if (info)
+        if (H5P_get(plist, H5F_ACS_MPI_PARAMS_INFO_NAME, info) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI info object")
+
+    if (stripe_size)
+        *stripe_size = fa->stripe_size;
+    if (ranks_per_subfile)
+        *ranks_per_subfile = fa->ranks_per_subfile;
+
+done:
+    /* Clean up anything duplicated on errors. The free calls will set
+     * the output values to MPI_COMM|INFO_NULL.
+     */
+    if (ret_value != SUCCEED) {
+        if (comm)
+            if (H5_mpi_comm_free(comm) < 0)
+                HDONE_ERROR(H5E_PLIST, H5E_CANTFREE, FAIL, "unable to free MPI communicator")
+        if (info)
+            if (H5_mpi_info_free(info) < 0)
+                HDONE_ERROR(H5E_PLIST, H5E_CANTFREE, FAIL, "unable to free MPI info object")
+    }
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_subfiling() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__subfiling_fapl_get(H5FD_t *_file)
+{
+    H5FD_subfiling_t *file      = (H5FD_subfiling_t *)_file;
+    void *            ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = H5FD__subfiling_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_fapl_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_fapl_copy
+ *
+ * Purpose:     Copies the subfiling-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__subfiling_fapl_copy(const void *_old_fa)
+{
+    const H5FD_subfiling_fapl_t *old_fa    = (const H5FD_subfiling_fapl_t *)_old_fa;
+    H5FD_subfiling_fapl_t *      new_fa    = NULL;
+    void *                       ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (new_fa = (H5FD_subfiling_fapl_t *)H5MM_malloc(sizeof(H5FD_subfiling_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    H5MM_memcpy(new_fa, old_fa, sizeof(H5FD_subfiling_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_fapl_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_find_groups
+ *
+ * Purpose:     Divides the processes of a file into the groups which would
+ *              share a subfile: runs of `ranks_per_subfile' consecutive
+ *              ranks, or the processes of each node.  Returns the lowest
+ *              rank of each group, in increasing order.  This is
+ *              collective.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_find_groups(const H5FD_subfiling_t *file, int **leaders, int *nleaders)
+{
+    int *  all = NULL; /* The lowest rank of the group of each process */
+    int    my_leader;
+    int    i, n;
+    int    mpi_code;            /* MPI return code */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (file->fa.ranks_per_subfile > 0)
+        my_leader = (file->mpi_rank / file->fa.ranks_per_subfile) * file->fa.ranks_per_subfile;
+    else {
+#if MPI_VERSION >= 3
+        MPI_Comm node_comm = MPI_COMM_NULL;
+
+        /* The processes sharing memory are those of a node, and the first
+         * of them (keyed by rank) has the lowest rank
+         */
+        if (MPI_SUCCESS != (mpi_code = MPI_Comm_split_type(file->comm, MPI_COMM_TYPE_SHARED, file->mpi_rank,
+                                                           MPI_INFO_NULL, &node_comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Comm_split_type failed", mpi_code)
+        my_leader = file->mpi_rank;
+        mpi_code  = MPI_Bcast(&my_leader, 1, MPI_INT, 0, node_comm);
+        MPI_Comm_free(&node_comm);
+        if (MPI_SUCCESS != mpi_code)
+            HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+#else
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL,
+                    "one subfile per node needs MPI-3; set the number of processes per subfile")
+#endif
+    } /* end else */
+
+    if (NULL == (all = (int *)H5MM_malloc((size_t)file->mpi_size * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (MPI_SUCCESS != (mpi_code = MPI_Allgather(&my_leader, 1, MPI_INT, all, 1, MPI_INT, file->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allgather failed", mpi_code)
+
+    /* Keep the processes which lead their group */
+    for (i = 0, n = 0; i < file->mpi_size; i++)
+        if (all[i] == i)
+            all[n++] = i;
+
+    *leaders  = all;
+    *nleaders = n;
+    all       = NULL;
+
+done:
+    H5MM_xfree(all);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_find_groups() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_map
+ *
+ * Purpose:     Reads the map file NAME of an existing file, or writes a
+ *              new one when the file is created or truncated, and returns
+ *              the stripe unit and the number of subfiles.  A new file has
+ *              one subfile for each of the NGROUPS groups of processes.
+ *
+ *              This is only called by process 0.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_map(const char *name, unsigned flags, const H5FD_subfiling_fapl_t *fa, unsigned ngroups,
+                    size_t *stripe_size, unsigned *nsubfiles, hbool_t *created)
+{
+    FILE * fp = NULL;
+    char   line[128];
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    *created = FALSE;
+
+    if (0 == HDaccess(name, F_OK)) {
+        if (flags & H5F_ACC_EXCL)
+            HGOTO_ERROR(H5E_FILE, H5E_FILEEXISTS, FAIL, "file exists: name = '%s'", name)
+    } /* end if */
+    else if (!(flags & H5F_ACC_CREAT))
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open subfiling map file")
+    else
+        flags |= H5F_ACC_TRUNC;
+
+    if (flags & H5F_ACC_TRUNC) {
+        /* New file: record the layout */
+        if (NULL == (fp = HDfopen(name, "w")))
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTCREATE, FAIL, "unable to create subfiling map file")
+        if (HDfprintf(fp, "%s\nstripe_size %llu\nsubfile_count %u\n", H5FD_SUBFILING_MAP_MAGIC,
+                      (unsigned long long)fa->stripe_size, ngroups) < 0)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write subfiling map file")
+
+        *stripe_size = fa->stripe_size;
+        *nsubfiles   = ngroups;
+        *created     = TRUE;
+    } /* end if */
+    else {
+        unsigned long long size;
+
+        if (NULL == (fp = HDfopen(name, "r")))
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open subfiling map file")
+        if (NULL == HDfgets(line, (int)sizeof(line), fp) ||
+            HDstrncmp(line, H5FD_SUBFILING_MAP_MAGIC, HDstrlen(H5FD_SUBFILING_MAP_MAGIC)) != 0)
+            HGOTO_ERROR(H5E_FILE, H5E_NOTHDF5, FAIL, "not a subfiling map file: name = '%s'", name)
+        if (NULL == HDfgets(line, (int)sizeof(line), fp) || 1 != HDsscanf(line, "stripe_size %llu", &size) ||
+            0 == size || size != (unsigned long long)(size_t)size)
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "bad stripe size in subfiling map file")
+        if (NULL == HDfgets(line, (int)sizeof(line), fp) ||
+            1 != HDsscanf(line, "subfile_count %u", nsubfiles) || 0 == *nsubfiles)
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "bad subfile count in subfiling map file")
+
+        *stripe_size = (size_t)size;
+    } /* end else */
+
+done:
+    if (fp && HDfclose(fp) < 0)
+        HDONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close subfiling map file")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_map() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_open_subfile
+ *
+ * Purpose:     Opens subfile U with the open(2) flags O_FLAGS.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_open_subfile(H5FD_subfiling_t *file, unsigned u, int o_flags)
+{
+    char   name[H5FD_MAX_FILENAME_LEN + 64]; /* Map file name and the subfile suffix */
+    herr_t ret_value = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(u < file->nsubfiles);
+    HDassert(file->fds[u] < 0);
+
+    HDsnprintf(name, sizeof(name), H5FD_SUBFILING_NAME_FMT, file->filename, u, file->nsubfiles);
+    if ((file->fds[u] = HDopen(name, o_flags, H5_POSIX_CREATE_MODE_RW)) < 0) {
+        int myerrno = errno;
+
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL,
+                    "unable to open subfile: name = '%s', errno = %d, error message = '%s', o_flags = %x",
+                    name, myerrno, HDstrerror(myerrno), (unsigned)o_flags)
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_open_subfile() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_open
+ *
+ * Purpose:     Creates and/or opens the map file and the subfiles of a
+ *              file.  This is collective.
+ *
+ *              Process 0 reads or writes the map.  The processes are
+ *              divided into groups as for a new file, and subfile I is
+ *              served by the first process of group I modulo the number of
+ *              groups, so a file created on some nodes can be opened on
+ *              any number of processes.
+ *
+ * Return:      Success:    A new file pointer
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD__subfiling_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_subfiling_t *           file = NULL;
+    const H5FD_subfiling_fapl_t *fa;
+    H5P_genplist_t *             plist;          /* Property list pointer */
+    MPI_Comm                     comm = MPI_COMM_NULL;
+    MPI_Info                     info = MPI_INFO_NULL;
+    int *                        leaders = NULL; /* First process of each group */
+    int                          nleaders = 0;
+    unsigned long long           layout[4];           /* Status, stripe unit, # of subfiles, created */
+    unsigned long long           local[2], global[2]; /* Status and end of file */
+    int                          mpi_code;            /* MPI return code */
+    unsigned                     u;
+    H5FD_t *                     ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if (!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if (0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if (NULL == (fa = (const H5FD_subfiling_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Get the MPI communicator and info object from the property list */
+    if (H5P_get(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, &comm) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get MPI communicator")
+    if (H5P_get(plist, H5F_ACS_MPI_PARAMS_INFO_NAME, &info) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "can't get MPI info object")
+
+    /* Build the return value and initialize it */
+    if (NULL == (file = (H5FD_subfiling_t *)H5MM_calloc(sizeof(H5FD_subfiling_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    file->comm    = comm;
+    file->info    = info;
+    file->fa      = *fa;
+    file->o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Get the MPI rank of this process and the total number of processes */
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_rank(comm, &file->mpi_rank)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Comm_rank failed", mpi_code)
+    if (MPI_SUCCESS != (mpi_code = MPI_Comm_size(comm, &file->mpi_size)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Comm_size failed", mpi_code)
+
+    /* Divide the processes into groups */
+    if (H5FD__subfiling_find_groups(file, &leaders, &nleaders) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "can't divide processes into subfile groups")
+
+    /* Process 0 reads or writes the map and broadcasts the layout */
+    HDmemset(layout, 0, sizeof(layout));
+    if (0 == file->mpi_rank) {
+        size_t   stripe_size = 0;
+        unsigned nsubfiles   = 0;
+        hbool_t  created     = FALSE;
+
+        if (H5FD__subfiling_map(name, flags, fa, (unsigned)nleaders, &stripe_size, &nsubfiles, &created) < 0)
+            layout[0] = 1;
+        layout[1] = (unsigned long long)stripe_size;
+        layout[2] = (unsigned long long)nsubfiles;
+        layout[3] = (unsigned long long)created;
+    } /* end if */
+    if (MPI_SUCCESS != (mpi_code = MPI_Bcast(layout, 4, MPI_UNSIGNED_LONG_LONG, 0, comm)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Bcast failed", mpi_code)
+    if (layout[0])
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open subfiling map file: name = '%s'", name)
+
+    file->fa.stripe_size = (size_t)layout[1];
+    file->nsubfiles      = (unsigned)layout[2];
+    if (NULL == (file->iocs = (int *)H5MM_malloc(file->nsubfiles * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed")
+    if (NULL == (file->fds = (int *)H5MM_malloc(file->nsubfiles * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "memory allocation failed")
+    for (u = 0; u < file->nsubfiles; u++) {
+        file->iocs[u] = leaders[u % (unsigned)nleaders];
+        file->fds[u]  = -1;
+    } /* end for */
+
+    /* Each I/O concentrator opens its subfiles, creating them for a new
+     * file, and finds the end of the file from their sizes
+     */
+    local[0] = local[1] = 0;
+    for (u = 0; u < file->nsubfiles; u++)
+        if (file->iocs[u] == file->mpi_rank) {
+            int       o_flags = file->o_flags;
+            h5_stat_t sb;
+
+            if (layout[3])
+                o_flags |= O_CREAT | O_TRUNC;
+            if (H5FD__subfiling_open_subfile(file, u, o_flags) < 0) {
+                local[0] = 1;
+                break;
+            } /* end if */
+            if (HDfstat(file->fds[u], &sb) < 0) {
+                HDONE_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat subfile")
+                local[0] = 1;
+                break;
+            } /* end if */
+            if (sb.st_size > 0) {
+                haddr_t unit = (haddr_t)file->fa.stripe_size;
+                haddr_t last = (haddr_t)sb.st_size - 1; /* Subfile offset of the last byte */
+                haddr_t addr = ((last / unit) * file->nsubfiles + u) * unit + last % unit;
+
+                if (addr + 1 > (haddr_t)local[1])
+                    local[1] = (unsigned long long)(addr + 1);
+            } /* end if */
+        }     /* end if */
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Allreduce(local, global, 2, MPI_UNSIGNED_LONG_LONG, MPI_MAX, file->comm)))
+        HMPI_GOTO_ERROR(NULL, "MPI_Allreduce failed", mpi_code)
+    if (global[0])
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open subfiles")
+
+    /* Set the size of the file (from library's perspective) */
+    file->eof = (haddr_t)global[1];
+
+    /* Set return value */
+    ret_value = (H5FD_t *)file;
+
+done:
+    if (ret_value == NULL) {
+        if (file) {
+            if (file->fds)
+                for (u = 0; u < file->nsubfiles; u++)
+                    if (file->fds[u] >= 0)
+                        HDclose(file->fds[u]);
+            H5MM_xfree(file->fds);
+            H5MM_xfree(file->iocs);
+            H5MM_xfree(file);
+        } /* end if */
+        if (H5_mpi_comm_free(&comm) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free MPI communicator")
+        if (H5_mpi_info_free(&info) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free MPI info object")
+    } /* end if */
+    H5MM_xfree(leaders);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_open() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_close
+ *
+ * Purpose:     Closes a file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, with as many subfiles closed as possible.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_close(H5FD_t *_file)
+{
+    H5FD_subfiling_t *file    = (H5FD_subfiling_t *)_file;
+    unsigned          nerrors = 0;         /* Number of errors while closing subfiles */
+    unsigned          u;                   /* Local index variable */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    /* Close the subfiles */
+    for (u = 0; u < file->nsubfiles; u++)
+        if (file->fds[u] >= 0 && HDclose(file->fds[u]) < 0)
+            nerrors++;
+
+    /* Clean up other stuff */
+    H5_mpi_comm_free(&file->comm);
+    H5_mpi_info_free(&file->info);
+    H5MM_xfree(file->fds);
+    H5MM_xfree(file->iocs);
+    H5MM_xfree(file);
+
+    if (nerrors)
+        HGOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close subfiles")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if (flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;  /* OK to aggregate metadata allocations  */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
+        *flags |= H5FD_FEAT_HAS_MPI;             /* This driver uses MPI */
+        *flags |= H5FD_FEAT_ALLOCATE_EARLY;      /* Allocate space early instead of late */
+    }                                            /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__subfiling_query() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__subfiling_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD__subfiling_get_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_subfiling_t *file = (H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD__subfiling_set_eoa() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_get_eof
+ *
+ * Purpose:     Gets the end-of-file marker for the file, which is the
+ *              address following the last byte held by any subfile when
+ *              the file was opened, or the end of the last write made by
+ *              this process if that is larger.
+ *
+ * Return:      The end-of-file marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD__subfiling_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD__subfiling_get_eof() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_get_handle
+ *
+ * Purpose:     Returns the file descriptor of the first subfile.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_subfiling_t *file      = (H5FD_subfiling_t *)_file;
+    herr_t            ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if (!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+    if (file->fds[0] < 0 && H5FD__subfiling_open_subfile(file, 0, file->o_flags) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open subfile")
+
+    *file_handle = &(file->fds[0]);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_get_handle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_pio
+ *
+ * Purpose:     Transfers LEN bytes between BUF and OFFSET in subfile U,
+ *              opening the subfile if this process has not used it yet.
+ *              Reads beyond the end of a subfile return zeros.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_pio(H5FD_subfiling_t *file, hbool_t is_write, unsigned u, HDoff_t offset, size_t len,
+                    uint8_t *buf)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (file->fds[u] < 0 && H5FD__subfiling_open_subfile(file, u, file->o_flags) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to open subfile")
+
+    while (len > 0) {
+        h5_posix_io_t     bytes_in = 0;  /* # of bytes to transfer       */
+        h5_posix_io_ret_t nbytes   = -1; /* # of bytes actually moved    */
+
+        /* Trying to transfer more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if (len > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)len;
+
+        do {
+            if (is_write)
+                nbytes = HDpwrite(file->fds[u], buf, bytes_in, offset);
+            else
+                nbytes = HDpread(file->fds[u], buf, bytes_in, offset);
+        } while (-1 == nbytes && EINTR == errno);
+
+        if (-1 == nbytes) {
+            int myerrno = errno;
+
+            HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                        "file %s failed: filename = '%s', subfile = %u, errno = %d, error message = '%s', "
+                        "offset = %llu, len = %llu",
+                        is_write ? "write" : "read", file->filename, u, myerrno, HDstrerror(myerrno),
+                        (unsigned long long)offset, (unsigned long long)len)
+        } /* end if */
+
+        if (0 == nbytes) {
+            /* end of subfile but not end of format address space */
+            HDassert(!is_write);
+            HDmemset(buf, 0, len);
+            break;
+        } /* end if */
+
+        len -= (size_t)nbytes;
+        offset += nbytes;
+        buf += nbytes;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_pio() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_local_io
+ *
+ * Purpose:     Transfers SIZE bytes between BUF and the address ADDR
+ *              directly, one stripe unit after another.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_local_io(H5FD_subfiling_t *file, hbool_t is_write, haddr_t addr, size_t size, uint8_t *buf)
+{
+    haddr_t unit      = (haddr_t)file->fa.stripe_size;
+    herr_t  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    while (size > 0) {
+        haddr_t s   = addr / unit; /* Stripe unit holding ADDR */
+        size_t  len = (size_t)MIN((haddr_t)size, (s + 1) * unit - addr);
+
+        if (H5FD__subfiling_pio(file, is_write, (unsigned)(s % file->nsubfiles),
+                                (HDoff_t)((s / file->nsubfiles) * unit + addr % unit), len, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTOPERATE, FAIL, "can't transfer stripe unit")
+
+        addr += len;
+        buf += len;
+        size -= len;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_local_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_flatten
+ *
+ * Purpose:     Appends the contiguous ranges of COUNT consecutive copies
+ *              of the MPI datatype TYPE, starting at DISP, to LIST in type
+ *              map order.  Adjacent ranges are merged.
+ *
+ *              Handles the type constructors used by the library to
+ *              describe selections.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_flatten(H5FD_subfiling_seglist_t *list, MPI_Datatype type, MPI_Aint disp, MPI_Aint count)
+{
+    int *         ints  = NULL;
+    MPI_Aint *    aints = NULL;
+    MPI_Datatype *types = NULL;
+    int           nints, naints, ntypes, combiner;
+    MPI_Aint      lb, extent, old_lb, old_extent;
+    MPI_Aint      k;
+    int           i;
+    int           mpi_code;            /* MPI return code */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_get_envelope(type, &nints, &naints, &ntypes, &combiner)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_envelope failed", mpi_code)
+
+    if (MPI_COMBINER_NAMED == combiner) {
+        int    type_size;
+        size_t len;
+
+        /* Predefined types are contiguous */
+        if (MPI_SUCCESS != (mpi_code = MPI_Type_size(type, &type_size)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Type_size failed", mpi_code)
+        if (0 == (len = (size_t)count * (size_t)type_size))
+            HGOTO_DONE(SUCCEED)
+
+        if (list->nsegs > 0 &&
+            list->segs[list->nsegs - 1].disp + (MPI_Aint)list->segs[list->nsegs - 1].len == disp)
+            list->segs[list->nsegs - 1].len += len;
+        else {
+            if (list->nsegs == list->nalloc) {
+                size_t                new_nalloc = MAX(64, 2 * list->nalloc);
+                H5FD_subfiling_seg_t *segs;
+
+                if (NULL == (segs = (H5FD_subfiling_seg_t *)H5MM_realloc(
+                                 list->segs, new_nalloc * sizeof(H5FD_subfiling_seg_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+                list->segs   = segs;
+                list->nalloc = new_nalloc;
+            } /* end if */
+            list->segs[list->nsegs].disp = disp;
+            list->segs[list->nsegs].len  = len;
+            list->nsegs++;
+        } /* end else */
+        list->nbytes += len;
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(type, &lb, &extent)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+
+    /* Get the arguments the type was constructed with */
+    if (NULL == (ints = (int *)H5MM_malloc((size_t)(nints + 1) * sizeof(int))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (NULL == (aints = (MPI_Aint *)H5MM_malloc((size_t)(naints + 1) * sizeof(MPI_Aint))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (NULL == (types = (MPI_Datatype *)H5MM_malloc((size_t)(ntypes + 1) * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (MPI_SUCCESS !=
+        (mpi_code = MPI_Type_get_contents(type, nints, naints, ntypes, ints, aints, types))) {
+        ntypes = 0;
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_contents failed", mpi_code)
+    } /* end if */
+    if (MPI_SUCCESS != (mpi_code = MPI_Type_get_extent(types[0], &old_lb, &old_extent)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Type_get_extent failed", mpi_code)
+
+    for (k = 0; k < count; k++) {
+        MPI_Aint base = disp + k * extent;
+
+        switch (combiner) {
+            case MPI_COMBINER_DUP:
+            case MPI_COMBINER_RESIZED:
+                if (H5FD__subfiling_flatten(list, types[0], base, 1) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_CONTIGUOUS:
+                if (H5FD__subfiling_flatten(list, types[0], base, ints[0]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_VECTOR:
+                for (i = 0; i < ints[0]; i++)
+                    if (H5FD__subfiling_flatten(list, types[0], base + (MPI_Aint)i * ints[2] * old_extent,
+                                                ints[1]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_HVECTOR:
+                for (i = 0; i < ints[0]; i++)
+                    if (H5FD__subfiling_flatten(list, types[0], base + (MPI_Aint)i * aints[0], ints[1]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_INDEXED:
+                for (i = 0; i < ints[0]; i++)
+                    if (H5FD__subfiling_flatten(list, types[0],
+                                                base + (MPI_Aint)ints[ints[0] + 1 + i] * old_extent,
+                                                ints[1 + i]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_HINDEXED:
+                for (i = 0; i < ints[0]; i++)
+                    if (H5FD__subfiling_flatten(list, types[0], base + aints[i], ints[1 + i]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+            case MPI_COMBINER_INDEXED_BLOCK:
+                for (i = 0; i < ints[0]; i++)
+                    if (H5FD__subfiling_flatten(list, types[0], base + (MPI_Aint)ints[2 + i] * old_extent,
+                                                ints[1]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+#if MPI_VERSION >= 3
+            case MPI_COMBINER_HINDEXED_BLOCK:
+                for (i = 0; i < ints[0]; i++)
+                    if (H5FD__subfiling_flatten(list, types[0], base + aints[i], ints[1]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+#endif
+
+            case MPI_COMBINER_STRUCT:
+                for (i = 0; i < ints[0]; i++)
+                    if (H5FD__subfiling_flatten(list, types[i], base + aints[i], ints[1 + i]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten MPI datatype")
+                break;
+
+            default:
+                HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "unsupported MPI datatype constructor (%d)",
+                            combiner)
+        } /* end switch */
+    }     /* end for */
+
+done:
+    if (types)
+        for (i = 0; i < ntypes; i++) {
+            int t_nints, t_naints, t_ntypes, t_combiner;
+
+            /* Only derived datatypes returned by MPI_Type_get_contents are freed */
+            if (MPI_SUCCESS == MPI_Type_get_envelope(types[i], &t_nints, &t_naints, &t_ntypes, &t_combiner) &&
+                MPI_COMBINER_NAMED != t_combiner)
+                MPI_Type_free(&types[i]);
+        } /* end for */
+    H5MM_xfree(types);
+    H5MM_xfree(aints);
+    H5MM_xfree(ints);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_flatten() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_post
+ *
+ * Purpose:     Posts a non-blocking send or receive of NBYTES bytes,
+ *              using a derived datatype when the count does not fit in an
+ *              int.  The datatype is returned in TYPE and must be freed
+ *              by the caller if it is not MPI_BYTE.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_post(void *buf, size_t nbytes, int peer, int tag, hbool_t is_send, MPI_Comm comm,
+                     MPI_Request *req, MPI_Datatype *type)
+{
+    int    count     = (int)nbytes;
+    int    mpi_code;            /* MPI return code */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    *type = MPI_BYTE;
+    if ((size_t)count != nbytes) {
+        if (H5_mpio_create_large_type((hsize_t)nbytes, 0, MPI_BYTE, type) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't create MPI-I/O datatype")
+        count = 1;
+    } /* end if */
+
+    if (is_send) {
+        if (MPI_SUCCESS != (mpi_code = MPI_Isend(buf, count, *type, peer, tag, comm, req)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Isend failed", mpi_code)
+    } /* end if */
+    else if (MPI_SUCCESS != (mpi_code = MPI_Irecv(buf, count, *type, peer, tag, comm, req)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Irecv failed", mpi_code)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_post() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_exchange
+ *
+ * Purpose:     Performs the collective transfer of the ranges FILE_SEGS,
+ *              relative to ADDR, whose data is DATA in file order.
+ *
+ *              The ranges are cut into pieces at stripe unit boundaries,
+ *              and the pieces are sent, grouped by I/O concentrator, to
+ *              the processes serving their subfiles.  The concentrators
+ *              perform the pieces in the order they were received and,
+ *              for reads, send the data back.  This is collective.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_exchange(H5FD_subfiling_t *file, hbool_t is_write, haddr_t addr,
+                         const H5FD_subfiling_seglist_t *file_segs, uint8_t *data)
+{
+    haddr_t                 unit        = (haddr_t)file->fa.stripe_size;
+    int                     mpi_size    = file->mpi_size;
+    unsigned long long *    send_counts = NULL; /* # of pieces and bytes for each process            */
+    unsigned long long *    recv_counts = NULL; /* # of pieces and bytes from each process           */
+    size_t *                next_piece  = NULL; /* Next piece to fill for each process               */
+    H5FD_subfiling_piece_t *send_pieces = NULL; /* Pieces of this process, grouped by destination    */
+    size_t *                send_pos    = NULL; /* Position of each of those pieces in DATA          */
+    uint8_t *               send_data   = NULL; /* Data of those pieces, in the same order           */
+    H5FD_subfiling_piece_t *recv_pieces = NULL; /* Pieces served by this process, grouped by source  */
+    uint8_t *               recv_data   = NULL; /* Data of those pieces, in the same order           */
+    MPI_Request *           reqs        = NULL;
+    MPI_Datatype *          types       = NULL;
+    int                     nreqs       = 0;
+    size_t                  send_npieces = 0, send_nbytes = 0, recv_npieces = 0, recv_nbytes = 0;
+    int                     local_err = 0, global_err = 0;
+    size_t                  i, pos;
+    int                     p, round;
+    int                     mpi_code;            /* MPI return code */
+    herr_t                  ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if (NULL == (send_counts = (unsigned long long *)H5MM_calloc(2 * (size_t)mpi_size *
+                                                                 sizeof(unsigned long long))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (NULL == (recv_counts =
+                     (unsigned long long *)H5MM_malloc(2 * (size_t)mpi_size * sizeof(unsigned long long))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (NULL == (next_piece = (size_t *)H5MM_malloc((size_t)mpi_size * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (NULL == (reqs = (MPI_Request *)H5MM_malloc(4 * (size_t)mpi_size * sizeof(MPI_Request))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (NULL == (types = (MPI_Datatype *)H5MM_malloc(4 * (size_t)mpi_size * sizeof(MPI_Datatype))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Cut the ranges into pieces, counting them for each concentrator in the
+     * first round and placing them, grouped by concentrator, in the second
+     */
+    for (round = 0; round < 2; round++) {
+        if (round == 1) {
+            for (p = 0, send_npieces = 0; p < mpi_size; p++) {
+                next_piece[p] = send_npieces;
+                send_npieces += (size_t)send_counts[2 * p];
+                send_nbytes += (size_t)send_counts[2 * p + 1];
+            } /* end for */
+            if (send_npieces > 0) {
+                if (NULL == (send_pieces = (H5FD_subfiling_piece_t *)H5MM_malloc(
+                                 send_npieces * sizeof(H5FD_subfiling_piece_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+                if (NULL == (send_pos = (size_t *)H5MM_malloc(send_npieces * sizeof(size_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+            } /* end if */
+        }     /* end if */
+
+        for (i = 0, pos = 0; i < file_segs->nsegs; i++) {
+            haddr_t seg_addr = addr + (haddr_t)file_segs->segs[i].disp;
+            size_t  seg_len  = file_segs->segs[i].len;
+
+            while (seg_len > 0) {
+                haddr_t  s       = seg_addr / unit; /* Stripe unit holding SEG_ADDR */
+                size_t   len     = (size_t)MIN((haddr_t)seg_len, (s + 1) * unit - seg_addr);
+                unsigned subfile = (unsigned)(s % file->nsubfiles);
+                int      ioc     = file->iocs[subfile];
+
+                if (round == 0) {
+                    send_counts[2 * ioc]++;
+                    send_counts[2 * ioc + 1] += len;
+                } /* end if */
+                else {
+                    size_t n = next_piece[ioc]++;
+
+                    send_pieces[n].subfile = subfile;
+                    send_pieces[n].offset  = (uint64_t)((s / file->nsubfiles) * unit + seg_addr % unit);
+                    send_pieces[n].len     = len;
+                    send_pos[n]            = pos;
+                } /* end else */
+
+                seg_addr += len;
+                seg_len -= len;
+                pos += len;
+            } /* end while */
+        }     /* end for */
+    }         /* end for */
+
+    /* Tell each concentrator how many pieces and bytes it will get */
+    if (MPI_SUCCESS != (mpi_code = MPI_Alltoall(send_counts, 2, MPI_UNSIGNED_LONG_LONG, recv_counts, 2,
+                                                MPI_UNSIGNED_LONG_LONG, file->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Alltoall failed", mpi_code)
+    for (p = 0; p < mpi_size; p++) {
+        recv_npieces += (size_t)recv_counts[2 * p];
+        recv_nbytes += (size_t)recv_counts[2 * p + 1];
+    } /* end for */
+
+    if (send_nbytes > 0 && NULL == (send_data = (uint8_t *)H5MM_malloc(send_nbytes)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (recv_npieces > 0 && NULL == (recv_pieces = (H5FD_subfiling_piece_t *)H5MM_malloc(
+                                         recv_npieces * sizeof(H5FD_subfiling_piece_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (recv_nbytes > 0 && NULL == (recv_data = (uint8_t *)H5MM_malloc(recv_nbytes)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+
+    /* Gather the data to write in piece order */
+    if (is_write)
+        for (i = 0, pos = 0; i < send_npieces; i++) {
+            H5MM_memcpy(send_data + pos, data + send_pos[i], (size_t)send_pieces[i].len);
+            pos += (size_t)send_pieces[i].len;
+        } /* end for */
+
+    /* Send the pieces, with their data for writes, to the concentrators */
+    {
+        size_t send_poff = 0, send_doff = 0, recv_poff = 0, recv_doff = 0;
+
+        for (p = 0; p < mpi_size; p++) {
+            size_t np_in = (size_t)recv_counts[2 * p], nb_in = (size_t)recv_counts[2 * p + 1];
+            size_t np_out = (size_t)send_counts[2 * p], nb_out = (size_t)send_counts[2 * p + 1];
+
+            if (np_in > 0) {
+                if (H5FD__subfiling_post(recv_pieces + recv_poff, np_in * sizeof(H5FD_subfiling_piece_t), p,
+                                         H5FD_SUBFILING_PIECES_TAG, FALSE, file->comm, &reqs[nreqs],
+                                         &types[nreqs]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTRECV, FAIL, "can't receive pieces")
+                nreqs++;
+                if (is_write) {
+                    if (H5FD__subfiling_post(recv_data + recv_doff, nb_in, p, H5FD_SUBFILING_DATA_TAG, FALSE,
+                                             file->comm, &reqs[nreqs], &types[nreqs]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTRECV, FAIL, "can't receive data")
+                    nreqs++;
+                } /* end if */
+            }     /* end if */
+            if (np_out > 0) {
+                if (H5FD__subfiling_post(send_pieces + send_poff, np_out * sizeof(H5FD_subfiling_piece_t), p,
+                                         H5FD_SUBFILING_PIECES_TAG, TRUE, file->comm, &reqs[nreqs],
+                                         &types[nreqs]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_MPI, FAIL, "can't send pieces")
+                nreqs++;
+                if (is_write) {
+                    if (H5FD__subfiling_post(send_data + send_doff, nb_out, p, H5FD_SUBFILING_DATA_TAG, TRUE,
+                                             file->comm, &reqs[nreqs], &types[nreqs]) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_MPI, FAIL, "can't send data")
+                    nreqs++;
+                } /* end if */
+            }     /* end if */
+
+            recv_poff += np_in;
+            recv_doff += nb_in;
+            send_poff += np_out;
+            send_doff += nb_out;
+        } /* end for */
+    }
+    if (nreqs > 0 && MPI_SUCCESS != (mpi_code = MPI_Waitall(nreqs, reqs, MPI_STATUSES_IGNORE)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+    for (; nreqs > 0; nreqs--)
+        if (MPI_BYTE != types[nreqs - 1])
+            MPI_Type_free(&types[nreqs - 1]);
+
+    /* Perform the pieces this process serves.  A failure is remembered, so
+     * that the other processes are not left waiting.
+     */
+    for (i = 0, pos = 0; i < recv_npieces; i++) {
+        if (recv_pieces[i].subfile >= file->nsubfiles ||
+            file->iocs[recv_pieces[i].subfile] != file->mpi_rank) {
+            HDONE_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "piece sent to the wrong process")
+            local_err = 1;
+        } /* end if */
+        if (!local_err && H5FD__subfiling_pio(file, is_write, (unsigned)recv_pieces[i].subfile,
+                                              (HDoff_t)recv_pieces[i].offset, (size_t)recv_pieces[i].len,
+                                              recv_data + pos) < 0)
+            local_err = 1;
+        pos += (size_t)recv_pieces[i].len;
+    } /* end for */
+
+    /* Send the data read back to the processes which asked for it */
+    if (!is_write) {
+        size_t send_doff = 0, recv_doff = 0;
+
+        for (p = 0; p < mpi_size; p++) {
+            size_t nb_in = (size_t)recv_counts[2 * p + 1], nb_out = (size_t)send_counts[2 * p + 1];
+
+            if (nb_out > 0) {
+                if (H5FD__subfiling_post(send_data + send_doff, nb_out, p, H5FD_SUBFILING_DATA_TAG, FALSE,
+                                         file->comm, &reqs[nreqs], &types[nreqs]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTRECV, FAIL, "can't receive data")
+                nreqs++;
+            } /* end if */
+            if (nb_in > 0) {
+                if (H5FD__subfiling_post(recv_data + recv_doff, nb_in, p, H5FD_SUBFILING_DATA_TAG, TRUE,
+                                         file->comm, &reqs[nreqs], &types[nreqs]) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_MPI, FAIL, "can't send data")
+                nreqs++;
+            } /* end if */
+
+            send_doff += nb_out;
+            recv_doff += nb_in;
+        } /* end for */
+        if (nreqs > 0 && MPI_SUCCESS != (mpi_code = MPI_Waitall(nreqs, reqs, MPI_STATUSES_IGNORE)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Waitall failed", mpi_code)
+        for (; nreqs > 0; nreqs--)
+            if (MPI_BYTE != types[nreqs - 1])
+                MPI_Type_free(&types[nreqs - 1]);
+
+        /* Scatter the data read into file order */
+        for (i = 0, pos = 0; i < send_npieces; i++) {
+            H5MM_memcpy(data + send_pos[i], send_data + pos, (size_t)send_pieces[i].len);
+            pos += (size_t)send_pieces[i].len;
+        } /* end for */
+    }     /* end if */
+
+    /* Make sure that the transfer succeeded everywhere */
+    if (MPI_SUCCESS != (mpi_code = MPI_Allreduce(&local_err, &global_err, 1, MPI_INT, MPI_MAX, file->comm)))
+        HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+    if (local_err)
+        HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                    "can't transfer the pieces served by this process")
+    if (global_err)
+        HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                    "collective transfer failed on another process")
+
+done:
+    for (; nreqs > 0; nreqs--)
+        if (MPI_BYTE != types[nreqs - 1])
+            MPI_Type_free(&types[nreqs - 1]);
+    H5MM_xfree(recv_data);
+    H5MM_xfree(recv_pieces);
+    H5MM_xfree(send_data);
+    H5MM_xfree(send_pos);
+    H5MM_xfree(send_pieces);
+    H5MM_xfree(types);
+    H5MM_xfree(reqs);
+    H5MM_xfree(next_piece);
+    H5MM_xfree(recv_counts);
+    H5MM_xfree(send_counts);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_exchange() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_coll_io
+ *
+ * Purpose:     Performs a transfer in collective mode, with the memory and
+ *              file MPI datatypes from the API context, as the MPI-IO
+ *              driver would with a file view at ADDR.
+ *
+ *              The datatypes are flattened into lists of ranges, and the
+ *              data is gathered into (or scattered from) a buffer in file
+ *              order when it is not contiguous in memory.  The transfer is
+ *              then performed through the I/O concentrators, unless the
+ *              application asked for independent I/O, or for reads by
+ *              process 0 which are broadcast.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_coll_io(H5FD_subfiling_t *file, hbool_t is_write, haddr_t addr, size_t count, void *buf)
+{
+    MPI_Datatype               buf_type, file_type;
+    H5FD_mpio_collective_opt_t coll_opt_mode;
+    H5FD_subfiling_seglist_t   mem_segs;
+    H5FD_subfiling_seglist_t   file_segs;
+    uint8_t *                  data = NULL; /* The data, in file order */
+    size_t                     i, pos;
+    herr_t                     ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDmemset(&mem_segs, 0, sizeof(mem_segs));
+    HDmemset(&file_segs, 0, sizeof(file_segs));
+
+    if (H5CX_get_mpi_coll_datatypes(&buf_type, &file_type) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O datatypes")
+    if (H5CX_get_mpio_coll_opt(&coll_opt_mode) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O collective_op property")
+
+    /* Flatten the memory type, and the file type until it holds the data */
+    if (H5FD__subfiling_flatten(&mem_segs, buf_type, 0, (MPI_Aint)count) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten memory datatype")
+    if (MPI_BYTE == file_type) {
+        if (H5FD__subfiling_flatten(&file_segs, file_type, 0, (MPI_Aint)mem_segs.nbytes) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten file datatype")
+    } /* end if */
+    else if (H5FD__subfiling_flatten(&file_segs, file_type, 0, 1) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't flatten file datatype")
+    if (file_segs.nbytes < mem_segs.nbytes)
+        HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file datatype is smaller than the data")
+    for (i = 0; i < file_segs.nsegs; i++)
+        if (file_segs.segs[i].disp < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "file datatype has a negative displacement")
+
+    /* Put the data in file order */
+    if (1 == mem_segs.nsegs && 0 == mem_segs.segs[0].disp)
+        data = (uint8_t *)buf;
+    else if (mem_segs.nbytes > 0) {
+        if (NULL == (data = (uint8_t *)H5MM_malloc(mem_segs.nbytes)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed")
+        if (is_write)
+            for (i = 0, pos = 0; i < mem_segs.nsegs; i++) {
+                H5MM_memcpy(data + pos, (uint8_t *)buf + mem_segs.segs[i].disp, mem_segs.segs[i].len);
+                pos += mem_segs.segs[i].len;
+            } /* end for */
+    }         /* end if */
+
+    if (coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO && !(is_write == FALSE && H5CX_get_mpio_rank0_bcast())) {
+        H5FD_subfiling_seglist_t used = file_segs;
+
+        /* Only the part of the file type which holds the data is used */
+        used.nbytes = mem_segs.nbytes;
+        for (i = 0, pos = 0; i < file_segs.nsegs && pos < mem_segs.nbytes; i++)
+            pos += file_segs.segs[i].len;
+        used.nsegs = i;
+
+        if (H5FD__subfiling_exchange(file, is_write, addr, &used, data) < 0)
+            HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                        "collective transfer through I/O concentrators failed")
+    } /* end if */
+    else {
+        hbool_t rank0_bcast = (coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO);
+
+        /* Independent transfer, or read by process 0 and broadcast */
+        if (!rank0_bcast || 0 == file->mpi_rank)
+            for (i = 0, pos = 0; i < file_segs.nsegs && pos < mem_segs.nbytes; i++) {
+                size_t len = MIN(file_segs.segs[i].len, mem_segs.nbytes - pos);
+
+                if (H5FD__subfiling_local_io(file, is_write, addr + (haddr_t)file_segs.segs[i].disp, len,
+                                             data + pos) < 0)
+                    HGOTO_ERROR(H5E_IO, is_write ? H5E_WRITEERROR : H5E_READERROR, FAIL,
+                                "independent transfer failed")
+                pos += len;
+            } /* end for */
+        if (rank0_bcast && mem_segs.nbytes > 0) {
+            MPI_Datatype type;
+            int          bcast_count = (int)mem_segs.nbytes;
+            int          mpi_code; /* MPI return code */
+
+            type = MPI_BYTE;
+            if ((size_t)bcast_count != mem_segs.nbytes) {
+                if (H5_mpio_create_large_type((hsize_t)mem_segs.nbytes, 0, MPI_BYTE, &type) < 0)
+                    HGOTO_ERROR(H5E_INTERNAL, H5E_CANTGET, FAIL, "can't create MPI-I/O datatype")
+                bcast_count = 1;
+            } /* end if */
+            mpi_code = MPI_Bcast(data, bcast_count, type, 0, file->comm);
+            if (MPI_BYTE != type)
+                MPI_Type_free(&type);
+            if (MPI_SUCCESS != mpi_code)
+                HMPI_GOTO_ERROR(FAIL, "MPI_Bcast failed", mpi_code)
+        } /* end if */
+    }     /* end else */
+
+    /* Put the data read in memory order */
+    if (!is_write && data != (uint8_t *)buf)
+        for (i = 0, pos = 0; i < mem_segs.nsegs; i++) {
+            H5MM_memcpy((uint8_t *)buf + mem_segs.segs[i].disp, data + pos, mem_segs.segs[i].len);
+            pos += mem_segs.segs[i].len;
+        } /* end for */
+
+    /* Track the end of this process's writes */
+    if (is_write && mem_segs.nbytes > 0) {
+        for (i = 0, pos = 0; i < file_segs.nsegs && pos < mem_segs.nbytes; i++)
+            pos += file_segs.segs[i].len;
+        if (addr + (haddr_t)file_segs.segs[i - 1].disp + file_segs.segs[i - 1].len > file->eof)
+            file->eof = addr + (haddr_t)file_segs.segs[i - 1].disp + file_segs.segs[i - 1].len;
+    } /* end if */
+
+done:
+    if (data != (uint8_t *)buf)
+        H5MM_xfree(data);
+    H5MM_xfree(file_segs.segs);
+    H5MM_xfree(mem_segs.segs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_coll_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.  As with the MPI-IO driver, raw data reads in
+ *              collective mode use the MPI datatypes in the API context
+ *              and SIZE is the number of memory datatype elements.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL. Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+                     size_t size, void *buf /*out*/)
+{
+    H5FD_subfiling_t *file      = (H5FD_subfiling_t *)_file;
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+
+    /* Only look for MPI datatypes for raw data transfers */
+    if (type == H5FD_MEM_DRAW) {
+        H5FD_mpio_xfer_t xfer_mode; /* I/O transfer mode */
+
+        /* Get the transfer mode from the API context */
+        if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+
+        if (xfer_mode == H5FD_MPIO_COLLECTIVE) {
+            if (H5FD__subfiling_coll_io(file, FALSE, addr, size, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "collective read failed")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    }     /* end if */
+
+    if (H5FD__subfiling_local_io(file, FALSE, addr, size, (uint8_t *)buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read from subfiles")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.  As with the MPI-IO driver, writes in collective
+ *              mode use the MPI datatypes in the API context and SIZE is
+ *              the number of memory datatype elements.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+                      haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_subfiling_t *file = (H5FD_subfiling_t *)_file;
+    H5FD_mpio_xfer_t  xfer_mode;           /* I/O transfer mode */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    /* Verify that no data is written when between MPI_Barrier()s during file flush */
+    HDassert(!H5CX_get_mpi_file_flushing());
+
+    if (!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+
+    /* Get the transfer mode from the API context */
+    if (H5CX_get_io_xfer_mode(&xfer_mode) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+
+    /* The buffer is only read from */
+    H5_GCC_DIAG_OFF("cast-qual")
+    if (xfer_mode == H5FD_MPIO_COLLECTIVE) {
+        if (H5FD__subfiling_coll_io(file, TRUE, addr, size, (void *)buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "collective write failed")
+    } /* end if */
+    else {
+        if (H5FD__subfiling_local_io(file, TRUE, addr, size, (uint8_t *)buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write to subfiles")
+
+        /* Update eof */
+        if (addr + size > file->eof)
+            file->eof = addr + size;
+    } /* end else */
+    H5_GCC_DIAG_ON("cast-qual")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_truncate
+ *
+ * Purpose:     Makes sure that the subfile sizes are those which hold
+ *              exactly the address space up to the end-of-address.  Each
+ *              I/O concentrator resizes its subfiles.  This is
+ *              collective.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__subfiling_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_subfiling_t *file      = (H5FD_subfiling_t *)_file;
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    if (!H5F_addr_eq(file->eoa, file->last_eoa)) {
+        haddr_t  unit      = (haddr_t)file->fa.stripe_size;
+        haddr_t  nfull     = file->eoa / unit; /* # of whole stripe units */
+        haddr_t  partial   = file->eoa % unit; /* Size of the last, partial unit */
+        int      local_err = 0, global_err = 0;
+        int      mpi_code; /* MPI return code */
+        unsigned u;
+
+        /* Wait for all writes to finish, unless the file is being flushed,
+         * in which case the processes are already between barriers
+         */
+        if (!H5CX_get_mpi_file_flushing())
+            if (MPI_SUCCESS != (mpi_code = MPI_Barrier(file->comm)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Barrier failed", mpi_code)
+
+        for (u = 0; u < file->nsubfiles; u++)
+            if (file->iocs[u] == file->mpi_rank) {
+                haddr_t size = (nfull / file->nsubfiles) * unit;
+
+                /* The subfiles before the one holding the partial unit have
+                 * one more whole unit
+                 */
+                if (u < nfull % file->nsubfiles)
+                    size += unit;
+                else if (u == nfull % file->nsubfiles)
+                    size += partial;
+
+                if (-1 == HDftruncate(file->fds[u], (HDoff_t)size)) {
+                    HDONE_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to set subfile size: errno = %d", errno)
+                    local_err = 1;
+                    break;
+                } /* end if */
+            }     /* end if */
+
+        /* Wait until every subfile has been resized, so that no process
+         * writes at the end of a subfile before it is truncated
+         */
+        if (MPI_SUCCESS !=
+            (mpi_code = MPI_Allreduce(&local_err, &global_err, 1, MPI_INT, MPI_MAX, file->comm)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_Allreduce failed", mpi_code)
+        if (global_err)
+            HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to truncate subfiles")
+
+        /* Update the 'last' eoa and the eof values */
+        file->last_eoa = file->eoa;
+        file->eof      = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__subfiling_truncate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_mpi_rank
+ *
+ * Purpose:     Returns the MPI rank for a process
+ *
+ * Return:      Success: non-negative
+ *              Failure: negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__subfiling_mpi_rank(const H5FD_t *_file)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->mpi_rank)
+} /* end H5FD__subfiling_mpi_rank() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_mpi_size
+ *
+ * Purpose:     Returns the number of MPI processes
+ *
+ * Return:      Success: non-negative
+ *              Failure: negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD__subfiling_mpi_size(const H5FD_t *_file)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->mpi_size)
+} /* end H5FD__subfiling_mpi_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__subfiling_communicator
+ *
+ * Purpose:     Returns the MPI communicator for the file.
+ *
+ * Return:      Success:    The communicator
+ *              Failure:    Can't fail
+ *
+ *-------------------------------------------------------------------------
+ */
+static MPI_Comm
+H5FD__subfiling_communicator(const H5FD_t *_file)
+{
+    const H5FD_subfiling_t *file = (const H5FD_subfiling_t *)_file;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(file);
+    HDassert(H5FD_SUBFILING == file->pub.driver_id);
+
+    FUNC_LEAVE_NOAPI(file->comm)
+} /* end H5FD__subfiling_communicator() */
+
+#endif /* H5_HAVE_PARALLEL */
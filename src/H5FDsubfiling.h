@@ -0,0 +1,51 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the subfiling driver.
+ */
+#ifndef H5FDsubfiling_H
+#define H5FDsubfiling_H
+
+/* Macros */
+
+/* The driver uses MPI for every operation, opening a file to read it
+ * included, so it is not available in serial builds and serial tools
+ * cannot read a subfiled file. */
+#ifdef H5_HAVE_PARALLEL
+#define H5FD_SUBFILING (H5FD_subfiling_init())
+#else
+#define H5FD_SUBFILING (H5I_INVALID_HID)
+#endif /* H5_HAVE_PARALLEL */
+
+#ifdef H5_HAVE_PARALLEL
+
+/* Default stripe unit.  Application can set this value, and the number of
+ * processes sharing a subfile, through the function H5Pset_fapl_subfiling. */
+#define H5FD_SUBFILING_STRIPE_SIZE_DEF (1024 * 1024)
+
+/* Function prototypes */
+#ifdef __cplusplus
+extern "C" {
+#endif
+H5_DLL hid_t  H5FD_subfiling_init(void);
+H5_DLL herr_t H5Pset_fapl_subfiling(hid_t fapl_id, MPI_Comm comm, MPI_Info info, size_t stripe_size,
+                                    int ranks_per_subfile);
+H5_DLL herr_t H5Pget_fapl_subfiling(hid_t fapl_id, MPI_Comm *comm /*out*/, MPI_Info *info /*out*/,
+                                    size_t *stripe_size /*out*/, int *ranks_per_subfile /*out*/);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_PARALLEL */
+
+#endif
@@ -362,8 +362,9 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
     H5FD_driver_prop_t    driver_prop;                /* Property for driver ID & info */
     hbool_t               driver_prop_copied = FALSE; /* Whether the driver property has been set up */
     H5VL_connector_prop_t connector_prop;             /* Property for VOL connector ID & info */
-    unsigned              efc_size  = 0;
-    hid_t                 ret_value = H5I_INVALID_HID; /* Return value */
+    unsigned              efc_size        = 0;
+    unsigned              path_cache_size = 0;
+    hid_t                 ret_value       = H5I_INVALID_HID; /* Return value */
 
     FUNC_ENTER_NOAPI(H5I_INVALID_HID)
 
@@ -414,6 +415,12 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         efc_size = H5F__efc_max_nfiles(f->shared->efc);
     if (H5P_set(new_plist, H5F_ACS_EFC_SIZE_NAME, &efc_size) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set elink file cache size")
+    if (f->shared->path_cache)
+        path_cache_size = H5G_path_cache_max_nentries(f->shared->path_cache);
+    if (H5P_set(new_plist, H5F_ACS_PATH_CACHE_SIZE_NAME, &path_cache_size) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set path cache size")
+    if (H5P_set(new_plist, H5F_ACS_LIGHT_REFRESH_NAME, &(f->shared->light_refresh)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set light refresh flag")
     if (f->shared->page_buf != NULL) {
         if (H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, &(f->shared->page_buf->max_size)) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set page buffer size")
@@ -431,6 +438,12 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set collective metadata read flag")
     if (H5P_set(new_plist, H5F_ACS_COLL_MD_WRITE_FLAG_NAME, &(f->shared->coll_md_write)) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set collective metadata read flag")
+    if (H5P_set(new_plist, H5F_ACS_COLL_MD_READ_SIZE_NAME, &(f->shared->coll_md_read_size)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set collective metadata read size")
+    if (H5P_set(new_plist, H5F_ACS_COLL_FILTER_THREADS_NAME, &(f->shared->coll_filter_threads)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set collective filter threads")
+    if (H5P_set(new_plist, H5F_ACS_NONBLOCKING_MD_FLUSH_NAME, &(f->shared->nonblocking_md_flush)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, H5I_INVALID_HID, "can't set nonblocking metadata flush flag")
     if (H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
         MPI_Comm mpi_comm;
         MPI_Info mpi_info;
@@ -1116,9 +1129,10 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
         f->shared = shared;
     }
     else {
-        H5P_genplist_t *plist;    /* Property list */
-        unsigned        efc_size; /* External file cache size */
-        size_t          u;        /* Local index variable */
+        H5P_genplist_t *plist;           /* Property list */
+        unsigned        efc_size;        /* External file cache size */
+        unsigned        path_cache_size; /* Path cache size */
+        size_t          u;               /* Local index variable */
 
         HDassert(lf != NULL);
         if (NULL == (f->shared = H5FL_CALLOC(H5F_shared_t)))
@@ -1223,6 +1237,12 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get collective metadata read flag")
         if (H5P_get(plist, H5F_ACS_COLL_MD_WRITE_FLAG_NAME, &(f->shared->coll_md_write)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get collective metadata write flag")
+        if (H5P_get(plist, H5F_ACS_COLL_MD_READ_SIZE_NAME, &(f->shared->coll_md_read_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get collective metadata read size")
+        if (H5P_get(plist, H5F_ACS_COLL_FILTER_THREADS_NAME, &(f->shared->coll_filter_threads)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get collective filter threads")
+        if (H5P_get(plist, H5F_ACS_NONBLOCKING_MD_FLUSH_NAME, &(f->shared->nonblocking_md_flush)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get nonblocking metadata flush flag")
 #endif /* H5_HAVE_PARALLEL */
         if (H5P_get(plist, H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME, &(f->shared->mdc_initCacheImageCfg)) <
             0)
@@ -1256,6 +1276,22 @@ H5F__new(H5F_shared_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5F
          */
         f->shared->use_tmp_space = !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI);
 
+        /* Create the path cache, if requested */
+        /* (Not for SWMR readers, where the writer can change links underneath
+         *      the cache, or for parallel I/O, where lookups must stay the
+         *      same on all processes)
+         */
+        if (H5P_get(plist, H5F_ACS_PATH_CACHE_SIZE_NAME, &path_cache_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get path cache size")
+        if (path_cache_size > 0 && !(H5F_INTENT(f) & H5F_ACC_SWMR_READ) &&
+            !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+            if (NULL == (f->shared->path_cache = H5G_path_cache_create(path_cache_size)))
+                HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't create path cache")
+
+        /* Whether refreshing objects reloads only their metadata that changed */
+        if (H5P_get(plist, H5F_ACS_LIGHT_REFRESH_NAME, &f->shared->light_refresh) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get light refresh flag")
+
         /* Retrieve the # of read attempts here so that sohm in superblock will get the correct # of attempts
          */
         if (H5P_get(plist, H5F_ACS_METADATA_READ_ATTEMPTS_NAME, &f->shared->read_attempts) < 0)
@@ -1344,6 +1380,9 @@ done:
             if (f->shared->efc)
                 if (H5F__efc_destroy(f->shared->efc) < 0)
                     HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, NULL, "can't destroy external file cache")
+            if (f->shared->path_cache)
+                if (H5G_path_cache_dest(f->shared->path_cache) < 0)
+                    HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, NULL, "can't destroy path cache")
             if (f->shared->fcpl_id > 0)
                 if (H5I_dec_ref(f->shared->fcpl_id) < 0)
                     HDONE_ERROR(H5E_FILE, H5E_CANTDEC, NULL, "can't close property list")
@@ -1427,6 +1466,14 @@ H5F__dest(H5F_t *f, hbool_t flush)
             f->shared->efc = NULL;
         } /* end if */
 
+        /* Release the path cache */
+        if (f->shared->path_cache) {
+            if (H5G_path_cache_dest(f->shared->path_cache) < 0)
+                /* Push error, but keep going*/
+                HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "can't destroy path cache")
+            f->shared->path_cache = NULL;
+        } /* end if */
+
         /* With the shutdown modifications, the contents of the metadata cache
          * should be clean at this point, with the possible exception of the
          * the superblock and superblock extension.
@@ -1492,6 +1539,11 @@ H5F__dest(H5F_t *f, hbool_t flush)
                         /* Push error, but keep going*/
                         HDONE_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "low level truncate failed")
 
+                    /* Anything past the EOA is gone from the file now */
+                    H5C_cache_image_invalidate_range(f->shared->cache,
+                                                     H5FD_get_eoa(f->shared->lf, H5FD_MEM_DEFAULT),
+                                                     HSIZE_UNDEF);
+
                     /* at this point, only the superblock and superblock
                      * extension should be dirty.
                      */
@@ -2211,6 +2263,11 @@ H5F__flush_phase2(H5F_t *f, hbool_t closing)
         /* Push error, but keep going*/
         HDONE_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "low level truncate failed")
 
+    /* Anything past the EOA is gone from the file now */
+    if (f->shared->cache)
+        H5C_cache_image_invalidate_range(f->shared->cache, H5FD_get_eoa(f->shared->lf, H5FD_MEM_DEFAULT),
+                                         HSIZE_UNDEF);
+
     /* Flush the entire metadata cache again since the EOA could have changed in the truncate call. */
     if (H5AC_flush(f) < 0)
         /* Push error, but keep going*/
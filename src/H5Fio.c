@@ -183,6 +183,10 @@ H5F_shared_block_write(H5F_shared_t *f_sh, H5FD_mem_t type, haddr_t addr, size_t
     if (H5F_addr_le(f_sh->tmp_addr, (addr + size)))
         HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
 
+    /* Let the metadata cache drop its copy of a freed cache image that is overwritten */
+    if (f_sh->cache)
+        H5C_cache_image_invalidate_range(f_sh->cache, addr, (hsize_t)size);
+
     /* Treat global heap as raw data */
     map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
 
@@ -227,6 +231,10 @@ H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size, const void
     if (H5F_addr_le(f->shared->tmp_addr, (addr + size)))
         HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
 
+    /* Let the metadata cache drop its copy of a freed cache image that is overwritten */
+    if (f->shared->cache)
+        H5C_cache_image_invalidate_range(f->shared->cache, addr, (hsize_t)size);
+
     /* Treat global heap as raw data */
     map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
 
@@ -301,6 +309,56 @@ done:
     FUNC_LEAVE_NOAPI(ret_value);
 } /* end H5F_evict_tagged_metadata */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_tagged_metadata_changed
+ *
+ * Purpose:     Checks whether any metadata in the cache with specified tag
+ *              differs from its current image in the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_tagged_metadata_changed(H5F_t *f, haddr_t tag, hbool_t *changed)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Compare the object's metadata with the file */
+    if (H5AC_tagged_metadata_changed(f, tag, TRUE, changed) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "unable to check tagged metadata for changes")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5F_tagged_metadata_changed */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_evict_changed_tagged_metadata
+ *
+ * Purpose:     Evicts metadata from the cache with specified tag that
+ *              differs from its current image in the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_evict_changed_tagged_metadata(H5F_t *f, haddr_t tag)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Evict the object's changed metadata */
+    if (H5AC_evict_changed_tagged_metadata(f, tag, TRUE) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTEXPUNGE, FAIL, "unable to evict changed tagged metadata")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5F_evict_changed_tagged_metadata */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F__evict_cache_entries
  *
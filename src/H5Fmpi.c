@@ -240,8 +240,8 @@ H5F_set_mpi_atomicity(H5F_t *file, hbool_t flag)
     /* Check args */
     HDassert(file);
 
-    /* Check VFD */
-    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI))
+    /* Check VFD.  Only MPI-IO files have an atomicity mode. */
+    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI) || H5FD_MPIO != H5F_DRIVER_ID(file))
         HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL,
                     "incorrect VFL driver, does not support MPI atomicity mode");
 
@@ -309,8 +309,8 @@ H5F_get_mpi_atomicity(H5F_t *file, hbool_t *flag)
     HDassert(file);
     HDassert(flag);
 
-    /* Check VFD */
-    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI))
+    /* Check VFD.  Only MPI-IO files have an atomicity mode. */
+    if (!H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI) || H5FD_MPIO != H5F_DRIVER_ID(file))
         HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL,
                     "incorrect VFL driver, does not support MPI atomicity mode");
 
@@ -357,6 +357,72 @@ done:
     FUNC_LEAVE_API(ret_value);
 } /* end H5Fget_mpi_atomicity() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_wait_flush
+ *
+ * Purpose:     Private call to complete a nonblocking flush
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_wait_flush(H5F_t *file)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI(FAIL);
+
+    /* Check args */
+    HDassert(file);
+
+    /* Only MPI-IO files have nonblocking flushes.  Also finish closing the
+     * files on the same processes that were closed with a flush in progress.
+     */
+    if (H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI) && H5FD_MPIO == H5F_DRIVER_ID(file)) {
+        if (H5AC_complete_flush(file) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "can't complete flush");
+        if (H5FD_mpio_wait_closes(file->shared->lf) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "can't complete closed files");
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value);
+} /* end H5F_wait_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fwait_flush
+ *
+ * Purpose:     Waits until the metadata writes of the last nonblocking
+ *              flush of the file have completed on all processes.
+ *
+ * Return:      Success:    Non-negative
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fwait_flush(hid_t file_id)
+{
+    H5VL_object_t *vol_obj   = NULL;
+    herr_t         ret_value = SUCCEED;
+
+    FUNC_ENTER_API(FAIL);
+    H5TRACE1("e", "i", file_id);
+
+    /* Get the file object */
+    if (NULL == (vol_obj = (H5VL_object_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid file identifier");
+
+    /* Complete the flush */
+    if (H5VL_file_optional(vol_obj, H5VL_NATIVE_FILE_WAIT_FLUSH, H5P_DATASET_XFER_DEFAULT,
+                           H5_REQUEST_NULL) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "unable to complete flush");
+
+done:
+    FUNC_LEAVE_API(ret_value);
+} /* end H5Fwait_flush() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5F_mpi_retrieve_comm
  *
@@ -412,7 +478,7 @@ H5F_mpi_retrieve_comm(hid_t loc_id, hid_t acspl_id, MPI_Comm *mpi_comm)
         if (NULL == (plist = H5P_object_verify(acspl_id, H5P_FILE_ACCESS)))
             HGOTO_ERROR(H5E_FILE, H5E_BADTYPE, FAIL, "not a file access list")
 
-        if (H5FD_MPIO == H5P_peek_driver(plist))
+        if (H5FD_MPIO == H5P_peek_driver(plist) || H5FD_SUBFILING == H5P_peek_driver(plist))
             if (H5P_peek(plist, H5F_ACS_MPI_PARAMS_COMM_NAME, mpi_comm) < 0)
                 HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get MPI communicator")
     }
@@ -289,6 +289,7 @@ struct H5F_shared_t {
     hid_t              fcpl_id;                      /* File creation property list ID 	*/
     H5F_close_degree_t fc_degree;                    /* File close behavior degree	*/
     hbool_t  evict_on_close; /* If the file's objects should be evicted from the metadata cache on close */
+    hbool_t  light_refresh;  /* If refreshing objects should reload only their metadata that changed */
     size_t   rdcc_nslots;    /* Size of raw data chunk cache (slots)	*/
     size_t   rdcc_nbytes;    /* Size of raw data chunk cache	(bytes)	*/
     double   rdcc_w0;        /* Preempt read chunks first? [0.0..1.0]*/
@@ -304,6 +305,7 @@ struct H5F_shared_t {
     struct H5G_t *       root_grp;          /* Open root group			*/
     H5FO_t *             open_objs;         /* Open objects in file                 */
     H5UC_t *             grp_btree_shared;  /* Ref-counted group B-tree node info   */
+    H5G_path_cache_t *   path_cache;        /* Cache of links found during path traversal */
     hbool_t              use_file_locking;  /* Whether or not to use file locking */
     hbool_t              closing;           /* File is in the process of being closed */
 
@@ -360,9 +362,12 @@ struct H5F_shared_t {
     char *extpath; /* Path for searching target external link file                 */
 
 #ifdef H5_HAVE_PARALLEL
-    H5P_coll_md_read_flag_t coll_md_read;  /* Do all metadata reads collectively */
-    hbool_t                 coll_md_write; /* Do all metadata writes collectively */
-#endif                                     /* H5_HAVE_PARALLEL */
+    H5P_coll_md_read_flag_t coll_md_read;         /* Do all metadata reads collectively */
+    hbool_t                 coll_md_write;        /* Do all metadata writes collectively */
+    size_t                  coll_md_read_size;    /* Size of the regions read for collective metadata reads */
+    unsigned                coll_filter_threads;  /* # of threads filtering chunks in collective I/O */
+    hbool_t                 nonblocking_md_flush; /* Whether flushes complete their metadata writes later */
+#endif                                            /* H5_HAVE_PARALLEL */
 };
 
 /*
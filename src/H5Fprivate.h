@@ -355,6 +355,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_FCPL(F)                      ((F)->shared->fcpl_id)
 #define H5F_GET_FC_DEGREE(F)             ((F)->shared->fc_degree)
 #define H5F_EVICT_ON_CLOSE(F)            ((F)->shared->evict_on_close)
+#define H5F_LIGHT_REFRESH(F)             ((F)->shared->light_refresh)
 #define H5F_RDCC_NSLOTS(F)               ((F)->shared->rdcc_nslots)
 #define H5F_RDCC_NBYTES(F)               ((F)->shared->rdcc_nbytes)
 #define H5F_RDCC_W0(F)                   ((F)->shared->rdcc_w0)
@@ -364,6 +365,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F)          ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_PATH_CACHE(F)                ((F)->shared->path_cache)
 #define H5F_USE_TMP_SPACE(F)             ((F)->shared->fs.use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_addr_le((F)->shared->fs.tmp_addr, (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -418,6 +420,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_FCPL(F)                      (H5F_get_fcpl(F))
 #define H5F_GET_FC_DEGREE(F)             (H5F_get_fc_degree(F))
 #define H5F_EVICT_ON_CLOSE(F)            (H5F_get_evict_on_close(F))
+#define H5F_LIGHT_REFRESH(F)             (H5F_get_light_refresh(F))
 #define H5F_RDCC_NSLOTS(F)               (H5F_rdcc_nslots(F))
 #define H5F_RDCC_NBYTES(F)               (H5F_rdcc_nbytes(F))
 #define H5F_RDCC_W0(F)                   (H5F_rdcc_w0(F))
@@ -427,6 +430,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL) (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F)          (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC)  (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_PATH_CACHE(F)                (H5F_path_cache(F))
 #define H5F_USE_TMP_SPACE(F)             (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR)         (H5F_is_tmp_addr((F), (ADDR)))
 #ifdef H5_HAVE_PARALLEL
@@ -585,6 +589,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_METADATA_READ_ATTEMPTS_NAME "metadata_read_attempts" /* # of metadata read attempts */
 #define H5F_ACS_OBJECT_FLUSH_CB_NAME        "object_flush_cb"        /* Object flush callback */
 #define H5F_ACS_EFC_SIZE_NAME               "efc_size"               /* Size of external file cache */
+#define H5F_ACS_PATH_CACHE_SIZE_NAME        "path_cache_size"        /* Size of path cache */
 #define H5F_ACS_FILE_IMAGE_INFO_NAME                                                                         \
     "file_image_info" /* struct containing initial file image and callback info */
 #define H5F_ACS_CLEAR_STATUS_FLAGS_NAME                                                                      \
@@ -600,6 +605,8 @@ typedef struct H5F_t H5F_t;
     "start_mdc_log_on_access" /* Whether logging starts on file create/open */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME                                                                     \
     "evict_on_close_flag" /* Whether or not the metadata cache will evict objects on close */
+#define H5F_ACS_LIGHT_REFRESH_NAME                                                                           \
+    "light_refresh" /* Whether refreshing an object reloads only its metadata that changed */
 #define H5F_ACS_COLL_MD_WRITE_FLAG_NAME                                                                      \
     "collective_metadata_write" /* property indicating whether metadata writes are done collectively or not  \
                                  */
@@ -618,6 +625,12 @@ typedef struct H5F_t H5F_t;
 #ifdef H5_HAVE_PARALLEL
 #define H5F_ACS_MPI_PARAMS_COMM_NAME "mpi_params_comm" /* the MPI communicator */
 #define H5F_ACS_MPI_PARAMS_INFO_NAME "mpi_params_info" /* the MPI info struct */
+#define H5F_ACS_COLL_MD_READ_SIZE_NAME                                                                       \
+    "collective_metadata_read_size" /* size of the regions read for collective metadata reads */
+#define H5F_ACS_COLL_FILTER_THREADS_NAME                                                                     \
+    "collective_filter_threads" /* # of threads filtering chunks in collective I/O */
+#define H5F_ACS_NONBLOCKING_MD_FLUSH_NAME                                                                    \
+    "nonblocking_metadata_flush" /* Whether flushes complete their metadata writes later */
 #endif                                                 /* H5_HAVE_PARALLEL */
 
 /* ======================== File Mount properties ====================*/
@@ -755,6 +768,7 @@ typedef struct H5F_t H5F_t;
 /* Forward declarations (for prototypes & type definitions) */
 struct H5B_class_t;
 struct H5UC_t;
+struct H5G_path_cache_t;
 struct H5O_loc_t;
 struct H5HG_heap_t;
 struct H5VL_class_t;
@@ -878,6 +892,7 @@ H5_DLL herr_t             H5F_set_sohm_nindexes(H5F_t *f, unsigned nindexes);
 H5_DLL hid_t              H5F_get_fcpl(const H5F_t *f);
 H5_DLL H5F_close_degree_t H5F_get_fc_degree(const H5F_t *f);
 H5_DLL hbool_t            H5F_get_evict_on_close(const H5F_t *f);
+H5_DLL hbool_t            H5F_get_light_refresh(const H5F_t *f);
 H5_DLL size_t             H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t             H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double             H5F_rdcc_w0(const H5F_t *f);
@@ -887,12 +902,15 @@ H5_DLL hbool_t            H5F_store_msg_crt_idx(const H5F_t *f);
 H5_DLL herr_t             H5F_set_store_msg_crt_idx(H5F_t *f, hbool_t flag);
 H5_DLL struct H5UC_t *    H5F_grp_btree_shared(const H5F_t *f);
 H5_DLL herr_t             H5F_set_grp_btree_shared(H5F_t *f, struct H5UC_t *rc);
+H5_DLL struct H5G_path_cache_t *H5F_path_cache(const H5F_t *f);
 H5_DLL hbool_t            H5F_use_tmp_space(const H5F_t *f);
 H5_DLL hbool_t            H5F_is_tmp_addr(const H5F_t *f, haddr_t addr);
 H5_DLL hsize_t            H5F_get_alignment(const H5F_t *f);
 H5_DLL hsize_t            H5F_get_threshold(const H5F_t *f);
+H5_DLL hbool_t            H5F_use_paged_aggr(const H5F_t *f);
 #ifdef H5_HAVE_PARALLEL
 H5_DLL H5P_coll_md_read_flag_t H5F_coll_md_read(const H5F_t *f);
+H5_DLL unsigned                H5F_coll_filter_threads(const H5F_t *f);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL hbool_t H5F_use_mdc_logging(const H5F_t *f);
 H5_DLL hbool_t H5F_start_mdc_log_on_access(const H5F_t *f);
@@ -924,6 +942,8 @@ H5_DLL herr_t H5F_block_write(H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t si
 /* Functions that flush or evict */
 H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t *f, haddr_t tag);
 H5_DLL herr_t H5F_evict_tagged_metadata(H5F_t *f, haddr_t tag);
+H5_DLL herr_t H5F_tagged_metadata_changed(H5F_t *f, haddr_t tag, hbool_t *changed);
+H5_DLL herr_t H5F_evict_changed_tagged_metadata(H5F_t *f, haddr_t tag);
 
 /* Functions that verify a piece of metadata with checksum */
 H5_DLL herr_t H5F_get_checksums(const uint8_t *buf, size_t chk_size, uint32_t *s_chksum, uint32_t *c_chksum);
@@ -963,6 +983,7 @@ H5_DLL int      H5F_mpi_get_size(const H5F_t *f);
 H5_DLL herr_t   H5F_mpi_retrieve_comm(hid_t loc_id, hid_t acspl_id, MPI_Comm *mpi_comm);
 H5_DLL herr_t   H5F_get_mpi_atomicity(H5F_t *file, hbool_t *flag);
 H5_DLL herr_t   H5F_set_mpi_atomicity(H5F_t *file, hbool_t flag);
+H5_DLL herr_t   H5F_wait_flush(H5F_t *file);
 #endif /* H5_HAVE_PARALLEL */
 
 /* External file cache routines */
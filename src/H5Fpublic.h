@@ -2170,6 +2170,32 @@ H5_DLL herr_t H5Fset_mpi_atomicity(hid_t file_id, hbool_t flag);
  * \todo Fix the reference!
  */
 H5_DLL herr_t H5Fget_mpi_atomicity(hid_t file_id, hbool_t *flag);
+/**
+ * \ingroup PH5F
+ *
+ * \brief Waits for the metadata writes of a nonblocking flush
+ *
+ * \file_id
+ * \returns \herr_t
+ *
+ * \details H5Fwait_flush() waits until the metadata writes posted by the
+ *          last H5Fflush() of the file \p file_id have completed on all
+ *          processes, then truncates and syncs the file as the flush
+ *          requested.  Once it returns, the file on disk reflects the
+ *          flush.  It also finishes closing the files on the same
+ *          processes that H5Fclose() left with a flush in progress.
+ *
+ *          Flushes only leave writes in progress when the file was opened
+ *          with H5Pset_nonblocking_metadata_flush(); otherwise, and when
+ *          no flush is pending, the function returns at once.
+ *
+ *          H5Fwait_flush() is a collective function and all processes
+ *          that opened the file must call it.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Fwait_flush(hid_t file_id);
 #endif /* H5_HAVE_PARALLEL */
 
 /* API Wrappers for async routines */
@@ -688,6 +688,28 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_path_cache
+ *
+ * Purpose:  Replaced a macro to retrieve the file's path cache.
+ *
+ * Return:   Success:    The path cache, or NULL if the file
+ *                       doesn't have one.
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+H5G_path_cache_t *
+H5F_path_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->path_cache)
+} /* end H5F_path_cache() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_sieve_buf_size
  *
@@ -783,6 +805,29 @@ H5F_get_evict_on_close(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->evict_on_close)
 } /* end H5F_get_evict_on_close() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5F_get_light_refresh
+ *
+ * Purpose:     Checks if refreshing objects in the file should reload only
+ *              the metadata that changed.
+ *
+ * Return:      Success:    Flag indicating whether the light refresh
+ *                          property was set for the file.
+ *              Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_get_light_refresh(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->light_refresh)
+} /* end H5F_get_light_refresh() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_store_msg_crt_idx
  *
@@ -1045,6 +1090,27 @@ H5F_coll_md_read(const H5F_t *f)
 
     FUNC_LEAVE_NOAPI(f->shared->coll_md_read)
 } /* end H5F_coll_md_read() */
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_coll_filter_threads
+ *
+ * Purpose:  Retrieve the number of threads running the filter pipeline
+ *           in collective I/O on filtered datasets.
+ *
+ * Return:   Success:    The number of threads
+ *           Failure:    (can't happen)
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_coll_filter_threads(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+
+    FUNC_LEAVE_NOAPI(f->shared->coll_filter_threads)
+} /* end H5F_coll_filter_threads() */
 #endif /* H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
@@ -1158,6 +1224,27 @@ H5F_get_threshold(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->threshold)
 } /* end H5F_get_threshold() */
 
+/*-------------------------------------------------------------------------
+ * Function: H5F_use_paged_aggr
+ *
+ * Purpose:  Determine whether the file uses paged aggregation for its
+ *           file space.
+ *
+ * Return:   TRUE/FALSE
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_use_paged_aggr(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(H5F_PAGED_AGGR(f) ? TRUE : FALSE)
+} /* end H5F_use_paged_aggr() */
+
 /*-------------------------------------------------------------------------
  * Function: H5F_get_pgend_meta_thres
  *
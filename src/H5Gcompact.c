@@ -45,23 +45,12 @@ typedef struct {
     const char *name;            /* Link name to search for */
 } H5G_iter_rm_t;
 
-/* User data for link message iteration when querying link info */
-typedef struct {
-    /* downward */
-    const char *name; /* Name to search for */
-
-    /* upward */
-    H5O_link_t *lnk;   /* Link struct to fill in */
-    hbool_t *   found; /* Pointer to flag to indicate that the object was found */
-} H5G_iter_lkp_t;
-
 /* Private macros */
 
 /* PRIVATE PROTOTYPES */
 static herr_t H5G__compact_build_table_cb(const void *_mesg, unsigned idx, void *_udata);
 static herr_t H5G__compact_build_table(const H5O_loc_t *oloc, const H5O_linfo_t *linfo, H5_index_t idx_type,
                                        H5_iter_order_t order, H5G_link_table_t *ltable);
-static herr_t H5G__compact_lookup_cb(const void *_mesg, unsigned H5_ATTR_UNUSED idx, void *_udata);
 
 /*-------------------------------------------------------------------------
  * Function:    H5G__compact_build_table_cb
@@ -415,51 +404,6 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__compact_iterate() */
 
-/*-------------------------------------------------------------------------
- * Function:    H5G__compact_lookup_cb
- *
- * Purpose:     Callback routine for searching 'link' messages for a particular
- *              name & gettting object location for it
- *
- * Return:      SUCCEED/FAIL
- *
- * Programmer:	Quincey Koziol
- *		Sep 20 2005
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5G__compact_lookup_cb(const void *_mesg, unsigned H5_ATTR_UNUSED idx, void *_udata)
-{
-    const H5O_link_t *lnk       = (const H5O_link_t *)_mesg; /* Pointer to link */
-    H5G_iter_lkp_t *  udata     = (H5G_iter_lkp_t *)_udata;  /* 'User data' passed in */
-    herr_t            ret_value = H5_ITER_CONT;              /* Return value */
-
-    FUNC_ENTER_STATIC
-
-    /* check arguments */
-    HDassert(lnk);
-    HDassert(udata);
-
-    /* Check for name to get information */
-    if (HDstrcmp(lnk->name, udata->name) == 0) {
-        if (udata->lnk) {
-            /* Copy link information */
-            if (NULL == H5O_msg_copy(H5O_LINK_ID, lnk, udata->lnk))
-                HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, H5_ITER_ERROR, "can't copy link message")
-        } /* end if */
-
-        /* Indicate that the correct link was found */
-        *udata->found = TRUE;
-
-        /* Stop iteration now */
-        HGOTO_DONE(H5_ITER_STOP)
-    } /* end if */
-
-done:
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5G__compact_lookup_cb() */
-
 /*-------------------------------------------------------------------------
  * Function:	H5G__compact_lookup
  *
@@ -475,9 +419,8 @@ done:
 herr_t
 H5G__compact_lookup(const H5O_loc_t *oloc, const char *name, hbool_t *found, H5O_link_t *lnk)
 {
-    H5G_iter_lkp_t      udata;               /* User data for iteration callback */
-    H5O_mesg_operator_t op;                  /* Message operator */
-    herr_t              ret_value = SUCCEED; /* Return value */
+    htri_t lnk_found;           /* Whether the link was found */
+    herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -486,16 +429,10 @@ H5G__compact_lookup(const H5O_loc_t *oloc, const char *name, hbool_t *found, H5O
     HDassert(found);
     HDassert(lnk && oloc->file);
 
-    /* Set up user data for iteration */
-    udata.name  = name;
-    udata.lnk   = lnk;
-    udata.found = found;
-
-    /* Iterate through the link messages, adding them to the table */
-    op.op_type  = H5O_MESG_OP_APP;
-    op.u.app_op = H5G__compact_lookup_cb;
-    if (H5O_msg_iterate(oloc, H5O_LINK_ID, &op, &udata) < 0)
-        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over link messages")
+    /* Look up the link message by name */
+    if ((lnk_found = H5O_msg_read_by_name(oloc, H5O_LINK_ID, name, lnk)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error looking up link message")
+    *found = (hbool_t)lnk_found;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
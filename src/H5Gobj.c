@@ -81,6 +81,7 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 static herr_t H5G__obj_compact_to_dense_cb(const void *_mesg, unsigned idx, void *_udata);
+static herr_t H5G__obj_compact_to_dense(const H5O_loc_t *grp_oloc, H5O_linfo_t *linfo);
 static herr_t H5G__obj_remove_update_linfo(const H5O_loc_t *oloc, H5O_linfo_t *linfo);
 
 /*********************/
@@ -406,6 +407,125 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__obj_stab_to_new_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5G__obj_compact_to_dense
+ *
+ * Purpose:     Convert a 'new format' group's link messages into "dense"
+ *              link storage.  The caller is responsible for writing the
+ *              updated link info message back to the object header.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__obj_compact_to_dense(const H5O_loc_t *grp_oloc, H5O_linfo_t *linfo)
+{
+    H5O_pline_t         tmp_pline;           /* Pipeline message */
+    H5O_pline_t *       pline = NULL;        /* Pointer to pipeline message */
+    htri_t              pline_exists;        /* Whether the pipeline message exists */
+    H5G_obj_oh_it_ud1_t udata;               /* User data for iteration */
+    H5O_mesg_operator_t op;                  /* Message operator */
+    herr_t              ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(linfo);
+    HDassert(!H5F_addr_defined(linfo->fheap_addr));
+
+    /* Get the pipeline message, if it exists */
+    if ((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
+    if (pline_exists) {
+        if (NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
+        pline = &tmp_pline;
+    } /* end if */
+
+    /* Create the "dense" storage for links */
+    if (H5G__dense_create(grp_oloc->file, linfo, pline) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+    /* Set up user data for object header message iteration */
+    udata.f       = grp_oloc->file;
+    udata.oh_addr = grp_oloc->addr;
+    udata.linfo   = linfo;
+
+    /* Iterate over the 'link' messages, inserting them into the dense link storage  */
+    op.op_type  = H5O_MESG_OP_APP;
+    op.u.app_op = H5G__obj_compact_to_dense_cb;
+    if (H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
+
+    /* Remove all the 'link' messages */
+    if (H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
+
+done:
+    /* Free any space used by the pipeline message */
+    if (pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__obj_compact_to_dense() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_obj_reserve
+ *
+ * Purpose:     Prepare a group for the insertion of NLINKS more links.
+ *
+ *              When a 'new format' group still stores its links compactly
+ *              but will exceed its "max. compact" threshold once the new
+ *              links are added, it is switched to "dense" storage up
+ *              front, rather than growing the object header with link
+ *              messages that are migrated again a few insertions later.
+ *
+ *              'Old format' groups and groups already using dense storage
+ *              are left untouched.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_obj_reserve(const H5O_loc_t *grp_oloc, size_t nlinks)
+{
+    H5O_linfo_t linfo;               /* Link info message */
+    htri_t      linfo_exists;        /* Whether the link info message exists */
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(grp_oloc->addr, FAIL)
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+
+    /* Check for 'new format' group still using link messages */
+    if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+    if (linfo_exists && !H5F_addr_defined(linfo.fheap_addr)) {
+        H5O_ginfo_t ginfo; /* Group info message */
+
+        /* Get the group info */
+        if (NULL == H5O_msg_read(grp_oloc, H5O_GINFO_ID, &ginfo))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get group info")
+
+        /* Switch to dense storage now, if the group would end up there anyway */
+        if ((linfo.nlinks + nlinks) > ginfo.max_compact) {
+            if (H5G__obj_compact_to_dense(grp_oloc, &linfo) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+            /* Record the new storage locations in the link info message */
+            if (H5O_msg_write(grp_oloc, H5O_LINFO_ID, 0, H5O_UPDATE_TIME, &linfo) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't update link info message")
+        } /* end if */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5G_obj_reserve() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5G_obj_insert
  *
@@ -426,13 +546,11 @@ herr_t
 H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk, hbool_t adj_link,
                H5O_type_t obj_type, const void *crt_info)
 {
-    H5O_pline_t  tmp_pline;             /* Pipeline message */
-    H5O_pline_t *pline = NULL;          /* Pointer to pipeline message */
-    H5O_linfo_t  linfo;                 /* Link info message */
-    htri_t       linfo_exists;          /* Whether the link info message exists */
-    hbool_t      use_old_format;        /* Whether to use 'old format' (symbol table) for insertions or not */
-    hbool_t      use_new_dense = FALSE; /* Whether to use "dense" form of 'new format' group */
-    herr_t       ret_value     = SUCCEED; /* Return value */
+    H5O_linfo_t linfo;                   /* Link info message */
+    htri_t      linfo_exists;            /* Whether the link info message exists */
+    hbool_t     use_old_format;          /* Whether to use 'old format' (symbol table) for insertions */
+    hbool_t     use_new_dense = FALSE;   /* Whether to use "dense" form of 'new format' group */
+    herr_t      ret_value     = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI_TAG(grp_oloc->addr, FAIL)
 
@@ -441,6 +559,10 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     HDassert(name && *name);
     HDassert(obj_lnk);
 
+    /* Drop any cached link of the same name in this group */
+    if (H5G__path_cache_remove(grp_oloc, name) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTREMOVE, FAIL, "can't remove link from path cache")
+
     /* Check if we have information about the number of objects in this group */
     /* (by attempting to get the link info message for this group) */
     if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
@@ -479,38 +601,10 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
         else if (linfo.nlinks < ginfo.max_compact && link_msg_size < H5O_MESG_MAX_SIZE)
             use_new_dense = FALSE;
         else {
-            htri_t              pline_exists; /* Whether the pipeline message exists */
-            H5G_obj_oh_it_ud1_t udata;        /* User data for iteration */
-            H5O_mesg_operator_t op;           /* Message operator */
-
-            /* Get the pipeline message, if it exists */
-            if ((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID)) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
-            if (pline_exists) {
-                if (NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline))
-                    HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
-                pline = &tmp_pline;
-            } /* end if */
-
             /* The group doesn't currently have "dense" storage for links */
-            if (H5G__dense_create(grp_oloc->file, &linfo, pline) < 0)
+            if (H5G__obj_compact_to_dense(grp_oloc, &linfo) < 0)
                 HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
 
-            /* Set up user data for object header message iteration */
-            udata.f       = grp_oloc->file;
-            udata.oh_addr = grp_oloc->addr;
-            udata.linfo   = &linfo;
-
-            /* Iterate over the 'link' messages, inserting them into the dense link storage  */
-            op.op_type  = H5O_MESG_OP_APP;
-            op.u.app_op = H5G__obj_compact_to_dense_cb;
-            if (H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
-
-            /* Remove all the 'link' messages */
-            if (H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
-
             use_new_dense = TRUE;
         } /* end else */
     }     /* end if */
@@ -599,10 +693,6 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     } /* end if */
 
 done:
-    /* Free any space used by the pipeline message */
-    if (pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
-        HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
-
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5G_obj_insert() */
 
@@ -956,6 +1046,10 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Removing the link may delete objects below it, so empty the path cache */
+    if (H5G_path_cache_reset(oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRESET, FAIL, "can't reset path cache")
+
     /* Attempt to get the link info for this group */
     if ((linfo_exists = H5G__obj_get_linfo(oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1019,6 +1113,10 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r, H5
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* Removing the link may delete objects below it, so empty the path cache */
+    if (H5G_path_cache_reset(grp_oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRESET, FAIL, "can't reset path cache")
+
     /* Attempt to get the link info for this group */
     if ((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
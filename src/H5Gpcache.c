@@ -0,0 +1,505 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Gpcache.c
+ *
+ * Purpose:     Path cache routines - implements a per-file cache of the
+ *              links found while traversing paths, keyed on the address
+ *              of the group holding the link and the link's name, so
+ *              that repeatedly opening objects through the same groups
+ *              skips the symbol table, B-tree and heap lookups for each
+ *              path component.
+ *
+ *              Entries are added as path components are looked up and
+ *              the least recently used entry is evicted when the cache
+ *              is full.  Inserting a link evicts any entry with the same
+ *              name in the same group and removing a link (or deleting
+ *              an object header, which may free a group's address for
+ *              reuse) empties the file's cache.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Gmodule.h" /* This source code file is part of the H5G module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                    */
+#include "H5Eprivate.h"  /* Error handling                       */
+#include "H5Fprivate.h"  /* File access                          */
+#include "H5FLprivate.h" /* Free lists                           */
+#include "H5Gpkg.h"      /* Groups                               */
+#include "H5SLprivate.h" /* Skip lists                           */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Key for an entry in a path cache */
+typedef struct H5G_path_cache_key_t {
+    haddr_t     grp_addr; /* Address of group holding the link */
+    const char *name;     /* Name of the link (points into link info) */
+} H5G_path_cache_key_t;
+
+/* Structure for each entry in a file's path cache */
+typedef struct H5G_path_cache_ent_t {
+    H5G_path_cache_key_t         key;      /* Key for skip list (must be first) */
+    H5O_link_t                   lnk;      /* Copy of the link info */
+    struct H5G_path_cache_ent_t *LRU_next; /* Next item in LRU list */
+    struct H5G_path_cache_ent_t *LRU_prev; /* Previous item in LRU list */
+} H5G_path_cache_ent_t;
+
+/* Structure for a shared file struct's path cache */
+struct H5G_path_cache_t {
+    H5SL_t *              slist;        /* Skip list of cached links */
+    H5G_path_cache_ent_t *LRU_head;     /* Head of LRU list.  This is the least recently used link */
+    H5G_path_cache_ent_t *LRU_tail;     /* Tail of LRU list.  This is the most recently used link */
+    unsigned              nentries;     /* Number of links in the cache */
+    unsigned              max_nentries; /* Maximum number of links in the cache */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+static int    H5G__path_cache_cmp(const void *key1, const void *key2);
+static herr_t H5G__path_cache_evict(H5G_path_cache_t *cache, H5G_path_cache_ent_t *ent);
+static herr_t H5G__path_cache_free_cb(void *item, void *key, void *op_data);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5G_path_cache_ent_t struct */
+H5FL_DEFINE_STATIC(H5G_path_cache_ent_t);
+
+/* Declare a free list to manage the H5G_path_cache_t struct */
+H5FL_DEFINE_STATIC(H5G_path_cache_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_cmp
+ *
+ * Purpose:     Skip list callback to compare two path cache keys, first
+ *              by group address, then by link name.
+ *
+ * Return:      Negative, zero or positive, like strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G__path_cache_cmp(const void *_key1, const void *_key2)
+{
+    const H5G_path_cache_key_t *key1      = (const H5G_path_cache_key_t *)_key1;
+    const H5G_path_cache_key_t *key2      = (const H5G_path_cache_key_t *)_key2;
+    int                         ret_value = 0;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(key1);
+    HDassert(key2);
+
+    /* Check group address first, then link name */
+    if (H5F_addr_lt(key1->grp_addr, key2->grp_addr))
+        HGOTO_DONE(-1)
+    if (H5F_addr_gt(key1->grp_addr, key2->grp_addr))
+        HGOTO_DONE(1)
+
+    ret_value = HDstrcmp(key1->name, key2->name);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_path_cache_create
+ *
+ * Purpose:     Allocate and initialize a new path cache, holding at most
+ *              MAX_NENTRIES links.
+ *
+ * Return:      Success:        Pointer to new path cache object
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+H5G_path_cache_t *
+H5G_path_cache_create(unsigned max_nentries)
+{
+    H5G_path_cache_t *cache     = NULL; /* New path cache */
+    H5G_path_cache_t *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_NOAPI(NULL)
+
+    /* Sanity checks */
+    HDassert(max_nentries > 0);
+
+    /* Allocate path cache */
+    if (NULL == (cache = H5FL_CALLOC(H5G_path_cache_t)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, NULL, "memory allocation failed")
+
+    /* Create skip list of links */
+    if (NULL == (cache->slist = H5SL_create(H5SL_TYPE_GENERIC, H5G__path_cache_cmp)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, NULL, "can't create skip list")
+
+    /* Initialize maximum number of links */
+    cache->max_nentries = max_nentries;
+
+    /* Set the return value */
+    ret_value = cache;
+
+done:
+    if (ret_value == NULL && cache)
+        cache = H5FL_FREE(H5G_path_cache_t, cache);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_path_cache_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_path_cache_max_nentries
+ *
+ * Purpose:     Returns the maximum number of links in the path cache.
+ *
+ * Return:      Maximum number of links (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5G_path_cache_max_nentries(const H5G_path_cache_t *cache)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(cache);
+    HDassert(cache->max_nentries > 0);
+
+    FUNC_LEAVE_NOAPI(cache->max_nentries)
+} /* end H5G_path_cache_max_nentries() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_lookup
+ *
+ * Purpose:     Look up the link named NAME in the group at GRP_OLOC in its
+ *              file's path cache.  If found, a copy of the link info is
+ *              returned in LNK, which the caller must reset.
+ *
+ * Return:      Success:        TRUE if found, FALSE if not (or if the file
+ *                              has no path cache)
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5G__path_cache_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk /*out*/)
+{
+    H5G_path_cache_t *    cache;             /* File's path cache */
+    H5G_path_cache_ent_t *ent;               /* Entry for the link */
+    H5G_path_cache_key_t  key;               /* Key to search for */
+    htri_t                ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(name && *name);
+    HDassert(lnk);
+
+    /* Check for a path cache on the file */
+    if (NULL == (cache = H5F_PATH_CACHE(grp_oloc->file)))
+        HGOTO_DONE(FALSE)
+
+    /* Search for the link */
+    key.grp_addr = grp_oloc->addr;
+    key.name     = name;
+    if (NULL == (ent = (H5G_path_cache_ent_t *)H5SL_search(cache->slist, &key)))
+        HGOTO_DONE(FALSE)
+
+    /* Move the entry to the end of the LRU list, if it isn't there already */
+    if (ent->LRU_next) {
+        if (ent->LRU_prev)
+            ent->LRU_prev->LRU_next = ent->LRU_next;
+        else
+            cache->LRU_head = ent->LRU_next;
+        ent->LRU_next->LRU_prev = ent->LRU_prev;
+
+        ent->LRU_prev             = cache->LRU_tail;
+        ent->LRU_next             = NULL;
+        cache->LRU_tail->LRU_next = ent;
+        cache->LRU_tail           = ent;
+    } /* end if */
+
+    /* Copy the link info for the caller */
+    if (NULL == H5O_msg_copy(H5O_LINK_ID, &ent->lnk, lnk))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy link message")
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_insert
+ *
+ * Purpose:     Add a copy of the link LNK, found in the group at GRP_OLOC,
+ *              to its file's path cache.  Evicts the least recently used
+ *              link if the cache is full.  Does nothing if the file has
+ *              no path cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk)
+{
+    H5G_path_cache_t *    cache;               /* File's path cache */
+    H5G_path_cache_ent_t *ent        = NULL;    /* Entry for the link */
+    hbool_t               lnk_copied = FALSE;   /* Whether the link info was copied */
+    herr_t                ret_value  = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(lnk && lnk->name);
+
+    /* Check for a path cache on the file */
+    if (NULL == (cache = H5F_PATH_CACHE(grp_oloc->file)))
+        HGOTO_DONE(SUCCEED)
+
+    /* Make room for the new link */
+    if (cache->nentries == cache->max_nentries) {
+        HDassert(cache->LRU_head);
+        if (H5G__path_cache_evict(cache, cache->LRU_head) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTREMOVE, FAIL, "can't evict link from path cache")
+    } /* end if */
+
+    /* Allocate and fill in the new entry */
+    if (NULL == (ent = H5FL_MALLOC(H5G_path_cache_ent_t)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed")
+    if (NULL == H5O_msg_copy(H5O_LINK_ID, lnk, &ent->lnk))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy link message")
+    lnk_copied        = TRUE;
+    ent->key.grp_addr = grp_oloc->addr;
+    ent->key.name     = ent->lnk.name;
+
+    /* Add the entry to the skip list */
+    if (H5SL_insert(cache->slist, ent, &ent->key) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert link into path cache")
+
+    /* Add the entry to the end of the LRU list */
+    ent->LRU_next = NULL;
+    ent->LRU_prev = cache->LRU_tail;
+    if (cache->LRU_tail)
+        cache->LRU_tail->LRU_next = ent;
+    cache->LRU_tail = ent;
+    if (!cache->LRU_head)
+        cache->LRU_head = ent;
+    cache->nentries++;
+
+done:
+    if (ret_value < 0 && ent) {
+        if (lnk_copied)
+            H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+        ent = H5FL_FREE(H5G_path_cache_ent_t, ent);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_remove
+ *
+ * Purpose:     Remove the link named NAME in the group at GRP_OLOC from
+ *              its file's path cache, if it's there.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__path_cache_remove(const H5O_loc_t *grp_oloc, const char *name)
+{
+    H5G_path_cache_t *    cache;               /* File's path cache */
+    H5G_path_cache_ent_t *ent;                 /* Entry for the link */
+    H5G_path_cache_key_t  key;                 /* Key to search for */
+    herr_t                ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(name);
+
+    /* Check for a path cache on the file */
+    if (NULL == (cache = H5F_PATH_CACHE(grp_oloc->file)))
+        HGOTO_DONE(SUCCEED)
+
+    /* Look for the link and evict it */
+    key.grp_addr = grp_oloc->addr;
+    key.name     = name;
+    if (NULL != (ent = (H5G_path_cache_ent_t *)H5SL_search(cache->slist, &key)))
+        if (H5G__path_cache_evict(cache, ent) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTREMOVE, FAIL, "can't evict link from path cache")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_evict
+ *
+ * Purpose:     Remove ENT from the path cache and free it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__path_cache_evict(H5G_path_cache_t *cache, H5G_path_cache_ent_t *ent)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(cache);
+    HDassert(ent);
+
+    /* Remove the entry from the skip list */
+    if (ent != H5SL_remove(cache->slist, &ent->key))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "can't delete entry from skip list")
+
+    /* Remove the entry from the LRU list */
+    if (ent->LRU_next)
+        ent->LRU_next->LRU_prev = ent->LRU_prev;
+    else
+        cache->LRU_tail = ent->LRU_prev;
+    if (ent->LRU_prev)
+        ent->LRU_prev->LRU_next = ent->LRU_next;
+    else
+        cache->LRU_head = ent->LRU_next;
+    cache->nentries--;
+
+    /* Release the entry */
+    H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+    ent = H5FL_FREE(H5G_path_cache_ent_t, ent);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__path_cache_evict() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G__path_cache_free_cb
+ *
+ * Purpose:     Skip list callback to free a path cache entry.
+ *
+ * Return:      Non-negative on success (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G__path_cache_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5G_path_cache_ent_t *ent = (H5G_path_cache_ent_t *)item;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+
+    H5O_msg_reset(H5O_LINK_ID, &ent->lnk);
+    ent = H5FL_FREE(H5G_path_cache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5G__path_cache_free_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_path_cache_reset
+ *
+ * Purpose:     Empty the path cache for file F, if it has one.  Called
+ *              whenever a link is removed from a group or an object header
+ *              is deleted, since either may make cached links stale.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_path_cache_reset(H5F_t *f)
+{
+    H5G_path_cache_t *cache;               /* File's path cache */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+
+    /* Empty the cache */
+    if (NULL != (cache = H5F_PATH_CACHE(f)) && cache->nentries > 0) {
+        if (H5SL_free(cache->slist, H5G__path_cache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't free path cache entries")
+        cache->LRU_head = NULL;
+        cache->LRU_tail = NULL;
+        cache->nentries = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_path_cache_reset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5G_path_cache_dest
+ *
+ * Purpose:     Release all links in the path cache and free the cache
+ *              itself.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_path_cache_dest(H5G_path_cache_t *cache)
+{
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(cache);
+
+    /* Release the entries and the skip list */
+    if (H5SL_destroy(cache->slist, H5G__path_cache_free_cb, NULL) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCLOSEOBJ, FAIL, "can't destroy path cache skip list")
+
+    /* Free the cache */
+    cache = H5FL_FREE(H5G_path_cache_t, cache);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_path_cache_dest() */
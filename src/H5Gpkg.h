@@ -457,6 +457,11 @@ H5_DLL herr_t H5G__get_objinfo(const H5G_loc_t *loc, const char *name, hbool_t f
                                H5G_stat_t *statbuf /*out*/);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+/* Functions that cache links found during path traversal */
+H5_DLL htri_t H5G__path_cache_lookup(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *lnk /*out*/);
+H5_DLL herr_t H5G__path_cache_insert(const H5O_loc_t *grp_oloc, const H5O_link_t *lnk);
+H5_DLL herr_t H5G__path_cache_remove(const H5O_loc_t *grp_oloc, const char *name);
+
 /*
  * These functions operate on group hierarchy names.
  */
@@ -185,6 +185,9 @@ typedef struct H5G_t        H5G_t;
 typedef struct H5G_shared_t H5G_shared_t;
 typedef struct H5G_entry_t  H5G_entry_t;
 
+/* Path cache info (forward decl - defined in H5Gpcache.c) */
+typedef struct H5G_path_cache_t H5G_path_cache_t;
+
 /*
  * Library prototypes...  These are the ones that other packages routinely
  * call.
@@ -227,6 +230,7 @@ H5_DLL herr_t H5G_link_to_info(const struct H5O_loc_t *link_loc, const struct H5
 /*
  * Functions that understand group objects
  */
+H5_DLL herr_t  H5G_obj_reserve(const struct H5O_loc_t *grp_oloc, size_t nlinks);
 H5_DLL herr_t  H5G_obj_insert(const struct H5O_loc_t *grp_oloc, const char *name, struct H5O_link_t *obj_lnk,
                               hbool_t adj_link, H5O_type_t obj_type, const void *crt_info);
 H5_DLL ssize_t H5G_obj_get_name_by_idx(const struct H5O_loc_t *oloc, H5_index_t idx_type,
@@ -238,6 +242,14 @@ H5_DLL herr_t  H5G_obj_lookup_by_idx(const struct H5O_loc_t *grp_oloc, H5_index_
                                      H5_iter_order_t order, hsize_t n, struct H5O_link_t *lnk);
 H5_DLL hid_t   H5G_get_create_plist(const H5G_t *grp);
 
+/*
+ * Functions that cache links found during path traversal
+ */
+H5_DLL H5G_path_cache_t *H5G_path_cache_create(unsigned max_nentries);
+H5_DLL unsigned          H5G_path_cache_max_nentries(const H5G_path_cache_t *cache);
+H5_DLL herr_t            H5G_path_cache_reset(H5F_t *f);
+H5_DLL herr_t            H5G_path_cache_dest(H5G_path_cache_t *cache);
+
 /*
  * These functions operate on symbol table nodes.
  */
@@ -536,6 +536,7 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target, H5G
     while ((name = H5G__component(name, &nchars)) && *name) {
         const char *s;             /* Temporary string pointer */
         hbool_t     lookup_status; /* Status from object lookup */
+        htri_t      cached;        /* Whether the link was in the path cache */
         hbool_t     obj_exists;    /* Whether the object exists */
 
         /*
@@ -563,10 +564,20 @@ H5G__traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target, H5G
             link_valid = FALSE;
         } /* end if */
 
-        /* Get information for object in current group */
+        /* Get information for object in current group, checking the file's
+         * path cache first and remembering links found in the group
+         */
         lookup_status = FALSE;
-        if (H5G__obj_lookup(grp_loc.oloc, comp, &lookup_status, &lnk /*out*/) < 0)
-            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't look up component")
+        if ((cached = H5G__path_cache_lookup(grp_loc.oloc, comp, &lnk /*out*/)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't search path cache")
+        if (cached)
+            lookup_status = TRUE;
+        else {
+            if (H5G__obj_lookup(grp_loc.oloc, comp, &lookup_status, &lnk /*out*/) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't look up component")
+            if (lookup_status && H5G__path_cache_insert(grp_loc.oloc, &lnk) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't add link to path cache")
+        } /* end else */
         obj_exists = FALSE;
 
         /* If the lookup was OK, build object location and traverse special links, etc. */
@@ -807,6 +807,74 @@ done:
         FUNC_LEAVE_NOAPI(ret_value)
     } /* end H5MF_free_aggrs() */
 
+    /*-------------------------------------------------------------------------
+     * Function:    H5MF_aggr_set_meta_block_size
+     *
+     * Purpose:     Raise the size of the blocks the metadata aggregator
+     *		requests from the file to at least SIZE bytes, so that a
+     *		burst of small metadata allocations (e.g. many object
+     *		headers created together) is carved out of a single
+     *		contiguous file space request.  The previous block size is
+     *		returned in OLD_SIZE so the caller can restore it.
+     *
+     *		Has no effect when metadata aggregation is not in use for
+     *		the file.
+     *
+     * Return:      Success:        Non-negative
+     *              Failure:        Negative
+     *
+     *-------------------------------------------------------------------------
+     */
+    herr_t H5MF_aggr_set_meta_block_size(H5F_t * f, hsize_t size, hsize_t * old_size)
+    {
+        herr_t ret_value = SUCCEED; /* Return value */
+
+        FUNC_ENTER_NOAPI_NOERR
+
+        /* Check args */
+        HDassert(f);
+        HDassert(f->shared);
+        HDassert(old_size);
+
+        *old_size = f->shared->meta_aggr.alloc_size;
+
+        /* Only grow the block size, and only when the aggregator is used */
+        if ((f->shared->feature_flags & H5FD_FEAT_AGGREGATE_METADATA) &&
+            f->shared->fs_strategy != H5F_FSPACE_STRATEGY_NONE && !H5F_PAGED_AGGR(f) &&
+            size > f->shared->meta_aggr.alloc_size)
+            f->shared->meta_aggr.alloc_size = size;
+
+        FUNC_LEAVE_NOAPI(ret_value)
+    } /* end H5MF_aggr_set_meta_block_size() */
+
+    /*-------------------------------------------------------------------------
+     * Function:    H5MF_aggr_reset_meta_block_size
+     *
+     * Purpose:     Restore the metadata aggregator's block size after a call
+     *		to H5MF_aggr_set_meta_block_size().  Any space left in the
+     *		current aggregator block stays there for later allocations.
+     *
+     * Return:      Success:        Non-negative
+     *              Failure:        Negative
+     *
+     *-------------------------------------------------------------------------
+     */
+    herr_t H5MF_aggr_reset_meta_block_size(H5F_t * f, hsize_t size)
+    {
+        herr_t ret_value = SUCCEED; /* Return value */
+
+        FUNC_ENTER_NOAPI_NOERR
+
+        /* Check args */
+        HDassert(f);
+        HDassert(f->shared);
+        HDassert(size > 0);
+
+        f->shared->meta_aggr.alloc_size = size;
+
+        FUNC_LEAVE_NOAPI(ret_value)
+    } /* end H5MF_aggr_reset_meta_block_size() */
+
     /*-------------------------------------------------------------------------
      * Function:    H5MF__aggr_can_shrink_eoa
      *
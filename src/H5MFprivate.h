@@ -63,6 +63,8 @@ H5_DLL haddr_t H5MF_alloc_tmp(H5F_t *f, hsize_t size);
 
 /* 'block aggregator' routines */
 H5_DLL herr_t H5MF_free_aggrs(H5F_t *f);
+H5_DLL herr_t H5MF_aggr_set_meta_block_size(H5F_t *f, hsize_t size, hsize_t *old_size);
+H5_DLL herr_t H5MF_aggr_reset_meta_block_size(H5F_t *f, hsize_t size);
 
 /* Free space manager settling routines */
 H5_DLL herr_t H5MF_settle_raw_data_fsm(H5F_t *f, hbool_t *fsm_settled);
@@ -887,6 +887,9 @@ H5O__alloc_chunk(H5F_t *f, H5O_t *oh, size_t size, size_t found_null, const H5O_
     HDassert(found_msg);
     HDassert(new_idx);
 
+    /* Messages may move within the message array below */
+    H5O__name_index_reset(oh);
+
     /*
      * The total chunk size must include the requested space plus enough
      * for the message header.  This must be at least some minimum and
@@ -1375,6 +1378,9 @@ H5O__release_mesg(H5F_t *f, H5O_t *oh, H5O_mesg_t *mesg, hbool_t adj_link)
     if (NULL == (chk_proxy = H5O__chunk_protect(f, oh, mesg->chunkno)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header chunk")
 
+    /* Remove the message's name from the header's name index */
+    H5O__name_index_remove(oh, (size_t)(mesg - oh->mesg));
+
     /* Free any native information */
     H5O__msg_free_mesg(mesg);
 
@@ -2309,6 +2315,7 @@ herr_t
 H5O__condense_header(H5F_t *f, H5O_t *oh)
 {
     hbool_t rescan_header;       /* Whether to rescan header */
+    hbool_t condensed = FALSE;   /* Whether any messages were moved */
     htri_t  result;              /* Result from packing/merging/etc */
     herr_t  ret_value = SUCCEED; /* return value */
 
@@ -2342,12 +2349,19 @@ H5O__condense_header(H5F_t *f, H5O_t *oh)
             HGOTO_ERROR(H5E_OHDR, H5E_CANTPACK, FAIL, "can't remove empty chunk")
         if (result > 0)
             rescan_header = TRUE;
+
+        if (rescan_header)
+            condensed = TRUE;
     } while (rescan_header);
 #ifdef H5O_DEBUG
     H5O__assert(oh);
 #endif /* H5O_DEBUG */
 
 done:
+    /* Messages may have moved within the message array */
+    if (condensed)
+        H5O__name_index_reset(oh);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5O__condense_header() */
 
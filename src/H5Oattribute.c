@@ -53,14 +53,22 @@ typedef struct {
     H5O_ainfo_t *ainfo; /* Attribute info struct */
 } H5O_iter_cvt_t;
 
-/* User data for iteration when opening an attribute */
+/* Entry in the table of attribute names to open at once */
 typedef struct {
-    /* down */
     const char *name; /* Name of attribute to open */
+    size_t      idx;  /* Index of name in caller's array */
+} H5O_attr_name_ent_t;
+
+/* User data for iteration when opening several attributes */
+typedef struct {
+    /* down */
+    H5O_attr_name_ent_t *ents;  /* Names of attributes to open, sorted by name */
+    size_t               nents; /* # of entries in table */
 
     /* up */
-    H5A_t *attr; /* Attribute data to update object header with */
-} H5O_iter_opn_t;
+    H5A_t **attrs;  /* Attributes opened, in caller's order */
+    size_t  nfound; /* # of attributes opened so far */
+} H5O_iter_opn_multi_t;
 
 /* User data for iteration when updating an attribute */
 typedef struct {
@@ -93,15 +101,6 @@ typedef struct {
     hbool_t found; /* Found attribute to delete */
 } H5O_iter_rm_t;
 
-/* User data for iteration when checking if an attribute exists */
-typedef struct {
-    /* down */
-    const char *name; /* Name of attribute to open */
-
-    /* up */
-    hbool_t *exists; /* Pointer to flag to indicate attribute exists */
-} H5O_iter_xst_t;
-
 /********************/
 /* Package Typedefs */
 /********************/
@@ -112,8 +111,10 @@ typedef struct {
 static herr_t H5O__attr_to_dense_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned H5_ATTR_UNUSED sequence,
                                     unsigned *oh_modified, void *_udata);
 static htri_t H5O__attr_find_opened_attr(const H5O_loc_t *loc, H5A_t **attr, const char *name_to_open);
-static herr_t H5O__attr_open_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned sequence,
-                                unsigned H5_ATTR_UNUSED *oh_modified, void *_udata);
+static int    H5O__attr_name_ent_cmp(const void *_ent1, const void *_ent2);
+static herr_t H5O__attr_open_multi_cb(H5O_t *oh, H5O_mesg_t *mesg /*in,out*/, unsigned sequence,
+                                      unsigned *oh_modified, void *_udata /*in,out*/);
+static H5A_t *H5O__attr_open_compact(H5F_t *f, H5O_t *oh, const char *name);
 static herr_t H5O__attr_open_by_idx_cb(const H5A_t *attr, void *_ret_attr);
 static herr_t H5O__attr_write_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned H5_ATTR_UNUSED sequence,
                                  unsigned *oh_modified, void *_udata);
@@ -125,9 +126,6 @@ static herr_t H5O__attr_rename_mod_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned H5_A
 static herr_t H5O__attr_remove_update(const H5O_loc_t *loc, H5O_t *oh, H5O_ainfo_t *ainfo);
 static herr_t H5O__attr_remove_cb(H5O_t *oh, H5O_mesg_t *mesg, unsigned H5_ATTR_UNUSED sequence,
                                   unsigned *oh_modified, void *_udata);
-static herr_t H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg,
-                                  unsigned H5_ATTR_UNUSED sequence, unsigned H5_ATTR_UNUSED *oh_modified,
-                                  void *_udata);
 
 /*********************/
 /* Package Variables */
@@ -383,50 +381,55 @@ done:
 } /* end H5O__attr_create() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5O__attr_open_cb
+ * Function:    H5O__attr_open_compact
  *
- * Purpose:     Object header iterator callback routine to open an
- *              attribute stored compactly.
- *
- * Return:      SUCCEED/FAIL
+ * Purpose:     Open an existing attribute stored compactly in an object
+ *              header, locating it through the header's name index.
  *
- * Programmer:	Quincey Koziol
- *		Dec 11 2006
+ * Return:      Success:    Pointer to opened attribute
+ *              Failure:    NULL
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5O__attr_open_cb(H5O_t *oh, H5O_mesg_t *mesg /*in,out*/, unsigned sequence,
-                  unsigned H5_ATTR_UNUSED *oh_modified, void *_udata /*in,out*/)
+static H5A_t *
+H5O__attr_open_compact(H5F_t *f, H5O_t *oh, const char *name)
 {
-    H5O_iter_opn_t *udata     = (H5O_iter_opn_t *)_udata; /* Operator user data */
-    herr_t          ret_value = H5_ITER_CONT;             /* Return value */
+    size_t mesg_idx;         /* Index of attribute's message */
+    htri_t found;            /* Whether the attribute was found */
+    H5A_t *ret_value = NULL; /* Return value */
 
     FUNC_ENTER_STATIC
 
     /* check args */
     HDassert(oh);
-    HDassert(mesg);
-    HDassert(!udata->attr);
-
-    /* Check for correct attribute message to modify */
-    if (HDstrcmp(((H5A_t *)mesg->native)->shared->name, udata->name) == 0) {
-        /* Make a copy of the attribute to return */
-        if (NULL == (udata->attr = H5A__copy(NULL, (H5A_t *)mesg->native)))
-            HGOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy attribute")
-
-        /* Assign [somewhat arbitrary] creation order value, for older versions
-         * of the format or if creation order is not tracked */
-        if (oh->version == H5O_VERSION_1 || !(oh->flags & H5O_HDR_ATTR_CRT_ORDER_TRACKED))
-            udata->attr->shared->crt_idx = sequence;
+    HDassert(name);
 
-        /* Stop iterating */
-        ret_value = H5_ITER_STOP;
+    /* Locate the attribute's message */
+    if ((found = H5O__name_index_find(f, oh, H5O_MSG_ATTR, name, &mesg_idx)) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "error locating attribute")
+    if (!found)
+        HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, NULL, "can't locate attribute: '%s'", name)
+
+    /* Make a copy of the attribute to return */
+    if (NULL == (ret_value = H5A__copy(NULL, (H5A_t *)oh->mesg[mesg_idx].native)))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "unable to copy attribute")
+
+    /* Assign [somewhat arbitrary] creation order value (the attribute's
+     * position among the header's attribute messages), for older versions
+     * of the format or if creation order is not tracked */
+    if (oh->version == H5O_VERSION_1 || !(oh->flags & H5O_HDR_ATTR_CRT_ORDER_TRACKED)) {
+        unsigned sequence = 0; /* Relative index of attribute message */
+        size_t   u;            /* Local index variable */
+
+        for (u = 0; u < mesg_idx; u++)
+            if (H5O_MSG_ATTR == oh->mesg[u].type)
+                sequence++;
+        ret_value->shared->crt_idx = sequence;
     } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5O__attr_open_cb() */
+} /* end H5O__attr_open_compact() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5O__attr_open_by_name
@@ -485,26 +488,9 @@ H5O__attr_open_by_name(const H5O_loc_t *loc, const char *name)
                 HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "can't open attribute")
         } /* end if */
         else {
-            H5O_iter_opn_t      udata; /* User data for callback */
-            H5O_mesg_operator_t op;    /* Wrapper for operator */
-
-            /* Set up user data for callback */
-            udata.name = name;
-            udata.attr = NULL;
-
-            /* Iterate over attributes, to locate correct one to open */
-            op.op_type  = H5O_MESG_OP_LIB;
-            op.u.lib_op = H5O__attr_open_cb;
-            if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
-                HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "error updating attribute")
-
-            /* Check that we found the attribute */
-            if (!udata.attr)
-                HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, NULL, "can't locate attribute: '%s'", name)
-
-            /* Get attribute opened from object header */
-            HDassert(udata.attr);
-            opened_attr = udata.attr;
+            /* Open attribute with compact storage */
+            if (NULL == (opened_attr = H5O__attr_open_compact(loc->file, oh, name)))
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, NULL, "can't open attribute")
         } /* end else */
 
         /* Mark datatype as being on disk now */
@@ -527,6 +513,245 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5O__attr_open_by_name() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_name_ent_cmp
+ *
+ * Purpose:     Compare two entries in the table of attribute names to look
+ *              up, for sorting & searching the table by name.
+ *
+ * Return:      <0, 0 or >0, as for strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5O__attr_name_ent_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5O_attr_name_ent_t *ent1 = (const H5O_attr_name_ent_t *)_ent1;
+    const H5O_attr_name_ent_t *ent2 = (const H5O_attr_name_ent_t *)_ent2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(HDstrcmp(ent1->name, ent2->name))
+} /* end H5O__attr_name_ent_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_open_multi_cb
+ *
+ * Purpose:     Object header iterator callback routine to open all the
+ *              requested attributes stored compactly, in one pass over
+ *              the header's messages.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__attr_open_multi_cb(H5O_t *oh, H5O_mesg_t *mesg /*in,out*/, unsigned sequence,
+                        unsigned H5_ATTR_UNUSED *oh_modified, void *_udata /*in,out*/)
+{
+    H5O_iter_opn_multi_t *udata = (H5O_iter_opn_multi_t *)_udata; /* Operator user data */
+    H5O_attr_name_ent_t   key;                                     /* Search key */
+    H5O_attr_name_ent_t * ent;                                     /* Matching name entry */
+    herr_t                ret_value = H5_ITER_CONT;                /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(oh);
+    HDassert(mesg);
+
+    /* Look the message's attribute name up in the sorted table */
+    key.name = ((H5A_t *)mesg->native)->shared->name;
+    if (NULL != (ent = (H5O_attr_name_ent_t *)HDbsearch(&key, udata->ents, udata->nents,
+                                                         sizeof(H5O_attr_name_ent_t),
+                                                         H5O__attr_name_ent_cmp))) {
+        H5O_attr_name_ent_t *last = udata->ents + udata->nents; /* End of the table */
+
+        /* Back up to the first entry with this name (names may be repeated) */
+        while (ent > udata->ents && !HDstrcmp((ent - 1)->name, key.name))
+            ent--;
+
+        /* Open a copy of the attribute for every entry with this name */
+        for (; ent < last && !HDstrcmp(ent->name, key.name); ent++) {
+            if (udata->attrs[ent->idx])
+                continue;
+
+            if (NULL == (udata->attrs[ent->idx] = H5A__copy(NULL, (H5A_t *)mesg->native)))
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, H5_ITER_ERROR, "unable to copy attribute")
+
+            /* Assign [somewhat arbitrary] creation order value, for older versions
+             * of the format or if creation order is not tracked */
+            if (oh->version == H5O_VERSION_1 || !(oh->flags & H5O_HDR_ATTR_CRT_ORDER_TRACKED))
+                udata->attrs[ent->idx]->shared->crt_idx = sequence;
+
+            udata->nfound++;
+        } /* end for */
+
+        /* Stop iterating once every attribute has been located */
+        if (udata->nfound == udata->nents)
+            ret_value = H5_ITER_STOP;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__attr_open_multi_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__attr_open_multi
+ *
+ * Purpose:     Open several existing attributes in an object header, with
+ *              a single pass over the header's messages (or a single
+ *              opening of the dense attribute storage).
+ *
+ *              When NAMES is NULL, the first COUNT attributes of the
+ *              object, in increasing name order, are opened instead.
+ *
+ *              On success, ATTRS holds COUNT opened attributes, which
+ *              must be closed by the caller.  On failure, ATTRS is reset
+ *              to NULLs.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__attr_open_multi(const H5O_loc_t *loc, size_t count, const char *names[], H5A_t *attrs[])
+{
+    H5O_t *              oh = NULL;            /* Pointer to actual object header */
+    H5O_ainfo_t          ainfo;                /* Attribute information for object */
+    H5O_attr_name_ent_t *ents          = NULL; /* Table of names to look up */
+    size_t               num_open_attr = 0;    /* Number of opened attributes in file */
+    size_t               u;                    /* Local index variable */
+    herr_t               ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(loc->addr)
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(attrs);
+
+    for (u = 0; u < count; u++)
+        attrs[u] = NULL;
+
+    /* Protect the object header to iterate over */
+    if (NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+
+    /* Check for attribute info stored */
+    ainfo.fheap_addr = HADDR_UNDEF;
+    if (oh->version > H5O_VERSION_1) {
+        /* Check for (& retrieve if available) attribute info */
+        if (H5A__get_ainfo(loc->file, oh, &ainfo) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for attribute info message")
+    } /* end if */
+
+    if (NULL == names) {
+        H5A_attr_table_t atable = {0, NULL}; /* Table of attributes */
+
+        /* Build the table of all the object's attributes, sorted by name */
+        if (H5F_addr_defined(ainfo.fheap_addr)) {
+            if (H5A__dense_build_table(loc->file, &ainfo, H5_INDEX_NAME, H5_ITER_INC, &atable) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "error building attribute table")
+        } /* end if */
+        else {
+            if (H5A__compact_build_table(loc->file, oh, H5_INDEX_NAME, H5_ITER_INC, &atable) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "error building attribute table")
+        } /* end else */
+
+        /* Take over the first COUNT attributes */
+        if (count <= atable.nattrs)
+            for (u = 0; u < count; u++) {
+                attrs[u]        = atable.attrs[u];
+                atable.attrs[u] = NULL;
+            } /* end for */
+
+        /* Release the rest of the table */
+        if (atable.attrs && H5A__attr_release_table(&atable) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTFREE, FAIL, "unable to release attribute table")
+
+        if (count > atable.nattrs)
+            HGOTO_ERROR(H5E_ATTR, H5E_BADRANGE, FAIL, "object has fewer attributes than requested")
+    } /* end if */
+    else {
+        /* Share the information of attributes that are already opened */
+        if (H5F_get_obj_count(loc->file, H5F_OBJ_ATTR | H5F_OBJ_LOCAL, FALSE, &num_open_attr) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't count opened attributes")
+        if (num_open_attr)
+            for (u = 0; u < count; u++) {
+                H5A_t *exist_attr = NULL; /* Existing opened attribute object */
+                htri_t found_open_attr;   /* Whether opened object is found */
+
+                if ((found_open_attr = H5O__attr_find_opened_attr(loc, &exist_attr, names[u])) < 0)
+                    HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "failed in finding opened attribute")
+                else if (found_open_attr == TRUE)
+                    if (NULL == (attrs[u] = H5A__copy(NULL, exist_attr)))
+                        HGOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, FAIL, "can't copy existing attribute")
+            } /* end for */
+
+        /* Check for attributes in dense storage */
+        if (H5F_addr_defined(ainfo.fheap_addr)) {
+            /* Open the remaining attributes from dense storage */
+            if (H5A__dense_open_multi(loc->file, &ainfo, count, names, attrs) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "can't open attributes")
+        } /* end if */
+        else {
+            H5O_iter_opn_multi_t udata; /* User data for callback */
+            H5O_mesg_operator_t  op;    /* Wrapper for operator */
+
+            /* Build the table of names to look up, sorted by name */
+            if (NULL == (ents = (H5O_attr_name_ent_t *)H5MM_malloc(count * sizeof(H5O_attr_name_ent_t))))
+                HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't allocate attribute name table")
+            udata.nfound = 0;
+            for (u = 0; u < count; u++) {
+                ents[u].name = names[u];
+                ents[u].idx  = u;
+                if (attrs[u])
+                    udata.nfound++;
+            } /* end for */
+            HDqsort(ents, count, sizeof(H5O_attr_name_ent_t), H5O__attr_name_ent_cmp);
+
+            /* Set up user data for callback */
+            udata.ents  = ents;
+            udata.nents = count;
+            udata.attrs = attrs;
+
+            /* Iterate over attributes once, opening every requested one */
+            if (udata.nfound < count) {
+                op.op_type  = H5O_MESG_OP_LIB;
+                op.u.lib_op = H5O__attr_open_multi_cb;
+                if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+                    HGOTO_ERROR(H5E_ATTR, H5E_CANTOPENOBJ, FAIL, "error opening attributes")
+            } /* end if */
+
+            /* Check that we found all the attributes */
+            for (u = 0; u < count; u++)
+                if (NULL == attrs[u])
+                    HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "can't locate attribute: '%s'", names[u])
+        } /* end else */
+    }     /* end else */
+
+    /* Mark datatypes as being on disk now */
+    for (u = 0; u < count; u++)
+        if (H5T_set_loc(attrs[u]->shared->dt, H5F_VOL_OBJ(loc->file), H5T_LOC_DISK) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "invalid datatype location")
+
+done:
+    if (oh && H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+    H5MM_xfree(ents);
+
+    /* Release any resources, on error */
+    if (ret_value < 0)
+        for (u = 0; u < count; u++)
+            if (attrs[u]) {
+                if (H5A__close(attrs[u]) < 0)
+                    HDONE_ERROR(H5E_ATTR, H5E_CANTCLOSEOBJ, FAIL, "can't close attribute")
+                attrs[u] = NULL;
+            } /* end if */
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5O__attr_open_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5O__attr_open_by_idx_cb
  *
@@ -1024,6 +1249,9 @@ H5O__attr_rename_mod_cb(H5O_t *oh, H5O_mesg_t *mesg /*in,out*/, unsigned H5_ATTR
         H5MM_xfree(((H5A_t *)mesg->native)->shared->name);
         ((H5A_t *)mesg->native)->shared->name = H5MM_xstrdup(udata->new_name);
 
+        /* The header's name index no longer matches its messages */
+        H5O__name_index_reset(oh);
+
         /* Recompute the version to encode the attribute with */
         if (H5A__set_version(udata->f, ((H5A_t *)mesg->native)) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_CANTSET, H5_ITER_ERROR, "unable to update attribute version")
@@ -1715,44 +1943,6 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O__attr_count_real */
 
-/*-------------------------------------------------------------------------
- * Function:    H5O__attr_exists_cb
- *
- * Purpose:     Object header iterator callback routine to check for an
- *              attribute stored compactly, by name.
- *
- * Return:      SUCCEED/FAIL
- *
- * Programmer:	Quincey Koziol
- *		Dec 11 2006
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5O__attr_exists_cb(H5O_t H5_ATTR_UNUSED *oh, H5O_mesg_t *mesg /*in,out*/, unsigned H5_ATTR_UNUSED sequence,
-                    unsigned H5_ATTR_UNUSED *oh_modified, void *_udata /*in,out*/)
-{
-    H5O_iter_xst_t *udata     = (H5O_iter_xst_t *)_udata; /* Operator user data */
-    herr_t          ret_value = H5_ITER_CONT;             /* Return value */
-
-    FUNC_ENTER_STATIC_NOERR
-
-    /* check args */
-    HDassert(mesg);
-    HDassert(udata->exists && !*udata->exists);
-
-    /* Check for correct attribute message */
-    if (HDstrcmp(((H5A_t *)mesg->native)->shared->name, udata->name) == 0) {
-        /* Indicate that this message is the attribute sought */
-        *udata->exists = TRUE;
-
-        /* Stop iterating */
-        ret_value = H5_ITER_STOP;
-    } /* end if */
-
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5O__attr_exists_cb() */
-
 /*-------------------------------------------------------------------------
  * Function:    H5O__attr_exists
  *
@@ -1798,18 +1988,13 @@ H5O__attr_exists(const H5O_loc_t *loc, const char *name, hbool_t *attr_exists)
             HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "error checking for existence of attribute")
     } /* end if */
     else {
-        H5O_iter_xst_t      udata; /* User data for callback */
-        H5O_mesg_operator_t op;    /* Wrapper for operator */
-
-        /* Set up user data for callback */
-        udata.name   = name;
-        udata.exists = attr_exists;
+        size_t mesg_idx; /* Index of attribute's message */
+        htri_t found;    /* Whether the attribute was found */
 
-        /* Iterate over existing attributes, checking for attribute with same name */
-        op.op_type  = H5O_MESG_OP_LIB;
-        op.u.lib_op = H5O__attr_exists_cb;
-        if (H5O__msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &op, &udata) < 0)
+        /* Look up the attribute in the compact storage */
+        if ((found = H5O__name_index_find(loc->file, oh, H5O_MSG_ATTR, name, &mesg_idx)) < 0)
             HGOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "error checking for existence of attribute")
+        *attr_exists = (hbool_t)found;
     } /* end else */
 
 done:
@@ -1298,6 +1298,9 @@ H5O__chunk_deserialize(H5O_t *oh, haddr_t addr, size_t len, const uint8_t *image
     HDassert(udata->f);
     HDassert(udata->cont_msg_info);
 
+    /* New messages aren't in the header's name index */
+    H5O__name_index_reset(oh);
+
     /* Increase chunk array size, if necessary */
     if (oh->nchunks >= oh->alloc_nchunks) {
         size_t       na = MAX(H5O_NCHUNKS, oh->alloc_nchunks * 2); /* Double # of chunks allocated */
@@ -0,0 +1,371 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Ocstats.c
+ *
+ * Purpose:     A message indicating that a block holding the per-chunk
+ *              value statistics of a chunked dataset exists at the
+ *              specified offset in the HDF5 file.
+ *
+ *              The block itself is encoded and decoded by the dataset
+ *              code (see H5Dstats.c); this message only records where it
+ *              lives, so that the space can be released when the dataset
+ *              is deleted and the block can be carried along when the
+ *              dataset is copied.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include "H5Omodule.h" /* This source code file is part of the H5O module */
+
+#include "H5private.h"   /* Generic Functions                     */
+#include "H5Eprivate.h"  /* Error handling                        */
+#include "H5Fprivate.h"  /* Files                                 */
+#include "H5FLprivate.h" /* Free Lists                            */
+#include "H5MFprivate.h" /* File space management                 */
+#include "H5MMprivate.h" /* Memory management                     */
+#include "H5Opkg.h"      /* Object headers                        */
+
+/* Callbacks for message class */
+static void *H5O__cstats_decode(H5F_t *f, H5O_t *open_oh, unsigned mesg_flags, unsigned *ioflags,
+                                size_t p_size, const uint8_t *p);
+static herr_t H5O__cstats_encode(H5F_t *f, hbool_t disable_shared, uint8_t *p, const void *_mesg);
+static void * H5O__cstats_copy(const void *_mesg, void *_dest);
+static size_t H5O__cstats_size(const H5F_t *f, hbool_t disable_shared, const void *_mesg);
+static herr_t H5O__cstats_free(void *mesg);
+static herr_t H5O__cstats_delete(H5F_t *f, H5O_t *open_oh, void *_mesg);
+static void * H5O__cstats_copy_file(H5F_t *file_src, void *mesg_src, H5F_t *file_dst, hbool_t *recompute_size,
+                                    unsigned *mesg_flags, H5O_copy_t *cpy_info, void *udata);
+static herr_t H5O__cstats_debug(H5F_t *f, const void *_mesg, FILE *stream, int indent, int fwidth);
+
+/* This message derives from H5O message class */
+const H5O_msg_class_t H5O_MSG_CSTATS[1] = {{
+    H5O_CSTATS_ID,         /* message id number              */
+    "chunk statistics",    /* message name for debugging     */
+    sizeof(H5O_cstats_t),  /* native message size            */
+    0,                     /* messages are sharable?         */
+    H5O__cstats_decode,    /* decode message                 */
+    H5O__cstats_encode,    /* encode message                 */
+    H5O__cstats_copy,      /* copy method                    */
+    H5O__cstats_size,      /* size of raw message            */
+    NULL,                  /* reset method                   */
+    H5O__cstats_free,      /* free method                    */
+    H5O__cstats_delete,    /* file delete method             */
+    NULL,                  /* link method                    */
+    NULL,                  /* set share method               */
+    NULL,                  /* can share method               */
+    NULL,                  /* pre copy native value to file  */
+    H5O__cstats_copy_file, /* copy native value to file      */
+    NULL,                  /* post copy native value to file */
+    NULL,                  /* get creation index             */
+    NULL,                  /* set creation index             */
+    H5O__cstats_debug      /* debugging                      */
+}};
+
+/* Only one version of the chunk statistics message at present */
+#define H5O_CSTATS_VERSION_0 0
+
+/* Declare the free list for H5O_cstats_t's */
+H5FL_DEFINE_STATIC(H5O_cstats_t);
+
+/* Declare a free list to manage blocks of statistics being copied */
+H5FL_BLK_DEFINE_STATIC(cstats_block);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_decode
+ *
+ * Purpose:     Decode a chunk statistics message and return a pointer to
+ *              a newly allocated H5O_cstats_t struct.
+ *
+ * Return:      Success:        Ptr to new message in native struct.
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__cstats_decode(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh, unsigned H5_ATTR_UNUSED mesg_flags,
+                   unsigned H5_ATTR_UNUSED *ioflags, size_t H5_ATTR_UNUSED p_size, const uint8_t *p)
+{
+    H5O_cstats_t *mesg;             /* Native message        */
+    void *        ret_value = NULL; /* Return value          */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(p);
+
+    /* Version of message */
+    if (*p++ != H5O_CSTATS_VERSION_0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "bad version number for message")
+
+    /* Allocate space for message */
+    if (NULL == (mesg = (H5O_cstats_t *)H5FL_MALLOC(H5O_cstats_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for chunk statistics message")
+
+    /* Decode */
+    H5F_addr_decode(f, &p, &(mesg->addr));
+    H5F_DECODE_LENGTH(f, p, mesg->size);
+    H5F_DECODE_LENGTH(f, p, mesg->nentries);
+
+    /* Set return value */
+    ret_value = (void *)mesg;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__cstats_decode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_encode
+ *
+ * Purpose:     Encode a chunk statistics message
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__cstats_encode(H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, uint8_t *p, const void *_mesg)
+{
+    const H5O_cstats_t *mesg = (const H5O_cstats_t *)_mesg;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(p);
+    HDassert(mesg);
+
+    /* encode */
+    *p++ = H5O_CSTATS_VERSION_0;
+    H5F_addr_encode(f, &p, mesg->addr);
+    H5F_ENCODE_LENGTH(f, p, mesg->size);
+    H5F_ENCODE_LENGTH(f, p, mesg->nentries);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__cstats_encode() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_copy
+ *
+ * Purpose:     Copies a message from _MESG to _DEST, allocating _DEST if
+ *              necessary.
+ *
+ * Return:      Success:        Ptr to _DEST
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__cstats_copy(const void *_mesg, void *_dest)
+{
+    const H5O_cstats_t *mesg      = (const H5O_cstats_t *)_mesg;
+    H5O_cstats_t *      dest      = (H5O_cstats_t *)_dest;
+    void *              ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(mesg);
+    if (!dest && NULL == (dest = H5FL_MALLOC(H5O_cstats_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* copy */
+    *dest = *mesg;
+
+    /* Set return value */
+    ret_value = dest;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__cstats_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_size
+ *
+ * Purpose:     Returns the size of the raw message in bytes not counting
+ *              the message type or size fields, but only the data fields.
+ *              This function doesn't take into account alignment.
+ *
+ * Return:      Success:        Message data size in bytes without alignment.
+ *
+ *              Failure:        zero
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5O__cstats_size(const H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, const void H5_ATTR_UNUSED *_mesg)
+{
+    size_t ret_value = 0; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Set return value */
+    ret_value = (size_t)(1 +                  /* Version number              */
+                         H5F_SIZEOF_ADDR(f) + /* Address of statistics block */
+                         H5F_SIZEOF_SIZE(f) + /* Length of statistics block  */
+                         H5F_SIZEOF_SIZE(f)); /* Number of entries in block  */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__cstats_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_free
+ *
+ * Purpose:     Free the message
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__cstats_free(void *mesg)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(mesg);
+
+    mesg = H5FL_FREE(H5O_cstats_t, mesg);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__cstats_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_delete
+ *
+ * Purpose:     Free file space referenced by message
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__cstats_delete(H5F_t *f, H5O_t H5_ATTR_UNUSED *open_oh, void *_mesg)
+{
+    H5O_cstats_t *mesg      = (H5O_cstats_t *)_mesg;
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(f);
+    HDassert(mesg);
+
+    /* Free file space for the statistics block */
+    if (H5F_addr_defined(mesg->addr))
+        if (H5MF_xfree(f, H5FD_MEM_DRAW, mesg->addr, mesg->size) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTFREE, FAIL, "unable to free file space for chunk statistics")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__cstats_delete() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_copy_file
+ *
+ * Purpose:     Copies a chunk statistics message and the block it refers
+ *              to from _MESG in FILE_SRC to FILE_DST.
+ *
+ *              The block is file-independent (its keys are derived from
+ *              the chunk grid and its fields have fixed sizes), so it is
+ *              copied as is.
+ *
+ * Return:      Success:        Ptr to _DEST
+ *
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5O__cstats_copy_file(H5F_t *file_src, void *mesg_src, H5F_t *file_dst,
+                      hbool_t H5_ATTR_UNUSED *recompute_size, unsigned H5_ATTR_UNUSED *mesg_flags,
+                      H5O_copy_t H5_ATTR_UNUSED *cpy_info, void H5_ATTR_UNUSED *udata)
+{
+    H5O_cstats_t *cstats_src = (H5O_cstats_t *)mesg_src;
+    H5O_cstats_t *cstats_dst = NULL;
+    uint8_t *     block      = NULL; /* Copy of the statistics block */
+    void *        ret_value  = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(cstats_src);
+    HDassert(file_dst);
+
+    /* Allocate space for the destination message */
+    if (NULL == (cstats_dst = H5FL_MALLOC(H5O_cstats_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    *cstats_dst = *cstats_src;
+
+    if (H5F_addr_defined(cstats_src->addr)) {
+        size_t size; /* Size of the statistics block */
+
+        H5_CHECKED_ASSIGN(size, size_t, cstats_src->size, hsize_t);
+        if (NULL == (block = (uint8_t *)H5FL_BLK_MALLOC(cstats_block, size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+        /* Read the block from the source file */
+        if (H5F_block_read(file_src, H5FD_MEM_DRAW, cstats_src->addr, size, block) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_READERROR, NULL, "unable to read chunk statistics")
+
+        /* Write it to new space in the destination file */
+        if (HADDR_UNDEF == (cstats_dst->addr = H5MF_alloc(file_dst, H5FD_MEM_DRAW, cstats_src->size)))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, NULL, "unable to allocate space for chunk statistics")
+        if (H5F_block_write(file_dst, H5FD_MEM_DRAW, cstats_dst->addr, size, block) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_WRITEERROR, NULL, "unable to write chunk statistics")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = cstats_dst;
+
+done:
+    if (block)
+        block = H5FL_BLK_FREE(cstats_block, block);
+    if (!ret_value && cstats_dst)
+        cstats_dst = H5FL_FREE(H5O_cstats_t, cstats_dst);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__cstats_copy_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__cstats_debug
+ *
+ * Purpose:     Prints debugging info.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__cstats_debug(H5F_t H5_ATTR_UNUSED *f, const void *_mesg, FILE *stream, int indent, int fwidth)
+{
+    const H5O_cstats_t *cstats = (const H5O_cstats_t *)_mesg;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* check args */
+    HDassert(f);
+    HDassert(cstats);
+    HDassert(stream);
+    HDassert(indent >= 0);
+    HDassert(fwidth >= 0);
+
+    HDfprintf(stream, "%*s%-*s %" PRIuHADDR "\n", indent, "", fwidth,
+              "Chunk Statistics Block address:", cstats->addr);
+    HDfprintf(stream, "%*s%-*s %" PRIuHSIZE "\n", indent, "", fwidth,
+              "Chunk Statistics Block size in bytes:", cstats->size);
+    HDfprintf(stream, "%*s%-*s %" PRIuHSIZE "\n", indent, "", fwidth, "Number of chunks:", cstats->nentries);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__cstats_debug() */
@@ -209,6 +209,21 @@ H5O_refresh_metadata(hid_t oid, H5O_loc_t oloc)
         H5O_shared_t cached_H5O_shared;
         H5VL_t *     connector = NULL;
 
+        /* In the light mode, leave the object alone unless some of its
+         *  metadata changed in the file.
+         */
+        if (H5F_LIGHT_REFRESH(oloc.file)) {
+            haddr_t tag     = HADDR_UNDEF; /* Tag for object */
+            hbool_t changed = FALSE;       /* Whether the object's metadata changed */
+
+            if (H5O__oh_tag(&oloc, &tag) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to get object header address")
+            if (H5F_tagged_metadata_changed(oloc.file, tag, &changed) < 0)
+                HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "unable to compare metadata with the file")
+            if (!changed)
+                HGOTO_DONE(SUCCEED)
+        } /* end if */
+
         /* Create empty object location */
         obj_loc.oloc = &obj_oloc;
         obj_loc.path = &obj_path;
@@ -271,7 +286,8 @@ done:
  *		(2) Handle multiple dataset opens
  *		(3) Get object cork status
  *		(4) Close the object
- *		(5) Flush and evict object metadata
+ *		(5) Flush and evict object metadata (only the metadata that
+ *		    changed in the file, in the light refresh mode)
  *		(6) Re-cork the object if needed
  *
  * Return:  Success:    Non-negative
@@ -320,8 +336,14 @@ H5O__refresh_metadata_close(hid_t oid, H5O_loc_t oloc, H5G_loc_t *obj_loc)
     if (H5F_flush_tagged_metadata(oloc.file, tag) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTFLUSH, FAIL, "unable to flush tagged metadata")
 
-    /* Evict the object's tagged metadata */
-    if (H5F_evict_tagged_metadata(oloc.file, tag) < 0)
+    /* Evict the object's tagged metadata (in the light mode, only what
+     *  changed in the file)
+     */
+    if (H5F_LIGHT_REFRESH(oloc.file)) {
+        if (H5F_evict_changed_tagged_metadata(oloc.file, tag) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTFLUSH, FAIL, "unable to evict changed metadata")
+    } /* end if */
+    else if (H5F_evict_tagged_metadata(oloc.file, tag) < 0)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTFLUSH, FAIL, "unable to evict metadata")
 
     /* Re-cork object with tag */
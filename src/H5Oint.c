@@ -35,6 +35,7 @@
 #include "H5Fprivate.h"  /* File access                              */
 #include "H5FLprivate.h" /* Free lists                               */
 #include "H5FOprivate.h" /* File objects                             */
+#include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
 #include "H5Lprivate.h"  /* Links                                    */
 #include "H5MFprivate.h" /* File memory management                   */
@@ -120,7 +121,8 @@ const H5O_msg_class_t *const H5O_msg_class_g[] = {
     H5O_MSG_REFCOUNT,    /*0x0016 Object's ref. count             */
     H5O_MSG_FSINFO,      /*0x0017 Free-space manager info         */
     H5O_MSG_MDCI,        /*0x0018 Metadata cache image            */
-    H5O_MSG_UNKNOWN      /*0x0019 Placeholder for unknown message */
+    H5O_MSG_CSTATS,      /*0x0019 Chunk statistics                */
+    H5O_MSG_UNKNOWN      /*0x001A Placeholder for unknown message */
 };
 
 /* Format version bounds for object header */
@@ -1558,6 +1560,10 @@ H5O_delete(H5F_t *f, haddr_t addr)
     loc.addr         = addr;
     loc.holding_file = FALSE;
 
+    /* The object's address may be reused, so drop any links cached for the file */
+    if (H5G_path_cache_reset(f) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTRESET, FAIL, "unable to reset path cache")
+
     /* Get the object header information */
     if (NULL == (oh = H5O_protect(&loc, H5AC__NO_FLAGS_SET, FALSE)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to load object header")
@@ -3030,6 +3036,9 @@ H5O__free(H5O_t *oh)
     HDassert(oh);
     HDassert(0 == oh->rc);
 
+    /* Destroy the name indices */
+    H5O__name_index_reset(oh);
+
     /* Destroy chunks */
     if (oh->chunk) {
         for (u = 0; u < oh->nchunks; u++)
@@ -462,6 +462,61 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value)
 } /* end H5O_msg_read() */
 
+/*-------------------------------------------------------------------------
+ * Function:	H5O_msg_read_by_name
+ *
+ * Purpose:	Reads the link or attribute message with a given name from
+ *		an object header's compact storage.  If MESG is non-NULL,
+ *		a copy of the message is returned in it, which should be
+ *		released with H5O_msg_reset().
+ *
+ *		Lookups use the object header's in-memory name index, so
+ *		they don't scan every message in large headers.
+ *
+ * Return:	Success:	TRUE if the message was found, FALSE if not
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5O_msg_read_by_name(const H5O_loc_t *loc, unsigned type_id, const char *name, void *mesg)
+{
+    const H5O_msg_class_t *type;             /* Actual H5O class type for the ID */
+    H5O_t *                oh = NULL;        /* Object header to use */
+    size_t                 idx;              /* Message's index in object header */
+    htri_t                 ret_value = FAIL; /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(loc->addr, FAIL)
+
+    /* check args */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(H5F_addr_defined(loc->addr));
+    HDassert(type_id == H5O_LINK_ID || type_id == H5O_ATTR_ID);
+    HDassert(name);
+    type = H5O_msg_class_g[type_id]; /* map the type ID to the actual type object */
+    HDassert(type);
+
+    /* Get the object header */
+    if (NULL == (oh = H5O_protect(loc, H5AC__READ_ONLY_FLAG, FALSE)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header")
+
+    /* Look up the message */
+    if ((ret_value = H5O__name_index_find(loc->file, oh, type, name, &idx)) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_NOTFOUND, FAIL, "unable to look up object header message")
+
+    /* Copy the native message, if requested */
+    if (ret_value && mesg)
+        if (NULL == (type->copy)(oh->mesg[idx].native, mesg))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "unable to copy message to user space")
+
+done:
+    if (oh && H5O_unprotect(loc, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value)
+} /* end H5O_msg_read_by_name() */
+
 /*-------------------------------------------------------------------------
  * Function:	H5O_msg_read_oh
  *
@@ -1895,6 +1950,9 @@ H5O__copy_mesg(H5F_t *f, H5O_t *oh, size_t idx, const H5O_msg_class_t *type, con
     if (NULL == (chk_proxy = H5O__chunk_protect(f, oh, idx_msg->chunkno)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTPROTECT, FAIL, "unable to protect object header chunk")
 
+    /* Remove any previous name for the message from the header's name index */
+    H5O__name_index_remove(oh, idx);
+
     /* Reset existing native information for the header's message */
     H5O__msg_reset_real(type, idx_msg->native);
 
@@ -1902,6 +1960,10 @@ H5O__copy_mesg(H5F_t *f, H5O_t *oh, size_t idx, const H5O_msg_class_t *type, con
     if (NULL == (idx_msg->native = (type->copy)(mesg, idx_msg->native)))
         HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "unable to copy message to object header")
 
+    /* Add the message's name to the header's name index */
+    if (H5O__name_index_insert(oh, idx) < 0)
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, FAIL, "unable to update object header name index")
+
     /* Update the message flags */
     idx_msg->flags = (uint8_t)mesg_flags;
 
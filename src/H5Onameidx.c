@@ -0,0 +1,442 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:     H5Onameidx.c
+ *
+ * Purpose:     In-memory name index for the link and attribute messages
+ *              stored compactly in an object header.
+ *
+ *              Looking up a link or attribute by name in compact storage
+ *              would otherwise scan every message in the header.  For
+ *              headers with many messages, a skip list keyed on the
+ *              link/attribute name is built on the first lookup and kept
+ *              up to date as messages are added and released.  Operations
+ *              that shuffle the header's message array (condensing the
+ *              header, moving messages into a new chunk, etc.) simply
+ *              discard the index, which is rebuilt on the next lookup.
+ *
+ *              The index is never stored in the file.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5A_FRIEND     /* Suppress error about including H5Apkg.h */
+#include "H5Omodule.h" /* This source code file is part of the H5O module */
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"   /* Generic Functions                        */
+#include "H5Apkg.h"      /* Attributes                               */
+#include "H5Eprivate.h"  /* Error handling                           */
+#include "H5FLprivate.h" /* Free lists                               */
+#include "H5MMprivate.h" /* Memory management                        */
+#include "H5Opkg.h"      /* Object headers                           */
+#include "H5SLprivate.h" /* Skip lists                               */
+
+/****************/
+/* Local Macros */
+/****************/
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Entry in an object header's name index */
+typedef struct H5O_name_ent_t {
+    char * name; /* Name of link or attribute (key for skip list) */
+    size_t idx;  /* Index of message in object header's message array */
+} H5O_name_ent_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+static H5SL_t **    H5O__name_index_list(H5O_t *oh, const H5O_msg_class_t *type);
+static const char * H5O__name_index_mesg_name(const H5O_mesg_t *mesg);
+static herr_t       H5O__name_index_build(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type);
+static herr_t       H5O__name_index_add(H5SL_t *slist, const char *name, size_t idx);
+static herr_t       H5O__name_index_free_cb(void *item, void *key, void *op_data);
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5O_name_ent_t struct */
+H5FL_DEFINE_STATIC(H5O_name_ent_t);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_list
+ *
+ * Purpose:     Retrieve the location of the name index for a message
+ *              class, if that class is indexed by name.
+ *
+ * Return:      Success:    Pointer to the skip list pointer in the header
+ *              Failure:    NULL (message class isn't indexed)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5SL_t **
+H5O__name_index_list(H5O_t *oh, const H5O_msg_class_t *type)
+{
+    H5SL_t **ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if (type == H5O_MSG_LINK)
+        ret_value = &oh->link_names;
+    else if (type == H5O_MSG_ATTR)
+        ret_value = &oh->attr_names;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__name_index_list() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_mesg_name
+ *
+ * Purpose:     Retrieve the name of a decoded link or attribute message.
+ *
+ * Return:      Pointer to the name in the message's native information
+ *
+ *-------------------------------------------------------------------------
+ */
+static const char *
+H5O__name_index_mesg_name(const H5O_mesg_t *mesg)
+{
+    const char *ret_value = NULL; /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(mesg->native);
+
+    if (mesg->type == H5O_MSG_LINK)
+        ret_value = ((const H5O_link_t *)mesg->native)->name;
+    else {
+        HDassert(mesg->type == H5O_MSG_ATTR);
+        ret_value = ((const H5A_t *)mesg->native)->shared->name;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__name_index_mesg_name() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_add
+ *
+ * Purpose:     Add a name to a name index, or point an existing entry for
+ *              the name at a new message.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__name_index_add(H5SL_t *slist, const char *name, size_t idx)
+{
+    H5O_name_ent_t *ent       = NULL;    /* Name index entry */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(slist);
+    HDassert(name);
+
+    if (NULL != (ent = (H5O_name_ent_t *)H5SL_search(slist, name)))
+        ent->idx = idx;
+    else {
+        if (NULL == (ent = H5FL_MALLOC(H5O_name_ent_t)))
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, FAIL, "can't allocate name index entry")
+        if (NULL == (ent->name = H5MM_xstrdup(name))) {
+            ent = H5FL_FREE(H5O_name_ent_t, ent);
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTALLOC, FAIL, "can't copy name for name index entry")
+        } /* end if */
+        ent->idx = idx;
+
+        if (H5SL_insert(slist, ent, ent->name) < 0) {
+            H5MM_xfree(ent->name);
+            ent = H5FL_FREE(H5O_name_ent_t, ent);
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, FAIL, "can't insert name index entry")
+        } /* end if */
+    }     /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__name_index_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_free_cb
+ *
+ * Purpose:     Skip list callback to release a name index entry.
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__name_index_free_cb(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    H5O_name_ent_t *ent = (H5O_name_ent_t *)item; /* Name index entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(ent);
+
+    H5MM_xfree(ent->name);
+    ent = H5FL_FREE(H5O_name_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__name_index_free_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_build
+ *
+ * Purpose:     Build the name index for all the messages of a class in
+ *              an object header.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__name_index_build(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type)
+{
+    H5SL_t **   slist;               /* Name index to build */
+    H5O_mesg_t *idx_msg;             /* Pointer to current message */
+    size_t      u;                   /* Local index variable */
+    herr_t      ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    slist = H5O__name_index_list(oh, type);
+    HDassert(slist && NULL == *slist);
+
+    if (NULL == (*slist = H5SL_create(H5SL_TYPE_STR, NULL)))
+        HGOTO_ERROR(H5E_OHDR, H5E_CANTCREATE, FAIL, "can't create name index")
+
+    for (u = 0, idx_msg = &oh->mesg[0]; u < oh->nmesgs; u++, idx_msg++)
+        if (type == idx_msg->type) {
+            const char *name; /* Name of link/attribute */
+
+            /* Decode the message, if necessary */
+            H5O_LOAD_NATIVE(f, 0, oh, idx_msg, FAIL)
+
+            /* Keep the first message with each name, as a scan would */
+            name = H5O__name_index_mesg_name(idx_msg);
+            if (NULL == H5SL_search(*slist, name))
+                if (H5O__name_index_add(*slist, name, u) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, FAIL, "can't add name to name index")
+        } /* end if */
+
+done:
+    if (ret_value < 0 && *slist) {
+        H5SL_destroy(*slist, H5O__name_index_free_cb, NULL);
+        *slist = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__name_index_build() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_find
+ *
+ * Purpose:     Locate the link or attribute message with a given name in
+ *              an object header, building the header's name index for
+ *              that message class first if the header is large enough to
+ *              benefit from one.
+ *
+ *              On success, the message's native information is decoded.
+ *
+ * Return:      Success:    TRUE (found, index in *MESG_IDX) / FALSE
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5O__name_index_find(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type, const char *name, size_t *mesg_idx)
+{
+    H5SL_t **   slist;             /* Name index for message class */
+    H5O_mesg_t *idx_msg;           /* Pointer to current message */
+    size_t      u;                 /* Local index variable */
+    htri_t      ret_value = FALSE; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(name);
+    HDassert(mesg_idx);
+    slist = H5O__name_index_list(oh, type);
+    HDassert(slist);
+
+    /* Build the index, if it's worthwhile */
+    if (NULL == *slist && oh->nmesgs >= H5O_NAME_INDEX_MIN_NMESGS)
+        if (H5O__name_index_build(f, oh, type) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTINIT, FAIL, "can't build name index")
+
+    if (*slist) {
+        H5O_name_ent_t *ent; /* Name index entry */
+
+        /* A name that's not in the index isn't in the header */
+        if (NULL == (ent = (H5O_name_ent_t *)H5SL_search(*slist, name)))
+            HGOTO_DONE(FALSE)
+
+        /* Make certain the entry still refers to the right message */
+        if (ent->idx < oh->nmesgs && type == oh->mesg[ent->idx].type) {
+            idx_msg = &oh->mesg[ent->idx];
+            H5O_LOAD_NATIVE(f, 0, oh, idx_msg, FAIL)
+            if (0 == HDstrcmp(H5O__name_index_mesg_name(idx_msg), name)) {
+                *mesg_idx = ent->idx;
+                HGOTO_DONE(TRUE)
+            } /* end if */
+        }     /* end if */
+
+        /* The message moved without the index being updated: drop the
+         *      index and fall back to scanning the header.
+         */
+        H5O__name_index_reset(oh);
+    } /* end if */
+
+    /* Scan the messages */
+    for (u = 0, idx_msg = &oh->mesg[0]; u < oh->nmesgs; u++, idx_msg++)
+        if (type == idx_msg->type) {
+            /* Decode the message, if necessary */
+            H5O_LOAD_NATIVE(f, 0, oh, idx_msg, FAIL)
+
+            if (0 == HDstrcmp(H5O__name_index_mesg_name(idx_msg), name)) {
+                *mesg_idx = u;
+                HGOTO_DONE(TRUE)
+            } /* end if */
+        }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__name_index_find() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_insert
+ *
+ * Purpose:     Record the name of a link or attribute message that was
+ *              just written to an object header, if the header has a name
+ *              index for that class of message.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__name_index_insert(H5O_t *oh, size_t idx)
+{
+    H5SL_t **slist;               /* Name index for message class */
+    herr_t   ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check args */
+    HDassert(oh);
+    HDassert(idx < oh->nmesgs);
+
+    if (NULL != (slist = H5O__name_index_list(oh, oh->mesg[idx].type)) && *slist) {
+        HDassert(oh->mesg[idx].native);
+        if (H5O__name_index_add(*slist, H5O__name_index_mesg_name(&oh->mesg[idx]), idx) < 0) {
+            H5O__name_index_reset(oh);
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTINSERT, FAIL, "can't add name to name index")
+        } /* end if */
+    }     /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__name_index_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_remove
+ *
+ * Purpose:     Forget the name of a link or attribute message that is
+ *              about to be released or overwritten, if the header has a
+ *              name index for that class of message.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__name_index_remove(H5O_t *oh, size_t idx)
+{
+    H5SL_t **         slist;               /* Name index for message class */
+    const H5O_mesg_t *idx_msg;             /* Message being removed */
+    herr_t            ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* check args */
+    HDassert(oh);
+    HDassert(idx < oh->nmesgs);
+
+    idx_msg = &oh->mesg[idx];
+    if (NULL != (slist = H5O__name_index_list(oh, idx_msg->type)) && *slist) {
+        /* Without the native information the name is unknown, but a stale
+         *      entry is caught when it's looked up.
+         */
+        if (idx_msg->native) {
+            const char *    name = H5O__name_index_mesg_name(idx_msg);
+            H5O_name_ent_t *ent;
+
+            if (NULL != (ent = (H5O_name_ent_t *)H5SL_search(*slist, name)) && ent->idx == idx) {
+                ent = (H5O_name_ent_t *)H5SL_remove(*slist, name);
+                H5O__name_index_free_cb(ent, NULL, NULL);
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__name_index_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5O__name_index_reset
+ *
+ * Purpose:     Discard an object header's name indices.  They are rebuilt
+ *              the next time they are needed.
+ *
+ * Return:      SUCCEED (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O__name_index_reset(H5O_t *oh)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(oh);
+
+    if (oh->link_names) {
+        H5SL_destroy(oh->link_names, H5O__name_index_free_cb, NULL);
+        oh->link_names = NULL;
+    } /* end if */
+    if (oh->attr_names) {
+        H5SL_destroy(oh->attr_names, H5O__name_index_free_cb, NULL);
+        oh->attr_names = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5O__name_index_reset() */
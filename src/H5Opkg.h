@@ -24,15 +24,21 @@
 /* Other private headers needed by this file */
 #include "H5ACprivate.h" /* Metadata cache                       */
 #include "H5FLprivate.h" /* Free Lists                           */
+#include "H5SLprivate.h" /* Skip lists                           */
 
 /* Object header macros */
 #define H5O_NMESGS  8 /*initial number of messages	     */
 #define H5O_NCHUNKS 2 /*initial number of chunks	     */
 #define H5O_MIN_SIZE                                                                                         \
     22 /* Min. obj header data size (must be big enough for a message prefix and a continuation message) */
-#define H5O_MSG_TYPES         26    /* # of types of messages            */
+#define H5O_MSG_TYPES         27    /* # of types of messages            */
 #define H5O_MAX_CRT_ORDER_IDX 65535 /* Max. creation order index value   */
 
+/* Minimum # of messages in an object header before link & attribute
+ * lookups by name build an in-memory name index (see H5Onameidx.c)
+ */
+#define H5O_NAME_INDEX_MIN_NMESGS 16
+
 /* Versions of object header structure */
 
 /* Initial version of the object header format */
@@ -316,6 +322,10 @@ struct H5O_t {
 
     /* Object header proxy information (not stored) */
     H5AC_proxy_entry_t *proxy; /* Proxy cache entry for all ohdr entries */
+
+    /* Name indices for compact links & attributes (not stored) */
+    H5SL_t *link_names; /* Link messages, keyed on link name */
+    H5SL_t *attr_names; /* Attribute messages, keyed on attribute name */
 };
 
 /* Class for types of objects in file */
@@ -523,7 +533,10 @@ H5_DLLVAR const H5O_msg_class_t H5O_MSG_FSINFO[1];
 /* Metadata Cache Image message. (0x0018) */
 H5_DLLVAR const H5O_msg_class_t H5O_MSG_MDCI[1];
 
-/* Placeholder for unknown message. (0x0019) */
+/* Chunk statistics message. (0x0019) */
+H5_DLLVAR const H5O_msg_class_t H5O_MSG_CSTATS[1];
+
+/* Placeholder for unknown message. (0x001a) */
 H5_DLLVAR const H5O_msg_class_t H5O_MSG_UNKNOWN[1];
 
 /*
@@ -593,6 +606,13 @@ H5_DLL herr_t H5O__alloc(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type, const
 H5_DLL herr_t H5O__condense_header(H5F_t *f, H5O_t *oh);
 H5_DLL herr_t H5O__release_mesg(H5F_t *f, H5O_t *oh, H5O_mesg_t *mesg, hbool_t adj_link);
 
+/* Object header name index routines */
+H5_DLL htri_t H5O__name_index_find(H5F_t *f, H5O_t *oh, const H5O_msg_class_t *type, const char *name,
+                                   size_t *mesg_idx);
+H5_DLL herr_t H5O__name_index_insert(H5O_t *oh, size_t idx);
+H5_DLL herr_t H5O__name_index_remove(H5O_t *oh, size_t idx);
+H5_DLL herr_t H5O__name_index_reset(H5O_t *oh);
+
 /* Shared object operators */
 H5_DLL void * H5O__shared_decode(H5F_t *f, H5O_t *open_oh, unsigned *ioflags, const uint8_t *buf,
                                  const H5O_msg_class_t *type);
@@ -231,7 +231,8 @@ typedef struct H5O_copy_t {
 #define H5O_REFCOUNT_ID    0x0016 /* Reference count message.  */
 #define H5O_FSINFO_ID      0x0017 /* File space info message.  */
 #define H5O_MDCI_MSG_ID    0x0018 /* Metadata Cache Image Message */
-#define H5O_UNKNOWN_ID     0x0019 /* Placeholder message ID for unknown message.  */
+#define H5O_CSTATS_ID      0x0019 /* Chunk statistics Message */
+#define H5O_UNKNOWN_ID     0x001a /* Placeholder message ID for unknown message.  */
 /* (this should never exist in a file) */
 /*
  * Note: Must increment H5O_MSG_TYPES in H5Opkg.h and update H5O_msg_class_g
@@ -241,7 +242,7 @@ typedef struct H5O_copy_t {
  *
  * (this should never exist in a file)
  */
-#define H5O_BOGUS_INVALID_ID 0x001a /* "Bogus invalid" Message.  */
+#define H5O_BOGUS_INVALID_ID 0x001b /* "Bogus invalid" Message.  */
 
 /* Shared object message types.
  * Shared objects can be committed, in which case the shared message contains
@@ -865,6 +866,18 @@ typedef struct H5O_mdci_t {
     hsize_t size; /* size of MDC image block    */
 } H5O_mdci_t;
 
+/*
+ * Chunk Statistics Message.
+ * Contains the address and length of the block holding the per-chunk
+ * value statistics of a chunked dataset.
+ * (Data structure in memory)
+ */
+typedef struct H5O_cstats_t {
+    haddr_t addr;     /* address of statistics block (HADDR_UNDEF if none) */
+    hsize_t size;     /* size of statistics block                          */
+    hsize_t nentries; /* number of chunks described by the block           */
+} H5O_cstats_t;
+
 /* Typedef for "application" iteration operations */
 typedef herr_t (*H5O_operator_t)(const void *mesg /*in*/, unsigned idx, void *operator_data /*in,out*/);
 
@@ -947,6 +960,7 @@ H5_DLL herr_t H5O_msg_write_oh(H5F_t *f, H5O_t *oh, unsigned type_id, unsigned m
                                unsigned update_flags, void *mesg);
 H5_DLL herr_t H5O_msg_flush(H5F_t *f, H5O_t *oh, H5O_mesg_t *mesg);
 H5_DLL void * H5O_msg_read(const H5O_loc_t *loc, unsigned type_id, void *mesg);
+H5_DLL htri_t H5O_msg_read_by_name(const H5O_loc_t *loc, unsigned type_id, const char *name, void *mesg);
 H5_DLL void * H5O_msg_read_oh(H5F_t *f, H5O_t *oh, unsigned type_id, void *mesg);
 H5_DLL herr_t H5O_msg_reset(unsigned type_id, void *native);
 H5_DLL void * H5O_msg_free(unsigned type_id, void *mesg);
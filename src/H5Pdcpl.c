@@ -218,6 +218,11 @@
 #define H5D_CRT_MIN_DSET_HDR_SIZE_DEF  FALSE
 #define H5D_CRT_MIN_DSET_HDR_SIZE_ENC  H5P__encode_hbool_t
 #define H5D_CRT_MIN_DSET_HDR_SIZE_DEC  H5P__decode_hbool_t
+/* Definitions for per-chunk value statistics */
+#define H5D_CRT_CHUNK_STATS_SIZE sizeof(hbool_t)
+#define H5D_CRT_CHUNK_STATS_DEF  FALSE
+#define H5D_CRT_CHUNK_STATS_ENC  H5P__encode_hbool_t
+#define H5D_CRT_CHUNK_STATS_DEC  H5P__decode_hbool_t
 
 /******************/
 /* Local Typedefs */
@@ -306,6 +311,7 @@ static const unsigned     H5D_def_alloc_time_state_g =
     H5D_CRT_ALLOC_TIME_STATE_DEF;                                     /* Default allocation time state */
 static const H5O_efl_t H5D_def_efl_g = H5D_CRT_EXT_FILE_LIST_DEF;     /* Default external file list */
 static const unsigned H5O_ohdr_min_g = H5D_CRT_MIN_DSET_HDR_SIZE_DEF; /* Default object header minimization */
+static const hbool_t  H5D_def_chunk_stats_g = H5D_CRT_CHUNK_STATS_DEF; /* Default chunk statistics flag */
 
 /* Defaults for each type of layout */
 #ifdef H5_HAVE_C99_DESIGNATED_INITIALIZER
@@ -373,6 +379,12 @@ H5P__dcrt_reg_prop(H5P_genclass_t *pclass)
                            H5D_CRT_MIN_DSET_HDR_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the per-chunk statistics property */
+    if (H5P__register_real(pclass, H5D_CRT_CHUNK_STATS_NAME, H5D_CRT_CHUNK_STATS_SIZE, &H5D_def_chunk_stats_g,
+                           NULL, NULL, NULL, H5D_CRT_CHUNK_STATS_ENC, H5D_CRT_CHUNK_STATS_DEC, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dcrt_reg_prop() */
@@ -1906,6 +1918,15 @@ H5P__set_layout(H5P_genplist_t *plist, const H5O_layout_t *layout)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set space allocation time")
     } /* end if */
 
+    /* Chunk statistics are only kept for chunked datasets, so a property list
+     * copied from a dataset with statistics can be given another layout */
+    if (H5D_CHUNKED != layout->type) {
+        hbool_t chunk_stats = FALSE; /* Chunk statistics flag */
+
+        if (H5P_set(plist, H5D_CRT_CHUNK_STATS_NAME, &chunk_stats) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't reset chunk statistics flag")
+    } /* end if */
+
     /* Set layout value */
     if (H5P_set(plist, H5D_CRT_LAYOUT_NAME, layout) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINIT, FAIL, "can't set layout")
@@ -3866,3 +3887,73 @@ H5Pset_dset_no_attrs_hint(hid_t dcpl_id, hbool_t minimize)
 done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pset_dset_no_attrs_hint() */
+
+/*-----------------------------------------------------------------------------
+ * Function: H5Pset_chunk_stats
+ *
+ * Purpose:  Sets whether a chunked dataset created with this property list
+ *           keeps the minimum, maximum and NaN count of the values in each
+ *           of its chunks.  The statistics are updated as chunks are
+ *           written and stored with the dataset, and can be used to find
+ *           the chunks that may hold values in a given range.
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *
+ *-----------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_stats(hid_t dcpl_id, hbool_t enable)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", dcpl_id, enable);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set the value */
+    if (H5P_set(plist, H5D_CRT_CHUNK_STATS_NAME, &enable) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk statistics flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_chunk_stats() */
+
+/*-----------------------------------------------------------------------------
+ * Function: H5Pget_chunk_stats
+ *
+ * Purpose:  Retrieves whether per-chunk value statistics are kept for
+ *           datasets created with this property list (or, for the
+ *           creation property list of an existing dataset, whether the
+ *           dataset keeps them).
+ *
+ * Return:   Non-negative on success/Negative on failure
+ *
+ *-----------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_stats(hid_t dcpl_id, hbool_t *enable /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dcpl_id, enable);
+
+    if (NULL == enable)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "receiving pointer cannot be NULL")
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(dcpl_id, H5P_DATASET_CREATE)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get the value */
+    if (H5P_get(plist, H5D_CRT_CHUNK_STATS_NAME, enable) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk statistics flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_chunk_stats() */
@@ -169,6 +169,11 @@
 #define H5F_ACS_EFC_SIZE_DEF  0
 #define H5F_ACS_EFC_SIZE_ENC  H5P__encode_unsigned
 #define H5F_ACS_EFC_SIZE_DEC  H5P__decode_unsigned
+/* Definition for path cache size */
+#define H5F_ACS_PATH_CACHE_SIZE_SIZE sizeof(unsigned)
+#define H5F_ACS_PATH_CACHE_SIZE_DEF  0
+#define H5F_ACS_PATH_CACHE_SIZE_ENC  H5P__encode_unsigned
+#define H5F_ACS_PATH_CACHE_SIZE_DEC  H5P__decode_unsigned
 /* Definition of pointer to initial file image info */
 #define H5F_ACS_FILE_IMAGE_INFO_SIZE  sizeof(H5FD_file_image_info_t)
 #define H5F_ACS_FILE_IMAGE_INFO_DEF   H5FD_DEFAULT_FILE_IMAGE_INFO
@@ -224,6 +229,11 @@
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF  FALSE
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_ENC  H5P__encode_hbool_t
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEC  H5P__decode_hbool_t
+/* Definition for light refresh flag */
+#define H5F_ACS_LIGHT_REFRESH_SIZE sizeof(hbool_t)
+#define H5F_ACS_LIGHT_REFRESH_DEF  FALSE
+#define H5F_ACS_LIGHT_REFRESH_ENC  H5P__encode_hbool_t
+#define H5F_ACS_LIGHT_REFRESH_DEC  H5P__decode_hbool_t
 #ifdef H5_HAVE_PARALLEL
 /* Definition of collective metadata read mode flag */
 #define H5F_ACS_COLL_MD_READ_FLAG_SIZE sizeof(H5P_coll_md_read_flag_t)
@@ -235,6 +245,21 @@
 #define H5F_ACS_COLL_MD_WRITE_FLAG_DEF  FALSE
 #define H5F_ACS_COLL_MD_WRITE_FLAG_ENC  H5P__encode_hbool_t
 #define H5F_ACS_COLL_MD_WRITE_FLAG_DEC  H5P__decode_hbool_t
+/* Definition of the size of regions read for collective metadata reads */
+#define H5F_ACS_COLL_MD_READ_SIZE_SIZE sizeof(size_t)
+#define H5F_ACS_COLL_MD_READ_SIZE_DEF  0
+#define H5F_ACS_COLL_MD_READ_SIZE_ENC  H5P__encode_size_t
+#define H5F_ACS_COLL_MD_READ_SIZE_DEC  H5P__decode_size_t
+/* Definition of the # of threads filtering chunks in collective I/O */
+#define H5F_ACS_COLL_FILTER_THREADS_SIZE sizeof(unsigned)
+#define H5F_ACS_COLL_FILTER_THREADS_DEF  1
+#define H5F_ACS_COLL_FILTER_THREADS_ENC  H5P__encode_unsigned
+#define H5F_ACS_COLL_FILTER_THREADS_DEC  H5P__decode_unsigned
+/* Definition of whether flushes complete their metadata writes later */
+#define H5F_ACS_NONBLOCKING_MD_FLUSH_SIZE sizeof(hbool_t)
+#define H5F_ACS_NONBLOCKING_MD_FLUSH_DEF  FALSE
+#define H5F_ACS_NONBLOCKING_MD_FLUSH_ENC  H5P__encode_hbool_t
+#define H5F_ACS_NONBLOCKING_MD_FLUSH_DEC  H5P__decode_hbool_t
 /* Definition for the file's MPI communicator */
 #define H5F_ACS_MPI_PARAMS_COMM_SIZE  sizeof(MPI_Comm)
 #define H5F_ACS_MPI_PARAMS_COMM_DEF   MPI_COMM_NULL
@@ -466,6 +491,7 @@ static const H5F_libver_t H5F_def_libver_high_bound_g =
 static const hbool_t H5F_def_want_posix_fd_g =
     H5F_ACS_WANT_POSIX_FD_DEF; /* Default setting for retrieving 'handle' from core VFD */
 static const unsigned H5F_def_efc_size_g = H5F_ACS_EFC_SIZE_DEF; /* Default external file cache size */
+static const unsigned H5F_def_path_cache_size_g = H5F_ACS_PATH_CACHE_SIZE_DEF; /* Default path cache size */
 static const H5FD_file_image_info_t H5F_def_file_image_info_g =
     H5F_ACS_FILE_IMAGE_INFO_DEF; /* Default file image info and callbacks */
 static const unsigned H5F_def_metadata_read_attempts_g =
@@ -486,11 +512,19 @@ static const hbool_t H5F_def_start_mdc_log_on_access_g =
     H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF; /* Default mdc log start on access flag */
 static const hbool_t H5F_def_evict_on_close_flag_g =
     H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF; /* Default setting for evict on close property */
+static const hbool_t H5F_def_light_refresh_g =
+    H5F_ACS_LIGHT_REFRESH_DEF; /* Default setting for light refresh property */
 #ifdef H5_HAVE_PARALLEL
 static const H5P_coll_md_read_flag_t H5F_def_coll_md_read_flag_g =
     H5F_ACS_COLL_MD_READ_FLAG_DEF; /* Default setting for the collective metedata read flag */
 static const hbool_t H5F_def_coll_md_write_flag_g =
     H5F_ACS_COLL_MD_WRITE_FLAG_DEF; /* Default setting for the collective metedata write flag */
+static const size_t H5F_def_coll_md_read_size_g =
+    H5F_ACS_COLL_MD_READ_SIZE_DEF; /* Default size of regions read for collective metadata reads */
+static const unsigned H5F_def_coll_filter_threads_g =
+    H5F_ACS_COLL_FILTER_THREADS_DEF; /* Default # of threads filtering chunks in collective I/O */
+static const hbool_t H5F_def_nonblocking_md_flush_g =
+    H5F_ACS_NONBLOCKING_MD_FLUSH_DEF; /* Default setting for nonblocking metadata flushes */
 static const MPI_Comm H5F_def_mpi_params_comm_g = H5F_ACS_MPI_PARAMS_COMM_DEF; /* Default MPI communicator */
 static const MPI_Info H5F_def_mpi_params_info_g = H5F_ACS_MPI_PARAMS_INFO_DEF; /* Default MPI info struct */
 #endif                                                                         /* H5_HAVE_PARALLEL */
@@ -655,6 +689,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the path cache size */
+    if (H5P__register_real(pclass, H5F_ACS_PATH_CACHE_SIZE_NAME, H5F_ACS_PATH_CACHE_SIZE_SIZE,
+                           &H5F_def_path_cache_size_g, NULL, NULL, NULL, H5F_ACS_PATH_CACHE_SIZE_ENC,
+                           H5F_ACS_PATH_CACHE_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the initial file image info */
     /* (Note: this property should not have an encode/decode callback -QAK) */
     if (H5P__register_real(pclass, H5F_ACS_FILE_IMAGE_INFO_NAME, H5F_ACS_FILE_IMAGE_INFO_SIZE,
@@ -724,6 +764,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_EVICT_ON_CLOSE_FLAG_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the light refresh flag */
+    if (H5P__register_real(pclass, H5F_ACS_LIGHT_REFRESH_NAME, H5F_ACS_LIGHT_REFRESH_SIZE,
+                           &H5F_def_light_refresh_g, NULL, NULL, NULL, H5F_ACS_LIGHT_REFRESH_ENC,
+                           H5F_ACS_LIGHT_REFRESH_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 #ifdef H5_HAVE_PARALLEL
     /* Register the metadata collective read flag */
     if (H5P__register_real(pclass, H5_COLL_MD_READ_FLAG_NAME, H5F_ACS_COLL_MD_READ_FLAG_SIZE,
@@ -737,6 +783,25 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
                            H5F_ACS_COLL_MD_WRITE_FLAG_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the size of regions read for collective metadata reads */
+    if (H5P__register_real(pclass, H5F_ACS_COLL_MD_READ_SIZE_NAME, H5F_ACS_COLL_MD_READ_SIZE_SIZE,
+                           &H5F_def_coll_md_read_size_g, NULL, NULL, NULL, H5F_ACS_COLL_MD_READ_SIZE_ENC,
+                           H5F_ACS_COLL_MD_READ_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the # of threads filtering chunks in collective I/O */
+    if (H5P__register_real(pclass, H5F_ACS_COLL_FILTER_THREADS_NAME, H5F_ACS_COLL_FILTER_THREADS_SIZE,
+                           &H5F_def_coll_filter_threads_g, NULL, NULL, NULL, H5F_ACS_COLL_FILTER_THREADS_ENC,
+                           H5F_ACS_COLL_FILTER_THREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the nonblocking metadata flush flag */
+    if (H5P__register_real(pclass, H5F_ACS_NONBLOCKING_MD_FLUSH_NAME, H5F_ACS_NONBLOCKING_MD_FLUSH_SIZE,
+                           &H5F_def_nonblocking_md_flush_g, NULL, NULL, NULL,
+                           H5F_ACS_NONBLOCKING_MD_FLUSH_ENC, H5F_ACS_NONBLOCKING_MD_FLUSH_DEC, NULL, NULL,
+                           NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the MPI communicator */
     if (H5P__register_real(pclass, H5F_ACS_MPI_PARAMS_COMM_NAME, H5F_ACS_MPI_PARAMS_COMM_SIZE,
                            &H5F_def_mpi_params_comm_g, NULL, H5F_ACS_MPI_PARAMS_COMM_SET,
@@ -2575,6 +2640,73 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_elink_file_cache_size() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_path_cache_size
+ *
+ * Purpose:     Sets the maximum number of links found during path
+ *              traversal to be held in the path cache of files opened
+ *              with this fapl.  When the maximum number of links is
+ *              reached, the least recently used link is dropped.  A size
+ *              of 0 disables the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_path_cache_size(hid_t plist_id, unsigned size)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, size);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_PATH_CACHE_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set path cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_path_cache_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_path_cache_size
+ *
+ * Purpose:     Gets the maximum number of links found during path
+ *              traversal to be held in the path cache of files opened
+ *              with this fapl.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_path_cache_size(hid_t plist_id, unsigned *size /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, size);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if (size)
+        if (H5P_get(plist, H5F_ACS_PATH_CACHE_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get path cache size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_path_cache_size() */
+
 /*-------------------------------------------------------------------------
  * Function: H5Pset_file_image
  *
@@ -4602,6 +4734,72 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_evict_on_close() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_light_refresh
+ *
+ * Purpose:     Sets whether refreshing an object (H5Drefresh, H5Grefresh,
+ *              H5Trefresh, H5Orefresh) in a file opened for reading with
+ *              this fapl reloads only the metadata that changed in the
+ *              file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_light_refresh(hid_t fapl_id, hbool_t light_refresh)
+{
+    H5P_genplist_t *plist;               /* property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", fapl_id, light_refresh);
+
+    /* Get the plist structure */
+    if (NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_LIGHT_REFRESH_NAME, &light_refresh) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set light refresh flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_light_refresh() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_light_refresh
+ *
+ * Purpose:     Gets the light refresh property value.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_light_refresh(hid_t fapl_id, hbool_t *light_refresh /*out*/)
+{
+    H5P_genplist_t *plist;               /* property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, light_refresh);
+
+    /* Compare the property list's class against the other class */
+    if (TRUE != H5P_isa_class(fapl_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not an access plist")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    if (H5P_get(plist, H5F_ACS_LIGHT_REFRESH_NAME, light_refresh) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get light refresh flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_light_refresh() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_file_locking
  *
@@ -5401,6 +5599,231 @@ H5Pget_coll_metadata_write(hid_t plist_id, hbool_t *is_collective /*out*/)
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_coll_metadata_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_coll_metadata_read_size
+ *
+ * Purpose:     Sets the size of the file regions read for collective
+ *              metadata reads.  When a piece of metadata is read
+ *              collectively, process 0 reads the whole region around
+ *              it and broadcasts the region, and all processes keep
+ *              it to satisfy the collective metadata reads that fall
+ *              in it without further communication.  Zero (the
+ *              default) reads and broadcasts each piece of metadata
+ *              on its own.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_coll_metadata_read_size(hid_t plist_id, size_t size)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, size);
+
+    /* The region is broadcast in one message */
+    if (size > INT_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "collective metadata read size too large")
+
+    /* Compare the property list's class against the other class */
+    if (TRUE != H5P_isa_class(plist_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not a file access plist")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_COLL_MD_READ_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set collective metadata read size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_coll_metadata_read_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_coll_metadata_read_size
+ *
+ * Purpose:     Gets the size of the file regions read for collective
+ *              metadata reads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_coll_metadata_read_size(hid_t plist_id, size_t *size /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, size);
+
+    /* Compare the property list's class against the other class */
+    if (TRUE != H5P_isa_class(plist_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not an access plist")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    if (size)
+        if (H5P_get(plist, H5F_ACS_COLL_MD_READ_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get collective metadata read size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_coll_metadata_read_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_coll_filter_threads
+ *
+ * Purpose:     Sets the number of threads each process uses to run the
+ *              filter pipeline on its chunks during collective I/O on
+ *              filtered datasets.  One (the default) filters the chunks
+ *              on the calling thread.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_coll_filter_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    if (0 == nthreads)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be positive")
+
+    /* Compare the property list's class against the other class */
+    if (TRUE != H5P_isa_class(plist_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not a file access plist")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_COLL_FILTER_THREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set collective filter threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_coll_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_coll_filter_threads
+ *
+ * Purpose:     Gets the number of threads each process uses to run the
+ *              filter pipeline during collective I/O on filtered datasets.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_coll_filter_threads(hid_t plist_id, unsigned *nthreads /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Compare the property list's class against the other class */
+    if (TRUE != H5P_isa_class(plist_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not an access plist")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    if (nthreads)
+        if (H5P_get(plist, H5F_ACS_COLL_FILTER_THREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get collective filter threads")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_coll_filter_threads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_nonblocking_metadata_flush
+ *
+ * Purpose:     Tell the library whether flushing and closing a file may
+ *              return before the metadata writes of all processes have
+ *              completed (1) or not (0).  Default is not.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_nonblocking_metadata_flush(hid_t plist_id, hbool_t is_nonblocking)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", plist_id, is_nonblocking);
+
+    /* Compare the property list's class against the other class */
+    if (TRUE != H5P_isa_class(plist_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not a file access plist")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if (H5P_set(plist, H5F_ACS_NONBLOCKING_MD_FLUSH_NAME, &is_nonblocking) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set nonblocking metadata flush flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_nonblocking_metadata_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_nonblocking_metadata_flush
+ *
+ * Purpose:     Gets information about nonblocking metadata flush mode.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_nonblocking_metadata_flush(hid_t plist_id, hbool_t *is_nonblocking /*out*/)
+{
+    H5P_genplist_t *plist;               /* Property list pointer */
+    herr_t          ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, is_nonblocking);
+
+    /* Compare the property list's class against the other class */
+    if (TRUE != H5P_isa_class(plist_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTREGISTER, FAIL, "property list is not an access plist")
+
+    /* Get the plist structure */
+    if (NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ID, H5E_BADID, FAIL, "can't find object for ID")
+
+    if (is_nonblocking)
+        if (H5P_get(plist, H5F_ACS_NONBLOCKING_MD_FLUSH_NAME, is_nonblocking) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get nonblocking metadata flush flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_nonblocking_metadata_flush() */
 #endif /* H5_HAVE_PARALLEL */
 
 /*-------------------------------------------------------------------------
@@ -3250,6 +3250,14 @@ H5_DLL herr_t H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled, siz
  *            <td>H5Pset_fapl_direct()</td>
  *           </tr>
  *           <tr>
+ *            <td>io_uring</td>
+ *            <td>#H5FD_IOURING</td>
+ *            <td>This is the #H5FD_SEC2 driver except that large requests are
+ *                split into segments which are kept in flight together through
+ *                a Linux io_uring queue, optionally with direct I/O.</td>
+ *            <td>H5Pset_fapl_iouring()</td>
+ *           </tr>
+ *           <tr>
  *            <td>Log</td>
  *            <td>#H5FD_LOG</td>
  *            <td>This is the #H5FD_SEC2 driver with logging capabilities.</td>
@@ -3299,6 +3307,16 @@ H5_DLL herr_t H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled, siz
  *            <td>H5Pset_fapl_multi()</td>
  *           </tr>
  *           <tr>
+ *            <td>Striping</td>
+ *            <td>#H5FD_STRIPE</td>
+ *            <td>With this driver, the HDF5 file’s address space is cut into
+ *                stripe units which are assigned round-robin to a fixed
+ *                number of member files. The members of a request are
+ *                transferred at the same time, so files can use the bandwidth
+ *                of several devices.</td>
+ *            <td>H5Pset_fapl_stripe()</td>
+ *           </tr>
+ *           <tr>
  *            <td>Parallel</td>
  *            <td>#H5FD_MPIO</td>
  *            <td>This is the standard HDF5 file driver for parallel file
@@ -3307,6 +3325,16 @@ H5_DLL herr_t H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled, siz
  *            <td>H5Pset_fapl_mpio()</td>
  *           </tr>
  *           <tr>
+ *            <td>Subfiling</td>
+ *            <td>#H5FD_SUBFILING</td>
+ *            <td>With this parallel driver, the HDF5 file’s address space is
+ *                cut into stripe units which are stored round-robin in one
+ *                subfile per node or per group of processes, instead of in a
+ *                single shared file. A small map file lets the set of
+ *                subfiles be opened again by any number of processes.</td>
+ *            <td>H5Pset_fapl_subfiling()</td>
+ *           </tr>
+ *           <tr>
  *            <td>Parallel POSIX</td>
  *            <td>H5FD_MPIPOSIX</td>
  *            <td>This driver is no longer available.</td>
@@ -3471,6 +3499,24 @@ H5_DLL herr_t H5Pget_gc_references(hid_t fapl_id, unsigned *gc_ref /*out*/);
  *
  */
 H5_DLL herr_t H5Pget_libver_bounds(hid_t plist_id, H5F_libver_t *low, H5F_libver_t *high);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves whether object refreshes reload only changed metadata
+ *
+ * \fapl_id
+ * \param[out] light_refresh Whether the light refresh mode is set
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_light_refresh() retrieves the value set with
+ *          H5Pset_light_refresh() on the file access property list
+ *          \p fapl_id.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_light_refresh(hid_t fapl_id, hbool_t *light_refresh /*out*/);
 H5_DLL herr_t H5Pget_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr); /* out */
 H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr /*out*/);
 H5_DLL herr_t H5Pget_mdc_log_options(hid_t plist_id, hbool_t *is_enabled, char *location,
@@ -3513,6 +3559,24 @@ H5_DLL herr_t H5Pget_multi_type(hid_t fapl_id, H5FD_mem_t *type);
 H5_DLL herr_t H5Pget_object_flush_cb(hid_t plist_id, H5F_flush_cb_t *func, void **udata);
 H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size, unsigned *min_meta_per,
                                       unsigned *min_raw_per);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the maximum number of links held in a file's path cache
+ *
+ * \fapl_id{plist_id}
+ * \param[out] size Maximum number of links in the path cache
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_path_cache_size() retrieves the maximum number of links
+ *          held in the path cache of files opened with the file access
+ *          property list \p plist_id, as set by H5Pset_path_cache_size().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_path_cache_size(hid_t plist_id, unsigned *size /*out*/);
 H5_DLL herr_t H5Pget_sieve_buf_size(hid_t fapl_id, size_t *size /*out*/);
 H5_DLL herr_t H5Pget_small_data_block_size(hid_t fapl_id, hsize_t *size /*out*/);
 /**
@@ -3913,6 +3977,41 @@ H5_DLL herr_t H5Pset_gc_references(hid_t fapl_id, unsigned gc_ref);
  *
  */
 H5_DLL herr_t H5Pset_libver_bounds(hid_t plist_id, H5F_libver_t low, H5F_libver_t high);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets whether object refreshes reload only changed metadata
+ *
+ * \fapl_id
+ * \param[in] light_refresh Whether to use the light refresh mode
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_light_refresh() sets how H5Drefresh(), H5Grefresh(),
+ *          H5Trefresh() and H5Orefresh() refresh objects in a file opened
+ *          for reading (typically by a SWMR reader) with the file access
+ *          property list \p fapl_id.
+ *
+ *          Normally a refresh evicts all of an object's metadata from the
+ *          metadata cache and reopens the object, so that any later
+ *          access reloads the object header and the nodes of its index.
+ *          In the light mode, the cached metadata is first compared with
+ *          its current image in the file.  If none of it changed, the
+ *          object is left as it is.  Otherwise only the changed metadata
+ *          is evicted before the object is reopened, unless cached
+ *          metadata that did not change depends on it.  Index headers
+ *          hold counts that change with every insertion, so growing a
+ *          chunk index still reloads the whole index.
+ *
+ *          Raw data cached for a dataset is always dropped, as the
+ *          writer may have rewritten it in place.
+ *
+ *          The default is to reload all of the metadata.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_light_refresh(hid_t fapl_id, hbool_t light_refresh);
 H5_DLL herr_t H5Pset_mdc_config(hid_t plist_id, H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t H5Pset_mdc_log_options(hid_t plist_id, hbool_t is_enabled, const char *location,
                                      hbool_t start_on_access);
@@ -3920,6 +4019,37 @@ H5_DLL herr_t H5Pset_meta_block_size(hid_t fapl_id, hsize_t size);
 H5_DLL herr_t H5Pset_metadata_read_attempts(hid_t plist_id, unsigned attempts);
 H5_DLL herr_t H5Pset_multi_type(hid_t fapl_id, H5FD_mem_t type);
 H5_DLL herr_t H5Pset_object_flush_cb(hid_t plist_id, H5F_flush_cb_t func, void *udata);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the maximum number of links held in a file's path cache
+ *
+ * \fapl_id{plist_id}
+ * \param[in] size Maximum number of links in the path cache
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_path_cache_size() sets the maximum number of links held
+ *          in the path cache of files opened with the file access property
+ *          list \p plist_id.
+ *
+ *          When a file has a path cache, each link found while traversing
+ *          a path (for example, when opening \c /a/b/c/dset) is remembered,
+ *          keyed on the group it was found in and its name.  Later
+ *          traversals through the same groups use the remembered links
+ *          instead of searching the groups again.  When the cache is full,
+ *          the least recently used link is dropped.  Creating a link drops
+ *          any remembered link of the same name in the same group, and
+ *          removing a link or deleting an object empties the cache.
+ *
+ *          The default size is 0, which disables the cache.  The cache is
+ *          also not used by SWMR readers or by files opened with a parallel
+ *          file driver.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_path_cache_size(hid_t plist_id, unsigned size);
 H5_DLL herr_t H5Pset_sieve_buf_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pset_small_data_block_size(hid_t fapl_id, hsize_t size);
 /**
@@ -3947,6 +4077,160 @@ H5_DLL herr_t H5Pset_all_coll_metadata_ops(hid_t plist_id, hbool_t is_collective
 H5_DLL herr_t H5Pget_all_coll_metadata_ops(hid_t plist_id, hbool_t *is_collective);
 H5_DLL herr_t H5Pset_coll_metadata_write(hid_t plist_id, hbool_t is_collective);
 H5_DLL herr_t H5Pget_coll_metadata_write(hid_t plist_id, hbool_t *is_collective);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the size of the file regions read for collective metadata reads
+ *
+ * \fapl_id{plist_id}
+ * \param[in] size Size of the regions, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_coll_metadata_read_size() makes process 0 read the
+ *          \p size bytes of the file around a piece of metadata that is
+ *          read collectively, and broadcast them in one message.  Every
+ *          process keeps the region until the next point where the
+ *          processes' metadata caches synchronize, and collective reads
+ *          of other metadata in it need no further I/O or communication.
+ *          This replaces many small broadcasts with one when a file is
+ *          opened and its objects are traversed.  The metadata of a file
+ *          is more likely to share a region with a larger metadata block
+ *          size; see H5Pset_meta_block_size().
+ *
+ *          The regions are only used for collective metadata reads; see
+ *          H5Pset_all_coll_metadata_ops().  All processes must use the
+ *          same \p size, which cannot exceed INT_MAX.  The default, 0,
+ *          reads and broadcasts each piece of metadata on its own.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_coll_metadata_read_size(hid_t plist_id, size_t size);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the size of the file regions read for collective metadata reads
+ *
+ * \fapl_id{plist_id}
+ * \param[out] size Size of the regions, in bytes
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_coll_metadata_read_size() retrieves the size set with
+ *          H5Pset_coll_metadata_read_size().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_coll_metadata_read_size(hid_t plist_id, size_t *size);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets the number of threads filtering chunks in collective I/O
+ *
+ * \fapl_id{plist_id}
+ * \param[in] nthreads Number of threads in each process
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_coll_filter_threads() sets the number of threads each
+ *          process uses to run the filter pipeline on its chunks during
+ *          collective reads and writes of filtered datasets.  The chunks
+ *          are read, exchanged and written by the calling thread as
+ *          before; only the compression and decompression of the chunks
+ *          is spread over the threads.  This lets a process use the idle
+ *          cores of a node when it runs fewer processes than cores.
+ *
+ *          The filters of the dataset must be safe to call from several
+ *          threads at the same time.  The filters built into the library
+ *          are.  The errors the filters push while the threads run are
+ *          discarded, and a failed chunk is reported as a failure of the
+ *          filter pipeline.  \p nthreads must be positive; the default, 1, filters
+ *          the chunks on the calling thread.  The setting has no effect
+ *          when the library is built without Pthreads or with the
+ *          function stack or filter statistics enabled, or when a filter
+ *          callback function is set with H5Pset_filter_callback().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_coll_filter_threads(hid_t plist_id, unsigned nthreads);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves the number of threads filtering chunks in collective I/O
+ *
+ * \fapl_id{plist_id}
+ * \param[out] nthreads Number of threads in each process
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_coll_filter_threads() retrieves the number of threads
+ *          set with H5Pset_coll_filter_threads().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_coll_filter_threads(hid_t plist_id, unsigned *nthreads);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Sets whether flushing a file waits for its metadata writes
+ *
+ * \fapl_id{plist_id}
+ * \param[in] is_nonblocking Boolean value indicating whether flushing and
+ *                           closing the file may return before the
+ *                           metadata writes have completed
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_nonblocking_metadata_flush() sets whether H5Fflush()
+ *          and H5Fclose() on a file opened with the MPI-IO driver may
+ *          return while the metadata writes of the processes are still in
+ *          progress.  Each process then posts its share of the dirty
+ *          metadata with nonblocking MPI-IO writes and returns to the
+ *          application, instead of waiting at a barrier for the slowest
+ *          process.
+ *
+ *          The writes of a flush complete, together with the file
+ *          truncation and sync, at the next metadata cache sync point, the
+ *          next flush of the file, the next collective deletion or move of
+ *          metadata, or an explicit call to H5Fwait_flush().  The writes of
+ *          a close complete at the next open, creation or close of a file
+ *          on the same processes, at a call to H5Fwait_flush() on such a
+ *          file, or when the library shuts down; errors in them are
+ *          reported by that call.  Until then the file on disk may not
+ *          reflect the flush, and the metadata
+ *          cache does not evict entries.  Collective metadata writes are
+ *          not used for these flushes.
+ *
+ *          All processes that open the file must use the same setting.
+ *          The setting has no effect with other file drivers.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_nonblocking_metadata_flush(hid_t plist_id, hbool_t is_nonblocking);
+/**
+ * \ingroup FAPL
+ *
+ * \brief Retrieves whether flushing a file waits for its metadata writes
+ *
+ * \fapl_id{plist_id}
+ * \param[out] is_nonblocking Boolean value indicating whether flushing and
+ *                            closing the file may return before the
+ *                            metadata writes have completed
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_nonblocking_metadata_flush() retrieves the setting made
+ *          with H5Pset_nonblocking_metadata_flush().
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_nonblocking_metadata_flush(hid_t plist_id, hbool_t *is_nonblocking);
 H5_DLL herr_t H5Pget_mpi_params(hid_t fapl_id, MPI_Comm *comm, MPI_Info *info);
 H5_DLL herr_t H5Pset_mpi_params(hid_t fapl_id, MPI_Comm comm, MPI_Info info);
 #endif /* H5_HAVE_PARALLEL */
@@ -4084,6 +4368,26 @@ H5_DLL int H5Pget_chunk(hid_t plist_id, int max_ndims, hsize_t dim[] /*out*/);
  *
  */
 H5_DLL herr_t H5Pget_chunk_opts(hid_t plist_id, unsigned *opts);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Retrieves whether per-chunk value statistics are maintained
+ *
+ * \dcpl_id
+ * \param[out] enable  Flag indicating whether the minimum, maximum and NaN
+ *                     count of each chunk are maintained
+ *
+ * \return \herr_t
+ *
+ * \details H5Pget_chunk_stats() retrieves the setting made with
+ *          H5Pset_chunk_stats().  For the creation property list of an
+ *          existing dataset, \p enable reports whether the dataset keeps
+ *          per-chunk statistics.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pget_chunk_stats(hid_t dcpl_id, hbool_t *enable);
 /**
  * \ingroup DCPL
  *
@@ -4571,6 +4875,51 @@ H5_DLL herr_t H5Pset_chunk(hid_t plist_id, int ndims, const hsize_t dim[/*ndims*
  *
  */
 H5_DLL herr_t H5Pset_chunk_opts(hid_t plist_id, unsigned opts);
+/**
+ * \ingroup DCPL
+ *
+ * \brief Sets whether per-chunk value statistics are maintained
+ *
+ * \dcpl_id
+ * \param[in] enable Flag indicating whether to maintain the minimum, maximum
+ *                   and NaN count of each chunk
+ *
+ * \return \herr_t
+ *
+ * \details H5Pset_chunk_stats() sets whether a dataset created with
+ *          \p dcpl_id records, for every chunk written, the smallest and
+ *          largest value in the chunk and the number of NaN values in it.
+ *          The statistics are computed when a chunk is flushed from the
+ *          chunk cache, stored with the dataset when it is flushed or
+ *          closed, and retrieved with H5Dget_chunk_stats().
+ *          H5Dget_chunks_in_range() uses them to list the chunks that may
+ *          hold values in a given range, so that a reader can skip the
+ *          others.
+ *
+ *          The dataset must use the chunked layout, have an integer or
+ *          floating-point datatype and have at most one unlimited
+ *          dimension.  Setting another layout with H5Pset_layout() turns
+ *          the statistics off.  Values are compared after conversion to
+ *          \c double.
+ *          The statistics describe every element of a chunk's buffer,
+ *          including elements of partial edge chunks that lie outside the
+ *          current extent of the dataset.
+ *
+ *          Chunks written with H5Dwrite_chunk() get statistics only when
+ *          the dataset has no filters and the whole chunk is written;
+ *          other direct chunk writes discard the chunk's statistics.
+ *          Statistics are not maintained by parallel HDF5: creating such
+ *          a dataset in a file opened with an MPI file driver fails, and
+ *          opening an existing one for writing discards its statistics.
+ *
+ *          Versions of the library that do not know about chunk
+ *          statistics can read these datasets, but refuse to open them
+ *          in a file opened for writing.
+ *
+ * \since 1.13.0
+ *
+ */
+H5_DLL herr_t H5Pset_chunk_stats(hid_t dcpl_id, hbool_t enable);
 /**
  * \ingroup DCPL
  *
@@ -1928,6 +1928,7 @@ H5T__conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5MM_xfree(priv->subset_info.runs);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T__conv_struct_free() */
@@ -2078,6 +2079,11 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     /* The compound conversion functions need a background buffer */
     cdata->need_bkg = H5T_BKG_YES;
 
+    priv->subset_info.subset    = H5T_SUBSET_FALSE;
+    priv->subset_info.copy_size = 0;
+    priv->subset_info.nruns     = 0;
+    priv->subset_info.runs      = (H5T_subset_run_t *)H5MM_xfree(priv->subset_info.runs);
+
     if (src_nmembs < dst_nmembs) {
         priv->subset_info.subset = H5T_SUBSET_SRC;
         for (i = 0; i < src_nmembs; i++) {
@@ -2126,6 +2132,49 @@ H5T__conv_struct_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
         ;
     }
 
+    /* If the common members don't form the top of both datatypes, but none of
+     * them needs a conversion, the conversion is a projection: each element
+     * only needs the bytes of the common members copied to their place in the
+     * destination.  Record those copies as runs, merging members that are
+     * adjacent in both datatypes.  Members are sorted by offset here.
+     */
+    if (priv->subset_info.subset == H5T_SUBSET_FALSE) {
+        H5T_subset_run_t *runs  = NULL;
+        size_t            nruns = 0;
+
+        for (i = 0; i < src_nmembs; i++)
+            if (src2dst[i] >= 0 && (priv->memb_path[i])->is_noop == FALSE)
+                break;
+
+        if (i == src_nmembs) {
+            if (NULL == (runs = (H5T_subset_run_t *)H5MM_malloc(src_nmembs * sizeof(H5T_subset_run_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+            for (i = 0; i < src_nmembs; i++) {
+                const H5T_cmemb_t *src_memb = &src->shared->u.compnd.memb[i];
+                const H5T_cmemb_t *dst_memb;
+
+                if (src2dst[i] < 0)
+                    continue;
+                dst_memb = &dst->shared->u.compnd.memb[src2dst[i]];
+
+                if (nruns > 0 && runs[nruns - 1].src_offset + runs[nruns - 1].size == src_memb->offset &&
+                    runs[nruns - 1].dst_offset + runs[nruns - 1].size == dst_memb->offset)
+                    runs[nruns - 1].size += src_memb->size;
+                else {
+                    runs[nruns].src_offset = src_memb->offset;
+                    runs[nruns].dst_offset = dst_memb->offset;
+                    runs[nruns].size       = src_memb->size;
+                    nruns++;
+                } /* end else */
+            }     /* end for */
+
+            priv->subset_info.subset = H5T_SUBSET_PROJECT;
+            priv->subset_info.nruns  = nruns;
+            priv->subset_info.runs   = runs;
+        } /* end if */
+    }     /* end if */
+
     cdata->recalc = FALSE;
 
 done:
@@ -2291,64 +2340,77 @@ H5T__conv_struct(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
 
             /* Conversion loop... */
             for (elmtno = 0; elmtno < nelmts; elmtno++) {
-                /*
-                 * For each source member which will be present in the
-                 * destination, convert the member to the destination type unless
-                 * it is larger than the source type.  Then move the member to the
-                 * left-most unoccupied position in the buffer.  This makes the
-                 * data point as small as possible with all the free space on the
-                 * right side.
-                 */
-                for (u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
-                    if (src2dst[u] < 0)
-                        continue; /*subsetting*/
-                    src_memb = src->shared->u.compnd.memb + u;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[u];
+                if (priv->subset_info.subset == H5T_SUBSET_PROJECT) {
+                    const H5T_subset_run_t *runs = priv->subset_info.runs;
+                    size_t                  r;
 
-                    if (dst_memb->size <= src_memb->size) {
-                        if (H5T_convert(priv->memb_path[u], priv->src_memb_id[u],
-                                        priv->dst_memb_id[src2dst[u]], (size_t)1, (size_t)0,
-                                        (size_t)0, /*no striding (packed array)*/
-                                        xbuf + src_memb->offset, xbkg + dst_memb->offset) < 0)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,
-                                        "unable to convert compound datatype member")
-                        HDmemmove(xbuf + offset, xbuf + src_memb->offset, dst_memb->size);
-                        offset += dst_memb->size;
-                    } /* end if */
-                    else {
-                        HDmemmove(xbuf + offset, xbuf + src_memb->offset, src_memb->size);
-                        offset += src_memb->size;
-                    } /* end else */
-                }     /* end for */
-
-                /*
-                 * For each source member which will be present in the
-                 * destination, convert the member to the destination type if it
-                 * is larger than the source type (that is, has not been converted
-                 * yet).  Then copy the member to the destination offset in the
-                 * background buffer.
-                 */
-                H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
-                for (i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
-                    if (src2dst[i] < 0)
-                        continue; /*subsetting*/
-                    src_memb = src->shared->u.compnd.memb + i;
-                    dst_memb = dst->shared->u.compnd.memb + src2dst[i];
+                    /* No member needs a conversion, so copy each run of
+                     * common members straight to its place in the
+                     * background buffer.
+                     */
+                    for (r = 0; r < priv->subset_info.nruns; r++)
+                        HDmemmove(xbkg + runs[r].dst_offset, xbuf + runs[r].src_offset, runs[r].size);
+                } /* end if */
+                else {
+                    /*
+                     * For each source member which will be present in the
+                     * destination, convert the member to the destination type unless
+                     * it is larger than the source type.  Then move the member to the
+                     * left-most unoccupied position in the buffer.  This makes the
+                     * data point as small as possible with all the free space on the
+                     * right side.
+                     */
+                    for (u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
+                        if (src2dst[u] < 0)
+                            continue; /*subsetting*/
+                        src_memb = src->shared->u.compnd.memb + u;
+                        dst_memb = dst->shared->u.compnd.memb + src2dst[u];
+
+                        if (dst_memb->size <= src_memb->size) {
+                            if (H5T_convert(priv->memb_path[u], priv->src_memb_id[u],
+                                            priv->dst_memb_id[src2dst[u]], (size_t)1, (size_t)0,
+                                            (size_t)0, /*no striding (packed array)*/
+                                            xbuf + src_memb->offset, xbkg + dst_memb->offset) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,
+                                            "unable to convert compound datatype member")
+                            HDmemmove(xbuf + offset, xbuf + src_memb->offset, dst_memb->size);
+                            offset += dst_memb->size;
+                        } /* end if */
+                        else {
+                            HDmemmove(xbuf + offset, xbuf + src_memb->offset, src_memb->size);
+                            offset += src_memb->size;
+                        } /* end else */
+                    }     /* end for */
 
-                    if (dst_memb->size > src_memb->size) {
-                        offset -= src_memb->size;
-                        if (H5T_convert(priv->memb_path[i], priv->src_memb_id[i],
-                                        priv->dst_memb_id[src2dst[i]], (size_t)1, (size_t)0,
-                                        (size_t)0, /*no striding (packed array)*/
-                                        xbuf + offset, xbkg + dst_memb->offset) < 0)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,
-                                        "unable to convert compound datatype member")
-                    } /* end if */
-                    else
-                        offset -= dst_memb->size;
-                    HDmemmove(xbkg + dst_memb->offset, xbuf + offset, dst_memb->size);
-                } /* end for */
-                HDassert(0 == offset);
+                    /*
+                     * For each source member which will be present in the
+                     * destination, convert the member to the destination type if it
+                     * is larger than the source type (that is, has not been converted
+                     * yet).  Then copy the member to the destination offset in the
+                     * background buffer.
+                     */
+                    H5_CHECK_OVERFLOW(src->shared->u.compnd.nmembs, size_t, int);
+                    for (i = (int)src->shared->u.compnd.nmembs - 1; i >= 0; --i) {
+                        if (src2dst[i] < 0)
+                            continue; /*subsetting*/
+                        src_memb = src->shared->u.compnd.memb + i;
+                        dst_memb = dst->shared->u.compnd.memb + src2dst[i];
+
+                        if (dst_memb->size > src_memb->size) {
+                            offset -= src_memb->size;
+                            if (H5T_convert(priv->memb_path[i], priv->src_memb_id[i],
+                                            priv->dst_memb_id[src2dst[i]], (size_t)1, (size_t)0,
+                                            (size_t)0, /*no striding (packed array)*/
+                                            xbuf + offset, xbkg + dst_memb->offset) < 0)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL,
+                                            "unable to convert compound datatype member")
+                        } /* end if */
+                        else
+                            offset -= dst_memb->size;
+                        HDmemmove(xbkg + dst_memb->offset, xbuf + offset, dst_memb->size);
+                    } /* end for */
+                    HDassert(0 == offset);
+                } /* end else */
 
                 /*
                  * Update pointers
@@ -2567,6 +2629,25 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelm
                     xbkg += bkg_stride;
                 } /* end for */
             }     /* end if */
+            else if (priv->subset_info.subset == H5T_SUBSET_PROJECT) {
+                const H5T_subset_run_t *runs  = priv->subset_info.runs;
+                size_t                  nruns = priv->subset_info.nruns;
+                size_t                  r;
+
+                /* No member needs a conversion, so copy each run of common
+                 * members straight to its place in the background buffer.
+                 */
+                xbuf = buf;
+                xbkg = bkg;
+                for (elmtno = 0; elmtno < nelmts; elmtno++) {
+                    for (r = 0; r < nruns; r++)
+                        HDmemmove(xbkg + runs[r].dst_offset, xbuf + runs[r].src_offset, runs[r].size);
+
+                    /* Update pointers */
+                    xbuf += buf_stride;
+                    xbkg += bkg_stride;
+                } /* end for */
+            }     /* end else-if */
             else {
                 /*
                  * For each member where the destination is not larger than the
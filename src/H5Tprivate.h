@@ -91,12 +91,24 @@ typedef enum {
     H5T_SUBSET_FALSE    = 0,  /* Source and destination aren't subset of each other */
     H5T_SUBSET_SRC,           /* Source is the subset of dest and no conversion is needed */
     H5T_SUBSET_DST,           /* Dest is the subset of source and no conversion is needed */
+    H5T_SUBSET_PROJECT,       /* Common members are in any order or position and no conversion is needed */
     H5T_SUBSET_CAP            /* Must be the last value */
 } H5T_subset_t;
 
+/* A run of bytes copied unchanged from each source element to its destination
+ * element, for H5T_SUBSET_PROJECT.  Adjacent members are merged into one run.
+ */
+typedef struct H5T_subset_run_t {
+    size_t src_offset; /* Offset of the run in the source element */
+    size_t dst_offset; /* Offset of the run in the destination element */
+    size_t size;       /* Size of the run in bytes */
+} H5T_subset_run_t;
+
 typedef struct H5T_subset_info_t {
-    H5T_subset_t subset;    /* See above */
-    size_t       copy_size; /* Size in bytes, to copy for each element */
+    H5T_subset_t      subset;    /* See above */
+    size_t            copy_size; /* Size in bytes, to copy for each element */
+    size_t            nruns;     /* Number of runs, for H5T_SUBSET_PROJECT */
+    H5T_subset_run_t *runs;      /* Runs to copy for each element, for H5T_SUBSET_PROJECT */
 } H5T_subset_info_t;
 
 /* Forward declarations for prototype arguments */
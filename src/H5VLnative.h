@@ -39,6 +39,7 @@
 #ifndef H5_NO_DEPRECATED_SYMBOLS
 #define H5VL_NATIVE_ATTR_ITERATE_OLD 0 /* H5Aiterate (deprecated routine) */
 #endif                                 /* H5_NO_DEPRECATED_SYMBOLS */
+#define H5VL_NATIVE_ATTR_READ_MULTI 1 /* H5Aread_multi */
 
 /* Values for native VOL connector dataset optional VOL operations */
 /* NOTE: If new values are added here, the H5VL__native_introspect_opt_query
@@ -54,6 +55,8 @@
 #define H5VL_NATIVE_DATASET_CHUNK_WRITE             7 /* H5Dchunk_write               */
 #define H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE       8 /* H5Dvlen_get_buf_size         */
 #define H5VL_NATIVE_DATASET_GET_OFFSET              9 /* H5Dget_offset                */
+#define H5VL_NATIVE_DATASET_GET_CHUNK_STATS         10 /* H5Dget_chunk_stats          */
+#define H5VL_NATIVE_DATASET_GET_CHUNKS_IN_RANGE     11 /* H5Dget_chunks_in_range      */
 
 /* Values for native VOL connector file optional VOL operations */
 /* NOTE: If new values are added here, the H5VL__native_introspect_opt_query
@@ -88,6 +91,7 @@
 #define H5VL_NATIVE_FILE_GET_MPI_ATOMICITY            26 /* H5Fget_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_SET_MPI_ATOMICITY            27 /* H5Fset_mpi_atomicity                 */
 #define H5VL_NATIVE_FILE_POST_OPEN                    28 /* Adjust file after open, with wrapping context */
+#define H5VL_NATIVE_FILE_WAIT_FLUSH                   29 /* H5Fwait_flush                        */
 
 /* Values for native VOL connector group optional VOL operations */
 /* NOTE: If new values are added here, the H5VL__native_introspect_opt_query
@@ -108,6 +112,8 @@
 #define H5VL_NATIVE_OBJECT_ENABLE_MDC_FLUSHES       3 /* H5Oenable_mdc_flushes                        */
 #define H5VL_NATIVE_OBJECT_ARE_MDC_FLUSHES_DISABLED 4 /* H5Oare_mdc_flushes_disabled                  */
 #define H5VL_NATIVE_OBJECT_GET_NATIVE_INFO          5 /* H5Oget_native_info(_by_idx, _by_name)        */
+#define H5VL_NATIVE_OBJECT_BEGIN_BATCH_CREATE       6 /* H5Dcreate_multi (internal)                   */
+#define H5VL_NATIVE_OBJECT_END_BATCH_CREATE         7 /* H5Dcreate_multi (internal)                   */
 
 /*******************/
 /* Public Typedefs */
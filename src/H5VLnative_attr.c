@@ -23,6 +23,7 @@
 #include "H5Fprivate.h"  /* Files                                    */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MMprivate.h" /* Memory management                        */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5Sprivate.h"  /* Dataspaces                               */
 #include "H5Tprivate.h"  /* Datatypes                                */
@@ -510,11 +511,11 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5VL__native_attr_optional(void H5_ATTR_UNUSED *obj, H5VL_attr_optional_t opt_type,
-                           hid_t H5_ATTR_UNUSED dxpl_id, void H5_ATTR_UNUSED **req,
-                           va_list H5_ATTR_DEPRECATED_USED arguments)
+H5VL__native_attr_optional(void *obj, H5VL_attr_optional_t opt_type, hid_t H5_ATTR_UNUSED dxpl_id,
+                           void H5_ATTR_UNUSED **req, va_list arguments)
 {
-    herr_t ret_value = SUCCEED; /* Return value */
+    const H5T_t **mem_types = NULL;    /* Memory datatypes for H5Aread_multi */
+    herr_t        ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_PACKAGE
 
@@ -534,11 +535,45 @@ H5VL__native_attr_optional(void H5_ATTR_UNUSED *obj, H5VL_attr_optional_t opt_ty
         }
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+        case H5VL_NATIVE_ATTR_READ_MULTI: {
+            const H5VL_loc_params_t *loc_params   = HDva_arg(arguments, const H5VL_loc_params_t *);
+            size_t                   count        = HDva_arg(arguments, size_t);
+            const char **            attr_names   = HDva_arg(arguments, const char **);
+            const hid_t *            mem_type_ids = HDva_arg(arguments, const hid_t *);
+            void **                  bufs         = HDva_arg(arguments, void **);
+            char **                  names_out    = HDva_arg(arguments, char **);
+            hid_t *                  type_ids_out = HDva_arg(arguments, hid_t *);
+            H5G_loc_t                loc;
+            size_t                   u;
+
+            /* Get the location of the object the attributes belong to */
+            if (H5G_loc_real(obj, loc_params->obj_type, &loc) < 0)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file or file object")
+
+            /* Look up the memory datatypes */
+            if (bufs) {
+                if (NULL == (mem_types = (const H5T_t **)H5MM_malloc(count * sizeof(H5T_t *))))
+                    HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't allocate datatype array")
+                for (u = 0; u < count; u++)
+                    if (NULL ==
+                        (mem_types[u] = (const H5T_t *)H5I_object_verify(mem_type_ids[u], H5I_DATATYPE)))
+                        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+            } /* end if */
+
+            /* Read the attributes */
+            if (H5A__read_multi(&loc, count, attr_names, mem_types, bufs, names_out, type_ids_out) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
 
 done:
+    H5MM_xfree(mem_types);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5VL__native_attr_optional() */
 
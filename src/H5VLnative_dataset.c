@@ -594,6 +594,35 @@ H5VL__native_dataset_optional(void *obj, H5VL_dataset_optional_t optional_type,
             break;
         }
 
+        case H5VL_NATIVE_DATASET_GET_CHUNK_STATS: { /* H5Dget_chunk_stats */
+            const hsize_t *    offset = HDva_arg(arguments, const hsize_t *);
+            H5D_chunk_stats_t *stats  = HDva_arg(arguments, H5D_chunk_stats_t *);
+
+            /* Make sure the dataset is chunked */
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            if (H5D__cstats_get(dset, offset, stats) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk statistics")
+            break;
+        }
+
+        case H5VL_NATIVE_DATASET_GET_CHUNKS_IN_RANGE: { /* H5Dget_chunks_in_range */
+            double   min        = HDva_arg(arguments, double);
+            double   max        = HDva_arg(arguments, double);
+            size_t   max_chunks = HDva_arg(arguments, size_t);
+            hsize_t *offsets    = HDva_arg(arguments, hsize_t *);
+            hsize_t *nchunks    = HDva_arg(arguments, hsize_t *);
+
+            /* Make sure the dataset is chunked */
+            if (H5D_CHUNKED != dset->shared->layout.type)
+                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+            if (H5D__cstats_query(dset, min, max, max_chunks, offsets, nchunks) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk statistics")
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid optional operation")
     } /* end switch */
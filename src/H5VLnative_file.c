@@ -782,6 +782,13 @@ H5VL__native_file_optional(void *obj, H5VL_file_optional_t optional_type, hid_t
                 HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "cannot set MPI atomicity");
             break;
         }
+
+        /* H5Fwait_flush */
+        case H5VL_NATIVE_FILE_WAIT_FLUSH: {
+            if (H5F_wait_flush(f) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTFLUSH, FAIL, "cannot complete flush");
+            break;
+        }
 #endif /* H5_HAVE_PARALLEL */
 
         /* Finalize H5Fopen */
@@ -68,6 +68,10 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     break;
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+                case H5VL_NATIVE_ATTR_READ_MULTI:
+                    *flags |= H5VL_OPT_QUERY_READ_DATA;
+                    break;
+
                 default:
                     HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown optional attribute operation")
                     break;
@@ -87,6 +91,8 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_COORD:
                 case H5VL_NATIVE_DATASET_GET_VLEN_BUF_SIZE:
                 case H5VL_NATIVE_DATASET_GET_OFFSET:
+                case H5VL_NATIVE_DATASET_GET_CHUNK_STATS:
+                case H5VL_NATIVE_DATASET_GET_CHUNKS_IN_RANGE:
                     *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
                     break;
 
@@ -153,6 +159,7 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                 case H5VL_NATIVE_FILE_GET_MPI_ATOMICITY:
                 case H5VL_NATIVE_FILE_SET_MPI_ATOMICITY:
                 case H5VL_NATIVE_FILE_POST_OPEN:
+                case H5VL_NATIVE_FILE_WAIT_FLUSH:
                     break;
 
                 default:
@@ -202,6 +209,13 @@ H5VL__native_introspect_opt_query(void H5_ATTR_UNUSED *obj, H5VL_subclass_t subc
                     *flags |= H5VL_OPT_QUERY_QUERY_METADATA;
                     break;
 
+                case H5VL_NATIVE_OBJECT_BEGIN_BATCH_CREATE:
+                    *flags |= H5VL_OPT_QUERY_MODIFY_METADATA;
+                    break;
+
+                case H5VL_NATIVE_OBJECT_END_BATCH_CREATE:
+                    break;
+
                 default:
                     HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown optional object operation")
                     break;
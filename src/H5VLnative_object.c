@@ -23,6 +23,7 @@
 #include "H5Fpkg.h"      /* Files (pkg needed for id_exists)         */
 #include "H5Gprivate.h"  /* Groups                                   */
 #include "H5Iprivate.h"  /* IDs                                      */
+#include "H5MFprivate.h" /* File memory management                   */
 #include "H5Opkg.h"      /* Object headers                           */
 #include "H5Pprivate.h"  /* Property lists                           */
 #include "H5VLprivate.h" /* Virtual Object Layer                     */
@@ -567,6 +568,34 @@ H5VL__native_object_optional(void *obj, H5VL_object_optional_t optional_type, hi
             break;
         }
 
+        /* H5Dcreate_multi */
+        case H5VL_NATIVE_OBJECT_BEGIN_BATCH_CREATE: {
+            size_t   nlinks     = HDva_arg(arguments, size_t);
+            hsize_t  hdr_space  = HDva_arg(arguments, hsize_t);
+            hsize_t *block_size = HDva_arg(arguments, hsize_t *);
+
+            /* Set up the group's link storage for the links about to be inserted */
+            if (nlinks > 0 && H5G_obj_reserve(loc.oloc, nlinks) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to reserve link storage in group")
+
+            /* Carve the new object headers out of one metadata block */
+            if (H5MF_aggr_set_meta_block_size(loc.oloc->file, hdr_space, block_size) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTSET, FAIL, "unable to set metadata block size")
+
+            break;
+        }
+
+        /* H5Dcreate_multi */
+        case H5VL_NATIVE_OBJECT_END_BATCH_CREATE: {
+            hsize_t block_size = HDva_arg(arguments, hsize_t);
+
+            /* Restore the metadata aggregator's block size */
+            if (H5MF_aggr_reset_meta_block_size(loc.oloc->file, block_size) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTSET, FAIL, "unable to reset metadata block size")
+
+            break;
+        }
+
         default:
             HGOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't perform this operation on object");
     } /* end switch */
@@ -1198,9 +1198,15 @@ typedef off_t       h5_stat_size_t;
 #ifndef HDmktime
 #define HDmktime(T) mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+#define HDmmap(A, L, P, F, D, O) mmap(A, L, P, F, D, O) /* io_uring VFD */
+#endif                                                  /* HDmmap */
 #ifndef HDmodf
 #define HDmodf(X, Y) modf(X, Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+#define HDmunmap(A, L) munmap(A, L) /* io_uring VFD */
+#endif                              /* HDmunmap */
 #ifndef HDnanosleep
 #define HDnanosleep(N, O) nanosleep(N, O)
 #endif /* HDnanosleep */
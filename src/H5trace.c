@@ -3368,6 +3368,10 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     break;
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
 
+                                case H5VL_NATIVE_ATTR_READ_MULTI:
+                                    H5RS_acat(rs, "H5VL_NATIVE_ATTR_READ_MULTI");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -3484,6 +3488,14 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_OFFSET");
                                     break;
 
+                                case H5VL_NATIVE_DATASET_GET_CHUNK_STATS:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_CHUNK_STATS");
+                                    break;
+
+                                case H5VL_NATIVE_DATASET_GET_CHUNKS_IN_RANGE:
+                                    H5RS_acat(rs, "H5VL_NATIVE_DATASET_GET_CHUNKS_IN_RANGE");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -3620,6 +3632,10 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_FILE_POST_OPEN");
                                     break;
 
+                                case H5VL_NATIVE_FILE_WAIT_FLUSH:
+                                    H5RS_acat(rs, "H5VL_NATIVE_FILE_WAIT_FLUSH");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
@@ -3686,6 +3702,14 @@ H5_trace_args(H5RS_str_t *rs, const char *type, va_list ap)
                                     H5RS_acat(rs, "H5VL_NATIVE_OBJECT_GET_NATIVE_INFO");
                                     break;
 
+                                case H5VL_NATIVE_OBJECT_BEGIN_BATCH_CREATE:
+                                    H5RS_acat(rs, "H5VL_NATIVE_OBJECT_BEGIN_BATCH_CREATE");
+                                    break;
+
+                                case H5VL_NATIVE_OBJECT_END_BATCH_CREATE:
+                                    H5RS_acat(rs, "H5VL_NATIVE_OBJECT_END_BATCH_CREATE");
+                                    break;
+
                                 default:
                                     H5RS_asprintf_cat(rs, "%ld", (long)optional);
                                     break;
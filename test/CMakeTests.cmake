@@ -266,6 +266,7 @@ set (test_CLEANFILES
     power2up.h5
     version_bounds.h5
     alloc_0sized.h5
+    create_multi.h5
     extend.h5
     istore.h5
     extlinks*.h5
@@ -338,7 +339,9 @@ set (test_CLEANFILES
     getname*.h5
     sec2_file.h5
     direct_file.h5
+    iouring_file.h5
     family_file000*.h5
+    stripe_file0000*.h5
     new_family_v16_000*.h5
     multi_file-*.h5
     core_file
@@ -365,6 +368,7 @@ set (test_CLEANFILES
     earray_tmp.h5
     efc*.h5
     log_vfd_out.log
+    log_vfd_out.trace
     log_ros3_out.log
     log_s3comms_out.log
     new_multi_file_v16-r.h5
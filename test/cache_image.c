@@ -49,6 +49,7 @@ static unsigned cache_image_smoke_check_3(hbool_t single_file_vfd);
 static unsigned cache_image_smoke_check_4(hbool_t single_file_vfd);
 static unsigned cache_image_smoke_check_5(hbool_t single_file_vfd);
 static unsigned cache_image_smoke_check_6(hbool_t single_file_vfd);
+static unsigned cache_image_smoke_check_7(hbool_t single_file_vfd);
 
 static unsigned cache_image_api_error_check_1(hbool_t single_file_vfd);
 static unsigned cache_image_api_error_check_2(hbool_t single_file_vfd);
@@ -5385,6 +5386,379 @@ cache_image_smoke_check_6(hbool_t single_file_vfd)
 
 } /* cache_image_smoke_check_6() */
 
+/*-------------------------------------------------------------------------
+ * Function:    cache_image_smoke_check_7()
+ *
+ * Purpose:     This test is one of a sequence of tests intended
+ *        to exercise the cache image feature verifying that it
+ *        works more or less correctly in common cases.
+ *
+ *        This test exercises incremental writes of the cache image.
+ *        When a file with a cache image is opened R/W, the cache
+ *        keeps a copy of the image block it reads, so that a new
+ *        image written to the same address on close only needs
+ *        the changed pages written.  Verify that the copy is kept,
+ *        and that files with images written this way (including
+ *        after writes, deletions and flushes that may overwrite or
+ *        truncate the old block) still read back correctly.
+ *
+ *        To do this:
+ *
+ *        1) Create a HDF5 file with the cache image FAPL entry.
+ *
+ *        2) Create some datasets in the file.
+ *
+ *        3) Close the file.
+ *
+ *        4) Open the file with the cache image FAPL entry.
+ *
+ *        5) Verify the datasets, and verify that the cache has
+ *           kept a copy of the cache image block.
+ *
+ *        6) Close the file.
+ *
+ *        7) Open the file with the cache image FAPL entry.
+ *
+ *        8) Verify the datasets, create some more, flush the file,
+ *           and then delete the new datasets.
+ *
+ *        9) Close the file.
+ *
+ *        10) Open the file read only.
+ *
+ *        11) Verify the datasets.
+ *
+ *        12) Close the file.
+ *
+ *        13) Open the file.
+ *
+ *        14) Verify the datasets.
+ *
+ *        15) Close the file.
+ *
+ *        16) Delete the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+cache_image_smoke_check_7(hbool_t single_file_vfd)
+{
+    const char *fcn_name = "cache_image_smoke_check_7()";
+    char        filename[512];
+    hbool_t     show_progress = FALSE;
+    hid_t       file_id       = -1;
+    H5F_t *     file_ptr      = NULL;
+    H5C_t *     cache_ptr     = NULL;
+    int         cp            = 0;
+
+    TESTING("metadata cache image smoke check 7");
+
+    /* Check for VFD that is a single file */
+    if (!single_file_vfd) {
+        SKIPPED();
+        HDputs("    Cache image not supported with the current VFD.");
+        return 0;
+    }
+
+    pass = TRUE;
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* setup the file name */
+    if (pass) {
+
+        if (h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename)) == NULL) {
+
+            pass         = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 1) Create a HDF5 file with the cache image FAPL entry. */
+
+    if (pass) {
+
+        open_hdf5_file(/* create_file        */ TRUE,
+                       /* mdci_sbem_expected */ FALSE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ TRUE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 2) Create some datasets in the file. */
+
+    if (pass) {
+
+        create_datasets(file_id, 0, 10);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 3) Close the file. */
+
+    if (pass) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 4) Open the file with the cache image FAPL entry. */
+
+    if (pass) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ TRUE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 5) Verify the datasets, and verify that the cache has kept a
+     *    copy of the cache image block.
+     */
+
+    if (pass) {
+
+        verify_datasets(file_id, 0, 10);
+    }
+
+    if (pass) {
+
+        if ((cache_ptr->prev_image_buffer == NULL) || (!H5F_addr_defined(cache_ptr->prev_image_addr)) ||
+            (cache_ptr->prev_image_len == 0)) {
+
+            pass         = FALSE;
+            failure_mssg = "copy of metadata cache image block not kept.";
+        }
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 6) Close the file. */
+
+    if (pass) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 7) Open the file with the cache image FAPL entry. */
+
+    if (pass) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ TRUE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 8) Verify the datasets, create some more, flush the file, and
+     *    then delete the new datasets.
+     */
+
+    if (pass) {
+
+        verify_datasets(file_id, 0, 10);
+    }
+
+    if (pass) {
+
+        create_datasets(file_id, 11, 20);
+    }
+
+    if (pass) {
+
+        if (H5Fflush(file_id, H5F_SCOPE_GLOBAL) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fflush() failed.\n";
+        }
+    }
+
+    if (pass) {
+
+        delete_datasets(file_id, 11, 20);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 9) Close the file. */
+
+    if (pass) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 10) Open the file read only. */
+
+    if (pass) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ TRUE,
+                       /* set_mdci_fapl      */ FALSE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ 0,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 11) Verify the datasets. */
+
+    if (pass) {
+
+        verify_datasets(file_id, 0, 10);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 12) Close the file. */
+
+    if (pass) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 13) Open the file. */
+
+    if (pass) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+                       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ FALSE,
+                       /* config_fsm         */ FALSE,
+                       /* set_eoc            */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ 0,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 14) Verify the datasets. */
+
+    if (pass) {
+
+        verify_datasets(file_id, 0, 10);
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 15) Close the file. */
+
+    if (pass) {
+
+        if (H5Fclose(file_id) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if (show_progress)
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    /* 16) Delete the file */
+
+    if (pass) {
+
+        if (HDremove(filename) < 0) {
+
+            pass         = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if (pass) {
+        PASSED();
+    }
+    else {
+        H5_FAILED();
+    }
+
+    if (!pass)
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+
+    return !pass;
+
+} /* cache_image_smoke_check_7() */
+
 /*-------------------------------------------------------------------------
  * Function:    cache_image_api_error_check_1()
  *
@@ -7866,6 +8240,7 @@ main(void)
     nerrs += cache_image_smoke_check_4(single_file_vfd);
     nerrs += cache_image_smoke_check_5(single_file_vfd);
     nerrs += cache_image_smoke_check_6(single_file_vfd);
+    nerrs += cache_image_smoke_check_7(single_file_vfd);
 
     nerrs += cache_image_api_error_check_1(single_file_vfd);
     nerrs += cache_image_api_error_check_2(single_file_vfd);
@@ -36,6 +36,7 @@
 #define DATASETNAME10 "read_w_valid_cache"
 #define DATASETNAME11 "unallocated_chunk"
 #define DATASETNAME12 "unfiltered_data"
+#define DATASETNAME13 "empty_extent"
 
 #define RANK     2
 #define NX       16
@@ -477,6 +478,84 @@ error:
     return 1;
 } /* end test_direct_chunk_overwrite_data() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_direct_chunk_write_empty
+ *
+ * Purpose:     Test writing a chunk at the extent of a dataset that has
+ *              no elements yet, then extending the dataset over it.
+ *
+ * Return:      Success:    0
+ *              Failure:    1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunk_write_empty(hid_t fid)
+{
+    hid_t   dcpl_id         = -1;
+    hid_t   sid             = -1;
+    hid_t   did             = -1;
+    hsize_t dset_dims[]     = {0, CHUNK_NY};
+    hsize_t dset_max_dims[] = {H5S_UNLIMITED, CHUNK_NY};
+    hsize_t chunk_dims[]    = {CHUNK_NX, CHUNK_NY};
+    hsize_t offset[]        = {0, 0};
+    int     data_buf[CHUNK_NX][CHUNK_NY];
+    int     read_buf[CHUNK_NX][CHUNK_NY];
+    int     i, j;
+
+    TESTING("H5Dwrite_chunk on a dataset with an empty extent");
+
+    if ((sid = H5Screate_simple(RANK, dset_dims, dset_max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl_id, RANK, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if ((did = H5Dcreate2(fid, DATASETNAME13, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    for (i = 0; i < CHUNK_NX; i++)
+        for (j = 0; j < CHUNK_NY; j++)
+            data_buf[i][j] = (i * CHUNK_NY) + j;
+
+    /* Write the first chunk before the dataset covers it */
+    if (H5Dwrite_chunk(did, H5P_DEFAULT, 0, offset, sizeof(data_buf), data_buf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Extend the dataset over the chunk and read it back */
+    dset_dims[0] = CHUNK_NX;
+    if (H5Dset_extent(did, dset_dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < CHUNK_NX; i++)
+        for (j = 0; j < CHUNK_NY; j++)
+            if (read_buf[i][j] != data_buf[i][j])
+                TEST_ERROR
+
+    if (H5Pclose(dcpl_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dcpl_id);
+        H5Sclose(sid);
+        H5Dclose(did);
+    }
+    H5E_END_TRY;
+
+    H5_FAILED();
+    return 1;
+} /* end test_direct_chunk_write_empty() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_skip_compress_write1
  *
@@ -2263,6 +2342,7 @@ main(void)
     nerrors += test_direct_chunk_write(file_id);
 #endif /* H5_HAVE_FILTER_DEFLATE */
     nerrors += test_direct_chunk_overwrite_data(file_id);
+    nerrors += test_direct_chunk_write_empty(file_id);
     nerrors += test_skip_compress_write1(file_id);
     nerrors += test_skip_compress_write2(file_id);
     nerrors += test_data_conv(file_id);
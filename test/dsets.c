@@ -83,6 +83,8 @@ const char *FILENAME[] = {"dataset",             /* 0 */
                           "power2up",            /* 24 */
                           "version_bounds",      /* 25 */
                           "alloc_0sized",        /* 26 */
+                          "create_multi",        /* 27 */
+                          "chunk_stats",         /* 28 */
                           NULL};
 
 #define OHMIN_FILENAME_A "ohdr_min_a"
@@ -15047,6 +15049,491 @@ error:
     return FAIL;
 } /* end test_0sized_dset_metadata_alloc() */
 
+/*-----------------------------------------------------------------------------
+ * Function:   test_create_multi
+ *
+ * Purpose:    Tests creating many datasets with a single H5Dcreate_multi()
+ *             call, both in compact and "dense" link storage groups.
+ *
+ * Return:     Success/pass:   0
+ *             Failure/error: -1
+ *
+ *-----------------------------------------------------------------------------
+ */
+#define CREATE_MULTI_NDSETS 40
+static herr_t
+test_create_multi(hid_t fapl_id)
+{
+    char        filename[FILENAME_BUF_SIZE] = "";
+    char        name_buf[CREATE_MULTI_NDSETS][16];
+    const char *names[CREATE_MULTI_NDSETS];
+    hid_t       type_ids[CREATE_MULTI_NDSETS];
+    hid_t       space_ids[CREATE_MULTI_NDSETS];
+    hid_t       dset_ids[CREATE_MULTI_NDSETS];
+    hid_t       file_id      = H5I_INVALID_HID;
+    hid_t       fapl_id_copy = H5I_INVALID_HID;
+    hid_t       group_id     = H5I_INVALID_HID;
+    hid_t       space_id     = H5I_INVALID_HID;
+    hid_t       dset_id      = H5I_INVALID_HID;
+    hsize_t     dims[1]      = {10};
+    H5G_info_t  ginfo;
+    int         wbuf[10], rbuf[10];
+    herr_t      ret;
+    unsigned    new_format; /* Whether to use latest file format */
+    size_t      u;
+
+    TESTING("creating multiple datasets at once");
+
+    if (NULL == h5_fixname(FILENAME[27], fapl_id, filename, sizeof(filename)))
+        FAIL_STACK_ERROR
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+
+    for (u = 0; u < CREATE_MULTI_NDSETS; u++) {
+        HDsnprintf(name_buf[u], sizeof(name_buf[u]), "dset_%02u", (unsigned)u);
+        names[u]     = name_buf[u];
+        type_ids[u]  = (u % 2) ? H5T_NATIVE_INT : H5T_NATIVE_DOUBLE;
+        space_ids[u] = space_id;
+        dset_ids[u]  = H5I_INVALID_HID;
+    } /* end for */
+    for (u = 0; u < 10; u++)
+        wbuf[u] = (int)u * 3;
+
+    /* Iterate over file format versions */
+    for (new_format = FALSE; new_format <= TRUE; new_format++) {
+        if ((fapl_id_copy = H5Pcopy(fapl_id)) < 0)
+            FAIL_STACK_ERROR
+        if (new_format)
+            if (H5Pset_libver_bounds(fapl_id_copy, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+                FAIL_STACK_ERROR
+
+        if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id_copy)) < 0)
+            FAIL_STACK_ERROR
+        if ((group_id = H5Gcreate2(file_id, "multi", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Zero datasets is a no-op */
+        if (H5Dcreate_multi(group_id, 0, names, type_ids, space_ids, H5P_DEFAULT, NULL, H5P_DEFAULT,
+                            dset_ids) < 0)
+            FAIL_STACK_ERROR
+
+        /* Create more datasets than fit in compact link storage */
+        if (H5Dcreate_multi(group_id, CREATE_MULTI_NDSETS, names, type_ids, space_ids, H5P_DEFAULT, NULL,
+                            H5P_DEFAULT, dset_ids) < 0)
+            FAIL_STACK_ERROR
+        for (u = 0; u < CREATE_MULTI_NDSETS; u++) {
+            if (dset_ids[u] < 0)
+                TEST_ERROR
+            if (H5Dclose(dset_ids[u]) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+
+        /* Creating the same names again must fail and leave no open IDs */
+        H5E_BEGIN_TRY
+        {
+            ret = H5Dcreate_multi(group_id, CREATE_MULTI_NDSETS, names, type_ids, space_ids, H5P_DEFAULT,
+                                  NULL, H5P_DEFAULT, dset_ids);
+        }
+        H5E_END_TRY;
+        if (ret >= 0)
+            TEST_ERROR
+        for (u = 0; u < CREATE_MULTI_NDSETS; u++)
+            if (dset_ids[u] != H5I_INVALID_HID)
+                TEST_ERROR
+
+        if (H5Gclose(group_id) < 0)
+            FAIL_STACK_ERROR
+        if (H5Fclose(file_id) < 0)
+            FAIL_STACK_ERROR
+
+        /* Re-open the file and verify the datasets */
+        if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id_copy)) < 0)
+            FAIL_STACK_ERROR
+        if ((group_id = H5Gopen2(file_id, "multi", H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Gget_info(group_id, &ginfo) < 0)
+            FAIL_STACK_ERROR
+        if (ginfo.nlinks != CREATE_MULTI_NDSETS)
+            TEST_ERROR
+        if (new_format && ginfo.storage_type != H5G_STORAGE_TYPE_DENSE)
+            TEST_ERROR
+
+        for (u = 0; u < CREATE_MULTI_NDSETS; u++) {
+            hid_t  tid;
+            htri_t equal;
+
+            if ((dset_id = H5Dopen2(group_id, names[u], H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if ((tid = H5Dget_type(dset_id)) < 0)
+                FAIL_STACK_ERROR
+            equal = H5Tequal(tid, type_ids[u]);
+            if (H5Tclose(tid) < 0)
+                FAIL_STACK_ERROR
+            if (equal != TRUE)
+                TEST_ERROR
+
+            if (u == 1) {
+                if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+                    FAIL_STACK_ERROR
+                if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                    FAIL_STACK_ERROR
+                if (HDmemcmp(wbuf, rbuf, sizeof(wbuf)) != 0)
+                    TEST_ERROR
+            } /* end if */
+
+            if (H5Dclose(dset_id) < 0)
+                FAIL_STACK_ERROR
+            dset_id = H5I_INVALID_HID;
+        } /* end for */
+
+        if (H5Gclose(group_id) < 0)
+            FAIL_STACK_ERROR
+        if (H5Fclose(file_id) < 0)
+            FAIL_STACK_ERROR
+        if (H5Pclose(fapl_id_copy) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    if (H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (u = 0; u < CREATE_MULTI_NDSETS; u++)
+            H5Dclose(dset_ids[u]);
+        H5Dclose(dset_id);
+        H5Sclose(space_id);
+        H5Gclose(group_id);
+        H5Fclose(file_id);
+        H5Pclose(fapl_id_copy);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_create_multi() */
+
+/*-----------------------------------------------------------------------------
+ * Function:   test_chunk_stats
+ *
+ * Purpose:    Tests the per-chunk minimum/maximum statistics kept for
+ *             datasets created with H5Pset_chunk_stats(): values written
+ *             through the chunk cache and with H5Dwrite_chunk(), range
+ *             queries, edge chunks, persistence, changing the extent and
+ *             H5Ocopy().
+ *
+ * Return:     Success/pass:   0
+ *             Failure/error: -1
+ *
+ *-----------------------------------------------------------------------------
+ */
+#define CHUNK_STATS_DIM   20
+#define CHUNK_STATS_CHUNK 10
+static herr_t
+test_chunk_stats(hid_t fapl_id)
+{
+    char              filename[FILENAME_BUF_SIZE] = "";
+    hid_t             file_id                     = H5I_INVALID_HID;
+    hid_t             dcpl_id                     = H5I_INVALID_HID;
+    hid_t             space_id                    = H5I_INVALID_HID;
+    hid_t             dset_id                     = H5I_INVALID_HID;
+    hid_t             dset2_id                    = H5I_INVALID_HID;
+    hsize_t           dims[2]    = {CHUNK_STATS_DIM, CHUNK_STATS_DIM};
+    hsize_t           maxdims[2] = {H5S_UNLIMITED, CHUNK_STATS_DIM};
+    hsize_t           chunk[2]   = {CHUNK_STATS_CHUNK, CHUNK_STATS_CHUNK};
+    hsize_t           offset[2];
+    hsize_t           offsets[4 * 2];
+    hsize_t           nchunks;
+    hsize_t           dims1 = 8, chunk1 = 4;
+    hsize_t           edge_dims[2]  = {7, 5};
+    hsize_t           edge_chunk[2] = {4, 4};
+    H5D_chunk_stats_t stats;
+    hbool_t           enable;
+    int               wbuf[CHUNK_STATS_DIM][CHUNK_STATS_DIM];
+    int               cbuf[CHUNK_STATS_CHUNK][CHUNK_STATS_CHUNK];
+    int               ebuf[7][5];
+    int               fill = -1000;
+    double            dbuf[8];
+    herr_t            ret;
+    int               i, j;
+
+    TESTING("per-chunk statistics");
+
+    if (NULL == h5_fixname(FILENAME[28], fapl_id, filename, sizeof(filename)))
+        FAIL_STACK_ERROR
+    if ((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check the property */
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_stats(dcpl_id, &enable) < 0)
+        FAIL_STACK_ERROR
+    if (enable)
+        TEST_ERROR
+    if (H5Pset_chunk_stats(dcpl_id, TRUE) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_stats(dcpl_id, &enable) < 0)
+        FAIL_STACK_ERROR
+    if (!enable)
+        TEST_ERROR
+
+    /* Statistics require chunked layout */
+    if ((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        dset_id = H5Dcreate2(file_id, "contig", H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (dset_id >= 0)
+        TEST_ERROR
+    if (H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a dataset with four chunks and fill it through the chunk cache */
+    if (H5Pset_chunk(dcpl_id, 2, chunk) < 0)
+        FAIL_STACK_ERROR
+    if ((space_id = H5Screate_simple(2, dims, maxdims)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset_id = H5Dcreate2(file_id, "dset", H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < CHUNK_STATS_DIM; i++)
+        for (j = 0; j < CHUNK_STATS_DIM; j++)
+            wbuf[i][j] = i * 100 + j;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+
+    offset[0] = 0;
+    offset[1] = 0;
+    if (H5Dget_chunk_stats(dset_id, offset, &stats) < 0)
+        FAIL_STACK_ERROR
+    if (!stats.known || stats.count != 100 || stats.nan_count != 0 || !H5_DBL_ABS_EQUAL(stats.min, 0.0) ||
+        !H5_DBL_ABS_EQUAL(stats.max, 909.0))
+        TEST_ERROR
+
+    /* Offsets must be on a chunk boundary */
+    offset[1] = 5;
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dget_chunk_stats(dset_id, offset, &stats);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+
+    /* Only the two chunks of the second row of chunks hold values in [1500, 1600] */
+    if (H5Dget_chunks_in_range(dset_id, 1500.0, 1600.0, 4, offsets, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 2 || offsets[0] != 10 || offsets[1] != 0 || offsets[2] != 10 || offsets[3] != 10)
+        TEST_ERROR
+    if (H5Dget_chunks_in_range(dset_id, 5000.0, 6000.0, 4, offsets, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 0)
+        TEST_ERROR
+
+    /* A whole unfiltered chunk written directly keeps its statistics */
+    for (i = 0; i < CHUNK_STATS_CHUNK; i++)
+        for (j = 0; j < CHUNK_STATS_CHUNK; j++)
+            cbuf[i][j] = 7;
+    offset[0] = 0;
+    offset[1] = 10;
+    if (H5Dwrite_chunk(dset_id, H5P_DEFAULT, 0, offset, sizeof(cbuf), cbuf) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dget_chunk_stats(dset_id, offset, &stats) < 0)
+        FAIL_STACK_ERROR
+    if (!stats.known || !H5_DBL_ABS_EQUAL(stats.min, 7.0) || !H5_DBL_ABS_EQUAL(stats.max, 7.0))
+        TEST_ERROR
+
+    if (H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR
+
+    /* NaN values are counted, not compared */
+    if (H5Pset_chunk(dcpl_id, 1, &chunk1) < 0)
+        FAIL_STACK_ERROR
+    if ((space_id = H5Screate_simple(1, &dims1, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset_id = H5Dcreate2(file_id, "double", H5T_NATIVE_DOUBLE, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < 8; i++)
+        dbuf[i] = (double)i - 2.5;
+    dbuf[1] = HDsqrt(-1.0);
+    if (H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, dbuf) < 0)
+        FAIL_STACK_ERROR
+    offset[0] = 0;
+    if (H5Dget_chunk_stats(dset_id, offset, &stats) < 0)
+        FAIL_STACK_ERROR
+    if (!stats.known || stats.count != 4 || stats.nan_count != 1 || !H5_DBL_ABS_EQUAL(stats.min, -2.5) ||
+        !H5_DBL_ABS_EQUAL(stats.max, 0.5))
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR
+
+    /* The fill values of edge chunks beyond the extent are not summarized */
+    if (H5Pset_chunk(dcpl_id, 2, edge_chunk) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_fill_value(dcpl_id, H5T_NATIVE_INT, &fill) < 0)
+        FAIL_STACK_ERROR
+    if ((space_id = H5Screate_simple(2, edge_dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset_id = H5Dcreate2(file_id, "edge", H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for (i = 0; i < 7; i++)
+        for (j = 0; j < 5; j++)
+            ebuf[i][j] = i * 10 + j + 1;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, ebuf) < 0)
+        FAIL_STACK_ERROR
+    offset[0] = 4;
+    offset[1] = 4;
+    if (H5Dget_chunk_stats(dset_id, offset, &stats) < 0)
+        FAIL_STACK_ERROR
+    if (!stats.known || stats.count != 3 || stats.nan_count != 0 || !H5_DBL_ABS_EQUAL(stats.min, 45.0) ||
+        !H5_DBL_ABS_EQUAL(stats.max, 65.0))
+        TEST_ERROR
+    offset[0] = 4;
+    offset[1] = 0;
+    if (H5Dget_chunk_stats(dset_id, offset, &stats) < 0)
+        FAIL_STACK_ERROR
+    if (!stats.known || stats.count != 12 || !H5_DBL_ABS_EQUAL(stats.min, 41.0) ||
+        !H5_DBL_ABS_EQUAL(stats.max, 64.0))
+        TEST_ERROR
+    if (H5Dget_chunks_in_range(dset_id, (double)fill, (double)fill, 4, offsets, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR
+
+    /* Datasets without statistics can't be queried */
+    if ((space_id = H5Screate_simple(1, &dims1, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset_id = H5Dcreate2(file_id, "no_stats", H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dget_chunks_in_range(dset_id, 0.0, 1.0, 0, NULL, &nchunks);
+    }
+    H5E_END_TRY;
+    if (ret >= 0)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR
+
+    /* The statistics are kept in the file */
+    if ((file_id = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset_id = H5Dopen2(file_id, "dset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if ((dcpl_id = H5Dget_create_plist(dset_id)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_stats(dcpl_id, &enable) < 0)
+        FAIL_STACK_ERROR
+    if (!enable)
+        TEST_ERROR
+
+    /* Giving the copied property list another layout turns the statistics off */
+    if (H5Pset_layout(dcpl_id, H5D_CONTIGUOUS) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_chunk_stats(dcpl_id, &enable) < 0)
+        FAIL_STACK_ERROR
+    if (enable)
+        TEST_ERROR
+    if ((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    if ((dset2_id = H5Dcreate2(file_id, "contig", H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                               H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dclose(dset2_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(space_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl_id) < 0)
+        FAIL_STACK_ERROR
+    offset[0] = 10;
+    offset[1] = 10;
+    if (H5Dget_chunk_stats(dset_id, offset, &stats) < 0)
+        FAIL_STACK_ERROR
+    if (!stats.known || !H5_DBL_ABS_EQUAL(stats.min, 1010.0) || !H5_DBL_ABS_EQUAL(stats.max, 1919.0))
+        TEST_ERROR
+
+    /* New chunks have no statistics until they are written */
+    dims[0] = 30;
+    if (H5Dset_extent(dset_id, dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dget_chunks_in_range(dset_id, 5000.0, 6000.0, 4, offsets, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 2 || offsets[0] != 20 || offsets[1] != 0 || offsets[2] != 20 || offsets[3] != 10)
+        TEST_ERROR
+
+    /* Chunks removed by shrinking the dataset lose their statistics */
+    dims[0] = 10;
+    if (H5Dset_extent(dset_id, dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dget_chunks_in_range(dset_id, 1000.0, 2000.0, 0, NULL, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 0)
+        TEST_ERROR
+    dims[0] = 20;
+    if (H5Dset_extent(dset_id, dims) < 0)
+        FAIL_STACK_ERROR
+    if (H5Dget_chunks_in_range(dset_id, 1000.0, 2000.0, 0, NULL, &nchunks) < 0)
+        FAIL_STACK_ERROR
+    if (nchunks != 2)
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR
+
+    /* Copies keep the statistics */
+    if (H5Ocopy(file_id, "dset", file_id, "copy", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if ((dset_id = H5Dopen2(file_id, "copy", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    offset[0] = 0;
+    offset[1] = 0;
+    if (H5Dget_chunk_stats(dset_id, offset, &stats) < 0)
+        FAIL_STACK_ERROR
+    if (!stats.known || !H5_DBL_ABS_EQUAL(stats.min, 0.0) || !H5_DBL_ABS_EQUAL(stats.max, 909.0))
+        TEST_ERROR
+    if (H5Dclose(dset_id) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(file_id) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Dclose(dset2_id);
+        H5Sclose(space_id);
+        H5Pclose(dcpl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end test_chunk_stats() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -15303,6 +15790,8 @@ main(void)
     /* Run misc tests */
     nerrors += (dls_01_main() < 0 ? 1 : 0);
     nerrors += (test_0sized_dset_metadata_alloc(fapl) < 0 ? 1 : 0);
+    nerrors += (test_create_multi(fapl) < 0 ? 1 : 0);
+    nerrors += (test_chunk_stats(fapl) < 0 ? 1 : 0);
 
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl) < 0 ? 1 : 0);
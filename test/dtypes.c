@@ -3676,6 +3676,227 @@ error:
     return 1;
 } /* end test_compound_18() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_compound_19
+ *
+ * Purpose:     Tests conversions where the common members of the source
+ *              and destination need no conversion, but are in a
+ *              different order or at different offsets, which the
+ *              library handles as a projection.  Members that are
+ *              adjacent in both types are copied together.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_compound_19(void)
+{
+    typedef struct file_struct {
+        int    a;
+        int    b;
+        int    c;
+        double d;
+        int    e;
+    } file_struct;
+
+    typedef struct mem_struct {
+        int    e;
+        int    extra;
+        int    b;
+        int    c;
+        double d;
+    } mem_struct;
+
+#define COMPOUND19_NELMTS 100
+    file_struct *wdata = NULL;
+    file_struct *fdata = NULL;
+    mem_struct * rdata = NULL;
+    hid_t        file  = H5I_INVALID_HID;
+    hid_t        cmpd_m_tid = H5I_INVALID_HID, cmpd_f_tid = H5I_INVALID_HID;
+    hid_t        space_id = H5I_INVALID_HID;
+    hid_t        dset_id  = H5I_INVALID_HID;
+    hsize_t      dim1[1];
+    char         filename[1024];
+    int          i;
+
+    TESTING("compound projection conversions");
+
+    if (NULL == (wdata = (file_struct *)HDcalloc(COMPOUND19_NELMTS, sizeof(file_struct))))
+        TEST_ERROR
+    if (NULL == (fdata = (file_struct *)HDcalloc(COMPOUND19_NELMTS, sizeof(file_struct))))
+        TEST_ERROR
+    if (NULL == (rdata = (mem_struct *)HDcalloc(COMPOUND19_NELMTS, sizeof(mem_struct))))
+        TEST_ERROR
+
+    for (i = 0; i < COMPOUND19_NELMTS; i++) {
+        wdata[i].a = i;
+        wdata[i].b = i + 1000;
+        wdata[i].c = i + 2000;
+        wdata[i].d = (double)i + 0.5;
+        wdata[i].e = i + 4000;
+    } /* end for */
+
+    /* Create File */
+    h5_fixname(FILENAME[3], H5P_DEFAULT, filename, sizeof filename);
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Create file compound datatype */
+    if ((cmpd_f_tid = H5Tcreate(H5T_COMPOUND, sizeof(file_struct))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_f_tid, "a", HOFFSET(file_struct, a), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_f_tid, "b", HOFFSET(file_struct, b), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_f_tid, "c", HOFFSET(file_struct, c), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_f_tid, "d", HOFFSET(file_struct, d), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_f_tid, "e", HOFFSET(file_struct, e), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+
+    /* Create memory compound datatype, with the members in a different order
+     * and a member that is not in the file */
+    if ((cmpd_m_tid = H5Tcreate(H5T_COMPOUND, sizeof(mem_struct))) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_m_tid, "e", HOFFSET(mem_struct, e), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_m_tid, "extra", HOFFSET(mem_struct, extra), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_m_tid, "b", HOFFSET(mem_struct, b), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_m_tid, "c", HOFFSET(mem_struct, c), H5T_NATIVE_INT) < 0)
+        TEST_ERROR
+    if (H5Tinsert(cmpd_m_tid, "d", HOFFSET(mem_struct, d), H5T_NATIVE_DOUBLE) < 0)
+        TEST_ERROR
+
+    /* Create space, dataset, write wdata */
+    dim1[0] = COMPOUND19_NELMTS;
+    if ((space_id = H5Screate_simple(1, dim1, NULL)) < 0)
+        TEST_ERROR
+    if ((dset_id = H5Dcreate2(file, "Dataset", cmpd_f_tid, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) <
+        0)
+        TEST_ERROR
+    if (H5Dwrite(dset_id, cmpd_f_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata) < 0)
+        TEST_ERROR
+
+    /* Read with the memory type.  The member that is not in the file must
+     * be left alone. */
+    for (i = 0; i < COMPOUND19_NELMTS; i++)
+        rdata[i].extra = -i;
+    if (H5Dread(dset_id, cmpd_m_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    for (i = 0; i < COMPOUND19_NELMTS; i++)
+        if (rdata[i].e != wdata[i].e || rdata[i].extra != -i || rdata[i].b != wdata[i].b ||
+            rdata[i].c != wdata[i].c || !H5_DBL_ABS_EQUAL(rdata[i].d, wdata[i].d)) {
+            H5_FAILED();
+            AT();
+            HDprintf("incorrect read data at element %d\n", i);
+            goto error;
+        } /* end if */
+
+    /* Write with the memory type.  The member that is only in the file must
+     * keep its value. */
+    for (i = 0; i < COMPOUND19_NELMTS; i++) {
+        rdata[i].e = -i;
+        rdata[i].b = -i - 1000;
+        rdata[i].c = -i - 2000;
+        rdata[i].d = -(double)i;
+    } /* end for */
+    if (H5Dwrite(dset_id, cmpd_m_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata) < 0)
+        TEST_ERROR
+    if (H5Dread(dset_id, cmpd_f_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, fdata) < 0)
+        TEST_ERROR
+    for (i = 0; i < COMPOUND19_NELMTS; i++)
+        if (fdata[i].a != wdata[i].a || fdata[i].b != rdata[i].b || fdata[i].c != rdata[i].c ||
+            !H5_DBL_ABS_EQUAL(fdata[i].d, rdata[i].d) || fdata[i].e != rdata[i].e) {
+            H5_FAILED();
+            AT();
+            HDprintf("incorrect written data at element %d\n", i);
+            goto error;
+        } /* end if */
+
+    /* Convert in memory with H5Tconvert */
+    for (i = 0; i < COMPOUND19_NELMTS; i++)
+        rdata[i].extra = -i;
+    HDmemcpy(fdata, wdata, COMPOUND19_NELMTS * sizeof(file_struct));
+    if (H5Tconvert(cmpd_f_tid, cmpd_m_tid, (size_t)COMPOUND19_NELMTS, fdata, rdata, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    for (i = 0; i < COMPOUND19_NELMTS; i++) {
+        mem_struct *conv = (mem_struct *)((void *)fdata) + i;
+
+        if (conv->e != wdata[i].e || conv->extra != -i || conv->b != wdata[i].b || conv->c != wdata[i].c ||
+            !H5_DBL_ABS_EQUAL(conv->d, wdata[i].d)) {
+            H5_FAILED();
+            AT();
+            HDprintf("incorrect converted data at element %d\n", i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    /* Convert again without the optimized compound conversion function */
+    if (H5Tunregister(H5T_PERS_DONTCARE, NULL, (hid_t)-1, (hid_t)-1,
+                      (H5T_conv_t)((void (*)(void))H5T__conv_struct_opt)) < 0)
+        TEST_ERROR
+    for (i = 0; i < COMPOUND19_NELMTS; i++)
+        rdata[i].extra = -i;
+    HDmemcpy(fdata, wdata, COMPOUND19_NELMTS * sizeof(file_struct));
+    if (H5Tconvert(cmpd_f_tid, cmpd_m_tid, (size_t)COMPOUND19_NELMTS, fdata, rdata, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if (H5Tregister(H5T_PERS_SOFT, "struct(opt)", cmpd_f_tid, cmpd_m_tid,
+                    (H5T_conv_t)((void (*)(void))H5T__conv_struct_opt)) < 0)
+        TEST_ERROR
+    for (i = 0; i < COMPOUND19_NELMTS; i++) {
+        mem_struct *conv = (mem_struct *)((void *)fdata) + i;
+
+        if (conv->e != wdata[i].e || conv->extra != -i || conv->b != wdata[i].b || conv->c != wdata[i].c ||
+            !H5_DBL_ABS_EQUAL(conv->d, wdata[i].d)) {
+            H5_FAILED();
+            AT();
+            HDprintf("incorrect unoptimized converted data at element %d\n", i);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    /* Close */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if (H5Tclose(cmpd_f_tid) < 0)
+        TEST_ERROR
+    if (H5Tclose(cmpd_m_tid) < 0)
+        TEST_ERROR
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if (H5Fclose(file) < 0)
+        TEST_ERROR
+
+    HDfree(wdata);
+    HDfree(fdata);
+    HDfree(rdata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Tclose(cmpd_f_tid);
+        H5Tclose(cmpd_m_tid);
+        H5Sclose(space_id);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+    HDfree(wdata);
+    HDfree(fdata);
+    HDfree(rdata);
+
+    return 1;
+} /* end test_compound_19() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_query
  *
@@ -8584,6 +8805,7 @@ main(void)
     nerrors += test_compound_16();
     nerrors += test_compound_17();
     nerrors += test_compound_18();
+    nerrors += test_compound_19();
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
     nerrors += test_conv_bitfield();
@@ -210,7 +210,7 @@ h5_delete_test_file(const char *base_name, hid_t fapl)
 
     driver = H5Pget_driver(fapl);
 
-    if (driver == H5FD_FAMILY) {
+    if (driver == H5FD_FAMILY || driver == H5FD_STRIPE) {
         int j;
         for (j = 0; /*void*/; j++) {
             HDsnprintf(sub_filename, sizeof(sub_filename), filename, j);
@@ -587,7 +587,7 @@ h5_fixname_real(const char *base_name, hid_t fapl, const char *_suffix, char *fu
             return NULL;
 
         if (suffix) {
-            if (H5FD_FAMILY == driver) {
+            if (H5FD_FAMILY == driver || H5FD_STRIPE == driver) {
                 if (subst_for_superblock)
                     suffix = "00000.h5";
                 else
@@ -1026,6 +1026,24 @@ h5_get_vfd_fapl(hid_t fapl)
          */
         if (H5Pset_fapl_direct(fapl, 1024, 4096, 8 * 4096) < 0)
             goto error;
+#endif
+#ifdef H5_HAVE_IOURING
+    }
+    else if (!HDstrcmp(tok, "iouring")) {
+        /* Linux io_uring I/O.  Set the queue depth and segment size to the
+         * default values.
+         */
+        if (H5Pset_fapl_iouring(fapl, 0, 0, 0) < 0)
+            goto error;
+#endif
+#ifdef H5_HAVE_STRIPE_VFD
+    }
+    else if (!HDstrcmp(tok, "stripe")) {
+        /* Files striped over four members, with small stripe units so that
+         * most requests span several members.
+         */
+        if (H5Pset_fapl_stripe(fapl, 4, 4096, 0) < 0)
+            goto error;
 #endif
     }
     else {
@@ -1375,6 +1393,9 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
             driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_IOURING
+            driver == H5FD_IOURING ||
+#endif /* H5_HAVE_IOURING */
             driver == H5FD_LOG) {
             /* Get the file's statistics */
             if (0 == HDstat(filename, &sb))
@@ -1422,7 +1443,7 @@ h5_get_file_size(const char *filename, hid_t fapl)
             return file_size;
         }
 #endif /* H5_HAVE_PARALLEL */
-        else if (driver == H5FD_FAMILY) {
+        else if (driver == H5FD_FAMILY || driver == H5FD_STRIPE) {
             h5_stat_size_t tot_size = 0;
 
             /* Try all filenames possible, until we find one that's missing */
@@ -16830,6 +16830,357 @@ error:
     return FAIL;
 } /* end obj_exists() */
 
+/*-------------------------------------------------------------------------
+ * Function:    compact_lookup_many
+ *
+ * Purpose:     Look up links by name in a compact group holding enough
+ *              links for the object header name index to be used, while
+ *              links are deleted, renamed and re-created.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static int
+compact_lookup_many(hid_t fapl, hbool_t new_format)
+{
+    char       filename[NAME_BUF_SIZE]; /* Buffer for file name */
+    char       objname[NAME_BUF_SIZE];  /* Object name */
+    char       newname[NAME_BUF_SIZE];  /* New object name */
+    hid_t      fid  = -1;               /* File ID */
+    hid_t      gid  = -1;               /* Group ID */
+    hid_t      gcpl = -1;               /* Group creation property list ID */
+    H5G_info_t grp_info;                /* Info about group */
+    unsigned   nlinks = 48;             /* Number of links in group */
+    unsigned   u;                       /* Local index variable */
+
+    if (new_format)
+        TESTING("looking up many links in compact group (w/new group format)")
+    else
+        TESTING("looking up many links in compact group")
+
+    /* Set up filename and create file */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Keep all the links in the group's object header */
+    if ((gcpl = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_link_phase_change(gcpl, 2 * nlinks, nlinks) < 0)
+        FAIL_STACK_ERROR
+    if ((gid = H5Gcreate2(fid, "group", H5P_DEFAULT, gcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create links */
+    for (u = 0; u < nlinks; u++) {
+        HDsnprintf(objname, sizeof(objname), "link %02u", u);
+        if (H5Lcreate_hard(fid, "/", gid, objname, H5P_DEFAULT, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Verify lookups, before and after the header is reloaded */
+    for (u = 0; u < nlinks; u++) {
+        HDsnprintf(objname, sizeof(objname), "link %02u", u);
+        if (TRUE != H5Lexists(gid, objname, H5P_DEFAULT))
+            TEST_ERROR
+    } /* end for */
+    if (FALSE != H5Lexists(gid, "link", H5P_DEFAULT))
+        TEST_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if ((gid = H5Gopen2(fid, "group", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < nlinks; u++) {
+        HDsnprintf(objname, sizeof(objname), "group/link %02u/group", u);
+        if (TRUE != H5Oexists_by_name(fid, objname, H5P_DEFAULT))
+            TEST_ERROR
+    } /* end for */
+
+    /* Delete every other link and rename every fourth one */
+    for (u = 0; u < nlinks; u += 2) {
+        HDsnprintf(objname, sizeof(objname), "link %02u", u);
+        if (H5Ldelete(gid, objname, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    for (u = 1; u < nlinks; u += 4) {
+        HDsnprintf(objname, sizeof(objname), "link %02u", u);
+        HDsnprintf(newname, sizeof(newname), "renamed %02u", u);
+        if (H5Lmove(gid, objname, gid, newname, H5P_DEFAULT, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Verify lookups */
+    for (u = 0; u < nlinks; u++) {
+        HDsnprintf(objname, sizeof(objname), "link %02u", u);
+        HDsnprintf(newname, sizeof(newname), "renamed %02u", u);
+        if ((htri_t)((u % 2) == 1 && (u % 4) != 1) != H5Lexists(gid, objname, H5P_DEFAULT))
+            TEST_ERROR
+        if ((htri_t)((u % 4) == 1) != H5Lexists(gid, newname, H5P_DEFAULT))
+            TEST_ERROR
+    } /* end for */
+
+    /* Re-create the deleted links */
+    for (u = 0; u < nlinks; u += 2) {
+        HDsnprintf(objname, sizeof(objname), "link %02u", u);
+        if (H5Lcreate_soft("/group", gid, objname, H5P_DEFAULT, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    for (u = 0; u < nlinks; u += 2) {
+        HDsnprintf(objname, sizeof(objname), "link %02u", u);
+        if (TRUE != H5Lexists(gid, objname, H5P_DEFAULT))
+            TEST_ERROR
+        HDsnprintf(objname, sizeof(objname), "link %02u/link %02u", u, u);
+        if (TRUE != H5Lexists(gid, objname, H5P_DEFAULT))
+            TEST_ERROR
+    } /* end for */
+
+    /* Check that the links stayed in the object header (old-format groups
+     * use a symbol table instead)
+     */
+    if (H5Gget_info(gid, &grp_info) < 0)
+        FAIL_STACK_ERROR
+    if (grp_info.nlinks != (hsize_t)nlinks)
+        TEST_ERROR
+    if (new_format && grp_info.storage_type != H5G_STORAGE_TYPE_COMPACT)
+        TEST_ERROR
+
+    /* Close everything */
+    if (H5Pclose(gcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(gcpl);
+        H5Gclose(gid);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end compact_lookup_many() */
+
+/*-------------------------------------------------------------------------
+ * Function:    path_cache_check
+ *
+ * Purpose:     Helper routine to check that NAME resolves to the object
+ *              with token TOKEN.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static int
+path_cache_check(hid_t fid, const char *name, const H5O_token_t *token)
+{
+    H5O_info2_t oinfo;     /* Object info */
+    int         token_cmp; /* Comparison of object tokens */
+
+    if (H5Oget_info_by_name3(fid, name, &oinfo, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        return FAIL;
+    if (H5Otoken_cmp(fid, &oinfo.token, token, &token_cmp) < 0)
+        return FAIL;
+
+    return token_cmp ? FAIL : SUCCEED;
+} /* end path_cache_check() */
+
+/*-------------------------------------------------------------------------
+ * Function:    path_cache
+ *
+ * Purpose:     Check that paths resolve correctly through a file's path
+ *              cache while links are created, deleted and moved.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static int
+path_cache(hid_t fapl, hbool_t new_format)
+{
+    char        filename[NAME_BUF_SIZE]; /* Buffer for file name */
+    char        objname[NAME_BUF_SIZE];  /* Object name */
+    hid_t       fid      = -1;           /* File ID */
+    hid_t       gid      = -1;           /* Group ID */
+    hid_t       lcpl     = -1;           /* Link creation property list ID */
+    hid_t       my_fapl  = -1;           /* File access property list ID */
+    hid_t       fapl_out = -1;           /* File access property list ID from file */
+    H5O_info2_t oinfo_e;                 /* Info for "/a/b/c/d/e" */
+    H5O_info2_t oinfo_y;                 /* Info for "/x/y" */
+    H5O_info2_t oinfo_a;                 /* Info for "/a" */
+    H5O_info2_t oinfos[10];              /* Info for sibling groups */
+    unsigned    cache_size;              /* Path cache size */
+    unsigned    u, v;                    /* Local index variables */
+
+    if (new_format)
+        TESTING("path cache (w/new group format)")
+    else
+        TESTING("path cache")
+
+    /* The cache is disabled by default */
+    if (H5Pget_path_cache_size(H5P_FILE_ACCESS_DEFAULT, &cache_size) < 0)
+        FAIL_STACK_ERROR
+    if (cache_size != 0)
+        TEST_ERROR
+
+    /* Use a small cache, so links are evicted */
+    if ((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_path_cache_size(my_fapl, 4) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_path_cache_size(my_fapl, &cache_size) < 0)
+        FAIL_STACK_ERROR
+    if (cache_size != 4)
+        TEST_ERROR
+
+    /* Set up filename and create file */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check the size reported for the file */
+    if ((fapl_out = H5Fget_access_plist(fid)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pget_path_cache_size(fapl_out, &cache_size) < 0)
+        FAIL_STACK_ERROR
+    if (cache_size != 4)
+        TEST_ERROR
+    if (H5Pclose(fapl_out) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a deep hierarchy and a second group to point into */
+    if ((lcpl = H5Pcreate(H5P_LINK_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_create_intermediate_group(lcpl, TRUE) < 0)
+        FAIL_STACK_ERROR
+    if ((gid = H5Gcreate2(fid, "/a/b/c/d/e", lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if ((gid = H5Gcreate2(fid, "/x/y", lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Oget_info_by_name3(fid, "/a/b/c/d/e", &oinfo_e, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (H5Oget_info_by_name3(fid, "/x/y", &oinfo_y, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (H5Oget_info_by_name3(fid, "/a", &oinfo_a, H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the same path repeatedly */
+    for (u = 0; u < 3; u++)
+        if (path_cache_check(fid, "/a/b/c/d/e", &oinfo_e.token) < 0)
+            TEST_ERROR
+
+    /* Replace an intermediate group with a soft link elsewhere */
+    if (H5Ldelete(fid, "/a/b/c", H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (H5Lcreate_soft("/x", fid, "/a/b/c", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (FALSE != H5Lexists(fid, "/a/b/c/d", H5P_DEFAULT))
+        TEST_ERROR
+    if (path_cache_check(fid, "/a/b/c/y", &oinfo_y.token) < 0)
+        TEST_ERROR
+
+    /* Rename the target of the soft link */
+    if (H5Lmove(fid, "/x/y", fid, "/x/z", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (FALSE != H5Lexists(fid, "/a/b/c/y", H5P_DEFAULT))
+        TEST_ERROR
+    if (path_cache_check(fid, "/a/b/c/z", &oinfo_y.token) < 0)
+        TEST_ERROR
+
+    /* Re-use the old name for a hard link to another group */
+    if (H5Lcreate_hard(fid, "/a", fid, "/x/y", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (path_cache_check(fid, "/a/b/c/y", &oinfo_a.token) < 0)
+        TEST_ERROR
+    if (TRUE != H5Lexists(fid, "/a/b/c/y/b/c/z", H5P_DEFAULT))
+        TEST_ERROR
+
+    /* Fan out across more sibling groups than the cache holds */
+    for (u = 0; u < 10; u++) {
+        HDsnprintf(objname, sizeof(objname), "/a/b/s%u/t", u);
+        if ((gid = H5Gcreate2(fid, objname, lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if (H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR
+        if (H5Oget_info_by_name3(fid, objname, &oinfos[u], H5O_INFO_BASIC, H5P_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    for (v = 0; v < 2; v++)
+        for (u = 0; u < 10; u++) {
+            HDsnprintf(objname, sizeof(objname), "/a/b/s%u/t", u);
+            if (path_cache_check(fid, objname, &oinfos[u].token) < 0)
+                TEST_ERROR
+        } /* end for */
+
+    /* Delete a group and re-create one with the same name */
+    if (H5Ldelete(fid, "/a/b/s3", H5P_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if (FALSE != H5Lexists(fid, "/a/b/s3", H5P_DEFAULT))
+        TEST_ERROR
+    if ((gid = H5Gcreate2(fid, "/a/b/s3/u", lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Gclose(gid) < 0)
+        FAIL_STACK_ERROR
+    if (FALSE != H5Lexists(fid, "/a/b/s3/t", H5P_DEFAULT))
+        TEST_ERROR
+    if (TRUE != H5Lexists(fid, "/a/b/s3/u", H5P_DEFAULT))
+        TEST_ERROR
+
+    /* Re-open the file and check the paths again */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if ((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    for (u = 0; u < 10; u++) {
+        if (u == 3)
+            continue;
+        HDsnprintf(objname, sizeof(objname), "/a/b/s%u/t", u);
+        if (path_cache_check(fid, objname, &oinfos[u].token) < 0)
+            TEST_ERROR
+    } /* end for */
+    if (path_cache_check(fid, "/a/b/c/z", &oinfo_y.token) < 0)
+        TEST_ERROR
+    if (path_cache_check(fid, "/x/y/b/c/z", &oinfo_y.token) < 0)
+        TEST_ERROR
+
+    /* Close everything */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(lcpl) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Pclose(fapl_out);
+        H5Pclose(lcpl);
+        H5Pclose(my_fapl);
+    }
+    H5E_END_TRY;
+    return FAIL;
+} /* end path_cache() */
+
 /*-------------------------------------------------------------------------
  * Function:    corder_create_empty
  *
@@ -22544,6 +22895,8 @@ main(void)
             nerrors += obj_visit_stop(my_fapl, new_format) < 0 ? 1 : 0;
             nerrors += link_filters(my_fapl, new_format) < 0 ? 1 : 0;
             nerrors += obj_exists(my_fapl, new_format) < 0 ? 1 : 0;
+            nerrors += compact_lookup_many(my_fapl, new_format) < 0 ? 1 : 0;
+            nerrors += path_cache(my_fapl, new_format) < 0 ? 1 : 0;
 
             /* Keep this test last, it's testing files that are used above */
             /* do not do this for files used by external link tests */
@@ -94,6 +94,7 @@ static int test_swmr_vfd_flag(void);
 
 /* Tests for H5Drefresh: concurrent access */
 static int test_refresh_concur(hid_t in_fapl, hbool_t new_format);
+static int test_refresh_light(hid_t in_fapl);
 
 /* Tests for multiple opens of files and datasets with H5Drefresh() & H5Fstart_swmr_write(): same process */
 static int test_multiple_same(hid_t in_fapl, hbool_t new_format);
@@ -6832,6 +6833,378 @@ error:
 } /* test_refresh_concur() */
 #endif /* H5_HAVE_UNISTD_H */
 
+/*
+ * test_refresh_light():
+ *
+ * Verify H5Drefresh() works correctly with concurrent access when the
+ * reader's file access property list enables light refresh:
+ *      Parent process:
+ *              (1) Open the test file, write to the dataset
+ *              (2) Notify child process #A
+ *              (3) Wait for notification from child process #B
+ *              (4) Overwrite the dataset in place, flush the file
+ *              (5) Notify child process #C
+ *              (6) Wait for notification from child process #D
+ *              (7) Extend the dataset, write to the dataset, flush the file
+ *              (8) Notify child process #E
+ *      Child process:
+ *              (1) Wait for notification from parent process #A
+ *              (2) Open the file with light refresh, open and read the dataset
+ *              (3) Refresh the dataset and verify that no cached metadata
+ *                  was evicted
+ *              (4) Notify parent process #B
+ *              (5) Wait for notification from parent process #C
+ *              (6) Refresh the dataset and verify the new data is read
+ *              (7) Notify parent process #D
+ *              (8) Wait for notification from parent process #E
+ *              (9) Refresh the dataset and verify its dimension and data
+ */
+#ifndef H5_HAVE_UNISTD_H
+
+static int
+test_refresh_light(hid_t H5_ATTR_UNUSED in_fapl)
+{
+    TESTING("H5Drefresh()--concurrent access with light refresh");
+
+    SKIPPED();
+    HDputs("    Test skipped due to a lack of unistd.h functionality.");
+    return 0;
+} /* test_refresh_light() */
+
+#else /* H5_HAVE_UNISTD_H */
+
+static int
+test_refresh_light(hid_t in_fapl)
+{
+    hid_t fid  = -1;               /* File ID */
+    hid_t fapl = -1;               /* File access property list */
+    pid_t childpid = 0;            /* Child process ID */
+    pid_t tmppid;                  /* Child process ID returned by waitpid */
+    int   child_status;            /* Status passed to waitpid */
+    int   child_wait_option = 0;   /* Options passed to waitpid */
+    int   child_exit_val;          /* Exit status of the child */
+    char  filename[NAME_BUF_SIZE]; /* File name */
+
+    hid_t   did           = -1;
+    hid_t   sid           = -1;
+    hid_t   dcpl          = -1;
+    hsize_t chunk_dims[1] = {1};
+    hsize_t maxdims[1]    = {H5S_UNLIMITED};
+    hsize_t dims[1]       = {1};
+    hsize_t new_dims[1]   = {2};
+
+    int out_pdf[2];
+    int in_pdf[2];
+    int notify = 0;
+    int wbuf[2];
+
+    /* Output message about test being performed */
+    TESTING("H5Drefresh()--concurrent access with light refresh");
+
+    if ((fapl = H5Pcopy(in_fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Set the filename to use for this test (dependent on fapl) */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof(filename));
+
+    /* Set to use the latest library format */
+    if (H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create the test file */
+    if ((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a chunked dataset with 1 extendible dimension */
+    if ((sid = H5Screate_simple(1, dims, maxdims)) < 0)
+        FAIL_STACK_ERROR;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        FAIL_STACK_ERROR;
+    if ((did = H5Dcreate2(fid, "dataset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Closing */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+    if (H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if (H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+
+    /* Close the file */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create 2 pipes */
+    if (HDpipe(out_pdf) < 0)
+        FAIL_STACK_ERROR
+    if (HDpipe(in_pdf) < 0)
+        FAIL_STACK_ERROR
+
+    /* Fork child process */
+    if ((childpid = HDfork()) < 0)
+        FAIL_STACK_ERROR
+
+    if (childpid == 0) {              /* Child process */
+        hid_t   child_fapl = -1;      /* File access property list */
+        hid_t   child_fapl2 = -1;     /* File access property list of the opened file */
+        hid_t   child_fid  = -1;      /* File ID */
+        hid_t   child_did  = -1;      /* Dataset ID */
+        hid_t   child_sid  = -1;      /* Dataspace ID */
+        hsize_t tdims[1];
+        hbool_t light_refresh = FALSE;
+        size_t  max_size, min_clean_size, cur_size;
+        int     cur_num_entries, old_num_entries;
+        int     rbuf[2]      = {0, 0};
+        int     child_notify = 0;
+
+        /* Close unused write end for out_pdf */
+        if (HDclose(out_pdf[1]) < 0)
+            HDexit(EXIT_FAILURE);
+
+        /* close unused read end for in_pdf */
+        if (HDclose(in_pdf[0]) < 0)
+            HDexit(EXIT_FAILURE);
+
+        /* Wait for notification from parent process */
+        while (child_notify != 1)
+            if (HDread(out_pdf[0], &child_notify, sizeof(int)) < 0)
+                HDexit(EXIT_FAILURE);
+
+        /* Enable light refresh */
+        if ((child_fapl = H5Pcopy(fapl)) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Pset_light_refresh(child_fapl, TRUE) < 0)
+            HDexit(EXIT_FAILURE);
+
+        /* Open the file and verify the setting is retained */
+        if ((child_fid = H5Fopen(filename, H5F_ACC_RDONLY | H5F_ACC_SWMR_READ, child_fapl)) < 0)
+            HDexit(EXIT_FAILURE);
+        if ((child_fapl2 = H5Fget_access_plist(child_fid)) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Pget_light_refresh(child_fapl2, &light_refresh) < 0)
+            HDexit(EXIT_FAILURE);
+        if (!light_refresh)
+            HDexit(EXIT_FAILURE);
+
+        /* Open the dataset and read from it */
+        if ((child_did = H5Dopen2(child_fid, "dataset", H5P_DEFAULT)) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Dread(child_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            HDexit(EXIT_FAILURE);
+        if (rbuf[0] != 99)
+            HDexit(EXIT_FAILURE);
+
+        /* Refreshing an unchanged dataset should not evict anything */
+        if (H5Fget_mdc_size(child_fid, &max_size, &min_clean_size, &cur_size, &old_num_entries) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Drefresh(child_did) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Fget_mdc_size(child_fid, &max_size, &min_clean_size, &cur_size, &cur_num_entries) < 0)
+            HDexit(EXIT_FAILURE);
+        if (cur_num_entries != old_num_entries)
+            HDexit(EXIT_FAILURE);
+
+        /* Notify parent process */
+        child_notify = 2;
+        if (HDwrite(in_pdf[1], &child_notify, sizeof(int)) < 0)
+            HDexit(EXIT_FAILURE);
+
+        /* Wait for notification from parent process */
+        while (child_notify != 3)
+            if (HDread(out_pdf[0], &child_notify, sizeof(int)) < 0)
+                HDexit(EXIT_FAILURE);
+
+        /* The data was overwritten in place: verify it is not served stale */
+        if (H5Drefresh(child_did) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Dread(child_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            HDexit(EXIT_FAILURE);
+        if (rbuf[0] != 101)
+            HDexit(EXIT_FAILURE);
+
+        /* Notify parent process */
+        child_notify = 4;
+        if (HDwrite(in_pdf[1], &child_notify, sizeof(int)) < 0)
+            HDexit(EXIT_FAILURE);
+
+        /* Wait for notification from parent process */
+        while (child_notify != 5)
+            if (HDread(out_pdf[0], &child_notify, sizeof(int)) < 0)
+                HDexit(EXIT_FAILURE);
+
+        /* Refresh the dataset */
+        if (H5Drefresh(child_did) < 0)
+            HDexit(EXIT_FAILURE);
+
+        /* Get the dataset's dataspace and verify */
+        if ((child_sid = H5Dget_space(child_did)) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Sget_simple_extent_dims(child_sid, tdims, NULL) < 0)
+            HDexit(EXIT_FAILURE);
+        if (tdims[0] != 2)
+            HDexit(EXIT_FAILURE);
+
+        /* Read from the dataset and verify the data is correct */
+        if (H5Dread(child_did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            HDexit(EXIT_FAILURE);
+        if (rbuf[0] != 100 || rbuf[1] != 100)
+            HDexit(EXIT_FAILURE);
+
+        /* Closing */
+        if (H5Sclose(child_sid) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Dclose(child_did) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Pclose(child_fapl2) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Pclose(child_fapl) < 0)
+            HDexit(EXIT_FAILURE);
+        if (H5Fclose(child_fid) < 0)
+            HDexit(EXIT_FAILURE);
+
+        /* Close the pipes */
+        if (HDclose(out_pdf[0]) < 0)
+            HDexit(EXIT_FAILURE);
+        if (HDclose(in_pdf[1]) < 0)
+            HDexit(EXIT_FAILURE);
+
+        HDexit(EXIT_SUCCESS);
+    }
+
+    /* Close unused read end for out_pdf */
+    if (HDclose(out_pdf[0]) < 0)
+        FAIL_STACK_ERROR
+    /* Close unused write end for in_pdf */
+    if (HDclose(in_pdf[1]) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the test file */
+    if ((fid = H5Fopen(filename, H5F_ACC_RDWR | H5F_ACC_SWMR_WRITE, fapl)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Open the dataset */
+    if ((did = H5Dopen2(fid, "dataset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write to the dataset */
+    wbuf[0] = wbuf[1] = 99;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Flush to disk */
+    if (H5Fflush(fid, H5F_SCOPE_LOCAL) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Notify child process */
+    notify = 1;
+    if (HDwrite(out_pdf[1], &notify, sizeof(int)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Wait for notification from child process */
+    while (notify != 2) {
+        if (HDread(in_pdf[0], &notify, sizeof(int)) < 0)
+            FAIL_STACK_ERROR;
+    }
+
+    /* Overwrite the dataset in place */
+    wbuf[0] = wbuf[1] = 101;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Flush to disk */
+    if (H5Fflush(fid, H5F_SCOPE_LOCAL) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Notify child process */
+    notify = 3;
+    if (HDwrite(out_pdf[1], &notify, sizeof(int)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Wait for notification from child process */
+    while (notify != 4) {
+        if (HDread(in_pdf[0], &notify, sizeof(int)) < 0)
+            FAIL_STACK_ERROR;
+    }
+
+    /* Cork the metadata cache, to prevent the object header from being
+     * flushed before the data has been written */
+    if (H5Odisable_mdc_flushes(did) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Extend the dataset */
+    if (H5Dset_extent(did, new_dims) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Write to the dataset */
+    wbuf[0] = wbuf[1] = 100;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Uncork the metadata cache */
+    if (H5Oenable_mdc_flushes(did) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Flush to disk */
+    if (H5Fflush(fid, H5F_SCOPE_LOCAL) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Notify child process */
+    notify = 5;
+    if (HDwrite(out_pdf[1], &notify, sizeof(int)) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Close the pipes */
+    if (HDclose(out_pdf[1]) < 0)
+        FAIL_STACK_ERROR;
+    if (HDclose(in_pdf[0]) < 0)
+        FAIL_STACK_ERROR;
+
+    /* Wait for child process to complete */
+    if ((tmppid = HDwaitpid(childpid, &child_status, child_wait_option)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check exit status of child process */
+    if (WIFEXITED(child_status)) {
+        if ((child_exit_val = WEXITSTATUS(child_status)) != 0)
+            TEST_ERROR
+    }
+    else /* Child process terminated abnormally */
+        TEST_ERROR
+
+    /* Close the dataset */
+    if (H5Dclose(did) < 0)
+        FAIL_STACK_ERROR
+
+    /* Close the file */
+    if (H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+
+    /* Close the property list */
+    if (H5Pclose(fapl) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(fapl);
+        H5Fclose(fid);
+    }
+    H5E_END_TRY;
+
+    return -1;
+
+} /* test_refresh_light() */
+#endif /* H5_HAVE_UNISTD_H */
+
 /*
  * test_multiple_same():
  *
@@ -7215,6 +7588,7 @@ main(void)
 #endif
     nerrors += test_refresh_concur(fapl, TRUE);
     nerrors += test_refresh_concur(fapl, FALSE);
+    nerrors += test_refresh_light(fapl);
     nerrors += test_multiple_same(fapl, TRUE);
     nerrors += test_multiple_same(fapl, FALSE);
 
@@ -8132,6 +8132,363 @@ test_attr_open_by_name(hbool_t new_format, hid_t fcpl, hid_t fapl)
     CHECK(ret, FAIL, "H5Sclose");
 } /* test_attr_open_by_name() */
 
+/****************************************************************
+**
+**  test_attr_read_multi(): Test basic H5A (attribute) code.
+**      Tests reading several attributes with H5Aread_multi
+**
+****************************************************************/
+static void
+test_attr_read_multi(hbool_t new_format, hid_t fcpl, hid_t fapl)
+{
+    hid_t       fid;                         /* HDF5 File ID            */
+    hid_t       dataset;                     /* Dataset ID            */
+    hid_t       dataset2;                    /* Dataset ID w/o attributes */
+    hid_t       sid;                         /* Dataspace ID            */
+    hid_t       attr;                        /* Attribute ID            */
+    hid_t       open_attr;                   /* Attribute ID held open across reads */
+    hid_t       dcpl;                        /* Dataset creation property list ID */
+    unsigned    max_compact;                 /* Maximum # of attributes to store compactly */
+    unsigned    min_dense;                   /* Minimum # of attributes to store "densely" */
+    unsigned    nattrs;                      /* Number of attributes on the dataset */
+    htri_t      is_dense;                    /* Are attributes stored densely? */
+    char *      attrbuf;                     /* Storage for attribute names */
+    char *      attrnames[4];                /* Names of attributes to read */
+    const char *names[4];                    /* Pointers to attribute names */
+    char *      names_out[4];                /* Names of attributes read */
+    hid_t       type_ids_out[4];             /* Datatypes of attributes read */
+    hid_t       mem_types[4];                /* Memory datatypes */
+    void *      bufs[4];                     /* Buffers to read into */
+    unsigned    values[4];                   /* Values read */
+    unsigned    value;                       /* Value written */
+    unsigned    pass;                        /* Compact or dense storage */
+    unsigned    u;                           /* Local index variable */
+    herr_t      ret;                         /* Generic return value        */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Reading Multiple Attributes At Once\n"));
+
+    /* Allocate space for the attribute names */
+    attrbuf = (char *)HDmalloc(4 * NAME_BUF_SIZE);
+    CHECK_PTR(attrbuf, "HDmalloc");
+    for (u = 0; u < 4; u++)
+        attrnames[u] = attrbuf + (u * NAME_BUF_SIZE);
+
+    /* Create dataspace for dataset & attributes */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+
+    /* Create dataset creation property list */
+    if (dcpl_g == H5P_DEFAULT) {
+        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+        CHECK(dcpl, FAIL, "H5Pcreate");
+    }
+    else {
+        dcpl = H5Pcopy(dcpl_g);
+        CHECK(dcpl, FAIL, "H5Pcopy");
+    }
+
+    /* Query the attribute creation properties */
+    ret = H5Pget_attr_phase_change(dcpl, &max_compact, &min_dense);
+    CHECK(ret, FAIL, "H5Pget_attr_phase_change");
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create dataset */
+    dataset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+
+    /* Check compact storage, then (for the new format) dense storage */
+    nattrs = 0;
+    for (pass = 0; pass < (new_format ? 2U : 1U); pass++) {
+        unsigned new_nattrs = (pass == 0) ? max_compact : (max_compact * 2);
+
+        /* Add attributes, each holding its own index */
+        for (u = nattrs; u < new_nattrs; u++) {
+            HDsprintf(attrnames[0], "attr %02u", u);
+            attr = H5Acreate2(dataset, attrnames[0], H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+            CHECK(attr, FAIL, "H5Acreate2");
+            ret = H5Awrite(attr, H5T_NATIVE_UINT, &u);
+            CHECK(ret, FAIL, "H5Awrite");
+            ret = H5Aclose(attr);
+            CHECK(ret, FAIL, "H5Aclose");
+        } /* end for */
+        nattrs = new_nattrs;
+
+        /* Check on dataset's attribute storage status */
+        is_dense = H5O__is_attr_dense_test(dataset);
+        VERIFY(is_dense, (pass == 0 ? FALSE : TRUE), "H5O__is_attr_dense_test");
+
+        /* Set up buffers */
+        for (u = 0; u < 4; u++) {
+            names[u]     = attrnames[u];
+            mem_types[u] = H5T_NATIVE_UINT;
+            bufs[u]      = &values[u];
+        } /* end for */
+
+        /* Read a subset out of name order, including a duplicate */
+        HDsprintf(attrnames[0], "attr %02u", nattrs - 1);
+        HDsprintf(attrnames[1], "attr %02u", 0);
+        HDsprintf(attrnames[2], "attr %02u", nattrs / 2);
+        HDsprintf(attrnames[3], "attr %02u", 0);
+        HDmemset(values, 0xff, sizeof(values));
+        ret = H5Aread_multi(dataset, 4, names, mem_types, bufs, NULL, NULL);
+        CHECK(ret, FAIL, "H5Aread_multi");
+        VERIFY(values[0], nattrs - 1, "H5Aread_multi");
+        VERIFY(values[1], 0, "H5Aread_multi");
+        VERIFY(values[2], nattrs / 2, "H5Aread_multi");
+        VERIFY(values[3], 0, "H5Aread_multi");
+
+        /* Modify an attribute through an open ID, then read it with the others */
+        HDsprintf(attrnames[0], "attr %02u", 1);
+        open_attr = H5Aopen(dataset, attrnames[0], H5P_DEFAULT);
+        CHECK(open_attr, FAIL, "H5Aopen");
+        value = 100 + pass;
+        ret   = H5Awrite(open_attr, H5T_NATIVE_UINT, &value);
+        CHECK(ret, FAIL, "H5Awrite");
+        HDmemset(values, 0xff, sizeof(values));
+        ret = H5Aread_multi(dataset, 4, names, mem_types, bufs, NULL, NULL);
+        CHECK(ret, FAIL, "H5Aread_multi");
+        VERIFY(values[0], value, "H5Aread_multi");
+        VERIFY(values[1], 0, "H5Aread_multi");
+        VERIFY(values[2], nattrs / 2, "H5Aread_multi");
+        VERIFY(values[3], 0, "H5Aread_multi");
+        value = 1;
+        ret   = H5Awrite(open_attr, H5T_NATIVE_UINT, &value);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(open_attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        /* Read the first attributes in name order, with their names and datatypes */
+        HDmemset(values, 0xff, sizeof(values));
+        ret = H5Aread_multi(dataset, 4, NULL, mem_types, bufs, names_out, type_ids_out);
+        CHECK(ret, FAIL, "H5Aread_multi");
+        for (u = 0; u < 4; u++) {
+            VERIFY(values[u], u, "H5Aread_multi");
+            HDsprintf(attrnames[0], "attr %02u", u);
+            VERIFY_STR(names_out[u], attrnames[0], "H5Aread_multi");
+            VERIFY(H5Tequal(type_ids_out[u], H5T_NATIVE_UINT), TRUE, "H5Tequal");
+            ret = H5free_memory(names_out[u]);
+            CHECK(ret, FAIL, "H5free_memory");
+            ret = H5Tclose(type_ids_out[u]);
+            CHECK(ret, FAIL, "H5Tclose");
+        } /* end for */
+
+        /* Only retrieve the names and datatypes */
+        ret = H5Aread_multi(dataset, 1, NULL, NULL, NULL, names_out, type_ids_out);
+        CHECK(ret, FAIL, "H5Aread_multi");
+        VERIFY_STR(names_out[0], "attr 00", "H5Aread_multi");
+        VERIFY(H5Tget_size(type_ids_out[0]), sizeof(unsigned), "H5Tget_size");
+        ret = H5free_memory(names_out[0]);
+        CHECK(ret, FAIL, "H5free_memory");
+        ret = H5Tclose(type_ids_out[0]);
+        CHECK(ret, FAIL, "H5Tclose");
+
+        /* Reading a missing attribute should fail */
+        HDstrcpy(attrnames[2], "foo");
+        H5E_BEGIN_TRY
+        {
+            ret = H5Aread_multi(dataset, 4, names, mem_types, bufs, names_out, NULL);
+        }
+        H5E_END_TRY;
+        VERIFY(ret, FAIL, "H5Aread_multi");
+    } /* end for */
+
+    /* Asking for more attributes than the object has should fail */
+    dataset2 = H5Dcreate2(fid, DSET2_NAME, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dataset2, FAIL, "H5Dcreate2");
+    H5E_BEGIN_TRY
+    {
+        ret = H5Aread_multi(dataset2, 1, NULL, mem_types, bufs, NULL, NULL);
+    }
+    H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Aread_multi");
+    ret = H5Dclose(dataset2);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Close dataset */
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Close property list */
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Close dataspace */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Release the attribute names */
+    HDfree(attrbuf);
+} /* test_attr_read_multi() */
+
+/****************************************************************
+**
+**  test_attr_compact_lookup_many(): Test basic H5A (attribute) code.
+**      Tests looking up attributes by name on an object holding
+**      enough compact attributes for the object header name index
+**      to be used, while attributes are renamed, deleted and
+**      re-created.
+**
+****************************************************************/
+static void
+test_attr_compact_lookup_many(hid_t fcpl, hid_t fapl)
+{
+    hid_t    fid;                     /* HDF5 File ID            */
+    hid_t    dataset;                 /* Dataset ID            */
+    hid_t    sid;                     /* Dataspace ID            */
+    hid_t    attr;                    /* Attribute ID            */
+    hid_t    dcpl;                    /* Dataset creation property list ID */
+    htri_t   is_dense;                /* Are attributes stored densely? */
+    htri_t   exists;                  /* Whether an attribute exists */
+    char     attrname[NAME_BUF_SIZE]; /* Name of attribute */
+    char     newname[NAME_BUF_SIZE];  /* New name of attribute */
+    unsigned nattrs = 40;             /* Number of attributes on the dataset */
+    unsigned value;                   /* Attribute value */
+    unsigned u;                       /* Local index variable */
+    herr_t   ret;                     /* Generic return value        */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Looking Up Many Compact Attributes\n"));
+
+    /* Create dataspace for dataset & attributes */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+
+    /* Keep all the attributes in the object header */
+    if (dcpl_g == H5P_DEFAULT) {
+        dcpl = H5Pcreate(H5P_DATASET_CREATE);
+        CHECK(dcpl, FAIL, "H5Pcreate");
+    }
+    else {
+        dcpl = H5Pcopy(dcpl_g);
+        CHECK(dcpl, FAIL, "H5Pcopy");
+    }
+    ret = H5Pset_attr_phase_change(dcpl, 2 * nattrs, nattrs);
+    CHECK(ret, FAIL, "H5Pset_attr_phase_change");
+
+    /* Create file & dataset */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+    CHECK(fid, FAIL, "H5Fcreate");
+    dataset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+
+    /* Add attributes, each holding its own index */
+    for (u = 0; u < nattrs; u++) {
+        HDsprintf(attrname, "attr %02u", u);
+        attr = H5Acreate2(dataset, attrname, H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, H5T_NATIVE_UINT, &u);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+    } /* end for */
+    is_dense = H5O__is_attr_dense_test(dataset);
+    VERIFY(is_dense, FALSE, "H5O__is_attr_dense_test");
+
+    /* Re-open the dataset, so the header is loaded from the file */
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+    fid = H5Fopen(FILENAME, H5F_ACC_RDWR, fapl);
+    CHECK(fid, FAIL, "H5Fopen");
+    dataset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dopen2");
+
+    /* Open each attribute by name, in reverse order */
+    for (u = nattrs; u > 0; u--) {
+        HDsprintf(attrname, "attr %02u", u - 1);
+        attr = H5Aopen(dataset, attrname, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Aopen");
+        ret = H5Aread(attr, H5T_NATIVE_UINT, &value);
+        CHECK(ret, FAIL, "H5Aread");
+        VERIFY(value, u - 1, "H5Aread");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+    } /* end for */
+    exists = H5Aexists(dataset, "attr");
+    VERIFY(exists, FALSE, "H5Aexists");
+
+    /* Rename every fourth attribute and delete every other one */
+    for (u = 1; u < nattrs; u += 4) {
+        HDsprintf(attrname, "attr %02u", u);
+        HDsprintf(newname, "renamed %02u", u);
+        ret = H5Arename(dataset, attrname, newname);
+        CHECK(ret, FAIL, "H5Arename");
+    } /* end for */
+    for (u = 0; u < nattrs; u += 2) {
+        HDsprintf(attrname, "attr %02u", u);
+        ret = H5Adelete(dataset, attrname);
+        CHECK(ret, FAIL, "H5Adelete");
+    } /* end for */
+
+    /* Verify the attributes */
+    for (u = 0; u < nattrs; u++) {
+        HDsprintf(attrname, "attr %02u", u);
+        HDsprintf(newname, "renamed %02u", u);
+        exists = H5Aexists(dataset, attrname);
+        VERIFY(exists, (htri_t)((u % 2) == 1 && (u % 4) != 1), "H5Aexists");
+        exists = H5Aexists(dataset, newname);
+        VERIFY(exists, (htri_t)((u % 4) == 1), "H5Aexists");
+        if ((u % 4) == 1) {
+            attr = H5Aopen(dataset, newname, H5P_DEFAULT);
+            CHECK(attr, FAIL, "H5Aopen");
+            ret = H5Aread(attr, H5T_NATIVE_UINT, &value);
+            CHECK(ret, FAIL, "H5Aread");
+            VERIFY(value, u, "H5Aread");
+            ret = H5Aclose(attr);
+            CHECK(ret, FAIL, "H5Aclose");
+        } /* end if */
+    }     /* end for */
+
+    /* Re-create the deleted attributes with new values */
+    for (u = 0; u < nattrs; u += 2) {
+        HDsprintf(attrname, "attr %02u", u);
+        attr = H5Acreate2(dataset, attrname, H5T_NATIVE_UINT, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        value = u + 1000;
+        ret   = H5Awrite(attr, H5T_NATIVE_UINT, &value);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+    } /* end for */
+    for (u = 0; u < nattrs; u += 2) {
+        HDsprintf(attrname, "attr %02u", u);
+        attr = H5Aopen(dataset, attrname, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Aopen");
+        ret = H5Aread(attr, H5T_NATIVE_UINT, &value);
+        CHECK(ret, FAIL, "H5Aread");
+        VERIFY(value, u + 1000, "H5Aread");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+    } /* end for */
+    is_dense = H5O__is_attr_dense_test(dataset);
+    VERIFY(is_dense, FALSE, "H5O__is_attr_dense_test");
+
+    /* Close dataset */
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Close file */
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Close property list */
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Close dataspace */
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+} /* test_attr_compact_lookup_many() */
+
 /****************************************************************
 **
 **  test_attr_create_by_name(): Test basic H5A (attribute) code.
@@ -11260,6 +11617,8 @@ test_attr(void)
                                    my_fapl); /* Test iterating over attributes by index */
                 test_attr_open_by_idx(new_format, my_fcpl, my_fapl);    /* Test opening attributes by index */
                 test_attr_open_by_name(new_format, my_fcpl, my_fapl);   /* Test opening attributes by name */
+                test_attr_read_multi(new_format, my_fcpl, my_fapl);     /* Test reading many attributes */
+                test_attr_compact_lookup_many(my_fcpl, my_fapl); /* Test looking up many compact attributes */
                 test_attr_create_by_name(new_format, my_fcpl, my_fapl); /* Test creating attributes by name */
 
                 /* Tests that address specific bugs */
@@ -25,6 +25,8 @@
 #define FAMILY_SIZE   (1 * KB)
 #define FAMILY_SIZE2  (5 * KB)
 #define MULTI_SIZE    128
+#define STRIPE_NUMBER 3
+#define STRIPE_SIZE   (4 * KB)
 #define SPLITTER_SIZE 8 /* dimensions of a dataset */
 
 #define CORE_INCREMENT (4 * KB)
@@ -46,8 +48,19 @@
 #define THRESHOLD  1
 #define DSET2_NAME "dset2"
 #define DSET2_DIM  4
+#define DSET3_DIM  (DSET1_DIM1 * DSET1_DIM2)
 #endif /* H5_HAVE_DIRECT */
 
+/* Macros for io_uring VFD */
+#ifdef H5_HAVE_IOURING
+#define IOURING_QUEUE_DEPTH  4
+#define IOURING_SEGMENT_SIZE (8 * KB)
+#ifndef DSET2_NAME
+#define DSET2_NAME "dset2"
+#define DSET2_DIM  4
+#endif /* DSET2_NAME */
+#endif /* H5_HAVE_IOURING */
+
 const char *FILENAME[] = {"sec2_file",          /*0*/
                           "core_file",          /*1*/
                           "family_file",        /*2*/
@@ -62,9 +75,12 @@ const char *FILENAME[] = {"sec2_file",          /*0*/
                           "splitter_rw_file",   /*11*/
                           "splitter_wo_file",   /*12*/
                           "splitter.log",       /*13*/
+                          "iouring_file",       /*14*/
+                          "stripe_file",        /*15*/
                           NULL};
 
 #define LOG_FILENAME "log_vfd_out.log"
+#define LOG_TRACE_FILENAME "log_vfd_out.trace"
 
 #define COMPAT_BASENAME       "family_v16_"
 #define MULTI_COMPAT_BASENAME "multi_file_v16"
@@ -598,15 +614,20 @@ test_direct(void)
 #ifdef H5_HAVE_DIRECT
     hid_t   file = -1, fapl = -1, access_fapl = -1;
     hid_t   dset1 = -1, dset2 = -1, space1 = -1, space2 = -1;
+    hid_t   dset3 = -1, space3 = -1, mspace3 = -1;
     char    filename[1024];
     int *   fhandle = NULL;
     hsize_t file_size;
-    hsize_t dims1[2], dims2[1];
+    hsize_t dims1[2], dims2[1], dims3[1];
+    hsize_t start[1], count[1];
+    hsize_t mem_off[2]  = {3, 0};
+    hsize_t file_off[2] = {3, 5};
     size_t  mbound;
     size_t  fbsize;
     size_t  cbsize;
     void *  proto_points = NULL, *proto_check = NULL;
     int *   points = NULL, *check = NULL, *p1 = NULL, *p2 = NULL;
+    int *   expect = NULL;
     int     wdata2[DSET2_DIM] = {11, 12, 13, 14};
     int     rdata2[DSET2_DIM];
     int     i, j, n;
@@ -759,6 +780,69 @@ test_direct(void)
             TEST_ERROR;
         } /* end if */
 
+    /* Create data set 3 and fill it with aligned I/O.  It is then updated
+     * and read back with large transfers that are not aligned in the file.
+     * For the first one the whole blocks are aligned in memory and move
+     * directly to or from the buffer; the second one isn't, and goes
+     * through the driver's bounce buffers in several pieces. */
+    if (NULL == (expect = (int *)HDmalloc(DSET3_DIM * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET3_DIM; i++)
+        expect[i] = points[i] = -i;
+
+    dims3[0] = DSET3_DIM;
+    if ((space3 = H5Screate_simple(1, dims3, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace3 = H5Screate_simple(1, dims3, NULL)) < 0)
+        TEST_ERROR;
+    if ((dset3 =
+             H5Dcreate2(file, DSET3_NAME, H5T_NATIVE_INT, space3, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset3, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+
+    for (n = 0; n < 2; n++) {
+        count[0] = DSET3_DIM - 8;
+
+        /* Update all but a few elements at both ends */
+        for (i = 0; i < DSET3_DIM; i++)
+            points[i] = (n + 1) * DSET3_DIM + i;
+        for (i = 0; i < (int)count[0]; i++)
+            expect[(int)file_off[n] + i] = points[(int)mem_off[n] + i];
+
+        start[0] = mem_off[n];
+        if (H5Sselect_hyperslab(mspace3, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        start[0] = file_off[n];
+        if (H5Sselect_hyperslab(space3, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset3, H5T_NATIVE_INT, mspace3, space3, H5P_DEFAULT, points) < 0)
+            TEST_ERROR;
+
+        /* Read the same selection back */
+        HDmemset(check, 0, DSET3_DIM * sizeof(int));
+        if (H5Dread(dset3, H5T_NATIVE_INT, mspace3, space3, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (i = (int)mem_off[n]; i < (int)(mem_off[n] + count[0]); i++)
+            if (points[i] != check[i]) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in data set 3.\n");
+                HDprintf("    At index %d of pass %d\n", i, n);
+                TEST_ERROR;
+            } /* end if */
+
+        /* Check the whole data set, including the untouched elements */
+        if (H5Dread(dset3, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for (i = 0; i < DSET3_DIM; i++)
+            if (expect[i] != check[i]) {
+                H5_FAILED();
+                HDprintf("    Data set 3 was corrupted by an unaligned write.\n");
+                HDprintf("    At index %d of pass %d\n", i, n);
+                TEST_ERROR;
+            } /* end if */
+    }     /* end for */
+
     if (H5Sclose(space1) < 0)
         TEST_ERROR;
     if (H5Dclose(dset1) < 0)
@@ -767,9 +851,16 @@ test_direct(void)
         TEST_ERROR;
     if (H5Dclose(dset2) < 0)
         TEST_ERROR;
+    if (H5Sclose(space3) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace3) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset3) < 0)
+        TEST_ERROR;
 
     HDfree(points);
     HDfree(check);
+    HDfree(expect);
 
     /* Close and delete the file */
     if (H5Fclose(file) < 0)
@@ -791,6 +882,9 @@ error:
         H5Dclose(dset1);
         H5Sclose(space2);
         H5Dclose(dset2);
+        H5Sclose(space3);
+        H5Sclose(mspace3);
+        H5Dclose(dset3);
         H5Fclose(file);
     }
     H5E_END_TRY;
@@ -799,11 +893,188 @@ error:
         HDfree(proto_points);
     if (proto_check)
         HDfree(proto_check);
+    if (expect)
+        HDfree(expect);
 
     return -1;
 #endif /*H5_HAVE_DIRECT*/
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver,
+ *              with unstaged, registered and direct I/O.  A small queue
+ *              depth and segment size make the dataset I/O span several
+ *              batches, and the file is read back with the sec2 driver.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING
+    hid_t    file = -1, fapl = -1, access_fapl = -1;
+    hid_t    dset1 = -1, dset2 = -1, space1 = -1, space2 = -1;
+    char     filename[1024];
+    int *    fhandle = NULL;
+    hsize_t  dims1[2], dims2[1];
+    unsigned queue_depth;
+    size_t   segment_size;
+    unsigned flags;
+    int *    points = NULL, *check = NULL;
+    int      wdata2[DSET2_DIM] = {11, 12, 13, 14};
+    int      rdata2[DSET2_DIM];
+    int      i, m;
+    unsigned modes[3] = {0, H5FD_IOURING_REGISTER_BUFFERS, H5FD_IOURING_DIRECT_IO};
+#endif /*H5_HAVE_IOURING*/
+
+    TESTING("IO_URING file driver");
+
+#ifndef H5_HAVE_IOURING
+    SKIPPED();
+    return 0;
+#else  /*H5_HAVE_IOURING*/
+
+    if (NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    for (m = 0; m < 3; m++) {
+        /* Set property list and file name for the io_uring driver */
+        if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_iouring(fapl, IOURING_QUEUE_DEPTH, IOURING_SEGMENT_SIZE, modes[m]) < 0)
+            TEST_ERROR;
+        h5_fixname(FILENAME[14], fapl, filename, sizeof filename);
+
+        /* Verify the file access properties */
+        if (H5Pget_fapl_iouring(fapl, &queue_depth, &segment_size, &flags) < 0)
+            TEST_ERROR;
+        if (queue_depth != IOURING_QUEUE_DEPTH || segment_size != IOURING_SEGMENT_SIZE || flags != modes[m])
+            TEST_ERROR;
+
+        H5E_BEGIN_TRY { file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl); }
+        H5E_END_TRY;
+        if (file < 0) {
+            /* Only direct I/O depends on the file system */
+            if (!(modes[m] & H5FD_IOURING_DIRECT_IO))
+                TEST_ERROR;
+            H5Pclose(fapl);
+            fapl = -1;
+            continue;
+        }
+
+        /* Check that the driver is correct */
+        if ((access_fapl = H5Fget_access_plist(file)) < 0)
+            TEST_ERROR;
+        if (H5FD_IOURING != H5Pget_driver(access_fapl))
+            TEST_ERROR;
+        if (H5Pclose(access_fapl) < 0)
+            TEST_ERROR;
+
+        /* Check file handle API */
+        if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+            TEST_ERROR;
+        if (*fhandle < 0)
+            TEST_ERROR;
+
+        /* Write a dataset larger than one batch, and a small one which isn't
+         * aligned in the file or in memory
+         */
+        dims1[0] = DSET1_DIM1;
+        dims1[1] = DSET1_DIM2;
+        if ((space1 = H5Screate_simple(2, dims1, NULL)) < 0)
+            TEST_ERROR;
+        if ((dset1 = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space1, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+            TEST_ERROR;
+        dims2[0] = DSET2_DIM;
+        if ((space2 = H5Screate_simple(1, dims2, NULL)) < 0)
+            TEST_ERROR;
+        if ((dset2 = H5Dcreate2(file, DSET2_NAME, H5T_NATIVE_INT, space2, H5P_DEFAULT, H5P_DEFAULT,
+                                H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata2) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset1) < 0 || H5Dclose(dset2) < 0)
+            TEST_ERROR;
+        if (H5Sclose(space1) < 0 || H5Sclose(space2) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Read the data back with the io_uring driver, then with sec2 */
+        for (i = 0; i < 2; i++) {
+            if ((file = H5Fopen(filename, H5F_ACC_RDONLY, i ? H5P_DEFAULT : fapl)) < 0)
+                TEST_ERROR;
+            if ((dset1 = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+            if (H5Dread(dset1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+                TEST_ERROR;
+            if (HDmemcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in data set 1 (mode %u).\n", modes[m]);
+                TEST_ERROR;
+            } /* end if */
+            if ((dset2 = H5Dopen2(file, DSET2_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (H5Dread(dset2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata2) < 0)
+                TEST_ERROR;
+            if (HDmemcmp(wdata2, rdata2, sizeof(wdata2)) != 0) {
+                H5_FAILED();
+                HDprintf("    Read different values than written in data set 2 (mode %u).\n", modes[m]);
+                TEST_ERROR;
+            } /* end if */
+            if (H5Dclose(dset1) < 0 || H5Dclose(dset2) < 0)
+                TEST_ERROR;
+            if (H5Fclose(file) < 0)
+                TEST_ERROR;
+        } /* end for */
+
+        /* Close and delete the file */
+        h5_delete_test_file(FILENAME[14], fapl);
+        if (H5Pclose(fapl) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Sclose(space1);
+        H5Dclose(dset1);
+        H5Sclose(space2);
+        H5Dclose(dset2);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    if (points)
+        HDfree(points);
+    if (check)
+        HDfree(check);
+
+    return -1;
+#endif /*H5_HAVE_IOURING*/
+} /* end test_iouring() */
+
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
  *
@@ -1310,6 +1581,201 @@ error:
     return FAIL;
 } /* end test_family_member_fapl() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_stripe
+ *
+ * Purpose:     Tests the file handle interface for the striping driver,
+ *              with the members transferred by the I/O threads and then
+ *              one after another.  The dataset spans many stripe units,
+ *              and the members must add up to the file size.  Reopening
+ *              the file with a different layout must fail.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+/* Disable warning for "format not a string literal" here */
+/*
+ *      This pragma only needs to surround the snprintf() calls with
+ *      'memb_name' in the code below, but early (4.4.7, at least) gcc only
+ *      allows diagnostic pragmas to be toggled outside of functions.
+ */
+H5_GCC_DIAG_OFF("format-nonliteral")
+static herr_t
+test_stripe(void)
+{
+#ifdef H5_HAVE_STRIPE_VFD
+    hid_t          file = -1, fapl = -1, access_fapl = -1, space = -1, dset = -1;
+    hid_t          driver_id    = -1; /* ID for this VFD              */
+    unsigned long  driver_flags = 0;  /* VFD feature flags            */
+    char           filename[1024];
+    char           memb_name[1024];
+    int *          fhandle = NULL;
+    hsize_t        dims[2] = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t        file_size;
+    h5_stat_t      sb;
+    h5_stat_size_t memb_total;
+    unsigned       nmembers;
+    size_t         stripe_size;
+    unsigned       nthreads;
+    int *          points = NULL, *check = NULL;
+    unsigned       threads[2] = {0, 1};
+    int            i, t;
+#endif /*H5_HAVE_STRIPE_VFD*/
+
+    TESTING("STRIPE file driver");
+
+#ifndef H5_HAVE_STRIPE_VFD
+    SKIPPED();
+    return 0;
+#else  /*H5_HAVE_STRIPE_VFD*/
+
+    if (NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    for (t = 0; t < 2; t++) {
+        /* Set property list and file name for the striping driver */
+        if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_stripe(fapl, STRIPE_NUMBER, STRIPE_SIZE, threads[t]) < 0)
+            TEST_ERROR;
+        h5_fixname(FILENAME[15], fapl, filename, sizeof(filename));
+
+        /* Verify the file access properties */
+        if (H5Pget_fapl_stripe(fapl, &nmembers, &stripe_size, &nthreads) < 0)
+            TEST_ERROR;
+        if (nmembers != STRIPE_NUMBER || stripe_size != STRIPE_SIZE ||
+            nthreads != (threads[t] ? threads[t] : STRIPE_NUMBER))
+            TEST_ERROR;
+
+        /* Check that the VFD feature flags are correct */
+        if ((driver_id = H5Pget_driver(fapl)) < 0)
+            TEST_ERROR
+        if (H5FDdriver_query(driver_id, &driver_flags) < 0)
+            TEST_ERROR
+        if (driver_flags != (H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA |
+                             H5FD_FEAT_DATA_SIEVE | H5FD_FEAT_AGGREGATE_SMALLDATA))
+            TEST_ERROR
+
+        if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+            TEST_ERROR;
+
+        /* Check that the driver is correct */
+        if ((access_fapl = H5Fget_access_plist(file)) < 0)
+            TEST_ERROR;
+        if (H5FD_STRIPE != H5Pget_driver(access_fapl))
+            TEST_ERROR;
+        if (H5Pclose(access_fapl) < 0)
+            TEST_ERROR;
+
+        /* Check file handle API */
+        if (H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+            TEST_ERROR;
+        if (*fhandle < 0)
+            TEST_ERROR;
+
+        /* Write a dataset spanning many stripe units */
+        if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+            TEST_ERROR;
+        if ((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+            TEST_ERROR;
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+        if (H5Sclose(space) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Read the data back */
+        if ((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+            TEST_ERROR;
+        if ((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if (H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        if (HDmemcmp(points, check, DSET1_DIM1 * DSET1_DIM2 * sizeof(int)) != 0) {
+            H5_FAILED();
+            HDprintf("    Read different values than written (nthreads %u).\n", threads[t]);
+            TEST_ERROR;
+        } /* end if */
+        if (H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        /* The members hold exactly the file, and are all in use */
+        if (H5Fget_filesize(file, &file_size) < 0)
+            TEST_ERROR;
+        if (H5Fclose(file) < 0)
+            TEST_ERROR;
+        memb_total = 0;
+        for (i = 0; i < STRIPE_NUMBER; i++) {
+            HDsnprintf(memb_name, sizeof(memb_name), filename, i);
+            if (HDstat(memb_name, &sb) < 0)
+                TEST_ERROR;
+            if (sb.st_size < (h5_stat_size_t)STRIPE_SIZE)
+                TEST_ERROR;
+            memb_total += (h5_stat_size_t)sb.st_size;
+        } /* end for */
+        if ((hsize_t)memb_total != file_size)
+            TEST_ERROR;
+
+        /* Reopening with a different number of members or stripe size fails */
+        if (H5Pset_fapl_stripe(fapl, STRIPE_NUMBER - 1, STRIPE_SIZE, threads[t]) < 0)
+            TEST_ERROR;
+        H5E_BEGIN_TRY { file = H5Fopen(filename, H5F_ACC_RDONLY, fapl); }
+        H5E_END_TRY;
+        if (file >= 0)
+            TEST_ERROR;
+        if (H5Pset_fapl_stripe(fapl, STRIPE_NUMBER, 2 * STRIPE_SIZE, threads[t]) < 0)
+            TEST_ERROR;
+        H5E_BEGIN_TRY { file = H5Fopen(filename, H5F_ACC_RDONLY, fapl); }
+        H5E_END_TRY;
+        if (file >= 0)
+            TEST_ERROR;
+
+        /* Delete the file */
+        if (H5Pset_fapl_stripe(fapl, STRIPE_NUMBER, STRIPE_SIZE, threads[t]) < 0)
+            TEST_ERROR;
+        h5_delete_test_file(FILENAME[15], fapl);
+        if (H5Pclose(fapl) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(fapl);
+        H5Pclose(access_fapl);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    }
+    H5E_END_TRY;
+
+    if (points)
+        HDfree(points);
+    if (check)
+        HDfree(check);
+
+    return -1;
+#endif /*H5_HAVE_STRIPE_VFD*/
+} /* end test_stripe() */
+H5_GCC_DIAG_ON("format-nonliteral")
+
 /*-------------------------------------------------------------------------
  * Function:    test_multi_opens
  *
@@ -1817,6 +2283,12 @@ test_log(void)
     hsize_t       file_size = 0;
     unsigned int  flags     = H5FD_LOG_ALL;
     size_t        buf_size  = 4 * KB;
+    FILE *        tracefp   = NULL;
+
+    H5FD_log_trace_header_t header;
+    H5FD_log_trace_rec_t    rec;
+    unsigned                nwrites = 0, ntruncates = 0;
+    double                  last_start = 0.0;
 
     TESTING("LOG file driver");
 
@@ -1889,6 +2361,44 @@ test_log(void)
         TEST_ERROR;
     h5_delete_test_file(FILENAME[6], fapl);
 
+    /* Create the file again, writing a binary trace this time */
+    if (H5Pset_fapl_log(fapl, LOG_TRACE_FILENAME, H5FD_LOG_TRACE, (size_t)0) < 0)
+        TEST_ERROR;
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if (H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[6], fapl);
+
+    /* Check the trace.  Creating and closing the file writes the superblock
+     * and truncates the file to its final size. */
+    if (NULL == (tracefp = HDfopen(LOG_TRACE_FILENAME, "rb")))
+        TEST_ERROR;
+    if (1 != HDfread(&header, sizeof(header), 1, tracefp))
+        TEST_ERROR;
+    if (header.magic != H5FD_LOG_TRACE_MAGIC || header.version != H5FD_LOG_TRACE_VERSION ||
+        header.rec_size != sizeof(H5FD_log_trace_rec_t))
+        TEST_ERROR;
+    while (1 == HDfread(&rec, sizeof(rec), 1, tracefp)) {
+        if (rec.op > H5FD_LOG_TRACE_OP_TRUNCATE || rec.type >= H5FD_MEM_NTYPES)
+            TEST_ERROR;
+        if (rec.start < last_start || rec.elapsed < 0.0)
+            TEST_ERROR;
+        last_start = rec.start;
+        if (rec.op == H5FD_LOG_TRACE_OP_WRITE) {
+            if (0 == rec.size)
+                TEST_ERROR;
+            nwrites++;
+        }
+        else if (rec.op == H5FD_LOG_TRACE_OP_TRUNCATE)
+            ntruncates++;
+    }
+    if (0 == nwrites || 0 == ntruncates)
+        TEST_ERROR;
+    HDfclose(tracefp);
+    tracefp = NULL;
+    HDremove(LOG_TRACE_FILENAME);
+
     /* Close the fapl */
     if (H5Pclose(fapl) < 0)
         TEST_ERROR;
@@ -1903,6 +2413,8 @@ error:
         H5Fclose(file);
     }
     H5E_END_TRY;
+    if (tracefp)
+        HDfclose(tracefp);
     return -1;
 }
 
@@ -3325,7 +3837,9 @@ main(void)
     nerrors += test_sec2() < 0 ? 1 : 0;
     nerrors += test_core() < 0 ? 1 : 0;
     nerrors += test_direct() < 0 ? 1 : 0;
+    nerrors += test_iouring() < 0 ? 1 : 0;
     nerrors += test_family() < 0 ? 1 : 0;
+    nerrors += test_stripe() < 0 ? 1 : 0;
     nerrors += test_family_compat() < 0 ? 1 : 0;
     nerrors += test_family_member_fapl() < 0 ? 1 : 0;
     nerrors += test_multi() < 0 ? 1 : 0;
@@ -39,6 +39,11 @@
 #define LINK_CHUNK_IO_SORT_CHUNK_ISSUE_CHUNK_SIZE   1
 #define LINK_CHUNK_IO_SORT_CHUNK_ISSUE_DIMS         1
 
+#define COLL_MD_READ_SIZE_NGROUPS  20
+#define COLL_MD_READ_SIZE_NELMTS   10
+#define COLL_MD_READ_SIZE_REGION   65536
+#define COLL_MD_READ_SIZE_ATTRNAME "attr"
+
 /*
  * A test for issue HDFFV-10501. A parallel hang was reported which occurred
  * in linked-chunk I/O when collective metadata reads are enabled and some ranks
@@ -521,3 +526,163 @@ test_link_chunk_io_sort_chunk_issue(void)
     VRFY((H5Pclose(fapl_id) >= 0), "H5Pclose succeeded");
     VRFY((H5Fclose(file_id) >= 0), "H5Fclose succeeded");
 }
+
+/*
+ * A test for H5Pset_coll_metadata_read_size(), which makes process 0 read
+ * and broadcast whole file regions for collective metadata reads.  Creates
+ * groups holding a dataset with an attribute, then verifies that all of
+ * them read back correctly with the regions enabled, both in a file opened
+ * read-only and in one that is modified between the reads.  The objects are
+ * opened with access property lists requesting collective metadata reads,
+ * since the setting on the file access property list covers the file open.
+ */
+void
+test_coll_md_read_size(void)
+{
+    const char *filename;
+    char        name[64];
+    hsize_t     dims[1] = {COLL_MD_READ_SIZE_NELMTS};
+    hid_t       file_id  = H5I_INVALID_HID;
+    hid_t       fapl_id  = H5I_INVALID_HID;
+    hid_t       fapl2_id = H5I_INVALID_HID;
+    hid_t       gapl_id  = H5I_INVALID_HID;
+    hid_t       dapl_id  = H5I_INVALID_HID;
+    hid_t       aapl_id  = H5I_INVALID_HID;
+    hid_t       group_id = H5I_INVALID_HID;
+    hid_t       dset_id  = H5I_INVALID_HID;
+    hid_t       attr_id  = H5I_INVALID_HID;
+    hid_t       space_id = H5I_INVALID_HID;
+    hid_t       ascal_id = H5I_INVALID_HID;
+    size_t      read_size;
+    herr_t      ret;
+    int         data[COLL_MD_READ_SIZE_NELMTS];
+    int         read_buf[COLL_MD_READ_SIZE_NELMTS];
+    int         attr_val;
+    int         pass;
+    int         mpi_rank;
+    int         i, j;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    filename = GetTestParameters();
+
+    fapl_id = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl_id >= 0), "create_faccess_plist succeeded");
+
+    VRFY((H5Pset_all_coll_metadata_ops(fapl_id, true) >= 0), "Set collective metadata reads succeeded");
+    VRFY((H5Pset_coll_metadata_write(fapl_id, true) >= 0), "Set collective metadata writes succeeded");
+
+    /* Verify the default, an invalid value, and setting the size */
+    VRFY((H5Pget_coll_metadata_read_size(fapl_id, &read_size) >= 0),
+         "H5Pget_coll_metadata_read_size succeeded");
+    VRFY((read_size == 0), "default collective metadata read size is 0");
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_coll_metadata_read_size(fapl_id, (size_t)INT_MAX + 1);
+    }
+    H5E_END_TRY;
+    VRFY((ret < 0), "H5Pset_coll_metadata_read_size failed for too large a size");
+    VRFY((H5Pset_coll_metadata_read_size(fapl_id, COLL_MD_READ_SIZE_REGION) >= 0),
+         "H5Pset_coll_metadata_read_size succeeded");
+
+    /* Make the object opens read their metadata collectively too */
+    gapl_id = H5Pcreate(H5P_GROUP_ACCESS);
+    VRFY((gapl_id >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_all_coll_metadata_ops(gapl_id, true) >= 0), "Set collective metadata reads succeeded");
+    dapl_id = H5Pcreate(H5P_DATASET_ACCESS);
+    VRFY((dapl_id >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_all_coll_metadata_ops(dapl_id, true) >= 0), "Set collective metadata reads succeeded");
+    aapl_id = H5Pcreate(H5P_ATTRIBUTE_ACCESS);
+    VRFY((aapl_id >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_all_coll_metadata_ops(aapl_id, true) >= 0), "Set collective metadata reads succeeded");
+
+    /* Create the groups, datasets and attributes */
+    file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((file_id >= 0), "H5Fcreate succeeded");
+
+    space_id = H5Screate_simple(1, dims, NULL);
+    VRFY((space_id >= 0), "H5Screate_simple succeeded");
+    ascal_id = H5Screate(H5S_SCALAR);
+    VRFY((ascal_id >= 0), "H5Screate succeeded");
+
+    for (i = 0; i < COLL_MD_READ_SIZE_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group_%d", i);
+        group_id = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((group_id >= 0), "H5Gcreate2 succeeded");
+
+        dset_id =
+            H5Dcreate2(group_id, "dset", H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((dset_id >= 0), "H5Dcreate2 succeeded");
+        for (j = 0; j < COLL_MD_READ_SIZE_NELMTS; j++)
+            data[j] = i * COLL_MD_READ_SIZE_NELMTS + j;
+        VRFY((H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) >= 0),
+             "H5Dwrite succeeded");
+
+        attr_id = H5Acreate2(dset_id, COLL_MD_READ_SIZE_ATTRNAME, H5T_NATIVE_INT, ascal_id, H5P_DEFAULT,
+                             H5P_DEFAULT);
+        VRFY((attr_id >= 0), "H5Acreate2 succeeded");
+        VRFY((H5Awrite(attr_id, H5T_NATIVE_INT, &i) >= 0), "H5Awrite succeeded");
+
+        VRFY((H5Aclose(attr_id) >= 0), "H5Aclose succeeded");
+        VRFY((H5Dclose(dset_id) >= 0), "H5Dclose succeeded");
+        VRFY((H5Gclose(group_id) >= 0), "H5Gclose succeeded");
+    }
+
+    VRFY((H5Fclose(file_id) >= 0), "H5Fclose succeeded");
+
+    /* Read everything back, first from the file opened read-only, then
+     * opened for writing and adding a group after reading each group
+     */
+    for (pass = 0; pass < 2; pass++) {
+        file_id = H5Fopen(filename, pass == 0 ? H5F_ACC_RDONLY : H5F_ACC_RDWR, fapl_id);
+        VRFY((file_id >= 0), "H5Fopen succeeded");
+
+        fapl2_id = H5Fget_access_plist(file_id);
+        VRFY((fapl2_id >= 0), "H5Fget_access_plist succeeded");
+        VRFY((H5Pget_coll_metadata_read_size(fapl2_id, &read_size) >= 0),
+             "H5Pget_coll_metadata_read_size succeeded");
+        VRFY((read_size == COLL_MD_READ_SIZE_REGION), "collective metadata read size retained");
+        VRFY((H5Pclose(fapl2_id) >= 0), "H5Pclose succeeded");
+
+        for (i = 0; i < COLL_MD_READ_SIZE_NGROUPS; i++) {
+            HDsnprintf(name, sizeof(name), "group_%d", i);
+            group_id = H5Gopen2(file_id, name, gapl_id);
+            VRFY((group_id >= 0), "H5Gopen2 succeeded");
+
+            dset_id = H5Dopen2(group_id, "dset", dapl_id);
+            VRFY((dset_id >= 0), "H5Dopen2 succeeded");
+            HDmemset(read_buf, 0, sizeof(read_buf));
+            VRFY((H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, read_buf) >= 0),
+                 "H5Dread succeeded");
+            for (j = 0; j < COLL_MD_READ_SIZE_NELMTS; j++)
+                VRFY((read_buf[j] == i * COLL_MD_READ_SIZE_NELMTS + j), "data verification succeeded");
+
+            attr_id = H5Aopen(dset_id, COLL_MD_READ_SIZE_ATTRNAME, aapl_id);
+            VRFY((attr_id >= 0), "H5Aopen succeeded");
+            attr_val = -1;
+            VRFY((H5Aread(attr_id, H5T_NATIVE_INT, &attr_val) >= 0), "H5Aread succeeded");
+            VRFY((attr_val == i), "attribute verification succeeded");
+
+            VRFY((H5Aclose(attr_id) >= 0), "H5Aclose succeeded");
+            VRFY((H5Dclose(dset_id) >= 0), "H5Dclose succeeded");
+            VRFY((H5Gclose(group_id) >= 0), "H5Gclose succeeded");
+
+            if (pass == 1) {
+                HDsnprintf(name, sizeof(name), "new_group_%d", i);
+                group_id = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+                VRFY((group_id >= 0), "H5Gcreate2 succeeded");
+                VRFY((H5Gclose(group_id) >= 0), "H5Gclose succeeded");
+                VRFY((H5Fflush(file_id, H5F_SCOPE_GLOBAL) >= 0), "H5Fflush succeeded");
+            }
+        }
+
+        VRFY((H5Fclose(file_id) >= 0), "H5Fclose succeeded");
+    }
+
+    VRFY((H5Pclose(aapl_id) >= 0), "H5Pclose succeeded");
+    VRFY((H5Pclose(dapl_id) >= 0), "H5Pclose succeeded");
+    VRFY((H5Pclose(gapl_id) >= 0), "H5Pclose succeeded");
+    VRFY((H5Sclose(ascal_id) >= 0), "H5Sclose succeeded");
+    VRFY((H5Sclose(space_id) >= 0), "H5Sclose succeeded");
+    VRFY((H5Pclose(fapl_id) >= 0), "H5Pclose succeeded");
+}
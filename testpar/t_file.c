@@ -20,6 +20,7 @@
 #include "H5CXprivate.h" /* API Contexts                         */
 #include "H5Iprivate.h"
 #include "H5PBprivate.h"
+#include "H5VLprivate.h" /* Virtual Object Layer                 */
 
 /*
  * This file needs to access private information from the H5F package.
@@ -945,3 +946,249 @@ test_file_properties(void)
     VRFY((mpi_ret >= 0), "MPI_Info_free succeeded");
 
 } /* end test_file_properties() */
+
+/*
+ * Check whether the last flush of a file is still pending, from the
+ * metadata cache of the file.
+ */
+static hbool_t
+nonblocking_flush_pending(hid_t fid)
+{
+    H5F_t *     f;
+    H5AC_aux_t *aux_ptr;
+
+    f = (H5F_t *)H5VL_object_verify(fid, H5I_FILE);
+    VRFY((f != NULL), "H5VL_object_verify succeeded");
+    aux_ptr = (H5AC_aux_t *)f->shared->cache->aux_ptr;
+    VRFY((aux_ptr != NULL), "metadata cache has auxiliary structure");
+    VRFY((aux_ptr->nonblocking_flush == TRUE), "nonblocking flushes enabled in metadata cache");
+
+    /* Evictions are disabled exactly while a flush is pending */
+    VRFY((f->shared->cache->evictions_enabled == !aux_ptr->flush_pending), "evictions match pending flush");
+
+    return aux_ptr->flush_pending;
+}
+
+/*
+ * Test flushing and closing a file with nonblocking metadata flushes:
+ * each process creates groups and a dataset, the file is flushed, and the
+ * flush is completed by H5Fwait_flush(), by deleting an object, and by
+ * the next flush.  The file is closed with a flush still in progress, the
+ * close is completed by H5Fwait_flush() on another file, and the contents
+ * and size of the file are verified by process 0 and by all processes
+ * after reopening it.
+ */
+void
+test_nonblocking_flush(void)
+{
+    hid_t       fid     = H5I_INVALID_HID; /* HDF5 file ID */
+    hid_t       fapl_id = H5I_INVALID_HID; /* File access plist */
+    hid_t       gid     = H5I_INVALID_HID; /* Group ID */
+    hid_t       sid     = H5I_INVALID_HID; /* Dataspace ID */
+    hid_t       did     = H5I_INVALID_HID; /* Dataset ID */
+    hid_t       aux_fid = H5I_INVALID_HID; /* Second HDF5 file ID */
+    H5F_t *     f;
+    hbool_t     is_nonblocking;
+    const char *filename;
+    char        aux_filename[1024];
+    char        name[32];
+    hsize_t     dims[1];
+    int *       wbuf = NULL;
+    int *       rbuf = NULL;
+    int         round;
+    int         i;
+    htri_t      exists;
+    haddr_t     eoa;
+    hsize_t     filesize;
+    herr_t      ret;     /* Generic return value */
+    int         mpi_ret; /* MPI return value */
+
+    filename = (const char *)GetTestParameters();
+
+    /* set up MPI parameters */
+    mpi_ret = MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    VRFY((mpi_ret >= 0), "MPI_Comm_size succeeded");
+    mpi_ret = MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    VRFY((mpi_ret >= 0), "MPI_Comm_rank succeeded");
+
+    dims[0] = (hsize_t)(mpi_size * 64);
+    wbuf    = (int *)HDmalloc((size_t)dims[0] * sizeof(int));
+    VRFY((wbuf != NULL), "HDmalloc succeeded");
+    rbuf = (int *)HDmalloc((size_t)dims[0] * sizeof(int));
+    VRFY((rbuf != NULL), "HDmalloc succeeded");
+    for (i = 0; i < (int)dims[0]; i++)
+        wbuf[i] = i;
+
+    /* setup file access plist */
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl_id != H5I_INVALID_HID), "H5Pcreate");
+    ret = H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL);
+    VRFY((ret >= 0), "H5Pset_fapl_mpio");
+    ret = H5Pget_nonblocking_metadata_flush(fapl_id, &is_nonblocking);
+    VRFY((ret >= 0), "H5Pget_nonblocking_metadata_flush succeeded");
+    VRFY((is_nonblocking == FALSE), "nonblocking metadata flush is off by default");
+    ret = H5Pset_nonblocking_metadata_flush(fapl_id, TRUE);
+    VRFY((ret >= 0), "H5Pset_nonblocking_metadata_flush succeeded");
+
+    fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((fid != H5I_INVALID_HID), "H5Fcreate succeeded");
+    VRFY((nonblocking_flush_pending(fid) == FALSE), "no flush pending after create");
+
+    /* The setting is reported by the file's access plist */
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    fapl_id = H5Fget_access_plist(fid);
+    VRFY((fapl_id != H5I_INVALID_HID), "H5Fget_access_plist succeeded");
+    ret = H5Pget_nonblocking_metadata_flush(fapl_id, &is_nonblocking);
+    VRFY((ret >= 0), "H5Pget_nonblocking_metadata_flush succeeded");
+    VRFY((is_nonblocking == TRUE), "nonblocking metadata flush is set on file");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* A second file on the same communicator */
+    HDsnprintf(aux_filename, sizeof(aux_filename), "%s.aux", filename);
+    fapl_id = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl_id != H5I_INVALID_HID), "create_faccess_plist succeeded");
+    aux_fid = H5Fcreate(aux_filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    VRFY((aux_fid != H5I_INVALID_HID), "H5Fcreate succeeded");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    /* The dataset is written by all processes */
+    sid = H5Screate_simple(1, dims, NULL);
+    VRFY((sid != H5I_INVALID_HID), "H5Screate_simple succeeded");
+    did = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((did != H5I_INVALID_HID), "H5Dcreate2 succeeded");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    VRFY((ret >= 0), "H5Dwrite succeeded");
+    ret = H5Dclose(did);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+
+    for (round = 0; round < 3; round++) {
+        /* Give the flush enough metadata for every process to write some */
+        for (i = 0; i < 4 * mpi_size; i++) {
+            HDsnprintf(name, sizeof(name), "g_%d_%d", round, i);
+            gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            VRFY((gid != H5I_INVALID_HID), "H5Gcreate2 succeeded");
+            ret = H5Gclose(gid);
+            VRFY((ret >= 0), "H5Gclose succeeded");
+        } /* end for */
+
+        ret = H5Fflush(fid, H5F_SCOPE_GLOBAL);
+        VRFY((ret >= 0), "H5Fflush succeeded");
+        VRFY((nonblocking_flush_pending(fid) == TRUE), "flush pending after H5Fflush");
+
+        /* Creating metadata leaves the flush pending */
+        HDsnprintf(name, sizeof(name), "tmp_%d", round);
+        gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        VRFY((gid != H5I_INVALID_HID), "H5Gcreate2 succeeded");
+        ret = H5Gclose(gid);
+        VRFY((ret >= 0), "H5Gclose succeeded");
+        VRFY((nonblocking_flush_pending(fid) == TRUE), "flush pending after H5Gcreate2");
+
+        /* Complete the flush one of three ways */
+        if (round == 0) {
+            ret = H5Fwait_flush(fid);
+            VRFY((ret >= 0), "H5Fwait_flush succeeded");
+            VRFY((nonblocking_flush_pending(fid) == FALSE), "no flush pending after H5Fwait_flush");
+        } /* end if */
+        else if (round == 1) {
+            ret = H5Ldelete(fid, name, H5P_DEFAULT);
+            VRFY((ret >= 0), "H5Ldelete succeeded");
+            VRFY((nonblocking_flush_pending(fid) == FALSE), "no flush pending after H5Ldelete");
+        } /* end else-if */
+        else {
+            ret = H5Fflush(fid, H5F_SCOPE_GLOBAL);
+            VRFY((ret >= 0), "H5Fflush succeeded");
+            VRFY((nonblocking_flush_pending(fid) == TRUE), "flush pending after second H5Fflush");
+        } /* end else */
+    }     /* end for */
+
+    /* Waiting without a pending flush does nothing */
+    ret = H5Fwait_flush(fid);
+    VRFY((ret >= 0), "H5Fwait_flush succeeded");
+    ret = H5Fwait_flush(fid);
+    VRFY((ret >= 0), "H5Fwait_flush succeeded");
+
+    /* Close the file with a flush in progress */
+    gid = H5Gcreate2(fid, "last", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((gid != H5I_INVALID_HID), "H5Gcreate2 succeeded");
+    ret = H5Gclose(gid);
+    VRFY((ret >= 0), "H5Gclose succeeded");
+    ret = H5Sclose(sid);
+    VRFY((ret >= 0), "H5Sclose succeeded");
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Waiting on the other file completes the close */
+    ret = H5Fwait_flush(aux_fid);
+    VRFY((ret >= 0), "H5Fwait_flush succeeded");
+    ret = H5Fclose(aux_fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+
+    /* Without opening the file with MPI-IO again, the last group and the
+     * truncation are on disk
+     */
+    if (MAINPROCESS) {
+        fid = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT);
+        VRFY((fid != H5I_INVALID_HID), "H5Fopen succeeded");
+        exists = H5Lexists(fid, "last", H5P_DEFAULT);
+        VRFY((exists == TRUE), "group exists");
+        ret = H5Fget_eoa(fid, &eoa);
+        VRFY((ret >= 0), "H5Fget_eoa succeeded");
+        ret = H5Fget_filesize(fid, &filesize);
+        VRFY((ret >= 0), "H5Fget_filesize succeeded");
+        VRFY((filesize == (hsize_t)eoa), "file truncated to EOA");
+        ret = H5Fclose(fid);
+        VRFY((ret >= 0), "H5Fclose succeeded");
+
+        HDremove(aux_filename);
+    } /* end if */
+    mpi_ret = MPI_Barrier(MPI_COMM_WORLD);
+    VRFY((mpi_ret == MPI_SUCCESS), "MPI_Barrier succeeded");
+
+    /* Reopen the file and verify it */
+    fapl_id = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, facc_type);
+    VRFY((fapl_id != H5I_INVALID_HID), "create_faccess_plist succeeded");
+    fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id);
+    VRFY((fid != H5I_INVALID_HID), "H5Fopen succeeded");
+
+    /* H5Fget_eoa() is only for SWMR drivers */
+    f = (H5F_t *)H5VL_object_verify(fid, H5I_FILE);
+    VRFY((f != NULL), "H5VL_object_verify succeeded");
+    eoa = H5F_get_eoa(f, H5FD_MEM_DEFAULT);
+    VRFY((H5F_addr_defined(eoa)), "H5F_get_eoa succeeded");
+    ret = H5Fget_filesize(fid, &filesize);
+    VRFY((ret >= 0), "H5Fget_filesize succeeded");
+    VRFY((filesize == (hsize_t)eoa), "file truncated to EOA");
+
+    for (round = 0; round < 3; round++) {
+        for (i = 0; i < 4 * mpi_size; i++) {
+            HDsnprintf(name, sizeof(name), "g_%d_%d", round, i);
+            exists = H5Lexists(fid, name, H5P_DEFAULT);
+            VRFY((exists == TRUE), "group exists");
+        } /* end for */
+        HDsnprintf(name, sizeof(name), "tmp_%d", round);
+        exists = H5Lexists(fid, name, H5P_DEFAULT);
+        VRFY((exists == (round != 1)), "temporary group exists unless deleted");
+    } /* end for */
+    exists = H5Lexists(fid, "last", H5P_DEFAULT);
+    VRFY((exists == TRUE), "group exists");
+
+    did = H5Dopen2(fid, "dset", H5P_DEFAULT);
+    VRFY((did != H5I_INVALID_HID), "H5Dopen2 succeeded");
+    HDmemset(rbuf, 0, (size_t)dims[0] * sizeof(int));
+    ret = H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf);
+    VRFY((ret >= 0), "H5Dread succeeded");
+    VRFY((HDmemcmp(wbuf, rbuf, (size_t)dims[0] * sizeof(int)) == 0), "dataset data verified");
+    ret = H5Dclose(did);
+    VRFY((ret >= 0), "H5Dclose succeeded");
+
+    ret = H5Fclose(fid);
+    VRFY((ret >= 0), "H5Fclose succeeded");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+} /* end test_nonblocking_flush() */
@@ -90,6 +90,22 @@ static void test_read_cmpd_filtered_dataset_type_conversion_shared(void);
 #if MPI_VERSION >= 3
 /* Other miscellaneous tests */
 static void test_shrinking_growing_chunks(void);
+static void test_contiguous_chunk_alloc(void);
+static void test_filter_threads(void);
+
+static size_t filter_threads_corrupt(unsigned int filter_flags, size_t nelmts, const unsigned int *values,
+                                     size_t nbytes, size_t *buf_size, void **buf);
+
+/* Filter corrupting the chunks after their checksum when writing */
+const H5Z_class2_t H5Z_FILTER_THREADS_CORRUPT[1] = {{
+    H5Z_CLASS_T_VERS,          /* H5Z_class_t version */
+    FILTER_THREADS_CORRUPT_ID, /* Filter id number        */
+    1, 1,                      /* Encoding and decoding enabled */
+    "filter_threads_corrupt",  /* Filter name for debugging    */
+    NULL,                      /* The "can apply" callback     */
+    NULL,                      /* The "set local" callback     */
+    filter_threads_corrupt,    /* The actual filter function    */
+}};
 #endif
 
 /*
@@ -146,6 +162,8 @@ static void (*tests[])(void) = {
 #if MPI_VERSION >= 3
     test_write_parallel_read_serial,
     test_shrinking_growing_chunks,
+    test_contiguous_chunk_alloc,
+    test_filter_threads,
 #endif
 };
 
@@ -6053,6 +6071,397 @@ test_shrinking_growing_chunks(void)
 
     return;
 }
+
+/*
+ * Tests that the filtered chunks written by each process in a
+ * collective write are allocated next to each other in the file,
+ * both when the chunks are first written and when they are
+ * rewritten with data that filters to a different size.
+ */
+static void
+test_contiguous_chunk_alloc(void)
+{
+    double * data     = NULL;
+    double * read_buf = NULL;
+    haddr_t *addrs    = NULL;
+    hsize_t *sizes    = NULL;
+    hsize_t dataset_dims[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+    hsize_t chunk_dims[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+    hsize_t sel_dims[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+    hsize_t start[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+    hsize_t stride[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+    hsize_t count[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+    hsize_t block[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+    size_t  i, j, k, data_size, num_chunks;
+    hid_t   file_id = -1, dset_id = -1, plist_id = -1;
+    hid_t   filespace = -1, memspace = -1;
+
+    if (MAINPROCESS)
+        HDputs("Testing contiguous allocation of filtered chunks");
+
+    CHECK_CUR_FILTER_AVAIL();
+
+    /* Set up file access property list with parallel I/O access */
+    plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((plist_id >= 0), "FAPL creation succeeded");
+
+    VRFY((H5Pset_fapl_mpio(plist_id, comm, info) >= 0), "Set FAPL MPIO succeeded");
+
+    VRFY((H5Pset_libver_bounds(plist_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) >= 0),
+         "Set libver bounds succeeded");
+
+    file_id = H5Fopen(filenames[0], H5F_ACC_RDWR, plist_id);
+    VRFY((file_id >= 0), "Test file open succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "FAPL close succeeded");
+
+    /* Create the dataspace for the dataset */
+    dataset_dims[0] = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_NROWS;
+    dataset_dims[1] = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_NCOLS;
+    chunk_dims[0]   = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NROWS;
+    chunk_dims[1]   = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NCOLS;
+    sel_dims[0]     = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NROWS;
+    sel_dims[1]     = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_NCOLS;
+
+    filespace = H5Screate_simple(CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS, dataset_dims, NULL);
+    VRFY((filespace >= 0), "File dataspace creation succeeded");
+
+    memspace = H5Screate_simple(CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS, sel_dims, NULL);
+    VRFY((memspace >= 0), "Memory dataspace creation succeeded");
+
+    /* Create chunked dataset */
+    plist_id = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((plist_id >= 0), "DCPL creation succeeded");
+
+    VRFY((H5Pset_chunk(plist_id, CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS, chunk_dims) >= 0), "Chunk size set");
+
+    /* Add test filter to the pipeline */
+    VRFY((set_dcpl_filter(plist_id) >= 0), "Filter set");
+
+    dset_id = H5Dcreate2(file_id, CONTIGUOUS_CHUNK_ALLOC_DATASET_NAME, H5T_NATIVE_DOUBLE, filespace,
+                         H5P_DEFAULT, plist_id, H5P_DEFAULT);
+    VRFY((dset_id >= 0), "Dataset creation succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "DCPL close succeeded");
+    VRFY((H5Sclose(filespace) >= 0), "File dataspace close succeeded");
+
+    /*
+     * Each process writes a full row of chunks
+     */
+    num_chunks = (size_t)CONTIGUOUS_CHUNK_ALLOC_NCOLS / (size_t)CONTIGUOUS_CHUNK_ALLOC_CH_NCOLS;
+    count[0]   = 1;
+    count[1]   = (hsize_t)num_chunks;
+    stride[0]  = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NROWS;
+    stride[1]  = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NCOLS;
+    block[0]   = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NROWS;
+    block[1]   = (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NCOLS;
+    start[0]   = ((hsize_t)mpi_rank * (hsize_t)CONTIGUOUS_CHUNK_ALLOC_CH_NROWS * count[0]);
+    start[1]   = 0;
+
+    filespace = H5Dget_space(dset_id);
+    VRFY((filespace >= 0), "File dataspace retrieval succeeded");
+
+    VRFY((H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, stride, count, block) >= 0),
+         "Hyperslab selection succeeded");
+
+    /* Create property list for collective dataset write */
+    plist_id = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((plist_id >= 0), "DXPL creation succeeded");
+
+    VRFY((H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE) >= 0), "Set DXPL MPIO succeeded");
+
+    data_size = sel_dims[0] * sel_dims[1] * sizeof(double);
+
+    data = (double *)HDcalloc(1, data_size);
+    VRFY((NULL != data), "HDcalloc succeeded");
+
+    read_buf = (double *)HDcalloc(1, data_size);
+    VRFY((NULL != read_buf), "HDcalloc succeeded");
+
+    addrs = (haddr_t *)HDcalloc(num_chunks, sizeof(haddr_t));
+    VRFY((NULL != addrs), "HDcalloc succeeded");
+
+    sizes = (hsize_t *)HDcalloc(num_chunks, sizeof(hsize_t));
+    VRFY((NULL != sizes), "HDcalloc succeeded");
+
+    /* Write random data first, then data that filters to a different size */
+    for (i = 0; i < 2; i++) {
+        hsize_t offset[CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS];
+
+        for (j = 0; j < data_size / sizeof(*data); j++)
+            data[j] = i ? (double)j : (double)(rand() / (double)(RAND_MAX / (double)1.0L));
+
+        VRFY((H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, data) >= 0),
+             "Dataset write succeeded");
+
+        VRFY((H5Dread(dset_id, H5T_NATIVE_DOUBLE, memspace, filespace, plist_id, read_buf) >= 0),
+             "Dataset read succeeded");
+        VRFY((0 == HDmemcmp(data, read_buf, data_size)), "Data verification succeeded");
+
+        /* Check that this process' chunks form a single contiguous range in the file */
+        offset[0] = start[0];
+        for (j = 0; j < num_chunks; j++) {
+            offset[1] = (hsize_t)j * chunk_dims[1];
+            VRFY((H5Dget_chunk_info_by_coord(dset_id, offset, NULL, &addrs[j], &sizes[j]) >= 0),
+                 "Chunk info retrieval succeeded");
+            VRFY((addrs[j] != HADDR_UNDEF && sizes[j] > 0), "Chunk is allocated");
+        }
+
+        for (j = 0; j < num_chunks; j++) {
+            hbool_t has_next = TRUE;
+
+            /* Every chunk but the last one in the file must be followed by another one */
+            for (k = 0; k < num_chunks; k++)
+                if (addrs[k] > addrs[j])
+                    has_next = FALSE;
+            for (k = 0; k < num_chunks; k++)
+                if (addrs[k] == addrs[j] + sizes[j])
+                    has_next = TRUE;
+            VRFY(has_next, "Chunks are contiguous in the file");
+        }
+    }
+
+    if (sizes)
+        HDfree(sizes);
+    if (addrs)
+        HDfree(addrs);
+    if (read_buf)
+        HDfree(read_buf);
+    if (data)
+        HDfree(data);
+
+    VRFY((H5Dclose(dset_id) >= 0), "Dataset close succeeded");
+    VRFY((H5Sclose(filespace) >= 0), "File dataspace close succeeded");
+    VRFY((H5Sclose(memspace) >= 0), "Memory dataspace close succeeded");
+    VRFY((H5Pclose(plist_id) >= 0), "DXPL close succeeded");
+    VRFY((H5Fclose(file_id) >= 0), "File close succeeded");
+
+    return;
+}
+
+/*
+ * Flips the first byte of the chunks when writing them, so that their
+ * Fletcher32 checksum fails when they are read.
+ */
+static size_t
+filter_threads_corrupt(unsigned int filter_flags, size_t H5_ATTR_UNUSED nelmts,
+                       const unsigned int H5_ATTR_UNUSED *values, size_t nbytes,
+                       size_t H5_ATTR_UNUSED *buf_size, void **buf)
+{
+    if (!(filter_flags & H5Z_FLAG_REVERSE))
+        *(unsigned char *)*buf ^= 0xff;
+
+    return nbytes;
+}
+
+/*
+ * Tests collective writes and reads of filtered chunks with the
+ * filter pipeline running on several threads in each process, with
+ * both linked-chunk and multi-chunk I/O. The second write of each
+ * dataset only modifies part of the chunks, so they are unfiltered
+ * on the threads too. Finally, reading chunks whose checksum fails
+ * on the threads must fail cleanly.
+ */
+static void
+test_filter_threads(void)
+{
+    int *    data     = NULL;
+    int *    read_buf = NULL;
+    unsigned nthreads = 0;
+    hsize_t  dataset_dims[FILTER_THREADS_DATASET_DIMS];
+    hsize_t  chunk_dims[FILTER_THREADS_DATASET_DIMS];
+    hsize_t  sel_dims[FILTER_THREADS_DATASET_DIMS];
+    hsize_t  start[FILTER_THREADS_DATASET_DIMS];
+    hsize_t  count[FILTER_THREADS_DATASET_DIMS];
+    size_t   i, j, k, data_size;
+    hid_t    file_id = -1, dset_id = -1, plist_id = -1, dxpl_id = -1;
+    hid_t    filespace = -1, memspace = -1;
+    herr_t   ret;
+    char     dset_name[32];
+
+    if (MAINPROCESS)
+        HDputs("Testing filter pipeline running on several threads");
+
+    CHECK_CUR_FILTER_AVAIL();
+
+    /* Set up file access property list with parallel I/O access and filter threads */
+    plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((plist_id >= 0), "FAPL creation succeeded");
+
+    VRFY((H5Pset_fapl_mpio(plist_id, comm, info) >= 0), "Set FAPL MPIO succeeded");
+
+    VRFY((H5Pset_libver_bounds(plist_id, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) >= 0),
+         "Set libver bounds succeeded");
+
+    H5E_BEGIN_TRY
+    {
+        ret = H5Pset_coll_filter_threads(plist_id, 0);
+    }
+    H5E_END_TRY;
+    VRFY((ret < 0), "Zero filter threads rejected");
+    VRFY((H5Pset_coll_filter_threads(plist_id, FILTER_THREADS_NTHREADS) >= 0),
+         "Set filter threads succeeded");
+
+    file_id = H5Fopen(filenames[0], H5F_ACC_RDWR, plist_id);
+    VRFY((file_id >= 0), "Test file open succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "FAPL close succeeded");
+
+    /* Check that the setting is kept by the file */
+    plist_id = H5Fget_access_plist(file_id);
+    VRFY((plist_id >= 0), "H5Fget_access_plist succeeded");
+    VRFY((H5Pget_coll_filter_threads(plist_id, &nthreads) >= 0), "Get filter threads succeeded");
+    VRFY((nthreads == FILTER_THREADS_NTHREADS), "Filter threads retrieved");
+    VRFY((H5Pclose(plist_id) >= 0), "FAPL close succeeded");
+
+    dataset_dims[0] = (hsize_t)FILTER_THREADS_NROWS;
+    dataset_dims[1] = (hsize_t)FILTER_THREADS_NCOLS;
+    chunk_dims[0]   = (hsize_t)FILTER_THREADS_CH_NROWS;
+    chunk_dims[1]   = (hsize_t)FILTER_THREADS_CH_NCOLS;
+
+    data_size = (size_t)FILTER_THREADS_NROWS * (size_t)FILTER_THREADS_NCOLS * sizeof(int);
+
+    data = (int *)HDcalloc(1, data_size);
+    VRFY((NULL != data), "HDcalloc succeeded");
+
+    read_buf = (int *)HDcalloc(1, data_size);
+    VRFY((NULL != read_buf), "HDcalloc succeeded");
+
+    dxpl_id = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl_id >= 0), "DXPL creation succeeded");
+
+    VRFY((H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) >= 0), "Set DXPL MPIO succeeded");
+
+    /* Once with linked-chunk I/O, once with multi-chunk I/O */
+    for (i = 0; i < 2; i++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "%s_%d", FILTER_THREADS_DATASET_NAME, (int)i);
+
+        VRFY((H5Pset_dxpl_mpio_chunk_opt(dxpl_id, i ? H5FD_MPIO_CHUNK_MULTI_IO : H5FD_MPIO_CHUNK_ONE_IO) >=
+              0),
+             "Set chunk I/O optimization succeeded");
+
+        filespace = H5Screate_simple(FILTER_THREADS_DATASET_DIMS, dataset_dims, NULL);
+        VRFY((filespace >= 0), "File dataspace creation succeeded");
+
+        plist_id = H5Pcreate(H5P_DATASET_CREATE);
+        VRFY((plist_id >= 0), "DCPL creation succeeded");
+
+        VRFY((H5Pset_chunk(plist_id, FILTER_THREADS_DATASET_DIMS, chunk_dims) >= 0), "Chunk size set");
+
+        /* Add test filter to the pipeline */
+        VRFY((set_dcpl_filter(plist_id) >= 0), "Filter set");
+
+        dset_id =
+            H5Dcreate2(file_id, dset_name, H5T_NATIVE_INT, filespace, H5P_DEFAULT, plist_id, H5P_DEFAULT);
+        VRFY((dset_id >= 0), "Dataset creation succeeded");
+
+        VRFY((H5Pclose(plist_id) >= 0), "DCPL close succeeded");
+
+        /* Each process writes its band of rows, then only the first row of the band */
+        for (j = 0; j < 2; j++) {
+            sel_dims[0] = j ? 1 : (hsize_t)FILTER_THREADS_CH_NROWS;
+            sel_dims[1] = (hsize_t)FILTER_THREADS_NCOLS;
+            start[0]    = (hsize_t)mpi_rank * (hsize_t)FILTER_THREADS_CH_NROWS;
+            start[1]    = 0;
+            count[0]    = sel_dims[0];
+            count[1]    = sel_dims[1];
+
+            VRFY((H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, count, NULL) >= 0),
+                 "Hyperslab selection succeeded");
+
+            memspace = H5Screate_simple(FILTER_THREADS_DATASET_DIMS, sel_dims, NULL);
+            VRFY((memspace >= 0), "Memory dataspace creation succeeded");
+
+            for (k = 0; k < sel_dims[0] * sel_dims[1]; k++)
+                data[k] = j ? -(int)(start[0] * sel_dims[1] + k) - 1 : (int)(start[0] * sel_dims[1] + k);
+
+            VRFY((H5Dwrite(dset_id, H5T_NATIVE_INT, memspace, filespace, dxpl_id, data) >= 0),
+                 "Dataset write succeeded");
+
+            VRFY((H5Sclose(memspace) >= 0), "Memory dataspace close succeeded");
+        }
+
+        /* Read the whole dataset back and verify it */
+        VRFY((H5Sselect_all(filespace) >= 0), "Select all succeeded");
+
+        VRFY((H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, filespace, dxpl_id, read_buf) >= 0),
+             "Dataset read succeeded");
+
+        for (k = 0; k < (size_t)FILTER_THREADS_NROWS * (size_t)FILTER_THREADS_NCOLS; k++) {
+            size_t row      = k / (size_t)FILTER_THREADS_NCOLS;
+            int    expected = (row % (size_t)FILTER_THREADS_CH_NROWS) ? (int)k : -(int)k - 1;
+
+            VRFY((read_buf[k] == expected), "Data verification succeeded");
+        }
+
+        VRFY((H5Dclose(dset_id) >= 0), "Dataset close succeeded");
+        VRFY((H5Sclose(filespace) >= 0), "File dataspace close succeeded");
+    }
+
+    /* Corrupt the chunks after their checksum, so that the checksum
+     * filter fails and reports errors on all the threads when reading
+     */
+    VRFY((H5Zregister(H5Z_FILTER_THREADS_CORRUPT) >= 0), "Filter registration succeeded");
+
+    HDsnprintf(dset_name, sizeof(dset_name), "%s_corrupt", FILTER_THREADS_DATASET_NAME);
+
+    filespace = H5Screate_simple(FILTER_THREADS_DATASET_DIMS, dataset_dims, NULL);
+    VRFY((filespace >= 0), "File dataspace creation succeeded");
+
+    plist_id = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((plist_id >= 0), "DCPL creation succeeded");
+
+    VRFY((H5Pset_chunk(plist_id, FILTER_THREADS_DATASET_DIMS, chunk_dims) >= 0), "Chunk size set");
+    VRFY((H5Pset_fletcher32(plist_id) >= 0), "Fletcher32 filter set");
+    VRFY((H5Pset_filter(plist_id, FILTER_THREADS_CORRUPT_ID, H5Z_FLAG_MANDATORY, 0, NULL) >= 0),
+         "Corrupting filter set");
+
+    dset_id = H5Dcreate2(file_id, dset_name, H5T_NATIVE_INT, filespace, H5P_DEFAULT, plist_id, H5P_DEFAULT);
+    VRFY((dset_id >= 0), "Dataset creation succeeded");
+
+    VRFY((H5Pclose(plist_id) >= 0), "DCPL close succeeded");
+
+    sel_dims[0] = (hsize_t)FILTER_THREADS_CH_NROWS;
+    sel_dims[1] = (hsize_t)FILTER_THREADS_NCOLS;
+    start[0]    = (hsize_t)mpi_rank * (hsize_t)FILTER_THREADS_CH_NROWS;
+    start[1]    = 0;
+
+    VRFY((H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start, NULL, sel_dims, NULL) >= 0),
+         "Hyperslab selection succeeded");
+
+    memspace = H5Screate_simple(FILTER_THREADS_DATASET_DIMS, sel_dims, NULL);
+    VRFY((memspace >= 0), "Memory dataspace creation succeeded");
+
+    VRFY((H5Dwrite(dset_id, H5T_NATIVE_INT, memspace, filespace, dxpl_id, data) >= 0),
+         "Dataset write succeeded");
+
+    VRFY((H5Sclose(memspace) >= 0), "Memory dataspace close succeeded");
+
+    VRFY((H5Sselect_all(filespace) >= 0), "Select all succeeded");
+
+    H5E_BEGIN_TRY
+    {
+        ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, filespace, dxpl_id, read_buf);
+    }
+    H5E_END_TRY;
+    VRFY((ret < 0), "Dataset read of corrupted chunks failed");
+    VRFY((H5Eget_num(H5E_DEFAULT) > 0), "Read failure reported on the error stack");
+
+    VRFY((H5Dclose(dset_id) >= 0), "Dataset close succeeded");
+    VRFY((H5Sclose(filespace) >= 0), "File dataspace close succeeded");
+
+    VRFY((H5Zunregister(FILTER_THREADS_CORRUPT_ID) >= 0), "Filter unregistration succeeded");
+
+    if (read_buf)
+        HDfree(read_buf);
+    if (data)
+        HDfree(data);
+
+    VRFY((H5Pclose(dxpl_id) >= 0), "DXPL close succeeded");
+    VRFY((H5Fclose(file_id) >= 0), "File close succeeded");
+
+    return;
+}
 #endif
 
 int
@@ -383,4 +383,22 @@ typedef struct {
 #define SHRINKING_GROWING_CHUNKS_CH_NCOLS     (SHRINKING_GROWING_CHUNKS_NCOLS / mpi_size)
 #define SHRINKING_GROWING_CHUNKS_NLOOPS       20
 
+/* Defines for the contiguous chunk allocation test */
+#define CONTIGUOUS_CHUNK_ALLOC_DATASET_NAME "contiguous_chunk_alloc_test"
+#define CONTIGUOUS_CHUNK_ALLOC_DATASET_DIMS 2
+#define CONTIGUOUS_CHUNK_ALLOC_NROWS        (mpi_size * DIM0_SCALE_FACTOR)
+#define CONTIGUOUS_CHUNK_ALLOC_NCOLS        (mpi_size * DIM1_SCALE_FACTOR)
+#define CONTIGUOUS_CHUNK_ALLOC_CH_NROWS     (CONTIGUOUS_CHUNK_ALLOC_NROWS / mpi_size)
+#define CONTIGUOUS_CHUNK_ALLOC_CH_NCOLS     (CONTIGUOUS_CHUNK_ALLOC_NCOLS / mpi_size)
+
+/* Defines for the filter threads test */
+#define FILTER_THREADS_DATASET_NAME "filter_threads_test"
+#define FILTER_THREADS_DATASET_DIMS 2
+#define FILTER_THREADS_NTHREADS     4
+#define FILTER_THREADS_NROWS        (mpi_size * DIM0_SCALE_FACTOR)
+#define FILTER_THREADS_NCOLS        (8 * DIM1_SCALE_FACTOR)
+#define FILTER_THREADS_CH_NROWS     (DIM0_SCALE_FACTOR)
+#define FILTER_THREADS_CH_NCOLS     (DIM1_SCALE_FACTOR)
+#define FILTER_THREADS_CORRUPT_ID   310
+
 #endif /* TEST_PARALLEL_FILTERS_H_ */
@@ -0,0 +1,444 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Tests for the subfiling VFD: a file is written collectively and
+ * independently by all processes, read back collectively with a different
+ * decomposition, and finally opened and checked by a single process.
+ */
+
+#include "testpar.h"
+
+#define FILENAME_BUF_SIZE 1024
+
+/* A small stripe unit, so that rows and chunks span several subfiles */
+#define SUBF_STRIPE_SIZE       4096
+#define SUBF_RANKS_PER_SUBFILE 2
+
+#define SUBF_ROWS 8   /* Rows written by each process */
+#define SUBF_COLS 300 /* Columns of the datasets      */
+
+/* The values of the datasets */
+#define SUBF_BAND_VALUE(r, c)    ((int)((r)*1000 + (c)))
+#define SUBF_STRIDED_VALUE(r, c) (-(int)((r)*1000 + (c)))
+#define SUBF_INDEP_VALUE(r, c)   ((int)((r)*1000 + (c) + 7))
+#define SUBF_CHUNKED_VALUE(r, c) ((int)((r) + (c)*3))
+
+const char *FILENAME[] = {"t_subfiling", NULL};
+char        filename[FILENAME_BUF_SIZE];
+
+int      nerrors = 0;
+int      mpi_size, mpi_rank;
+MPI_Comm comm = MPI_COMM_WORLD;
+MPI_Info info = MPI_INFO_NULL;
+
+/*-------------------------------------------------------------------------
+ * Function:    create_fapl
+ *
+ * Purpose:     Creates a file access property list for the subfiling
+ *              driver, with collective metadata writes.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hid_t
+create_fapl(MPI_Comm fapl_comm, int ranks_per_subfile)
+{
+    hid_t fapl;
+
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_fapl_subfiling(fapl, fapl_comm, info, SUBF_STRIPE_SIZE, ranks_per_subfile) >= 0),
+         "H5Pset_fapl_subfiling succeeded");
+    VRFY((H5Pset_coll_metadata_write(fapl, TRUE) >= 0), "H5Pset_coll_metadata_write succeeded");
+
+    return fapl;
+} /* end create_fapl() */
+
+/*-------------------------------------------------------------------------
+ * Function:    check_fapl
+ *
+ * Purpose:     Checks that the subfiling properties are returned as set.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+check_fapl(void)
+{
+    hid_t    fapl;
+    MPI_Comm fapl_comm         = MPI_COMM_NULL;
+    MPI_Info fapl_info         = MPI_INFO_NULL;
+    size_t   stripe_size       = 0;
+    int      ranks_per_subfile = -1;
+    int      comm_size         = 0;
+
+    if (MAINPROCESS)
+        HDputs("Testing subfiling file access properties");
+
+    fapl = create_fapl(comm, SUBF_RANKS_PER_SUBFILE);
+    VRFY((H5Pget_fapl_subfiling(fapl, &fapl_comm, &fapl_info, &stripe_size, &ranks_per_subfile) >= 0),
+         "H5Pget_fapl_subfiling succeeded");
+    VRFY((stripe_size == SUBF_STRIPE_SIZE), "stripe size is correct");
+    VRFY((ranks_per_subfile == SUBF_RANKS_PER_SUBFILE), "processes per subfile are correct");
+    VRFY((MPI_Comm_size(fapl_comm, &comm_size) == MPI_SUCCESS), "MPI_Comm_size succeeded");
+    VRFY((comm_size == mpi_size), "communicator is correct");
+    MPI_Comm_free(&fapl_comm);
+    if (MPI_INFO_NULL != fapl_info)
+        MPI_Info_free(&fapl_info);
+    VRFY((H5Pclose(fapl) >= 0), "H5Pclose succeeded");
+
+    /* The default stripe unit is used for a zero size */
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    VRFY((fapl >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_fapl_subfiling(fapl, comm, info, 0, 0) >= 0), "H5Pset_fapl_subfiling succeeded");
+    VRFY((H5Pget_fapl_subfiling(fapl, NULL, NULL, &stripe_size, &ranks_per_subfile) >= 0),
+         "H5Pget_fapl_subfiling succeeded");
+    VRFY((stripe_size == H5FD_SUBFILING_STRIPE_SIZE_DEF), "default stripe size is correct");
+    VRFY((ranks_per_subfile == 0), "one subfile per node is correct");
+    VRFY((H5Pclose(fapl) >= 0), "H5Pclose succeeded");
+} /* end check_fapl() */
+
+/*-------------------------------------------------------------------------
+ * Function:    write_file
+ *
+ * Purpose:     Creates the test file with all processes.  Each process
+ *              writes a band of rows of the "band" and "chunked" datasets
+ *              and every mpi_size'th row of the "strided" dataset
+ *              collectively, the latter from every other element of its
+ *              buffer, and a band of the "indep" dataset independently.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+write_file(void)
+{
+    hid_t   fapl, fid, dcpl, dxpl, fspace, mspace, dset;
+    hsize_t dims[2]   = {(hsize_t)mpi_size * SUBF_ROWS, SUBF_COLS};
+    hsize_t chunk[2]  = {SUBF_ROWS, SUBF_COLS};
+    hsize_t start[2]  = {(hsize_t)mpi_rank * SUBF_ROWS, 0};
+    hsize_t stride[2] = {1, 1};
+    hsize_t count[2]  = {SUBF_ROWS, SUBF_COLS};
+    hsize_t mdims[1]  = {2 * SUBF_ROWS * SUBF_COLS};
+    int *   buf;
+    size_t  i, j;
+
+    H5D_mpio_actual_io_mode_t io_mode = H5D_MPIO_NO_COLLECTIVE;
+
+    if (MAINPROCESS)
+        HDputs("Testing collective and independent writes to subfiles");
+
+    buf = (int *)HDcalloc(2 * SUBF_ROWS * SUBF_COLS, sizeof(int));
+    VRFY((buf != NULL), "HDcalloc succeeded");
+
+    fapl = create_fapl(comm, SUBF_RANKS_PER_SUBFILE);
+    fid  = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    VRFY((fid >= 0), "H5Fcreate succeeded");
+    VRFY((H5Pclose(fapl) >= 0), "H5Pclose succeeded");
+
+    fspace = H5Screate_simple(2, dims, NULL);
+    VRFY((fspace >= 0), "H5Screate_simple succeeded");
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    VRFY((dcpl >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_chunk(dcpl, 2, chunk) >= 0), "H5Pset_chunk succeeded");
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE) >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    /* Band of contiguous rows, collectively */
+    for (i = 0; i < SUBF_ROWS; i++)
+        for (j = 0; j < SUBF_COLS; j++)
+            buf[i * SUBF_COLS + j] = SUBF_BAND_VALUE(start[0] + i, j);
+    dset = H5Dcreate2(fid, "band", H5T_NATIVE_INT, fspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+    VRFY((H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, stride, count, NULL) >= 0),
+         "H5Sselect_hyperslab succeeded");
+    mspace = H5Screate_simple(2, count, NULL);
+    VRFY((mspace >= 0), "H5Screate_simple succeeded");
+    VRFY((H5Dwrite(dset, H5T_NATIVE_INT, mspace, fspace, dxpl, buf) >= 0), "H5Dwrite succeeded");
+    VRFY((H5Pget_mpio_actual_io_mode(dxpl, &io_mode) >= 0), "H5Pget_mpio_actual_io_mode succeeded");
+    VRFY((io_mode == H5D_MPIO_CONTIGUOUS_COLLECTIVE), "write was collective");
+    VRFY((H5Dclose(dset) >= 0), "H5Dclose succeeded");
+
+    /* The same band in a chunked dataset, collectively */
+    for (i = 0; i < SUBF_ROWS; i++)
+        for (j = 0; j < SUBF_COLS; j++)
+            buf[i * SUBF_COLS + j] = SUBF_CHUNKED_VALUE(start[0] + i, j);
+    dset = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, fspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+    VRFY((H5Dwrite(dset, H5T_NATIVE_INT, mspace, fspace, dxpl, buf) >= 0), "H5Dwrite succeeded");
+    VRFY((H5Dclose(dset) >= 0), "H5Dclose succeeded");
+
+    /* The same band, independently */
+    for (i = 0; i < SUBF_ROWS; i++)
+        for (j = 0; j < SUBF_COLS; j++)
+            buf[i * SUBF_COLS + j] = SUBF_INDEP_VALUE(start[0] + i, j);
+    dset = H5Dcreate2(fid, "indep", H5T_NATIVE_INT, fspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+    VRFY((H5Dwrite(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, buf) >= 0), "H5Dwrite succeeded");
+    VRFY((H5Dclose(dset) >= 0), "H5Dclose succeeded");
+    VRFY((H5Sclose(mspace) >= 0), "H5Sclose succeeded");
+
+    /* Interleaved rows from every other element of the buffer, collectively */
+    start[0]  = (hsize_t)mpi_rank;
+    stride[0] = (hsize_t)mpi_size;
+    for (i = 0; i < SUBF_ROWS; i++)
+        for (j = 0; j < SUBF_COLS; j++)
+            buf[2 * (i * SUBF_COLS + j)] = SUBF_STRIDED_VALUE(start[0] + i * stride[0], j);
+    dset = H5Dcreate2(fid, "strided", H5T_NATIVE_INT, fspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dcreate2 succeeded");
+    VRFY((H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, stride, count, NULL) >= 0),
+         "H5Sselect_hyperslab succeeded");
+    mspace = H5Screate_simple(1, mdims, NULL);
+    VRFY((mspace >= 0), "H5Screate_simple succeeded");
+    start[0]  = 0;
+    stride[0] = 2;
+    count[0]  = SUBF_ROWS * SUBF_COLS;
+    VRFY((H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, stride, count, NULL) >= 0),
+         "H5Sselect_hyperslab succeeded");
+    VRFY((H5Dwrite(dset, H5T_NATIVE_INT, mspace, fspace, dxpl, buf) >= 0), "H5Dwrite succeeded");
+    VRFY((H5Dclose(dset) >= 0), "H5Dclose succeeded");
+
+    VRFY((H5Sclose(mspace) >= 0), "H5Sclose succeeded");
+    VRFY((H5Sclose(fspace) >= 0), "H5Sclose succeeded");
+    VRFY((H5Pclose(dxpl) >= 0), "H5Pclose succeeded");
+    VRFY((H5Pclose(dcpl) >= 0), "H5Pclose succeeded");
+    VRFY((H5Fclose(fid) >= 0), "H5Fclose succeeded");
+
+    HDfree(buf);
+} /* end write_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    check_subfiles
+ *
+ * Purpose:     Checks that the map file and one subfile per group of
+ *              processes were created.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+check_subfiles(void)
+{
+    char     name[FILENAME_BUF_SIZE + 64];
+    unsigned nsubfiles = (unsigned)((mpi_size + SUBF_RANKS_PER_SUBFILE - 1) / SUBF_RANKS_PER_SUBFILE);
+    unsigned u;
+
+    if (MAINPROCESS) {
+        HDputs("Testing subfile layout");
+
+        VRFY((HDaccess(filename, F_OK) == 0), "map file exists");
+        for (u = 0; u < nsubfiles; u++) {
+            HDsnprintf(name, sizeof(name), "%s.subfile_%u_of_%u", filename, u, nsubfiles);
+            VRFY((HDaccess(name, F_OK) == 0), "subfile exists");
+        }
+        HDsnprintf(name, sizeof(name), "%s.subfile_%u_of_%u", filename, nsubfiles, nsubfiles + 1);
+        VRFY((HDaccess(name, F_OK) != 0), "no extra subfile");
+    }
+
+    MPI_Barrier(comm);
+} /* end check_subfiles() */
+
+/*-------------------------------------------------------------------------
+ * Function:    verify_dataset
+ *
+ * Purpose:     Reads rows [FIRST, FIRST + NROWS) of dataset NAME and
+ *              compares them with the values written.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+verify_dataset(hid_t fid, const char *name, hid_t dxpl, hsize_t first, hsize_t nrows)
+{
+    hid_t   dset, fspace, mspace;
+    hsize_t start[2] = {first, 0};
+    hsize_t count[2] = {nrows, SUBF_COLS};
+    int *   buf;
+    int     nbad = 0;
+    size_t  i, j;
+
+    buf = (int *)HDcalloc((size_t)nrows * SUBF_COLS, sizeof(int));
+    VRFY((buf != NULL), "HDcalloc succeeded");
+
+    dset = H5Dopen2(fid, name, H5P_DEFAULT);
+    VRFY((dset >= 0), "H5Dopen2 succeeded");
+    fspace = H5Dget_space(dset);
+    VRFY((fspace >= 0), "H5Dget_space succeeded");
+    VRFY((H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, NULL, count, NULL) >= 0),
+         "H5Sselect_hyperslab succeeded");
+    mspace = H5Screate_simple(2, count, NULL);
+    VRFY((mspace >= 0), "H5Screate_simple succeeded");
+    VRFY((H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, dxpl, buf) >= 0), "H5Dread succeeded");
+
+    for (i = 0; i < nrows; i++)
+        for (j = 0; j < SUBF_COLS; j++) {
+            size_t r = (size_t)first + i;
+            int    expected;
+
+            if (!HDstrcmp(name, "band"))
+                expected = SUBF_BAND_VALUE(r, j);
+            else if (!HDstrcmp(name, "chunked"))
+                expected = SUBF_CHUNKED_VALUE(r, j);
+            else if (!HDstrcmp(name, "indep"))
+                expected = SUBF_INDEP_VALUE(r, j);
+            else
+                expected = SUBF_STRIDED_VALUE(r, j);
+
+            if (buf[i * SUBF_COLS + j] != expected)
+                nbad++;
+        }
+    VRFY((nbad == 0), "data read is correct");
+
+    VRFY((H5Sclose(mspace) >= 0), "H5Sclose succeeded");
+    VRFY((H5Sclose(fspace) >= 0), "H5Sclose succeeded");
+    VRFY((H5Dclose(dset) >= 0), "H5Dclose succeeded");
+
+    HDfree(buf);
+} /* end verify_dataset() */
+
+/*-------------------------------------------------------------------------
+ * Function:    read_file
+ *
+ * Purpose:     Reopens the test file with all processes and reads each
+ *              dataset collectively, each process reading the band of
+ *              its right neighbor.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+read_file(void)
+{
+    hid_t   fapl, fid, dxpl;
+    hsize_t first = (hsize_t)((mpi_rank + 1) % mpi_size) * SUBF_ROWS;
+
+    if (MAINPROCESS)
+        HDputs("Testing collective reads from subfiles");
+
+    /* The layout is read from the map, not from the access properties */
+    fapl = create_fapl(comm, 1);
+    fid  = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+    VRFY((fid >= 0), "H5Fopen succeeded");
+    VRFY((H5Pclose(fapl) >= 0), "H5Pclose succeeded");
+
+    dxpl = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl >= 0), "H5Pcreate succeeded");
+    VRFY((H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE) >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    verify_dataset(fid, "band", dxpl, first, SUBF_ROWS);
+    verify_dataset(fid, "chunked", dxpl, first, SUBF_ROWS);
+    verify_dataset(fid, "indep", dxpl, first, SUBF_ROWS);
+    verify_dataset(fid, "strided", dxpl, first, SUBF_ROWS);
+
+    VRFY((H5Pclose(dxpl) >= 0), "H5Pclose succeeded");
+    VRFY((H5Fclose(fid) >= 0), "H5Fclose succeeded");
+} /* end read_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    read_file_serial
+ *
+ * Purpose:     Opens the test file with process 0 alone and reads all of
+ *              each dataset.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+read_file_serial(void)
+{
+    hid_t fapl, fid;
+
+    if (MAINPROCESS) {
+        HDputs("Testing reads from subfiles by a single process");
+
+        fapl = create_fapl(MPI_COMM_SELF, 0);
+        fid  = H5Fopen(filename, H5F_ACC_RDONLY, fapl);
+        VRFY((fid >= 0), "H5Fopen succeeded");
+        VRFY((H5Pclose(fapl) >= 0), "H5Pclose succeeded");
+
+        verify_dataset(fid, "band", H5P_DEFAULT, 0, (hsize_t)mpi_size * SUBF_ROWS);
+        verify_dataset(fid, "chunked", H5P_DEFAULT, 0, (hsize_t)mpi_size * SUBF_ROWS);
+        verify_dataset(fid, "indep", H5P_DEFAULT, 0, (hsize_t)mpi_size * SUBF_ROWS);
+        verify_dataset(fid, "strided", H5P_DEFAULT, 0, (hsize_t)mpi_size * SUBF_ROWS);
+
+        VRFY((H5Fclose(fid) >= 0), "H5Fclose succeeded");
+    }
+
+    MPI_Barrier(comm);
+} /* end read_file_serial() */
+
+/*-------------------------------------------------------------------------
+ * Function:    cleanup
+ *
+ * Purpose:     Removes the map file and the subfiles.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+cleanup(void)
+{
+    char     name[FILENAME_BUF_SIZE + 64];
+    unsigned nsubfiles = (unsigned)((mpi_size + SUBF_RANKS_PER_SUBFILE - 1) / SUBF_RANKS_PER_SUBFILE);
+    unsigned u;
+
+    /* GetTestCleanup() is collective */
+    if (GetTestCleanup() && MAINPROCESS) {
+        for (u = 0; u < nsubfiles; u++) {
+            HDsnprintf(name, sizeof(name), "%s.subfile_%u_of_%u", filename, u, nsubfiles);
+            HDremove(name);
+        }
+        HDremove(filename);
+    }
+} /* end cleanup() */
+
+int
+main(int argc, char **argv)
+{
+    MPI_Init(&argc, &argv);
+    MPI_Comm_size(comm, &mpi_size);
+    MPI_Comm_rank(comm, &mpi_rank);
+
+    if (H5dont_atexit() < 0) {
+        if (MAINPROCESS)
+            HDprintf("Failed to turn off atexit processing. Continue.\n");
+    }
+
+    H5open();
+
+    if (MAINPROCESS) {
+        HDprintf("==========================\n");
+        HDprintf("Subfiling VFD tests\n");
+        HDprintf("==========================\n\n");
+    }
+
+    ALARM_ON;
+
+    VRFY((h5_fixname(FILENAME[0], H5P_DEFAULT, filename, sizeof(filename)) != NULL),
+         "Test file name created");
+
+    check_fapl();
+    write_file();
+    check_subfiles();
+    read_file();
+    read_file_serial();
+    cleanup();
+
+    if (MAINPROCESS) {
+        if (nerrors)
+            HDprintf("*** %d TEST ERROR%s OCCURRED ***\n", nerrors, nerrors > 1 ? "S" : "");
+        else
+            HDputs("All subfiling VFD tests passed\n");
+    }
+
+    ALARM_OFF;
+
+    H5close();
+
+    MPI_Finalize();
+
+    return (nerrors ? EXIT_FAILURE : EXIT_SUCCESS);
+} /* end main() */
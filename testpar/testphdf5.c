@@ -352,6 +352,7 @@ main(int argc, char **argv)
 #endif
 
     AddTest("props", test_file_properties, NULL, "Coll Metadata file property settings", PARATESTFILE);
+    AddTest("nbflush", test_nonblocking_flush, NULL, "nonblocking metadata flush and close", PARATESTFILE);
 
     AddTest("idsetw", dataset_writeInd, NULL, "dataset independent write", PARATESTFILE);
     AddTest("idsetr", dataset_readInd, NULL, "dataset independent read", PARATESTFILE);
@@ -495,6 +496,8 @@ main(int argc, char **argv)
             "Collective MD read with multi chunk I/O (H5D__chunk_addrmap)", PARATESTFILE);
     AddTest("LC_coll_MD_read", test_link_chunk_io_sort_chunk_issue, NULL,
             "Collective MD read with link chunk I/O (H5D__sort_chunk)", PARATESTFILE);
+    AddTest("coll_MD_rd_size", test_coll_md_read_size, NULL,
+            "Collective MD reads of whole file regions", PARATESTFILE);
 
     /* Display testing information */
     TestInfo(argv[0]);
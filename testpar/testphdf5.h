@@ -238,6 +238,7 @@ void test_plist_ed(void);
 void external_links(void);
 void zero_dim_dset(void);
 void test_file_properties(void);
+void test_nonblocking_flush(void);
 void multiple_dset_write(void);
 void multiple_group_write(void);
 void multiple_group_read(void);
@@ -299,6 +300,7 @@ void test_dense_attr(void);
 void test_partial_no_selection_coll_md_read(void);
 void test_multi_chunk_io_addrmap_issue(void);
 void test_link_chunk_io_sort_chunk_issue(void);
+void test_coll_md_read_size(void);
 
 /* commonly used prototypes */
 hid_t      create_faccess_plist(MPI_Comm comm, MPI_Info info, int l_facc_type);
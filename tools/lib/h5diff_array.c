@@ -19,6 +19,33 @@
 
 #define ATTR_NAME_MAX 255
 
+/* diff_array() compares buffers with memcmp() in blocks of this size, so
+ * only the blocks that differ are compared element by element */
+#define DIFF_BLOCK_SIZE (64 * 1024)
+
+/* Buffers smaller than this are scanned by the calling thread alone */
+#define DIFF_THREAD_MIN_SIZE (4 * 1024 * 1024)
+
+/* Upper bound on --threads */
+#define DIFF_MAX_THREADS 64
+
+#ifdef H5_HAVE_LIBPTHREAD
+#include <pthread.h>
+
+/* The part of a buffer one thread scans */
+typedef struct {
+    const unsigned char *mem1;       /* first buffer                      */
+    const unsigned char *mem2;       /* second buffer                     */
+    size_t               block_size; /* bytes in a block                  */
+    size_t               nbytes;     /* bytes in the buffers              */
+    size_t               first;      /* first block to scan               */
+    size_t               last;       /* one past the last block to scan   */
+    unsigned char *      differ;     /* set to 1 for each block differing */
+} diff_scan_t;
+
+static void *diff_scan_thread(void *_scan);
+#endif /* H5_HAVE_LIBPTHREAD */
+
 /*-------------------------------------------------------------------------
  * printf formatting
  *-------------------------------------------------------------------------
@@ -153,6 +180,10 @@ static int  print_data(diff_opt_t *opts);
 static void print_pos(diff_opt_t *opts, hsize_t elemtno, size_t u);
 static void h5diff_print_char(char ch);
 
+static hsize_t diff_array_elmts(unsigned char *mem1, unsigned char *mem2, hsize_t start, hsize_t end,
+                                hsize_t count, diff_opt_t *opts, hid_t container1_id, hid_t container2_id);
+static void    diff_scan_blocks(const unsigned char *mem1, const unsigned char *mem2, size_t block_size,
+                                size_t nbytes, size_t nblocks, unsigned char *differ, int nthreads);
 static hsize_t diff_region(hid_t obj1_id, hid_t obj2_id, hid_t region1_id, hid_t region2_id,
                            diff_opt_t *opts);
 static hsize_t diff_datum(void *_mem1, void *_mem2, hsize_t elemtno, diff_opt_t *opts, hid_t container1_id,
@@ -211,6 +242,13 @@ static void close_member_types(mcomp_t *members);
  * Purpose: compare two memory buffers;
  *
  * Return: number of differences found
+ *
+ * Buffers of atomic types are first compared with memcmp() in blocks of
+ * DIFF_BLOCK_SIZE bytes, and only the runs of blocks that differ are
+ * compared element by element.  With opts->nthreads > 1 the blocks of a
+ * large buffer are scanned by several threads; the element comparison,
+ * which prints the differences, always runs in the calling thread so the
+ * output is the same as with one thread.
  *-------------------------------------------------------------------------
  */
 
@@ -221,8 +259,9 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
     size_t         size;       /* size of datum */
     unsigned char *mem1 = (unsigned char *)_mem1;
     unsigned char *mem2 = (unsigned char *)_mem2;
-    hsize_t        i;
-    mcomp_t        members;
+    unsigned char *differ = NULL; /* which blocks differ */
+    size_t         block_nelmts, nblocks, b, e;
+    hsize_t        first, last;
     H5T_class_t    type_class;
 
     H5TOOLS_START_DEBUG(" - rank:%d hs_nelmts:%ld errstat:%d", opts->rank, opts->hs_nelmts, opts->err_stat);
@@ -236,12 +275,161 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
      * It is OK not to list non-atomic type here because it will not be caught
      * by the condition, but it gives more clarity for code planning
      */
-    if (type_class != H5T_REFERENCE && type_class != H5T_COMPOUND && type_class != H5T_STRING &&
-        type_class != H5T_VLEN && HDmemcmp(mem1, mem2, size * opts->hs_nelmts) == 0) {
-        H5TOOLS_ENDDEBUG(":Fast comparison - errstat:%d", opts->err_stat);
-        return 0;
+    if (type_class == H5T_REFERENCE || type_class == H5T_COMPOUND || type_class == H5T_STRING ||
+        type_class == H5T_VLEN || 0 == size) {
+        nfound = diff_array_elmts(mem1, mem2, (hsize_t)0, opts->hs_nelmts, opts->count, opts, container1_id,
+                                  container2_id);
+        H5TOOLS_ENDDEBUG(":%d - errstat:%d", nfound, opts->err_stat);
+        return nfound;
+    }
+
+    block_nelmts = MAX(DIFF_BLOCK_SIZE / size, 1);
+    nblocks      = (size_t)((opts->hs_nelmts + block_nelmts - 1) / block_nelmts);
+    if (nblocks <= 1 || NULL == (differ = (unsigned char *)HDcalloc(nblocks, sizeof(unsigned char)))) {
+        if (HDmemcmp(mem1, mem2, size * opts->hs_nelmts) == 0) {
+            H5TOOLS_ENDDEBUG(":Fast comparison - errstat:%d", opts->err_stat);
+            return 0;
+        }
+        nfound = diff_array_elmts(mem1, mem2, (hsize_t)0, opts->hs_nelmts, opts->count, opts, container1_id,
+                                  container2_id);
+        H5TOOLS_ENDDEBUG(":%d - errstat:%d", nfound, opts->err_stat);
+        return nfound;
+    }
+
+    diff_scan_blocks(mem1, mem2, block_nelmts * size, (size_t)opts->hs_nelmts * size, nblocks, differ,
+                     opts->nthreads);
+
+    /* Compare each run of differing blocks element by element */
+    for (b = 0; b < nblocks; b = e) {
+        if (!differ[b]) {
+            e = b + 1;
+            continue;
+        }
+        for (e = b + 1; e < nblocks && differ[e]; e++)
+            ;
+        first = (hsize_t)b * block_nelmts;
+        last  = MIN((hsize_t)e * block_nelmts, opts->hs_nelmts);
+        nfound += diff_array_elmts(mem1 + first * size, mem2 + first * size, first, last,
+                                   opts->count - nfound, opts, container1_id, container2_id);
+        if (opts->count_bool && nfound >= opts->count)
+            break;
+    }
+    HDfree(differ);
+
+    H5TOOLS_ENDDEBUG(":%d - errstat:%d", nfound, opts->err_stat);
+    return nfound;
+}
+
+#ifdef H5_HAVE_LIBPTHREAD
+/*-------------------------------------------------------------------------
+ * Function: diff_scan_thread
+ *
+ * Purpose: thread body of diff_scan_blocks(); only calls memcmp()
+ *-------------------------------------------------------------------------
+ */
+static void *
+diff_scan_thread(void *_scan)
+{
+    diff_scan_t *scan = (diff_scan_t *)_scan;
+    size_t       b, len;
+
+    for (b = scan->first; b < scan->last; b++) {
+        len = MIN(scan->block_size, scan->nbytes - b * scan->block_size);
+        scan->differ[b] =
+            (unsigned char)(HDmemcmp(scan->mem1 + b * scan->block_size, scan->mem2 + b * scan->block_size,
+                                     len) != 0);
     }
 
+    return NULL;
+}
+#endif /* H5_HAVE_LIBPTHREAD */
+
+/*-------------------------------------------------------------------------
+ * Function: diff_scan_blocks
+ *
+ * Purpose: set DIFFER[b] for each block of BLOCK_SIZE bytes in which the
+ *          NBYTES long buffers MEM1 and MEM2 differ, using up to NTHREADS
+ *          threads for large buffers
+ *-------------------------------------------------------------------------
+ */
+static void
+diff_scan_blocks(const unsigned char *mem1, const unsigned char *mem2, size_t block_size, size_t nbytes,
+                 size_t nblocks, unsigned char *differ, int nthreads)
+{
+    size_t b, len;
+
+#ifdef H5_HAVE_LIBPTHREAD
+    if (nthreads > 1 && nbytes >= DIFF_THREAD_MIN_SIZE) {
+        pthread_t    threads[DIFF_MAX_THREADS];
+        hbool_t      started[DIFF_MAX_THREADS];
+        diff_scan_t *scan;
+        int          t;
+
+        if (nthreads > DIFF_MAX_THREADS)
+            nthreads = DIFF_MAX_THREADS;
+        if ((size_t)nthreads > nblocks)
+            nthreads = (int)nblocks;
+
+        /* Without memory for the slices, scan on this thread alone */
+        if (NULL != (scan = (diff_scan_t *)HDmalloc((size_t)nthreads * sizeof(diff_scan_t)))) {
+            for (t = 0; t < nthreads; t++) {
+                scan[t].mem1       = mem1;
+                scan[t].mem2       = mem2;
+                scan[t].block_size = block_size;
+                scan[t].nbytes     = nbytes;
+                scan[t].first      = nblocks * (size_t)t / (size_t)nthreads;
+                scan[t].last       = nblocks * (size_t)(t + 1) / (size_t)nthreads;
+                scan[t].differ     = differ;
+            }
+
+            /* The calling thread takes the first slice, and any slice whose
+             * thread could not be started */
+            for (t = 1; t < nthreads; t++)
+                started[t] = (0 == pthread_create(&threads[t], NULL, diff_scan_thread, &scan[t]));
+            diff_scan_thread(&scan[0]);
+            for (t = 1; t < nthreads; t++) {
+                if (started[t])
+                    pthread_join(threads[t], NULL);
+                else
+                    diff_scan_thread(&scan[t]);
+            }
+            HDfree(scan);
+            return;
+        }
+    }
+#else
+    (void)nthreads;
+#endif /* H5_HAVE_LIBPTHREAD */
+
+    for (b = 0; b < nblocks; b++) {
+        len       = MIN(block_size, nbytes - b * block_size);
+        differ[b] = (unsigned char)(HDmemcmp(mem1 + b * block_size, mem2 + b * block_size, len) != 0);
+    }
+}
+
+/*-------------------------------------------------------------------------
+ * Function: diff_array_elmts
+ *
+ * Purpose: compare elements START to END - 1 of the buffers element by
+ *          element; MEM1 and MEM2 point to element START.  With
+ *          opts->count_bool set, stop after COUNT differences
+ *
+ * Return: number of differences found
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+diff_array_elmts(unsigned char *mem1, unsigned char *mem2, hsize_t start, hsize_t end, hsize_t count,
+                 diff_opt_t *opts, hid_t container1_id, hid_t container2_id)
+{
+    hsize_t     nfound = 0; /* number of differences found */
+    size_t      size;       /* size of datum */
+    hsize_t     i;
+    mcomp_t     members;
+    H5T_class_t type_class;
+
+    size       = H5Tget_size(opts->m_tid);
+    type_class = H5Tget_class(opts->m_tid);
+
     H5TOOLS_DEBUG("type_class:%d", type_class);
     switch (type_class) {
         case H5T_NO_CLASS:
@@ -259,33 +447,33 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
         case H5T_FLOAT:
             H5TOOLS_DEBUG("type_class:H5T_FLOAT");
             if (H5Tequal(opts->m_tid, H5T_NATIVE_FLOAT)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_float_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(float);
                     mem2 += sizeof(float);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_DOUBLE)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_double_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(double);
                     mem2 += sizeof(double);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
 #if H5_SIZEOF_LONG_DOUBLE != 0
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_LDOUBLE)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_ldouble_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(long double);
                     mem2 += sizeof(long double);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
@@ -295,101 +483,101 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
         case H5T_INTEGER:
             H5TOOLS_DEBUG("type_class:H5T_INTEGER");
             if (H5Tequal(opts->m_tid, H5T_NATIVE_SCHAR)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_schar_element(mem1, mem2, i, opts);
                     mem1 += sizeof(char);
                     mem2 += sizeof(char);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_UCHAR)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_uchar_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(unsigned char);
                     mem2 += sizeof(unsigned char);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_SHORT)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_short_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(short);
                     mem2 += sizeof(short);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_USHORT)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_ushort_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(unsigned short);
                     mem2 += sizeof(unsigned short);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_INT)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_int_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(int);
                     mem2 += sizeof(int);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_UINT)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_int_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(unsigned int);
                     mem2 += sizeof(unsigned int);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_LONG)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_long_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(long);
                     mem2 += sizeof(long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_ULONG)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_ulong_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(unsigned long);
                     mem2 += sizeof(unsigned long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_LLONG)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_llong_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(long long);
                     mem2 += sizeof(long long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
             else if (H5Tequal(opts->m_tid, H5T_NATIVE_ULLONG)) {
-                for (i = 0; i < opts->hs_nelmts; i++) {
+                for (i = start; i < end; i++) {
                     nfound += diff_ullong_element(mem1, mem2, i, opts);
 
                     mem1 += sizeof(unsigned long long);
                     mem2 += sizeof(unsigned long long);
-                    if (opts->count_bool && nfound >= opts->count)
+                    if (opts->count_bool && nfound >= count)
                         return nfound;
                 } /* nelmts */
             }
@@ -410,16 +598,15 @@ diff_array(void *_mem1, void *_mem2, diff_opt_t *opts, hid_t container1_id, hid_
             H5TOOLS_DEBUG("type_class:OTHER");
             HDmemset(&members, 0, sizeof(mcomp_t));
             get_member_types(opts->m_tid, &members);
-            for (i = 0; i < opts->hs_nelmts; i++) {
+            for (i = start; i < end; i++) {
                 H5TOOLS_DEBUG("opts->pos[%ld]:%ld - nelmts:%ld", i, opts->pos[i], opts->hs_nelmts);
-                nfound += diff_datum(mem1 + i * size, mem2 + i * size, i, opts, container1_id, container2_id,
-                                     &members);
-                if (opts->count_bool && nfound >= opts->count)
+                nfound += diff_datum(mem1 + (i - start) * size, mem2 + (i - start) * size, i, opts,
+                                     container1_id, container2_id, &members);
+                if (opts->count_bool && nfound >= count)
                     break;
             } /* i */
             close_member_types(&members);
     } /* switch */
-    H5TOOLS_ENDDEBUG(":%d - errstat:%d", nfound, opts->err_stat);
     return nfound;
 }
 
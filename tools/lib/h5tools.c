@@ -22,6 +22,9 @@
 #include "h5tools_utils.h"
 #include "H5private.h"
 
+/* Size of the staging buffer used for CSV export */
+#define H5TOOLS_CSV_BUFSIZE (64 * 1024)
+
 #ifdef H5_TOOLS_DEBUG
 /* global debug variables */
 int H5tools_INDENT_g = 0;
@@ -47,7 +50,7 @@ FILE *rawoutstream   = NULL; /* should initialize to stdout but gcc moans about
 FILE *rawerrorstream = NULL; /* should initialize to stderr but gcc moans about it */
 
 int bin_output;       /* binary output */
-int bin_form = 0;     /* binary form, default NATIVE */
+int bin_form = 0;     /* binary form, default NATIVE; 4 is CSV text */
 int region_output;    /* region output */
 int oid_output;       /* oid output */
 int data_output;      /* data output */
@@ -1699,13 +1702,15 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t
         case H5T_ENUM:
         case H5T_BITFIELD:
             H5TOOLS_DEBUG("numbers");
+            /* The block is already in the requested byte order, so hand as much
+             * of it to the stream as it will take in one call */
             block_index = block_nelmts * size;
             while (block_index > 0) {
                 size_t bytes_in    = 0; /* # of bytes to write  */
                 size_t bytes_wrote = 0; /* # of bytes written   */
 
-                if (block_index > sizeof(size_t))
-                    bytes_in = sizeof(size_t);
+                if (block_index > (hsize_t)H5TOOLS_BUFSIZE)
+                    bytes_in = (size_t)H5TOOLS_BUFSIZE;
                 else
                     bytes_in = (size_t)block_index;
 
@@ -1719,10 +1724,9 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t
             }
             break;
         case H5T_STRING: {
-            unsigned int  i;
-            H5T_str_t     pad;
-            char *        s = NULL;
-            unsigned char tempuchar;
+            size_t    i;
+            H5T_str_t pad;
+            char *    s = NULL;
 
             H5TOOLS_DEBUG("H5T_STRING");
             pad = H5Tget_strpad(tid);
@@ -1740,11 +1744,10 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t
                 else {
                     s = (char *)mem;
                 }
-                for (i = 0; i < size && (s[i] || pad != H5T_STR_NULLTERM); i++) {
-                    HDmemcpy(&tempuchar, &s[i], sizeof(unsigned char));
-                    if (1 != HDfwrite(&tempuchar, sizeof(unsigned char), 1, stream))
-                        H5TOOLS_THROW((-1), "fwrite failed");
-                } /* i */
+                for (i = 0; i < size && (s[i] || pad != H5T_STR_NULLTERM); i++)
+                    ;
+                if (i > 0 && i != HDfwrite(s, sizeof(unsigned char), i, stream))
+                    H5TOOLS_THROW((-1), "fwrite failed");
             }     /* for (block_index = 0; block_index < block_nelmts; block_index++) */
         } break;
         case H5T_COMPOUND: {
@@ -1900,6 +1903,253 @@ render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t
     return ret_value;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: render_csv_flush
+ *
+ * Purpose:  Append LEN bytes to the CSV staging buffer, writing the buffer
+ *           to STREAM whenever it fills.  Passing S as NULL forces out
+ *           whatever is staged.
+ *
+ * Return:   Success:    SUCCEED
+ *           Failure:    FAIL
+ *-------------------------------------------------------------------------
+ */
+static int
+render_csv_flush(FILE *stream, char *buf, size_t *nused, const char *s, size_t len)
+{
+    if (NULL == s || *nused + len > H5TOOLS_CSV_BUFSIZE) {
+        if (*nused > 0 && *nused != HDfwrite(buf, 1, *nused, stream))
+            return FAIL;
+        *nused = 0;
+    }
+    if (s) {
+        if (len > H5TOOLS_CSV_BUFSIZE) {
+            if (len != HDfwrite(s, 1, len, stream))
+                return FAIL;
+        }
+        else {
+            HDmemcpy(buf + *nused, s, len);
+            *nused += len;
+        }
+    }
+
+    return SUCCEED;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: render_csv_output
+ *
+ * Purpose:  Write NELMTS elements of a memory buffer to STREAM as comma
+ *           separated text, one line per row of the last dimension.
+ *           Integers are converted without going through printf and the
+ *           text is staged in a buffer so that the stream sees a
+ *           few large writes instead of one per value.  Types other than
+ *           native integers and floats fall back to the normal renderer.
+ *
+ * Return:   Success:    SUCCEED
+ *           Failure:    FAIL
+ *-------------------------------------------------------------------------
+ */
+int
+render_csv_output(FILE *stream, const h5tool_format_t *info, h5tools_context_t *ctx, hid_t container,
+                  hid_t tid, void *_mem, hsize_t nelmts)
+{
+    unsigned char * mem = (unsigned char *)_mem;
+    char *          buf = NULL; /* staging buffer        */
+    char            num[64];    /* one rendered number   */
+    size_t          nused = 0;  /* bytes staged in buf   */
+    size_t          size;       /* datum size            */
+    H5T_class_t     type_class;
+    H5T_sign_t      sign     = H5T_SGN_NONE;
+    hbool_t         fast_int = FALSE; /* convert integers by hand */
+    h5tool_format_t csvinfo;          /* flattened format         */
+    h5tools_str_t   str;
+    hsize_t         i;
+    hbool_t         past_catch = FALSE;
+    int             ret_value  = 0;
+
+    H5TOOLS_START_DEBUG("");
+    HDmemset(&str, 0, sizeof(h5tools_str_t));
+
+    csvinfo               = *info;
+    csvinfo.arr_pre       = "";
+    csvinfo.arr_sep       = NULL; /* the default separator, without the trailing space */
+    csvinfo.arr_suf       = "";
+    csvinfo.arr_linebreak = 0;
+    csvinfo.cmpd_name     = "";
+    csvinfo.cmpd_pre      = "";
+    csvinfo.cmpd_sep      = ",";
+    csvinfo.cmpd_suf      = "";
+    csvinfo.cmpd_end      = "";
+    csvinfo.line_indent   = "";
+    csvinfo.fmt_float     = OPT(info->fmt_float, "%g");
+    csvinfo.fmt_double    = OPT(info->fmt_double, "%g");
+
+    if ((size = H5Tget_size(tid)) == 0)
+        H5TOOLS_THROW((-1), "H5Tget_size failed");
+    if ((type_class = H5Tget_class(tid)) < 0)
+        H5TOOLS_THROW((-1), "H5Tget_class failed");
+    if (type_class == H5T_INTEGER) {
+        if ((sign = H5Tget_sign(tid)) < 0)
+            H5TOOLS_THROW((-1), "H5Tget_sign failed");
+        fast_int = (H5Tequal(tid, H5T_NATIVE_HBOOL) <= 0) &&
+                   (size == sizeof(signed char) || size == sizeof(short) || size == sizeof(int) ||
+                    size == sizeof(long long));
+    }
+
+    if (NULL == (buf = (char *)HDmalloc(H5TOOLS_CSV_BUFSIZE)))
+        H5TOOLS_THROW((-1), "could not allocate staging buffer");
+
+    for (i = 0; i < nelmts; i++, mem += size) {
+        const char *s   = num;
+        size_t      len = 0;
+
+        if (fast_int) {
+            unsigned long long uval = 0;
+            hbool_t            neg  = FALSE;
+            char *             p    = num + sizeof(num);
+
+            if (sign == H5T_SGN_2) {
+                long long sval = 0;
+
+                if (size == sizeof(signed char)) {
+                    signed char v;
+                    HDmemcpy(&v, mem, size);
+                    sval = v;
+                }
+                else if (size == sizeof(short)) {
+                    short v;
+                    HDmemcpy(&v, mem, size);
+                    sval = v;
+                }
+                else if (size == sizeof(int)) {
+                    int v;
+                    HDmemcpy(&v, mem, size);
+                    sval = v;
+                }
+                else
+                    HDmemcpy(&sval, mem, size);
+                neg  = sval < 0;
+                uval = neg ? (unsigned long long)0 - (unsigned long long)sval : (unsigned long long)sval;
+            }
+            else {
+                if (size == sizeof(unsigned char))
+                    uval = *mem;
+                else if (size == sizeof(unsigned short)) {
+                    unsigned short v;
+                    HDmemcpy(&v, mem, size);
+                    uval = v;
+                }
+                else if (size == sizeof(unsigned int)) {
+                    unsigned int v;
+                    HDmemcpy(&v, mem, size);
+                    uval = v;
+                }
+                else
+                    HDmemcpy(&uval, mem, size);
+            }
+
+            do {
+                *--p = (char)('0' + (uval % 10));
+                uval /= 10;
+            } while (uval);
+            if (neg)
+                *--p = '-';
+            s   = p;
+            len = (size_t)((num + sizeof(num)) - p);
+        }
+        else if (type_class == H5T_FLOAT && size == sizeof(float)) {
+            float v;
+
+            HDmemcpy(&v, mem, sizeof(float));
+            len = MIN((size_t)HDsnprintf(num, sizeof(num), csvinfo.fmt_float, (double)v),
+                      sizeof(num) - 1);
+        }
+        else if (type_class == H5T_FLOAT && size == sizeof(double)) {
+            double v;
+
+            HDmemcpy(&v, mem, sizeof(double));
+            len = MIN((size_t)HDsnprintf(num, sizeof(num), csvinfo.fmt_double, v),
+                      sizeof(num) - 1);
+        }
+        else {
+            size_t j;
+            int    quote = 0;
+
+            if (type_class == H5T_STRING) {
+                /* Write the characters themselves rather than the quoted DDL form */
+                if (H5Tis_variable_str(tid)) {
+                    s   = *(char **)((void *)mem);
+                    s   = s ? s : "";
+                    len = HDstrlen(s);
+                }
+                else {
+                    H5T_str_t pad = H5Tget_strpad(tid);
+
+                    s = (const char *)mem;
+                    for (len = 0; len < size && (s[len] || pad != H5T_STR_NULLTERM); len++)
+                        ;
+                }
+            }
+            else {
+                h5tools_context_t csvctx = *ctx;
+
+                /* Render with the flat format; compound members and array
+                 * elements become fields of their own */
+                csvctx.indent_level = 0;
+                h5tools_str_reset(&str);
+                h5tools_str_sprint(&str, &csvinfo, container, tid, mem, &csvctx);
+                s   = str.s ? str.s : "";
+                len = h5tools_str_len(&str);
+                if (type_class == H5T_COMPOUND || type_class == H5T_ARRAY) {
+                    for (j = 0; j < len; j++)
+                        if (s[j] != OPTIONAL_LINE_BREAK[0] &&
+                            render_csv_flush(stream, buf, &nused, &s[j], 1) < 0)
+                            H5TOOLS_THROW((-1), "fwrite failed");
+                    len = 0;
+                }
+            }
+
+            /* Quote the field if it would otherwise break the row apart */
+            for (j = 0; j < len; j++)
+                if (s[j] == ',' || s[j] == '"' || s[j] == '\n' || s[j] == '\r')
+                    quote = 1;
+            if (quote) {
+                if (render_csv_flush(stream, buf, &nused, "\"", 1) < 0)
+                    H5TOOLS_THROW((-1), "fwrite failed");
+                for (j = 0; j < len; j++)
+                    if (render_csv_flush(stream, buf, &nused, &s[j], 1) < 0 ||
+                        (s[j] == '"' && render_csv_flush(stream, buf, &nused, "\"", 1) < 0))
+                        H5TOOLS_THROW((-1), "fwrite failed");
+                s   = "\"";
+                len = 1;
+            }
+        }
+
+        if (render_csv_flush(stream, buf, &nused, s, len) < 0)
+            H5TOOLS_THROW((-1), "fwrite failed");
+
+        /* End the line at the end of each row, otherwise separate the values.
+         * Scalars and one-dimensional datasets get one element per line. */
+        if (ctx->ndims <= 1 || ctx->size_last_dim == 0 || (ctx->sm_pos + i + 1) % ctx->size_last_dim == 0)
+            s = "\n";
+        else
+            s = ",";
+        if (render_csv_flush(stream, buf, &nused, s, 1) < 0)
+            H5TOOLS_THROW((-1), "fwrite failed");
+    }
+
+    if (render_csv_flush(stream, buf, &nused, NULL, 0) < 0)
+        H5TOOLS_THROW((-1), "fwrite failed");
+
+    CATCH
+    if (buf)
+        HDfree(buf);
+    h5tools_str_close(&str);
+    H5TOOLS_ENDDEBUG("");
+    return ret_value;
+}
+
 /*-------------------------------------------------------------------------
  * Function: render_bin_output_region_data_blocks
  *
@@ -686,6 +686,8 @@ H5TOOLS_DLL void h5tools_region_simple_prefix(FILE *stream, const h5tool_format_
                                               int secnum);
 
 H5TOOLS_DLL int     render_bin_output(FILE *stream, hid_t container, hid_t tid, void *_mem, hsize_t nelmts);
+H5TOOLS_DLL int     render_csv_output(FILE *stream, const h5tool_format_t *info, h5tools_context_t *ctx,
+                                      hid_t container, hid_t tid, void *_mem, hsize_t nelmts);
 H5TOOLS_DLL int     render_bin_output_region_data_blocks(hid_t region_id, FILE *stream, hid_t container,
                                                          unsigned ndims, hid_t type_id, hsize_t nblocks,
                                                          const hsize_t *ptdata);
@@ -276,7 +276,13 @@ h5tools_dump_simple_data(FILE *stream, const h5tool_format_t *info, h5tools_cont
     H5TOOLS_START_DEBUG(" file=%p", (void *)stream);
     H5TOOLS_DEBUG("rawdata file=%p", (void *)rawdatastream);
     /* binary dump */
-    if (bin_output && (rawdatastream != NULL)) {
+    if (bin_output && (rawdatastream != NULL) && bin_form == 4) {
+        H5TOOLS_DEBUG("render_csv_output");
+        if (render_csv_output(rawdatastream, info, ctx, container, type, _mem, nelmts) < 0) {
+            PRINTVALSTREAM(rawoutstream, "\nError in writing CSV stream\n");
+        }
+    } /* end if */
+    else if (bin_output && (rawdatastream != NULL)) {
         H5TOOLS_DEBUG("render_bin_output");
         if (render_bin_output(rawdatastream, container, type, _mem, nelmts) < 0) {
             PRINTVALSTREAM(rawoutstream, "\nError in writing binary stream\n");
@@ -25,11 +25,25 @@ typedef struct trav_addr_path_t {
 } trav_addr_path_t;
 
 typedef struct trav_addr_t {
-    size_t            nalloc;
-    size_t            nused;
-    trav_addr_path_t *objs;
+    size_t             nalloc;
+    size_t             nused;
+    trav_addr_path_t * objs;
+    trav_token_index_t index; /* token -> position in objs */
 } trav_addr_t;
 
+/* Group waiting to be iterated over in a breadth-first traversal */
+typedef struct trav_queue_item_t {
+    H5O_token_t token; /* Token of the group */
+    char *      path;  /* Path of the group, relative to the base group */
+} trav_queue_item_t;
+
+typedef struct trav_queue_t {
+    size_t             nalloc;
+    size_t             nused;
+    size_t             head; /* Next item to iterate over */
+    trav_queue_item_t *items;
+} trav_queue_t;
+
 typedef struct {
     h5trav_obj_func_t visit_obj; /* Callback for visiting objects */
     h5trav_lnk_func_t visit_lnk; /* Callback for visiting links */
@@ -42,9 +56,17 @@ typedef struct {
     hbool_t               is_absolute;   /* Whether the traversal has absolute paths */
     const char *          base_grp_name; /* Name of the group that serves as the base
                                           * for iteration */
-    unsigned fields;                     /* Fields needed in H5O_info2_t struct */
+    unsigned      fields;                /* Fields needed in H5O_info2_t struct */
+    trav_queue_t *queue;                 /* Groups left to iterate over, for
+                                          * breadth-first traversals */
 } trav_ud_traverse_t;
 
+typedef struct {
+    trav_ud_traverse_t *udata;       /* Traversal information */
+    const char *        parent_path; /* Path of the group being iterated over,
+                                      * relative to the base group */
+} trav_ud_bfs_t;
+
 typedef struct {
     hid_t fid; /* File ID being traversed */
 } trav_print_udata_t;
@@ -53,6 +75,9 @@ typedef struct trav_path_op_data_t {
     const char *path;
 } trav_path_op_data_t;
 
+/* Initial number of slots in a token index */
+#define TRAV_TOKEN_INDEX_MIN 64
+
 /* format for hsize_t */
 #ifdef H5TRAV_PRINT_SPACE
 #define HSIZE_T_FORMAT "%" H5_PRINTF_LL_WIDTH "u"
@@ -75,6 +100,8 @@ static H5_iter_order_t trav_index_order = H5_ITER_INC;
 
 static int trav_verbosity = 0;
 
+static hbool_t trav_breadth_first = FALSE;
+
 /*-------------------------------------------------------------------------
  * Function: h5trav_set_index
  *
@@ -104,6 +131,116 @@ h5trav_set_verbose(int print_verbose)
     trav_verbosity = print_verbose;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: h5trav_set_breadth_first
+ *
+ * Purpose:  Visit the objects & links in the file one group level at a
+ *           time, instead of descending into each group as it is found.
+ *           Each group is opened once and its links are looked up relative
+ *           to it.  The order of the callbacks differs from the default,
+ *           so this is only meant for callers that do not depend on it.
+ *
+ * Return:   none
+ *-------------------------------------------------------------------------
+ */
+void
+h5trav_set_breadth_first(hbool_t breadth_first)
+{
+    trav_breadth_first = breadth_first;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: trav_token_hash
+ *
+ * Purpose:  Hash the bytes of an object token (FNV-1a)
+ *
+ * Return:   hash value
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_PURE static size_t
+trav_token_hash(const H5O_token_t *token)
+{
+    uint32_t hash = 2166136261U;
+    size_t   u;
+
+    for (u = 0; u < H5O_MAX_TOKEN_SIZE; u++) {
+        hash ^= token->__data[u];
+        hash *= 16777619U;
+    }
+
+    return (size_t)hash;
+} /* end trav_token_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function: trav_token_index_insert
+ *
+ * Purpose:  Record position POS for an object token.  If the token is
+ *           already in the index the first position is kept.
+ *
+ * Return:   void
+ *-------------------------------------------------------------------------
+ */
+static void
+trav_token_index_insert(trav_token_index_t *index, const H5O_token_t *token, size_t pos)
+{
+    size_t mask;
+    size_t u;
+
+    /* Grow the index when it becomes half full */
+    if ((index->nused + 1) * 2 > index->nslots) {
+        trav_token_slot_t *old_slots  = index->slots;
+        size_t             old_nslots = index->nslots;
+        trav_token_slot_t *new_slots;
+        size_t             new_nslots = MAX(TRAV_TOKEN_INDEX_MIN, old_nslots * 2);
+
+        if (NULL == (new_slots = (trav_token_slot_t *)HDcalloc(new_nslots, sizeof(trav_token_slot_t))))
+            return;
+        index->slots  = new_slots;
+        index->nslots = new_nslots;
+        index->nused  = 0;
+
+        for (u = 0; u < old_nslots; u++)
+            if (old_slots[u].pos)
+                trav_token_index_insert(index, &old_slots[u].token, old_slots[u].pos - 1);
+        HDfree(old_slots);
+    } /* end if */
+
+    mask = index->nslots - 1;
+    for (u = trav_token_hash(token) & mask; index->slots[u].pos; u = (u + 1) & mask)
+        if (!HDmemcmp(&index->slots[u].token, token, sizeof(H5O_token_t)))
+            return;
+
+    HDmemcpy(&index->slots[u].token, token, sizeof(H5O_token_t));
+    index->slots[u].pos = pos + 1;
+    index->nused++;
+} /* end trav_token_index_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function: trav_token_index_find
+ *
+ * Purpose:  Look up the position recorded for an object token
+ *
+ * Return:   position on success,
+ *           -1 if not found
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_PURE static ssize_t
+trav_token_index_find(const trav_token_index_t *index, const H5O_token_t *token)
+{
+    size_t mask;
+    size_t u;
+
+    if (0 == index->nslots)
+        return -1;
+
+    mask = index->nslots - 1;
+    for (u = trav_token_hash(token) & mask; index->slots[u].pos; u = (u + 1) & mask)
+        if (!HDmemcmp(&index->slots[u].token, token, sizeof(H5O_token_t)))
+            return (ssize_t)(index->slots[u].pos - 1);
+
+    return -1;
+} /* end trav_token_index_find() */
+
 /*-------------------------------------------------------------------------
  * "h5trav info" public functions. used in h5diff
  *-------------------------------------------------------------------------
@@ -134,6 +271,7 @@ trav_token_add(trav_addr_t *visited, H5O_token_t *token, const char *path)
     idx = visited->nused++;
     HDmemcpy(&visited->objs[idx].token, token, sizeof(H5O_token_t));
     visited->objs[idx].path = HDstrdup(path);
+    trav_token_index_insert(&visited->index, token, idx);
 } /* end trav_token_add() */
 
 /*-------------------------------------------------------------------------
@@ -145,35 +283,65 @@ trav_token_add(trav_addr_t *visited, H5O_token_t *token, const char *path)
  *-------------------------------------------------------------------------
  */
 H5_ATTR_PURE static const char *
-trav_token_visited(hid_t loc_id, trav_addr_t *visited, H5O_token_t *token)
+trav_token_visited(trav_addr_t *visited, H5O_token_t *token)
 {
-    size_t u; /* Local index variable */
-    int    token_cmp;
+    ssize_t idx; /* Index of object token */
 
     /* Look for address */
-    for (u = 0; u < visited->nused; u++) {
-        /* Check for address already in array */
-        if (H5Otoken_cmp(loc_id, &visited->objs[u].token, token, &token_cmp) < 0)
-            return NULL;
-        if (!token_cmp)
-            return (visited->objs[u].path);
-    }
+    if ((idx = trav_token_index_find(&visited->index, token)) < 0)
+        /* Didn't find object token */
+        return (NULL);
 
-    /* Didn't find object token */
-    return (NULL);
+    return (visited->objs[idx].path);
 } /* end trav_token_visited() */
 
 /*-------------------------------------------------------------------------
- * Function: traverse_cb
+ * Function: trav_queue_add
  *
- * Purpose:  Iterator callback for traversing objects in file
+ * Purpose:  Add a group to the queue of a breadth-first traversal
+ *
+ * Return:   0 on success,
+ *          -1 on failure
+ *-------------------------------------------------------------------------
+ */
+static int
+trav_queue_add(trav_queue_t *queue, const H5O_token_t *token, const char *path)
+{
+    size_t idx; /* Index of item to use */
+
+    /* Allocate space if necessary */
+    if (queue->nused == queue->nalloc) {
+        trav_queue_item_t *items;
+
+        queue->nalloc = MAX(1, queue->nalloc * 2);
+        if (NULL ==
+            (items = (trav_queue_item_t *)HDrealloc(queue->items, queue->nalloc * sizeof(trav_queue_item_t))))
+            return -1;
+        queue->items = items;
+    } /* end if */
+
+    /* Append it */
+    idx = queue->nused++;
+    HDmemcpy(&queue->items[idx].token, token, sizeof(H5O_token_t));
+    if (NULL == (queue->items[idx].path = HDstrdup(path)))
+        return -1;
+
+    return 0;
+} /* end trav_queue_add() */
+
+/*-------------------------------------------------------------------------
+ * Function: traverse_link
+ *
+ * Purpose:  Visit one link found while traversing the file.  NAME is the
+ *           name of the link relative to LOC_ID and PATH is its path
+ *           relative to the base group.
  *-------------------------------------------------------------------------
  */
 static herr_t
-traverse_cb(hid_t loc_id, const char *path, const H5L_info2_t *linfo, void *_udata)
+traverse_link(hid_t loc_id, const char *name, const char *path, const H5L_info2_t *linfo,
+              trav_ud_traverse_t *udata)
 {
-    trav_ud_traverse_t *udata    = (trav_ud_traverse_t *)_udata; /* User data */
-    char *              new_name = NULL;
+    char *      new_name = NULL;
     const char *        full_name;
     const char *        already_visited = NULL; /* Whether the link/object was already visited */
 
@@ -200,7 +368,7 @@ traverse_cb(hid_t loc_id, const char *path, const H5L_info2_t *linfo, void *_uda
         H5O_info2_t oinfo;
 
         /* Get information about the object */
-        if (H5Oget_info_by_name3(loc_id, path, &oinfo, udata->fields, H5P_DEFAULT) < 0) {
+        if (H5Oget_info_by_name3(loc_id, name, &oinfo, udata->fields, H5P_DEFAULT) < 0) {
             if (new_name)
                 HDfree(new_name);
             return (H5_ITER_ERROR);
@@ -210,9 +378,17 @@ traverse_cb(hid_t loc_id, const char *path, const H5L_info2_t *linfo, void *_uda
          *  already visited, if it isn't there already
          */
         if (oinfo.rc > 1)
-            if (NULL == (already_visited = trav_token_visited(loc_id, udata->seen, &oinfo.token)))
+            if (NULL == (already_visited = trav_token_visited(udata->seen, &oinfo.token)))
                 trav_token_add(udata->seen, &oinfo.token, full_name);
 
+        /* Queue groups seen for the first time, for breadth-first traversals */
+        if (udata->queue && oinfo.type == H5O_TYPE_GROUP && NULL == already_visited)
+            if (trav_queue_add(udata->queue, &oinfo.token, path) < 0) {
+                if (new_name)
+                    HDfree(new_name);
+                return (H5_ITER_ERROR);
+            } /* end if */
+
         /* Make 'visit object' callback */
         if (udata->visitor->visit_obj)
             if ((*udata->visitor->visit_obj)(full_name, &oinfo, already_visited, udata->visitor->udata) < 0) {
@@ -235,8 +411,130 @@ traverse_cb(hid_t loc_id, const char *path, const H5L_info2_t *linfo, void *_uda
         HDfree(new_name);
 
     return (H5_ITER_CONT);
+} /* end traverse_link() */
+
+/*-------------------------------------------------------------------------
+ * Function: traverse_cb
+ *
+ * Purpose:  Iterator callback for traversing objects in file
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+traverse_cb(hid_t loc_id, const char *path, const H5L_info2_t *linfo, void *_udata)
+{
+    return traverse_link(loc_id, path, path, linfo, (trav_ud_traverse_t *)_udata);
 } /* end traverse_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function: traverse_bfs_cb
+ *
+ * Purpose:  Iterator callback for the links of one group in a
+ *           breadth-first traversal
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+traverse_bfs_cb(hid_t loc_id, const char *name, const H5L_info2_t *linfo, void *_udata)
+{
+    trav_ud_bfs_t *bfs_udata = (trav_ud_bfs_t *)_udata;
+    char *         path      = NULL;
+    size_t         path_len;
+    herr_t         ret_value;
+
+    /* Links in the base group are named relative to it */
+    if ('\0' == *bfs_udata->parent_path)
+        return traverse_link(loc_id, name, name, linfo, bfs_udata->udata);
+
+    path_len = HDstrlen(bfs_udata->parent_path) + 1 + HDstrlen(name) + 1;
+    if (NULL == (path = (char *)HDmalloc(path_len)))
+        return (H5_ITER_ERROR);
+    HDsnprintf(path, path_len, "%s/%s", bfs_udata->parent_path, name);
+
+    ret_value = traverse_link(loc_id, name, path, linfo, bfs_udata->udata);
+
+    HDfree(path);
+
+    return ret_value;
+} /* end traverse_bfs_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function: traverse_bfs
+ *
+ * Purpose:  Visit all links below the base group one group level at a
+ *           time.  Groups are opened by token as they come off the queue,
+ *           so each link is looked up relative to its parent group.
+ *
+ * Return:   0 on success,
+ *          -1 on failure
+ *-------------------------------------------------------------------------
+ */
+static int
+traverse_bfs(hid_t file_id, const char *grp_name, trav_ud_traverse_t *udata)
+{
+    trav_queue_t  queue;              /* Groups left to iterate over */
+    trav_ud_bfs_t bfs_udata;          /* User data for iteration callback */
+    char *        parent_path = NULL; /* Path of the group iterated over */
+    hid_t         gid         = H5I_INVALID_HID;
+    int           ret_value   = 0;
+
+    queue.nused = queue.nalloc = queue.head = 0;
+    queue.items                             = NULL;
+    udata->queue                            = &queue;
+    bfs_udata.udata                         = udata;
+
+    /* Start with the base group */
+    if ((gid = H5Gopen2(file_id, grp_name, H5P_DEFAULT)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Gopen2 failed");
+    bfs_udata.parent_path = "";
+    if (H5Literate2(gid, trav_index_by, trav_index_order, NULL, traverse_bfs_cb, &bfs_udata) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Literate2 failed");
+    if (H5Gclose(gid) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Gclose failed");
+    gid = H5I_INVALID_HID;
+
+    /* Iterate over the groups found, in the order they were found */
+    while (queue.head < queue.nused) {
+        trav_queue_item_t *item = &queue.items[queue.head];
+
+        if ((gid = H5Oopen_by_token(file_id, item->token)) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Oopen_by_token failed");
+
+        /* The queue may be reallocated while iterating, so take over the path */
+        parent_path           = item->path;
+        item->path            = NULL;
+        bfs_udata.parent_path = parent_path;
+        queue.head++;
+
+        if (H5Literate2(gid, trav_index_by, trav_index_order, NULL, traverse_bfs_cb, &bfs_udata) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Literate2 failed");
+        HDfree(parent_path);
+        parent_path = NULL;
+
+        if (H5Oclose(gid) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Oclose failed");
+        gid = H5I_INVALID_HID;
+    } /* end while */
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Oclose(gid);
+    }
+    H5E_END_TRY;
+
+    /* Free any groups left after a failure */
+    HDfree(parent_path);
+    if (queue.items) {
+        size_t u; /* Local index variable */
+
+        for (u = queue.head; u < queue.nused; u++)
+            HDfree(queue.items[u].path);
+        HDfree(queue.items);
+    } /* end if */
+    udata->queue = NULL;
+
+    return ret_value;
+} /* end traverse_bfs() */
+
 /*-------------------------------------------------------------------------
  * Function: traverse
  *
@@ -270,6 +568,7 @@ traverse(hid_t file_id, const char *grp_name, hbool_t visit_start, hbool_t recur
         /* Init addresses seen */
         seen.nused = seen.nalloc = 0;
         seen.objs                = NULL;
+        HDmemset(&seen.index, 0, sizeof(seen.index));
 
         /* Check for multiple links to top group */
         if (oinfo.rc > 1)
@@ -281,9 +580,15 @@ traverse(hid_t file_id, const char *grp_name, hbool_t visit_start, hbool_t recur
         udata.is_absolute   = (*grp_name == '/');
         udata.base_grp_name = grp_name;
         udata.fields        = fields;
+        udata.queue         = NULL;
 
         /* Check for iteration of links vs. visiting all links recursively */
-        if (recurse) {
+        if (recurse && trav_breadth_first) {
+            /* Visit all links in group, one group level at a time */
+            if (traverse_bfs(file_id, grp_name, &udata) < 0)
+                H5TOOLS_GOTO_ERROR((-1), "traverse_bfs failed");
+        } /* end if */
+        else if (recurse) {
             /* Visit all links in group, recursively */
             if (H5Lvisit_by_name2(file_id, grp_name, trav_index_by, trav_index_order, traverse_cb, &udata,
                                   H5P_DEFAULT) < 0)
@@ -305,6 +610,7 @@ traverse(hid_t file_id, const char *grp_name, hbool_t visit_start, hbool_t recur
                 HDfree(seen.objs[u].path);
             HDfree(seen.objs);
         } /* end if */
+        HDfree(seen.index.slots);
     }     /* end if */
 
 done:
@@ -665,8 +971,10 @@ trav_table_add(trav_table_t *table, const char *path, const H5O_info2_t *oinfo)
         } /* end if */
 
         new_obj = table->nobjs++;
-        if (oinfo)
+        if (oinfo) {
             HDmemcpy(&table->objs[new_obj].obj_token, &oinfo->token, sizeof(H5O_token_t));
+            trav_token_index_insert(&table->obj_index, &oinfo->token, new_obj);
+        } /* end if */
         else
             /* Set token to 'undefined' values */
             table->objs[new_obj].obj_token = H5O_TOKEN_UNDEF;
@@ -691,35 +999,49 @@ trav_table_add(trav_table_t *table, const char *path, const H5O_info2_t *oinfo)
 static void
 trav_table_addlink(trav_table_t *table, const H5O_token_t *obj_token, const char *path)
 {
-    size_t i; /* Local index variable */
-    int    token_cmp;
+    ssize_t idx; /* Index of object in table */
+    size_t  i;
 
     if (table) {
-        for (i = 0; i < table->nobjs; i++) {
-            if (H5Otoken_cmp(table->fid, &table->objs[i].obj_token, obj_token, &token_cmp) < 0)
-                return;
-            if (!token_cmp) {
-                size_t n;
-
-                /* already inserted? */
-                if (HDstrcmp(table->objs[i].name, path) == 0)
-                    return;
-
-                /* allocate space if necessary */
-                if (table->objs[i].nlinks == (unsigned)table->objs[i].sizelinks) {
-                    table->objs[i].sizelinks = MAX(1, table->objs[i].sizelinks * 2);
-                    table->objs[i].links     = (trav_link_t *)HDrealloc(
-                        table->objs[i].links, table->objs[i].sizelinks * sizeof(trav_link_t));
-                } /* end if */
+        if ((idx = trav_table_find_token(table, obj_token)) >= 0) {
+            size_t n;
 
-                /* insert it */
-                n                                = table->objs[i].nlinks++;
-                table->objs[i].links[n].new_name = (char *)HDstrdup(path);
+            i = (size_t)idx;
 
+            /* already inserted? */
+            if (HDstrcmp(table->objs[i].name, path) == 0)
                 return;
+
+            /* allocate space if necessary */
+            if (table->objs[i].nlinks == (unsigned)table->objs[i].sizelinks) {
+                table->objs[i].sizelinks = MAX(1, table->objs[i].sizelinks * 2);
+                table->objs[i].links     = (trav_link_t *)HDrealloc(
+                    table->objs[i].links, table->objs[i].sizelinks * sizeof(trav_link_t));
             } /* end if */
-        }     /* end for */
-    }         /* end if */
+
+            /* insert it */
+            n                                = table->objs[i].nlinks++;
+            table->objs[i].links[n].new_name = (char *)HDstrdup(path);
+        } /* end if */
+    }     /* end if */
+}
+
+/*-------------------------------------------------------------------------
+ * Function: trav_table_find_token
+ *
+ * Purpose:  Find the first object added to the table with token OBJ_TOKEN
+ *
+ * Return:   index on success,
+ *           -1 if not found
+ *-------------------------------------------------------------------------
+ */
+H5_ATTR_PURE ssize_t
+trav_table_find_token(const trav_table_t *table, const H5O_token_t *obj_token)
+{
+    if (NULL == table)
+        return -1;
+
+    return trav_token_index_find(&table->obj_index, obj_token);
 }
 
 /*-------------------------------------------------------------------------
@@ -774,6 +1096,7 @@ trav_table_init(hid_t fid, trav_table_t **tbl)
         table->size  = 0;
         table->nobjs = 0;
         table->objs  = NULL;
+        HDmemset(&table->obj_index, 0, sizeof(table->obj_index));
     }
     *tbl = table;
 }
@@ -806,6 +1129,7 @@ trav_table_free(trav_table_t *table)
             }     /* end for */
             HDfree(table->objs);
         } /* end if */
+        HDfree(table->obj_index.slots);
         HDfree(table);
     }
 }
@@ -78,6 +78,22 @@ typedef struct trav_info_t {
     void *         opts;            /* optional data passing */
 } trav_info_t;
 
+/*-------------------------------------------------------------------------
+ * hash index from object tokens to positions in an object array, used for
+ * hard link detection without scanning the whole array
+ *-------------------------------------------------------------------------
+ */
+typedef struct trav_token_slot_t {
+    H5O_token_t token; /* object token */
+    size_t      pos;   /* position in the indexed array + 1, 0 for an empty slot */
+} trav_token_slot_t;
+
+typedef struct trav_token_index_t {
+    size_t             nslots; /* number of slots, 0 or a power of two */
+    size_t             nused;  /* number of slots in use */
+    trav_token_slot_t *slots;
+} trav_token_index_t;
+
 /*-------------------------------------------------------------------------
  * keep record of hard link information
  *-------------------------------------------------------------------------
@@ -108,10 +124,11 @@ typedef struct trav_obj_t {
  */
 
 typedef struct trav_table_t {
-    hid_t       fid;
-    size_t      size;
-    size_t      nobjs;
-    trav_obj_t *objs;
+    hid_t              fid;
+    size_t             size;
+    size_t             nobjs;
+    trav_obj_t *       objs;
+    trav_token_index_t obj_index; /* token -> position in objs, for objects added with a token */
 } trav_table_t;
 
 /*-------------------------------------------------------------------------
@@ -128,6 +145,7 @@ extern "C" {
  *-------------------------------------------------------------------------
  */
 H5TOOLS_DLL void    h5trav_set_index(H5_index_t print_index_by, H5_iter_order_t print_index_order);
+H5TOOLS_DLL void    h5trav_set_breadth_first(hbool_t breadth_first);
 H5TOOLS_DLL int     h5trav_visit(hid_t file_id, const char *grp_name, hbool_t visit_start, hbool_t recurse,
                                  h5trav_obj_func_t visit_obj, h5trav_lnk_func_t visit_lnk, void *udata,
                                  unsigned fields);
@@ -190,4 +208,6 @@ H5TOOLS_DLL void trav_table_free(trav_table_t *table);
 H5TOOLS_DLL void trav_table_addflags(const unsigned *flags, char *objname, h5trav_type_t type,
                                      trav_table_t *table);
 
+H5TOOLS_DLL ssize_t trav_table_find_token(const trav_table_t *table, const H5O_token_t *obj_token);
+
 #endif /* H5TRAV_H */
@@ -48,6 +48,7 @@ static struct long_options l_opts[] = {{"help", no_arg, 'h'},
                                        {"vol-value-2", require_arg, '4'},
                                        {"vol-name-2", require_arg, '5'},
                                        {"vol-info-2", require_arg, '6'},
+                                       {"threads", require_arg, '7'},
                                        {NULL, 0, '\0'}};
 
 /*-------------------------------------------------------------------------
@@ -218,6 +219,9 @@ parse_command_line(int argc, const char *argv[], const char **fname1, const char
     /* NaNs are handled by default */
     opts->do_nans = 1;
 
+    /* buffers are scanned by one thread by default */
+    opts->nthreads = 1;
+
     /* not Listing objects that are not comparable */
     opts->mode_list_not_cmp = 0;
 
@@ -401,6 +405,14 @@ parse_command_line(int argc, const char *argv[], const char **fname1, const char
                 opts->use_system_epsilon = 1;
                 break;
 
+            case '7':
+                if (check_n_input(opt_arg) == -1 || (opts->nthreads = HDatoi(opt_arg)) < 1) {
+                    HDprintf("<--threads=%s> is not a valid option\n", opt_arg);
+                    usage();
+                    h5diff_exit(EXIT_FAILURE);
+                }
+                break;
+
             case '1':
                 opts->vol_info[0].type    = VOL_BY_VALUE;
                 opts->vol_info[0].u.value = (H5VL_class_value_t)HDatoi(opt_arg);
@@ -705,6 +717,11 @@ usage(void)
     PRINTVALSTREAM(rawoutstream, "         List objects that are not comparable\n");
     PRINTVALSTREAM(rawoutstream, "   -N, --nan\n");
     PRINTVALSTREAM(rawoutstream, "         Avoid NaNs detection\n");
+    PRINTVALSTREAM(rawoutstream, "   --threads=T\n");
+    PRINTVALSTREAM(rawoutstream,
+                   "         Use T threads to find the parts of large datasets that differ.\n");
+    PRINTVALSTREAM(rawoutstream,
+                   "         Differences are reported in the same order as with one thread.\n");
     PRINTVALSTREAM(rawoutstream, "   -n C, --count=C\n");
     PRINTVALSTREAM(rawoutstream, "         Print differences up to C. C must be a positive integer.\n");
     PRINTVALSTREAM(rawoutstream, "   -d D, --delta=D\n");
@@ -386,6 +386,8 @@ usage(const char *prog)
                    "  B - is the form of binary output: NATIVE for a memory type, FILE for the\n");
     PRINTVALSTREAM(rawoutstream,
                    "        file type, LE or BE for pre-existing little or big endian types.\n");
+    PRINTVALSTREAM(rawoutstream,
+                   "        CSV writes the values as comma separated text, one line per row.\n");
     PRINTVALSTREAM(rawoutstream, "        Must be used with -o (output file) and it is recommended that\n");
     PRINTVALSTREAM(rawoutstream,
                    "        -d (dataset) is used. B is an optional argument, defaults to NATIVE\n");
@@ -568,6 +570,8 @@ set_binary_form(const char *form)
         bform = 2;
     else if (HDstrcmp(form, "BE") == 0) /* convert to big endian */
         bform = 3;
+    else if (HDstrcmp(form, "CSV") == 0) /* comma separated text */
+        bform = 4;
 
     return bform;
 }
@@ -39,6 +39,8 @@
  */
 static int  get_hyperslab(hid_t dcpl_id, int rank_dset, const hsize_t dims_dset[], size_t size_datum,
                           hsize_t dims_hslab[], hsize_t *hslab_nbytes_p);
+static int  can_copy_raw_chunks(hid_t dcpl_in, hid_t dset_out, hid_t ftype_id, hid_t wtype_id);
+static int  copy_raw_chunks(hid_t dset_in, hid_t dset_out);
 static void print_dataset_info(hid_t dcpl_id, char *objname, double per, int pr);
 static int  do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *options);
 static int  copy_user_block(const char *infile, const char *outfile, hsize_t size);
@@ -529,6 +531,151 @@ done:
     return ret_value;
 } /* end get_hyperslab() */
 
+/*-------------------------------------------------------------------------
+ * Function: can_copy_raw_chunks
+ *
+ * Purpose:  determine if the chunks of the input dataset can be copied to
+ *           the output dataset as they are stored in the file, without
+ *           being decompressed and compressed again: both datasets must be
+ *           chunked with the same chunk dimensions and the same filter
+ *           pipeline, and the data must not need converting (or point into
+ *           the input file, as variable-length data and strings do)
+ *
+ * Return:   1, yes, 0, no, -1 error
+ *-------------------------------------------------------------------------
+ */
+static int
+can_copy_raw_chunks(hid_t dcpl_in, hid_t dset_out, hid_t ftype_id, hid_t wtype_id)
+{
+    hid_t   dcpl_out = H5I_INVALID_HID;
+    hsize_t chunk_in[H5S_MAX_RANK];
+    hsize_t chunk_out[H5S_MAX_RANK];
+    int     rank_in, rank_out;
+    int     nfilters_in, nfilters_out;
+    int     i, k;
+    htri_t  status;
+    int     ret_value = 0;
+
+    /* the data must be copied without conversion */
+    if ((status = H5Tequal(ftype_id, wtype_id)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Tequal failed");
+    if (!status)
+        H5TOOLS_GOTO_DONE(0);
+    if ((status = h5tools_detect_vlen(wtype_id)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "h5tools_detect_vlen failed");
+    if (status)
+        H5TOOLS_GOTO_DONE(0);
+    if ((status = H5Tdetect_class(wtype_id, H5T_REFERENCE)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Tdetect_class failed");
+    if (status)
+        H5TOOLS_GOTO_DONE(0);
+
+    /* both datasets must be chunked the same way */
+    if ((dcpl_out = H5Dget_create_plist(dset_out)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Dget_create_plist failed");
+    if (H5Pget_layout(dcpl_in) != H5D_CHUNKED || H5Pget_layout(dcpl_out) != H5D_CHUNKED)
+        H5TOOLS_GOTO_DONE(0);
+    if ((rank_in = H5Pget_chunk(dcpl_in, H5S_MAX_RANK, chunk_in)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_chunk failed");
+    if ((rank_out = H5Pget_chunk(dcpl_out, H5S_MAX_RANK, chunk_out)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_chunk failed");
+    if (rank_in != rank_out)
+        H5TOOLS_GOTO_DONE(0);
+    for (k = 0; k < rank_in; k++)
+        if (chunk_in[k] != chunk_out[k])
+            H5TOOLS_GOTO_DONE(0);
+
+    /* with the same filters, in the same order, with the same parameters */
+    if ((nfilters_in = H5Pget_nfilters(dcpl_in)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_nfilters failed");
+    if ((nfilters_out = H5Pget_nfilters(dcpl_out)) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Pget_nfilters failed");
+    if (nfilters_in != nfilters_out)
+        H5TOOLS_GOTO_DONE(0);
+    for (i = 0; i < nfilters_in; i++) {
+        unsigned     flags_in, flags_out;
+        size_t       cd_nelmts_in  = 20;
+        size_t       cd_nelmts_out = 20;
+        unsigned     cd_values_in[20];
+        unsigned     cd_values_out[20];
+        H5Z_filter_t filtn_in, filtn_out;
+
+        if ((filtn_in = H5Pget_filter2(dcpl_in, (unsigned)i, &flags_in, &cd_nelmts_in, cd_values_in, 0, NULL,
+                                       NULL)) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Pget_filter2 failed");
+        if ((filtn_out = H5Pget_filter2(dcpl_out, (unsigned)i, &flags_out, &cd_nelmts_out, cd_values_out, 0,
+                                        NULL, NULL)) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Pget_filter2 failed");
+        if (filtn_in != filtn_out || flags_in != flags_out || cd_nelmts_in != cd_nelmts_out ||
+            cd_nelmts_in > 20)
+            H5TOOLS_GOTO_DONE(0);
+        if (cd_nelmts_in && HDmemcmp(cd_values_in, cd_values_out, cd_nelmts_in * sizeof(unsigned)))
+            H5TOOLS_GOTO_DONE(0);
+    }
+
+    ret_value = 1;
+
+done:
+    if (dcpl_out >= 0)
+        H5Pclose(dcpl_out);
+
+    return ret_value;
+} /* end can_copy_raw_chunks() */
+
+/*-------------------------------------------------------------------------
+ * Function: copy_raw_chunks
+ *
+ * Purpose:  copy the allocated chunks of the input dataset to the output
+ *           dataset as they are stored in the file, with H5Dread_chunk and
+ *           H5Dwrite_chunk, visiting the chunks in the order of the chunk
+ *           index
+ *
+ * Return:   0, ok, -1 no
+ *-------------------------------------------------------------------------
+ */
+static int
+copy_raw_chunks(hid_t dset_in, hid_t dset_out)
+{
+    hsize_t offset[H5S_MAX_RANK];
+    hsize_t nchunks = 0;
+    hsize_t chunk_size;
+    hsize_t u;
+    size_t  buf_size = 0;
+    void *  buf      = NULL;
+    haddr_t addr;
+    int     ret_value = 0;
+
+    if (H5Dget_num_chunks(dset_in, H5S_ALL, &nchunks) < 0)
+        H5TOOLS_GOTO_ERROR((-1), "H5Dget_num_chunks failed");
+
+    for (u = 0; u < nchunks; u++) {
+        unsigned filter_mask = 0;
+
+        if (H5Dget_chunk_info(dset_in, H5S_ALL, u, offset, &filter_mask, &addr, &chunk_size) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Dget_chunk_info failed");
+        if (chunk_size == 0)
+            continue;
+        if ((size_t)chunk_size > buf_size) {
+            void *new_buf;
+
+            if (NULL == (new_buf = HDrealloc(buf, (size_t)chunk_size)))
+                H5TOOLS_GOTO_ERROR((-1), "can't allocate space for chunk");
+            buf      = new_buf;
+            buf_size = (size_t)chunk_size;
+        }
+        if (H5Dread_chunk(dset_in, H5P_DEFAULT, offset, &filter_mask, buf) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Dread_chunk failed");
+        if (H5Dwrite_chunk(dset_out, H5P_DEFAULT, filter_mask, offset, (size_t)chunk_size, buf) < 0)
+            H5TOOLS_GOTO_ERROR((-1), "H5Dwrite_chunk failed");
+    }
+
+done:
+    if (buf)
+        HDfree(buf);
+
+    return ret_value;
+} /* end copy_raw_chunks() */
+
 /*-------------------------------------------------------------------------
  * Function: do_copy_objects
  *
@@ -611,6 +758,7 @@ do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
     hsize_t            dsize_out;          /* output dataset size after filter */
     int                apply_s;            /* flag for apply filter to small dataset sizes */
     int                apply_f;            /* flag for apply filter to return error on H5Dcreate */
+    int                raw_copy;           /* flag for chunks copied as stored */
     void *             buf       = NULL;   /* buffer for raw data */
     void *             hslab_buf = NULL;   /* hyperslab buffer for raw data */
     int                has_filter;         /* current object has a filter */
@@ -959,10 +1107,26 @@ do_copy_objects(hid_t fidin, hid_t fidout, trav_table_t *travt, pack_opt_t *opti
                                 } /* end if retry dataset create */
 
                                 /*-------------------------------------------------------------------------
-                                 * read/write
+                                 * copy the chunks as they are stored, if the output dataset is
+                                 * chunked and filtered the same way as the input dataset
                                  *-------------------------------------------------------------------------
                                  */
+                                raw_copy = 0;
                                 if (nelmts > 0 && space_status != H5D_SPACE_STATUS_NOT_ALLOCATED) {
+                                    if ((raw_copy = can_copy_raw_chunks(dcpl_in, dset_out, ftype_id,
+                                                                        wtype_id)) < 0)
+                                        H5TOOLS_GOTO_ERROR((-1), "can_copy_raw_chunks failed");
+                                    if (raw_copy)
+                                        if (copy_raw_chunks(dset_in, dset_out) < 0)
+                                            H5TOOLS_GOTO_ERROR((-1), "copy_raw_chunks failed");
+                                }
+
+                                /*-------------------------------------------------------------------------
+                                 * read/write
+                                 *-------------------------------------------------------------------------
+                                 */
+                                if (!raw_copy && nelmts > 0 &&
+                                    space_status != H5D_SPACE_STATUS_NOT_ALLOCATED) {
                                     size_t need = (size_t)(nelmts * msize); /* bytes needed */
 
                                     /* have to read the whole dataset if there is only one element in the
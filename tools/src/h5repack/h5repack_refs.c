@@ -808,29 +808,22 @@ done:
 static const char *
 MapIdToName(hid_t refobj_id, trav_table_t *travt)
 {
-    unsigned int u;
-    const char * ret = NULL;
-
-    /* linear search */
-    for (u = 0; u < travt->nobjs; u++) {
-        if (travt->objs[u].type == (h5trav_type_t)H5O_TYPE_DATASET ||
-            travt->objs[u].type == (h5trav_type_t)H5O_TYPE_GROUP ||
-            travt->objs[u].type == (h5trav_type_t)H5O_TYPE_NAMED_DATATYPE) {
-            H5O_info2_t ref_oinfo; /* Stat for the refobj id */
-            int         token_cmp;
-
-            /* obtain information to identify the referenced object uniquely */
-            if (H5Oget_info3(refobj_id, &ref_oinfo, H5O_INFO_BASIC) < 0)
-                goto out;
-
-            if (H5Otoken_cmp(refobj_id, &ref_oinfo.token, &travt->objs[u].obj_token, &token_cmp) < 0)
-                goto out;
-            if (!token_cmp) {
-                ret = travt->objs[u].name;
-                goto out;
-            }
-        } /* end if */
-    }     /* u */
+    H5O_info2_t ref_oinfo; /* Stat for the refobj id */
+    ssize_t     idx;
+    const char *ret = NULL;
+
+    /* obtain information to identify the referenced object uniquely */
+    if (H5Oget_info3(refobj_id, &ref_oinfo, H5O_INFO_BASIC) < 0)
+        goto out;
+
+    /* look the object up by token */
+    if ((idx = trav_table_find_token(travt, &ref_oinfo.token)) < 0)
+        goto out;
+
+    if (travt->objs[idx].type == (h5trav_type_t)H5O_TYPE_DATASET ||
+        travt->objs[idx].type == (h5trav_type_t)H5O_TYPE_GROUP ||
+        travt->objs[idx].type == (h5trav_type_t)H5O_TYPE_NAMED_DATATYPE)
+        ret = travt->objs[idx].name;
 
 out:
     return ret;
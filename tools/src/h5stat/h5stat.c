@@ -158,6 +158,8 @@ static int display_dset_metadata  = FALSE; /* display file space info for datase
 
 static int display_object = FALSE; /* not implemented yet */
 
+static int fast_mode = FALSE; /* only read object headers and indexes, do not open datasets */
+
 /* Initialize threshold for small groups/datasets/attributes */
 static int sgroups_threshold = DEF_SIZE_SMALL_GROUPS;
 static int sdsets_threshold  = DEF_SIZE_SMALL_DSETS;
@@ -270,6 +272,7 @@ static struct long_options l_opts[] = {{"help", no_arg, 'h'},
                                        {"su", no_arg, 'S'},
                                        {"s3-cred", require_arg, 'w'},
                                        {"hdfs-attrs", require_arg, 'H'},
+                                       {"fast", no_arg, 'q'},
                                        {NULL, 0, '\0'}};
 
 static void
@@ -318,6 +321,10 @@ usage(const char *prog)
     HDfprintf(stdout, "                           than 0.  The default threshold is 10.\n");
     HDfprintf(stdout, "     -s, --freespace       Print free space information\n");
     HDfprintf(stdout, "     -S, --summary         Print summary of file space information\n");
+    HDfprintf(stdout, "     --fast                Gather statistics from object headers and indexes\n");
+    HDfprintf(stdout, "                           only.  Datasets are not opened, so their dimension,\n");
+    HDfprintf(stdout, "                           datatype, layout, filter and raw data information\n");
+    HDfprintf(stdout, "                           is not printed.\n");
     HDfprintf(stdout, "     --enable-error-stack  Prints messages from the HDF5 error stack as they occur\n");
     HDfprintf(stdout, "     --s3-cred=<cred>      Access file on S3, using provided credential\n");
     HDfprintf(stdout, "                           <cred> :: (region,id,key)\n");
@@ -528,9 +535,6 @@ dataset_stats(iter_t *iter, const char *name, const H5O_info2_t *oi, const H5O_n
     iter->dset_ohdr_info.total_size += native_oi->hdr.space.total;
     iter->dset_ohdr_info.free_size += native_oi->hdr.space.free;
 
-    if ((did = H5Dopen2(iter->fid, name, H5P_DEFAULT)) < 0)
-        H5TOOLS_GOTO_ERROR(FAIL, "H5Dopen() failed");
-
     /* Update dataset metadata info */
     iter->datasets_index_storage_size += native_oi->meta_size.obj.index_size;
     iter->datasets_heap_storage_size += native_oi->meta_size.obj.heap_size;
@@ -539,6 +543,13 @@ dataset_stats(iter_t *iter, const char *name, const H5O_info2_t *oi, const H5O_n
     if ((ret_value = attribute_stats(iter, oi, native_oi)) < 0)
         H5TOOLS_GOTO_ERROR(FAIL, "attribute_stats() failed");
 
+    /* Opening the dataset costs far more than everything above, skip it */
+    if (fast_mode)
+        H5TOOLS_GOTO_DONE(SUCCEED);
+
+    if ((did = H5Dopen2(iter->fid, name, H5P_DEFAULT)) < 0)
+        H5TOOLS_GOTO_ERROR(FAIL, "H5Dopen() failed");
+
     /* Get storage info */
     /* Failure 0 indistinguishable from no-data-stored 0 */
     storage = H5Dget_storage_size(did);
@@ -1027,6 +1038,12 @@ parse_command_line(int argc, const char *argv[], struct handler_t **hand_ret)
                 display_summary = TRUE;
                 break;
 
+            case 'q':
+                fast_mode = TRUE;
+                /* Only totals are printed, so the visiting order does not matter */
+                h5trav_set_breadth_first(TRUE);
+                break;
+
             case 'O':
                 display_all    = FALSE;
                 display_object = TRUE;
@@ -1226,8 +1243,9 @@ print_file_metadata(const iter_t *iter)
     HDfprintf(stdout, "\tObject headers: (total/unused)\n");
     HDfprintf(stdout, "\t\tGroups: %" PRIuHSIZE "/%" PRIuHSIZE "\n", iter->group_ohdr_info.total_size,
               iter->group_ohdr_info.free_size);
-    HDfprintf(stdout, "\t\tDatasets(exclude compact data): %" PRIuHSIZE "/%" PRIuHSIZE "\n",
-              iter->dset_ohdr_info.total_size, iter->dset_ohdr_info.free_size);
+    HDfprintf(stdout, "\t\tDatasets(%s compact data): %" PRIuHSIZE "/%" PRIuHSIZE "\n",
+              fast_mode ? "include" : "exclude", iter->dset_ohdr_info.total_size,
+              iter->dset_ohdr_info.free_size);
     HDfprintf(stdout, "\t\tDatatypes: %" PRIuHSIZE "/%" PRIuHSIZE "\n", iter->dtype_ohdr_info.total_size,
               iter->dtype_ohdr_info.free_size);
 
@@ -1359,7 +1377,9 @@ print_dataset_info(const iter_t *iter)
     unsigned long total; /* Total count for various statistics */
     unsigned      u;     /* Local index variable */
 
-    if (iter->uniq_dsets > 0) {
+    if (iter->uniq_dsets > 0 && fast_mode)
+        HDprintf("Dataset information: not gathered with --fast\n");
+    else if (iter->uniq_dsets > 0) {
         HDprintf("Dataset dimension information:\n");
         HDprintf("\tMax. rank of datasets: %u\n", iter->max_dset_rank);
         HDprintf("\tDataset ranks:\n");
@@ -1622,7 +1642,10 @@ print_storage_summary(const iter_t *iter)
         iter->SM_index_storage_size + iter->SM_heap_storage_size + iter->free_hdr;
 
     HDfprintf(stdout, "  File metadata: %" PRIuHSIZE " bytes\n", total_meta);
-    HDfprintf(stdout, "  Raw data: %" PRIuHSIZE " bytes\n", iter->dset_storage_size);
+    if (fast_mode)
+        HDprintf("  Raw data: not gathered with --fast, included in unaccounted space\n");
+    else
+        HDfprintf(stdout, "  Raw data: %" PRIuHSIZE " bytes\n", iter->dset_storage_size);
 
     percent = ((double)iter->free_space / (double)iter->filesize) * (double)100.0f;
     HDfprintf(stdout, "  Amount/Percent of tracked free space: %" PRIuHSIZE " bytes/%3.1f%%\n",
@@ -70,6 +70,8 @@
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_strings2.h5
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_eps1.h5
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_eps2.h5
+      ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_blocks1.h5
+      ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_blocks2.h5
       # tools/testfiles/vds
       ${HDF5_TOOLS_DIR}/testfiles/vds/1_a.h5
       ${HDF5_TOOLS_DIR}/testfiles/vds/1_b.h5
@@ -112,6 +114,8 @@
   set (LIST_OTHER_TEST_FILES
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_10.txt
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_100.txt
+      ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_100t.txt
+      ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_100n.txt
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_11.txt
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_12.txt
       ${HDF5_TOOLS_TEST_H5DIFF_SOURCE_DIR}/testfiles/h5diff_13.txt
@@ -549,6 +553,9 @@
   # epsilon
   set (EPS1 h5diff_eps1.h5)
   set (EPS2 h5diff_eps2.h5)
+  # differences in non-adjacent blocks
+  set (BLOCKS1 h5diff_blocks1.h5)
+  set (BLOCKS2 h5diff_blocks2.h5)
 
 # VDS tests
   set (FILEV1 1_vds.h5)
@@ -568,6 +575,10 @@
           h5diff_10.out.err
           h5diff_100.out
           h5diff_100.out.err
+          h5diff_100t.out
+          h5diff_100t.out.err
+          h5diff_100n.out
+          h5diff_100n.out.err
           h5diff_101.out
           h5diff_101.out.err
           h5diff_102.out
@@ -1233,6 +1244,10 @@ ADD_H5_TEST (h5diff_90 0 -v ${FILE2} ${FILE2})
 
 # 10. read by hyperslab, print indexes
 ADD_H5_TEST (h5diff_100 1 -v ${FILE9} ${FILE10})
+# same, scanning the hyperslabs with several threads
+ADD_H5_TEST (h5diff_100t 1 -v --threads=4 ${FILE9} ${FILE10})
+# --count over differences in several non-adjacent blocks
+ADD_H5_TEST (h5diff_100n 1 -v -n 3 ${BLOCKS1} ${BLOCKS2})
 
 # 11. floating point comparison
 # double value
@@ -99,6 +99,9 @@ size_t H5TOOLS_MALLOCSIZE = (128 * 1024 * 1024);
 /* double dataset and epsilon */
 #define DIFF_EPS1 "h5diff_eps1.h5"
 #define DIFF_EPS2 "h5diff_eps2.h5"
+/* differences in several non-adjacent blocks of a large dataset */
+#define DIFF_BLOCKS1 "h5diff_blocks1.h5"
+#define DIFF_BLOCKS2 "h5diff_blocks2.h5"
 
 #define UIMAX    4294967295u /*Maximum value for a variable of type unsigned int */
 #define STR_SIZE 3
@@ -178,6 +181,7 @@ static void test_data_nocomparables(const char *fname, int diff);
 static void test_objs_nocomparables(const char *fname1, const char *fname2);
 static void test_objs_strings(const char *fname, const char *fname2);
 static void test_double_epsilon(const char *fname1, const char *fname2);
+static void test_diff_blocks(const char *fname1, const char *fname2);
 
 /* called by test_attributes() and test_datasets() */
 static void write_attr_strings(hid_t loc_id, const char *dset_name, hid_t fid, int make_diffs);
@@ -298,6 +302,9 @@ main(void)
     /* double dataset and epsilion. HDFFV-10897 */
     test_double_epsilon(DIFF_EPS1, DIFF_EPS2);
 
+    /* differences in non-adjacent 64KB blocks, for --count */
+    test_diff_blocks(DIFF_BLOCKS1, DIFF_BLOCKS2);
+
     return EXIT_SUCCESS;
 }
 
@@ -8058,6 +8065,58 @@ error:
     H5E_END_TRY;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: test_diff_blocks
+ *
+ * Purpose: Create two files with a 256KB integer dataset that differs in
+ *          the first, third and fourth 64KB block, so that h5diff compares
+ *          two separate runs of differing blocks element by element.
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+test_diff_blocks(const char *fname1, const char *fname2)
+{
+    hid_t   fid1 = H5I_INVALID_HID, fid2 = H5I_INVALID_HID;
+    hsize_t dims1[1]     = {65536};
+    size_t  block_nelmts = 65536 / 4;
+    int *   wdata        = NULL;
+    size_t  i;
+
+    if ((fid1 = H5Fcreate(fname1, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        PROGRAM_ERROR;
+    if ((fid2 = H5Fcreate(fname2, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        PROGRAM_ERROR;
+
+    if (NULL == (wdata = (int *)HDmalloc((size_t)dims1[0] * sizeof(int))))
+        PROGRAM_ERROR;
+    for (i = 0; i < (size_t)dims1[0]; i++)
+        wdata[i] = (int)i;
+
+    if (write_dset(fid1, 1, dims1, "dset", H5T_NATIVE_INT, wdata) < 0)
+        PROGRAM_ERROR;
+
+    /* two differences in block 0 and in each of blocks 2 and 3 */
+    wdata[10]                   = -1;
+    wdata[20]                   = -1;
+    wdata[2 * block_nelmts + 5] = -1;
+    wdata[2 * block_nelmts + 6] = -1;
+    wdata[3 * block_nelmts + 7] = -1;
+    wdata[3 * block_nelmts + 8] = -1;
+
+    if (write_dset(fid2, 1, dims1, "dset", H5T_NATIVE_INT, wdata) < 0)
+        PROGRAM_ERROR;
+
+error:
+    HDfree(wdata);
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(fid1);
+        H5Fclose(fid2);
+    }
+    H5E_END_TRY;
+}
+
 /*-------------------------------------------------------------------------
  * Function: write_attr
  *
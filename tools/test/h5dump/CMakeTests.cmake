@@ -219,6 +219,8 @@
   )
   set (HDF5_REFERENCE_EXP_FILES
       tall-6.exp
+      tbincsv1.exp
+      tbincsv2.exp
       tnoddlfile.exp
       trawdatafile.exp
       trawssetfile.exp
@@ -1097,6 +1099,10 @@
   ADD_H5_EXPORT_TEST (tstr2bin2 tstr2.h5 0 --enable-error-stack -d /g2/dset2 -b -o)
   ADD_H5_EXPORT_TEST (tstr2bin6 tstr2.h5 0 --enable-error-stack -d /g6/dset6 -b -o)
 
+  # test for comma separated text output
+  ADD_H5_EXPORT_TEST (tbincsv1 tdset.h5 0 --enable-error-stack -d /dset1 -b CSV -o)
+  ADD_H5_EXPORT_TEST (tbincsv2 tcompound.h5 0 --enable-error-stack -d /dset1 -b CSV -o)
+
   # NATIVE default. the NATIVE test can be validated with h5import/h5diff
 #  ADD_H5_TEST_IMPORT (tbin1 out1D tbinary.h5 0 --enable-error-stack -d integer -b)
 
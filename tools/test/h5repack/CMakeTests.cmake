@@ -54,6 +54,7 @@
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_HDFFV-10590_CVE-2018-17432.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_nbit.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_objs.h5
+      ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_rawchunk.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_refs.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_shuffle.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_soffset.h5
@@ -149,6 +150,7 @@
   set (LIST_DDL_TEST_FILES
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/crtorder.tordergr.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/deflate_limit.h5repack_layout.h5
+      ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/rawchunk_mask.h5repack_rawchunk.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_layout.h5
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_layout.h5-plugin_test
       ${HDF5_TOOLS_TEST_H5REPACK_SOURCE_DIR}/testfiles/h5repack_layout.h5-plugin_version_test
@@ -966,6 +968,7 @@
   set (FILE16 tfamily%05d.h5)           # located in common testfiles folder
   set (FILE18 h5repack_layout2.h5)
   set (FILE19 h5repack_layout3.h5)
+  set (FILE20 h5repack_rawchunk.h5)
   set (FILE_REF h5repack_refs.h5)
   set (FILE_ATTR_REF h5repack_attr_refs.h5)
   set (FILEV1 1_vds.h5)
@@ -1042,6 +1045,8 @@
         out-objs.h5repack_objs.h5
         out-gt_mallocsize.h5repack_objs.h5
         out-bug1814.h5repack_refs.h5
+        out-rawchunk.h5repack_rawchunk.h5
+        out-rawchunk_mask.h5repack_rawchunk.h5
         out-shuffle_copy.h5repack_shuffle.h5
         out-shuffle_remove.h5repack_shuffle.h5
         out-scale_add.h5repack_soffset.h5
@@ -1357,6 +1362,13 @@
   set (TESTTYPE "TEST")
   ADD_H5_DMP_TEST (crtorder ${TESTTYPE} 0 ${arg})
 
+#raw chunk copy; the edge chunk is stored unfiltered, which only a raw copy keeps,
+#and the variable-length strings must not be copied raw
+  set (arg ${FILE20} -l dset:CHUNK=4x3)
+  set (TESTTYPE "TEST")
+  ADD_H5_TEST (rawchunk ${TESTTYPE} ${arg})
+  ADD_H5_DMP_TEST (rawchunk_mask ${TESTTYPE} 0 ${arg})
+
 ###################################################################################################
 # Testing paged aggregation related options:
 #   -G pagesize
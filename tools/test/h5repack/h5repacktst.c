@@ -80,6 +80,10 @@
 
 #define FNAME18 "h5repack_layout2.h5"
 
+/* Chunks copied without being filtered again */
+#define FNAME19    "h5repack_rawchunk.h5"
+#define FNAME19OUT "h5repack_rawchunk_out.h5"
+
 /* Files for testing file space paging */
 #define FSPACE_OUT "h5repack_fspace_OUT.h5"   /* The output file */
 #define NELMTS(X)  (sizeof(X) / sizeof(X[0])) /* # of elements */
@@ -115,6 +119,13 @@ const char *H5REPACK_FILENAMES[] = {"h5repack_big_out", NULL};
 #define CDIM2 DIM2 / 2
 #define RANK  2
 
+/* Dataset of the raw chunk copy test, with partial edge chunks */
+#define DIM1_RC       10
+#define DIM2_RC       7
+#define CDIM1_RC      4
+#define CDIM2_RC      3
+#define RAWCHUNK_MASK 0x3 /* shuffle and fletcher32 skipped */
+
 /* Size of userblock (for userblock test) */
 #define USERBLOCK_SIZE 2048
 
@@ -136,6 +147,8 @@ static int make_early(void);
 static int make_layout(hid_t loc_id);
 static int make_layout2(hid_t loc_id);
 static int make_layout3(hid_t loc_id);
+static int make_rawchunk(hid_t loc_id);
+static int make_rawchunk_vlstr(hid_t loc_id);
 #ifdef H5_HAVE_FILTER_SZIP
 static int make_szip(hid_t loc_id);
 #endif /* H5_HAVE_FILTER_SZIP */
@@ -1707,6 +1720,60 @@ main(void)
         GOERROR;
     PASSED();
 
+    /*-------------------------------------------------------------------------
+     * test copying the chunks without filtering them again; the partial edge
+     * chunk was written with its filters skipped, which only a raw copy keeps.
+     * The variable-length string datasets must be copied through memory.
+     * A layout option is given so that the datasets are not just H5Ocopy'ed.
+     *-------------------------------------------------------------------------
+     */
+    TESTING("    copy of chunks as they are stored");
+
+    if (h5repack_init(&pack_options, 0, FALSE) < 0)
+        GOERROR;
+    if (h5repack_addlayout("dset:CHUNK=4x3", &pack_options) < 0)
+        GOERROR;
+    if (h5repack(FNAME19, FNAME19OUT, &pack_options) < 0)
+        GOERROR;
+    if (h5diff(FNAME19, FNAME19OUT, NULL, NULL, &diff_options) > 0)
+        GOERROR;
+
+    /* verify the filter masks of a full chunk and of the edge chunk */
+    {
+        hsize_t  offset[RANK];
+        hsize_t  size;
+        haddr_t  addr;
+        unsigned filter_mask;
+        hid_t    fid;
+        hid_t    did;
+
+        if ((fid = H5Fopen(FNAME19OUT, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+            GOERROR;
+        if ((did = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0)
+            GOERROR;
+        offset[0] = offset[1] = 0;
+        if (H5Dget_chunk_info_by_coord(did, offset, &filter_mask, &addr, &size) < 0)
+            GOERROR;
+        if (filter_mask != 0)
+            GOERROR;
+        offset[0] = DIM1_RC - DIM1_RC % CDIM1_RC;
+        offset[1] = DIM2_RC - DIM2_RC % CDIM2_RC;
+        if (H5Dget_chunk_info_by_coord(did, offset, &filter_mask, &addr, &size) < 0)
+            GOERROR;
+        if (filter_mask != RAWCHUNK_MASK)
+            GOERROR;
+        if (size != CDIM1_RC * CDIM2_RC * sizeof(int))
+            GOERROR;
+        if (H5Dclose(did) < 0)
+            GOERROR;
+        if (H5Fclose(fid) < 0)
+            GOERROR;
+    }
+
+    if (h5repack_end(&pack_options) < 0)
+        GOERROR;
+    PASSED();
+
     /*-------------------------------------------------------------------------
      * clean temporary test files
      *-------------------------------------------------------------------------
@@ -1826,6 +1893,22 @@ make_testfiles(void)
     if (H5Fclose(fid) < 0)
         return -1;
 
+    /*-------------------------------------------------------------------------
+     * for test copying the chunks as they are stored
+     *-------------------------------------------------------------------------
+     */
+    if ((fid = H5Fcreate(FNAME19, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        return -1;
+
+    if (make_rawchunk(fid) < 0)
+        goto out;
+
+    if (make_rawchunk_vlstr(fid) < 0)
+        goto out;
+
+    if (H5Fclose(fid) < 0)
+        return -1;
+
     /*-------------------------------------------------------------------------
      * create a file for the H5D_ALLOC_TIME_EARLY test
      *-------------------------------------------------------------------------
@@ -3451,6 +3534,165 @@ error:
     return -1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function: make_rawchunk
+ *
+ * Purpose: make a chunked dataset with the shuffle and fletcher32 filters
+ *          and partial edge chunks, for the test that h5repack copies the
+ *          chunks as they are stored.  The last edge chunk is written with
+ *          H5Dwrite_chunk with both filters skipped, so that its filter
+ *          mask is only kept by a raw copy.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+make_rawchunk(hid_t loc_id)
+{
+    hid_t   did              = H5I_INVALID_HID;
+    hid_t   sid              = H5I_INVALID_HID;
+    hid_t   dcpl             = H5I_INVALID_HID;
+    hsize_t dims[RANK]       = {DIM1_RC, DIM2_RC};
+    hsize_t chunk_dims[RANK] = {CDIM1_RC, CDIM2_RC};
+    hsize_t offset[RANK]     = {DIM1_RC - DIM1_RC % CDIM1_RC, DIM2_RC - DIM2_RC % CDIM2_RC};
+    int     buf[DIM1_RC][DIM2_RC];
+    int     chunk[CDIM1_RC][CDIM2_RC];
+    int     i, j;
+
+    for (i = 0; i < DIM1_RC; i++)
+        for (j = 0; j < DIM2_RC; j++)
+            buf[i][j] = i * DIM2_RC + j;
+    for (i = 0; i < CDIM1_RC; i++)
+        for (j = 0; j < CDIM2_RC; j++)
+            chunk[i][j] = (int)(offset[0] + (hsize_t)i) * DIM2_RC + (int)offset[1] + j;
+
+    if ((sid = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, RANK, chunk_dims) < 0)
+        goto error;
+    if (H5Pset_shuffle(dcpl) < 0)
+        goto error;
+    if (H5Pset_fletcher32(dcpl) < 0)
+        goto error;
+    if ((did = H5Dcreate2(loc_id, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if (H5Dwrite_chunk(did, H5P_DEFAULT, RAWCHUNK_MASK, offset, sizeof chunk, chunk) < 0)
+        goto error;
+
+    if (H5Dclose(did) < 0)
+        goto error;
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+    if (H5Sclose(sid) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+    }
+    H5E_END_TRY;
+
+    return -1;
+}
+
+/*-------------------------------------------------------------------------
+ * Function: make_rawchunk_vlstr
+ *
+ * Purpose: make chunked datasets of variable-length strings, alone and in
+ *          a compound.  Their chunks hold global heap IDs that point into
+ *          the input file, so h5repack must not copy them as they are
+ *          stored.
+ *
+ *-------------------------------------------------------------------------
+ */
+typedef struct {
+    int         i;
+    const char *s;
+} vlstr_cmpd_t;
+
+static int
+make_rawchunk_vlstr(hid_t loc_id)
+{
+    hid_t        did           = H5I_INVALID_HID;
+    hid_t        sid           = H5I_INVALID_HID;
+    hid_t        dcpl          = H5I_INVALID_HID;
+    hid_t        str_tid       = H5I_INVALID_HID;
+    hid_t        cmpd_tid      = H5I_INVALID_HID;
+    hsize_t      dims[1]       = {5};
+    hsize_t      chunk_dims[1] = {2};
+    const char * buf[5]        = {"one", "two", "three", "four", "five"};
+    vlstr_cmpd_t cmpd_buf[5];
+    int          i;
+
+    for (i = 0; i < 5; i++) {
+        cmpd_buf[i].i = i;
+        cmpd_buf[i].s = buf[i];
+    }
+
+    if ((sid = H5Screate_simple(1, dims, NULL)) < 0)
+        goto error;
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+    if (H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        goto error;
+    if ((str_tid = H5Tcopy(H5T_C_S1)) < 0)
+        goto error;
+    if (H5Tset_size(str_tid, H5T_VARIABLE) < 0)
+        goto error;
+    if ((cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(vlstr_cmpd_t))) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_tid, "i", HOFFSET(vlstr_cmpd_t, i), H5T_NATIVE_INT) < 0)
+        goto error;
+    if (H5Tinsert(cmpd_tid, "s", HOFFSET(vlstr_cmpd_t, s), str_tid) < 0)
+        goto error;
+
+    if ((did = H5Dcreate2(loc_id, "vlstr", str_tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, str_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    if ((did = H5Dcreate2(loc_id, "cmpd_vlstr", cmpd_tid, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto error;
+    if (H5Dwrite(did, cmpd_tid, H5S_ALL, H5S_ALL, H5P_DEFAULT, cmpd_buf) < 0)
+        goto error;
+    if (H5Dclose(did) < 0)
+        goto error;
+
+    if (H5Tclose(cmpd_tid) < 0)
+        goto error;
+    if (H5Tclose(str_tid) < 0)
+        goto error;
+    if (H5Pclose(dcpl) < 0)
+        goto error;
+    if (H5Sclose(sid) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(did);
+        H5Tclose(cmpd_tid);
+        H5Tclose(str_tid);
+        H5Pclose(dcpl);
+        H5Sclose(sid);
+    }
+    H5E_END_TRY;
+
+    return -1;
+}
+
 /*-------------------------------------------------------------------------
  * Function: make a file with an integer dataset with a fill value
  *
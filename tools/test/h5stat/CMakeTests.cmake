@@ -51,6 +51,8 @@
       h5stat_numattrs2
       h5stat_numattrs3
       h5stat_numattrs4
+      h5stat_fast1
+      h5stat_fast2
   )
   set (HDF5_REFERENCE_ERR_FILES
       h5stat_err_refcount
@@ -225,6 +227,10 @@
 #   -A -a 100
   ADD_H5_TEST (h5stat_numattrs4 0 -A -a 100 h5stat_newgrat.h5)
 #
+# Tests for --fast option
+  ADD_H5_TEST (h5stat_fast1 0 --fast h5stat_filters.h5)
+  ADD_H5_TEST (h5stat_fast2 0 --fast -g h5stat_newgrat.h5)
+#
 # Tests to verify HDFFV-10333:
 # h5stat_err_refcount.h5 is generated by h5stat_gentest.c
 # h5stat_err_old_layout.h5 and h5stat_err_old_fill.h5: see explanation in h5stat_gentest.c
@@ -31,6 +31,7 @@ if (HDF5_TEST_SERIAL)
           chunk.h5
           iopipe.h5
           iopipe.raw
+          log_replay.trace
           x-diag-rd.dat
           x-diag-wr.dat
           x-rowmaj-rd.dat
@@ -42,6 +43,8 @@ if (HDF5_TEST_SERIAL)
           chunk.txt.err
           iopipe.txt
           iopipe.txt.err
+          log_replay.txt
+          log_replay.txt.err
           overhead.txt
           overhead.txt.err
           perf_meta.txt
@@ -114,6 +117,24 @@ if (HDF5_TEST_SERIAL)
       DEPENDS "PERFORM_h5perform-clearall-objects"
   )
 
+  if (HDF5_ENABLE_USING_MEMCHECKER)
+    add_test (NAME PERFORM_log_replay COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:log_replay>)
+  else ()
+    add_test (NAME PERFORM_log_replay COMMAND "${CMAKE_COMMAND}"
+        -D "TEST_EMULATOR=${CMAKE_CROSSCOMPILING_EMULATOR}"
+        -D "TEST_PROGRAM=$<TARGET_FILE:log_replay>"
+        -D "TEST_ARGS:STRING="
+        -D "TEST_EXPECT=0"
+        -D "TEST_SKIP_COMPARE=TRUE"
+        -D "TEST_OUTPUT=log_replay.txt"
+        -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+        -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+    )
+  endif ()
+  set_tests_properties (PERFORM_log_replay PROPERTIES
+      DEPENDS "PERFORM_h5perform-clearall-objects"
+  )
+
   if (HDF5_ENABLE_USING_MEMCHECKER)
     add_test (NAME PERFORM_overhead COMMAND ${CMAKE_CROSSCOMPILING_EMULATOR} $<TARGET_FILE:overhead>)
   else ()
@@ -0,0 +1,615 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://www.hdfgroup.org/licenses.               *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:     Replays a binary I/O trace captured with the log driver
+ *              (H5Pset_fapl_log with H5FD_LOG_TRACE) against any file
+ *              driver and reports the throughput and the latency
+ *              distribution of the reads and writes.  This lets the I/O
+ *              pattern of a real application be benchmarked on another
+ *              driver or file system without the application itself.
+ *
+ *              The operations are issued through the public H5FD
+ *              interface, so the replay measures the driver alone, without
+ *              the metadata cache, the chunk cache or the datatype
+ *              conversions that sat above it when the trace was captured.
+ *
+ *              Only drivers with one flat address space can replay a trace;
+ *              the split and multi drivers place each kind of data at its
+ *              own range of addresses, so they are not offered.
+ *
+ *              Without a trace argument the program first captures one from
+ *              a small built-in chunked-dataset workload and replays that.
+ */
+
+#include "hdf5.h"
+#include "H5private.h"
+#include "h5tools.h"
+#include "h5tools_utils.h"
+
+#define PROGRAMNAME "log_replay"
+
+#define REPLAY_FILE   "log_replay.h5"     /* File the trace is replayed against     */
+#define REPLAY_MEMB   "log_replay-%d.h5"  /* The same, for the multi-file drivers   */
+#define CAPTURE_FILE  "log_replay_src.h5" /* File written by the built-in workload  */
+#define CAPTURE_TRACE "log_replay.trace"  /* Trace of the built-in workload         */
+
+/* Built-in workload: a 2-D chunked dataset of doubles */
+#define CAPTURE_DIM   512
+#define CAPTURE_CHUNK 64
+
+#define ONE_MB (1024.0 * 1024.0)
+
+/* Latency histogram: bucket 0 is below one microsecond, bucket i is
+ * [2^(i-1), 2^i) microseconds and the last bucket takes everything above */
+#define NBUCKETS 28
+
+/* Statistics for one kind of operation */
+typedef struct replay_stats_t {
+    unsigned long long nops;           /* Operations replayed                      */
+    unsigned long long nbytes;         /* Bytes transferred                        */
+    double             time;           /* Seconds spent in the driver              */
+    double             traced_time;    /* Seconds the trace recorded for the same  */
+    double             max_latency;    /* Slowest operation, in seconds            */
+    unsigned long long hist[NBUCKETS]; /* Latency histogram                        */
+} replay_stats_t;
+
+static const char *        s_opts   = "hd:o:n:pk";
+static struct long_options l_opts[] = {{"help", no_arg, 'h'},           {"driver", require_arg, 'd'},
+                                       {"output", require_arg, 'o'},    {"iterations", require_arg, 'n'},
+                                       {"pace", no_arg, 'p'},           {"keep", no_arg, 'k'},
+                                       {NULL, 0, '\0'}};
+
+/* Local prototypes */
+static void   usage(void);
+static herr_t set_driver(hid_t fapl, const char *name);
+static void   remove_file(const char *name);
+static herr_t capture_workload(const char *trace_name);
+static herr_t replay(FILE *fp, H5FD_t *file, long data_start, hbool_t pace, replay_stats_t *rd,
+                     replay_stats_t *wr, unsigned long long *ntrunc, double *wall);
+static void   record_latency(replay_stats_t *st, double latency, double traced, size_t nbytes);
+static void   report(const char *name, const replay_stats_t *st, double wall);
+
+/*-------------------------------------------------------------------------
+ * Function:    usage
+ *
+ * Purpose:     Print a usage message
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(void)
+{
+    HDfprintf(stdout, "usage: %s [OPTIONS] [TRACE]\n", PROGRAMNAME);
+    HDfprintf(stdout, "  OPTIONS\n");
+    HDfprintf(stdout, "     -h, --help              Print this usage message and exit\n");
+    HDfprintf(stdout, "     -d D, --driver=D        File driver to replay with [default: sec2]\n");
+    HDfprintf(stdout, "                             One of sec2, stdio, core, direct, log, family,\n");
+    HDfprintf(stdout, "                             iouring or stripe\n");
+    HDfprintf(stdout, "     -o F, --output=F        File to replay against [default: %s,\n", REPLAY_FILE);
+    HDfprintf(stdout, "                             or %s for family and stripe]\n", REPLAY_MEMB);
+    HDfprintf(stdout, "     -n N, --iterations=N    Replay the trace N times [default: 1]\n");
+    HDfprintf(stdout, "     -p, --pace              Issue each operation no earlier than its\n");
+    HDfprintf(stdout, "                             recorded start time\n");
+    HDfprintf(stdout, "     -k, --keep              Keep the replayed file\n");
+    HDfprintf(stdout, "\n");
+    HDfprintf(stdout, "  TRACE is a trace written by the log driver with H5FD_LOG_TRACE.  When it is\n");
+    HDfprintf(stdout, "  omitted, a trace of a built-in workload is captured to %s first.\n",
+              CAPTURE_TRACE);
+}
+
+/*-------------------------------------------------------------------------
+ * Function:    set_driver
+ *
+ * Purpose:     Set the file driver named NAME on FAPL
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+set_driver(hid_t fapl, const char *name)
+{
+    if (!HDstrcmp(name, "sec2")) {
+        if (H5Pset_fapl_sec2(fapl) < 0)
+            return -1;
+    }
+    else if (!HDstrcmp(name, "stdio")) {
+        if (H5Pset_fapl_stdio(fapl) < 0)
+            return -1;
+    }
+    else if (!HDstrcmp(name, "core")) {
+        /* Keep everything in memory; the file is never written out */
+        if (H5Pset_fapl_core(fapl, (size_t)1024 * 1024, FALSE) < 0)
+            return -1;
+    }
+    else if (!HDstrcmp(name, "log")) {
+        if (H5Pset_fapl_log(fapl, NULL, (unsigned long long)H5FD_LOG_NUM_IO, (size_t)0) < 0)
+            return -1;
+    }
+    else if (!HDstrcmp(name, "family")) {
+        hid_t memb_fapl;
+
+        if ((memb_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+            return -1;
+        if (H5Pset_fapl_sec2(memb_fapl) < 0 || H5Pset_fapl_family(fapl, (hsize_t)1 << 30, memb_fapl) < 0) {
+            H5Pclose(memb_fapl);
+            return -1;
+        }
+        H5Pclose(memb_fapl);
+    }
+#ifdef H5_HAVE_DIRECT
+    else if (!HDstrcmp(name, "direct")) {
+        if (H5Pset_fapl_direct(fapl, 0, 0, 0) < 0)
+            return -1;
+    }
+#endif
+#ifdef H5_HAVE_IOURING
+    else if (!HDstrcmp(name, "iouring")) {
+        if (H5Pset_fapl_iouring(fapl, H5FD_IOURING_QUEUE_DEPTH_DEF, H5FD_IOURING_SEGMENT_SIZE_DEF, 0) < 0)
+            return -1;
+    }
+#endif
+#ifdef H5_HAVE_STRIPE_VFD
+    else if (!HDstrcmp(name, "stripe")) {
+        if (H5Pset_fapl_stripe(fapl, 4, H5FD_STRIPE_SIZE_DEF, 4) < 0)
+            return -1;
+    }
+#endif
+    else {
+        HDfprintf(stderr, "%s: unknown or unavailable driver `%s'\n", PROGRAMNAME, name);
+        return -1;
+    }
+
+    return 0;
+} /* end set_driver() */
+
+/*-------------------------------------------------------------------------
+ * Function:    remove_file
+ *
+ * Purpose:     Remove the replayed file NAME, or its members when NAME
+ *              is a family or stripe template.  H5Fdelete cannot be used since
+ *              the replay leaves no valid superblock behind.
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+remove_file(const char *name)
+{
+    char     memb_name[1024];
+    unsigned u;
+
+    if (HDstrchr(name, '%')) {
+        /* Family or stripe members, numbered from zero */
+        for (u = 0;; u++) {
+            HDsnprintf(memb_name, sizeof(memb_name), name, u);
+            if (HDremove(memb_name) < 0)
+                break;
+        }
+        return;
+    }
+
+    HDremove(name);
+} /* end remove_file() */
+
+/*-------------------------------------------------------------------------
+ * Function:    capture_workload
+ *
+ * Purpose:     Write and read back a chunked dataset through the log
+ *              driver, capturing a binary trace to TRACE_NAME
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+capture_workload(const char *trace_name)
+{
+    hid_t   fapl = H5I_INVALID_HID, file = H5I_INVALID_HID, dcpl = H5I_INVALID_HID;
+    hid_t   space = H5I_INVALID_HID, mspace = H5I_INVALID_HID, dset = H5I_INVALID_HID;
+    hsize_t dims[2]  = {CAPTURE_DIM, CAPTURE_DIM};
+    hsize_t chunk[2] = {CAPTURE_CHUNK, CAPTURE_CHUNK};
+    hsize_t start[2], count[2];
+    double *buf = NULL;
+    size_t  u;
+    herr_t  ret_value = -1;
+
+    if (NULL == (buf = (double *)HDmalloc(sizeof(double) * CAPTURE_DIM * CAPTURE_CHUNK)))
+        goto done;
+    for (u = 0; u < CAPTURE_DIM * CAPTURE_CHUNK; u++)
+        buf[u] = (double)u;
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto done;
+    if (H5Pset_fapl_log(fapl, trace_name, (unsigned long long)H5FD_LOG_TRACE, (size_t)0) < 0)
+        goto done;
+    if ((file = H5Fcreate(CAPTURE_FILE, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto done;
+
+    if ((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto done;
+    if (H5Pset_chunk(dcpl, 2, chunk) < 0)
+        goto done;
+    if ((space = H5Screate_simple(2, dims, NULL)) < 0)
+        goto done;
+    if ((dset = H5Dcreate2(file, "dset", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        goto done;
+
+    /* Write one band of chunks at a time, then read the columns back */
+    count[0] = CAPTURE_CHUNK;
+    count[1] = CAPTURE_DIM;
+    if ((mspace = H5Screate_simple(2, count, NULL)) < 0)
+        goto done;
+    for (start[0] = 0, start[1] = 0; start[0] < CAPTURE_DIM; start[0] += CAPTURE_CHUNK) {
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto done;
+        if (H5Dwrite(dset, H5T_NATIVE_DOUBLE, mspace, space, H5P_DEFAULT, buf) < 0)
+            goto done;
+    }
+    if (H5Fflush(file, H5F_SCOPE_GLOBAL) < 0)
+        goto done;
+
+    count[0] = CAPTURE_DIM;
+    count[1] = CAPTURE_CHUNK;
+    if (H5Sclose(mspace) < 0)
+        goto done;
+    if ((mspace = H5Screate_simple(2, count, NULL)) < 0)
+        goto done;
+    for (start[0] = 0, start[1] = 0; start[1] < CAPTURE_DIM; start[1] += CAPTURE_CHUNK) {
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            goto done;
+        if (H5Dread(dset, H5T_NATIVE_DOUBLE, mspace, space, H5P_DEFAULT, buf) < 0)
+            goto done;
+    }
+
+    ret_value = 0;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Pclose(dcpl);
+        H5Fclose(file);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    HDfree(buf);
+    HDremove(CAPTURE_FILE);
+
+    return ret_value;
+} /* end capture_workload() */
+
+/*-------------------------------------------------------------------------
+ * Function:    record_latency
+ *
+ * Purpose:     Add one operation to the statistics ST
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+record_latency(replay_stats_t *st, double latency, double traced, size_t nbytes)
+{
+    double   usec   = latency * 1000000.0;
+    unsigned bucket = 0;
+
+    while (bucket < NBUCKETS - 1 && usec >= 1.0) {
+        usec /= 2.0;
+        bucket++;
+    }
+
+    st->nops++;
+    st->nbytes += nbytes;
+    st->time += latency;
+    st->traced_time += traced;
+    if (latency > st->max_latency)
+        st->max_latency = latency;
+    st->hist[bucket]++;
+} /* end record_latency() */
+
+/*-------------------------------------------------------------------------
+ * Function:    replay
+ *
+ * Purpose:     Issue every operation of the trace FP, whose records start
+ *              at DATA_START, against FILE
+ *
+ * Return:      Success:    0
+ *              Failure:    -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+replay(FILE *fp, H5FD_t *file, long data_start, hbool_t pace, replay_stats_t *rd, replay_stats_t *wr,
+       unsigned long long *ntrunc, double *wall)
+{
+    H5FD_log_trace_rec_t rec;
+    unsigned char *      buf      = NULL;
+    size_t               buf_size = 0;
+    double               t_begin, t0, latency;
+    herr_t               ret_value = -1;
+
+    if (HDfseek(fp, data_start, SEEK_SET) < 0)
+        goto done;
+
+    t_begin = H5_get_time();
+    while (1 == HDfread(&rec, sizeof(rec), 1, fp)) {
+        H5FD_mem_t type = (H5FD_mem_t)rec.type;
+        haddr_t    end  = (haddr_t)(rec.addr + rec.size);
+
+        if (rec.type >= H5FD_MEM_NTYPES) {
+            HDfprintf(stderr, "%s: bad memory type %u in trace\n", PROGRAMNAME, (unsigned)rec.type);
+            goto done;
+        }
+
+        if (pace) {
+            double ahead = rec.start - (H5_get_time() - t_begin);
+
+            if (ahead > 0.0)
+                H5_nanosleep((uint64_t)(ahead * 1000000000.0));
+        }
+
+        switch (rec.op) {
+            case H5FD_LOG_TRACE_OP_READ:
+            case H5FD_LOG_TRACE_OP_WRITE:
+                if (rec.size > buf_size) {
+                    unsigned char *new_buf;
+
+                    if (NULL == (new_buf = (unsigned char *)HDrealloc(buf, (size_t)rec.size)))
+                        goto done;
+                    HDmemset(new_buf + buf_size, 0xa5, (size_t)rec.size - buf_size);
+                    buf      = new_buf;
+                    buf_size = (size_t)rec.size;
+                }
+
+                /* The library extends the EOA before it touches anything
+                 * past it; do the same here.  The EOA is asked for by type
+                 * since the multi driver keeps one per member. */
+                if (end > H5FDget_eoa(file, type))
+                    if (H5FDset_eoa(file, type, end) < 0)
+                        goto done;
+
+                t0 = H5_get_time();
+                if (rec.op == H5FD_LOG_TRACE_OP_READ) {
+                    if (H5FDread(file, type, H5P_DEFAULT, (haddr_t)rec.addr, (size_t)rec.size, buf) < 0)
+                        goto done;
+                    latency = H5_get_time() - t0;
+                    record_latency(rd, latency, rec.elapsed, (size_t)rec.size);
+                }
+                else {
+                    if (H5FDwrite(file, type, H5P_DEFAULT, (haddr_t)rec.addr, (size_t)rec.size, buf) < 0)
+                        goto done;
+                    latency = H5_get_time() - t0;
+                    record_latency(wr, latency, rec.elapsed, (size_t)rec.size);
+                }
+                break;
+
+            case H5FD_LOG_TRACE_OP_TRUNCATE:
+                /* The trace records the EOA the file was truncated to */
+                if (H5FDset_eoa(file, H5FD_MEM_DEFAULT, (haddr_t)rec.size) < 0)
+                    goto done;
+                if (H5FDtruncate(file, H5P_DEFAULT, FALSE) < 0)
+                    goto done;
+                (*ntrunc)++;
+                break;
+
+            default:
+                HDfprintf(stderr, "%s: bad operation %u in trace\n", PROGRAMNAME, (unsigned)rec.op);
+                goto done;
+        } /* end switch */
+    }     /* end while */
+    *wall += H5_get_time() - t_begin;
+
+    if (HDferror(fp))
+        goto done;
+
+    ret_value = 0;
+
+done:
+    HDfree(buf);
+
+    return ret_value;
+} /* end replay() */
+
+/*-------------------------------------------------------------------------
+ * Function:    report
+ *
+ * Purpose:     Print the throughput and the latency histogram in ST
+ *
+ * Return:      void
+ *-------------------------------------------------------------------------
+ */
+static void
+report(const char *name, const replay_stats_t *st, double wall)
+{
+    unsigned long long cum = 0;
+    double             pct[3]  = {0.50, 0.90, 0.99};
+    double             pval[3] = {0.0, 0.0, 0.0};
+    unsigned           p = 0, u;
+
+    HDfprintf(stdout, "%s: %llu ops, %.2f MB\n", name, st->nops, (double)st->nbytes / ONE_MB);
+    if (0 == st->nops)
+        return;
+
+    HDfprintf(stdout, "    in driver    %10.6f s  %10.2f MB/s  (trace: %.6f s)\n", st->time,
+              st->time > 0.0 ? (double)st->nbytes / ONE_MB / st->time : 0.0, st->traced_time);
+    HDfprintf(stdout, "    wall clock   %10.6f s  %10.2f MB/s\n", wall,
+              wall > 0.0 ? (double)st->nbytes / ONE_MB / wall : 0.0);
+    HDfprintf(stdout, "    latency      mean %.1f us, max %.1f us\n",
+              st->time * 1000000.0 / (double)st->nops, st->max_latency * 1000000.0);
+
+    /* Percentiles are reported as the upper bound of their bucket */
+    for (u = 0; u < NBUCKETS; u++) {
+        cum += st->hist[u];
+        while (p < 3 && (double)cum >= pct[p] * (double)st->nops)
+            pval[p++] = HDldexp(1.0, (int)u);
+    }
+    HDfprintf(stdout, "    percentiles  p50 < %.0f us, p90 < %.0f us, p99 < %.0f us\n", pval[0], pval[1],
+              pval[2]);
+
+    for (u = 0; u < NBUCKETS; u++) {
+        double   frac;
+        unsigned bar;
+
+        if (0 == st->hist[u])
+            continue;
+        frac = (double)st->hist[u] / (double)st->nops;
+        bar  = (unsigned)(frac * 50.0 + 0.5);
+        if (0 == u)
+            HDfprintf(stdout, "    %10s < %8u us %10llu %5.1f%% ", "", 1U, st->hist[u], frac * 100.0);
+        else if (NBUCKETS - 1 == u)
+            HDfprintf(stdout, "    %10u+           %10llu %5.1f%% ", 1U << (u - 1), st->hist[u],
+                      frac * 100.0);
+        else
+            HDfprintf(stdout, "    %10u - %8u us %10llu %5.1f%% ", 1U << (u - 1), 1U << u, st->hist[u],
+                      frac * 100.0);
+        while (bar-- > 0)
+            HDfputc('#', stdout);
+        HDfputc('\n', stdout);
+    }
+} /* end report() */
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Parse the options, then replay the trace
+ *
+ * Return:      Success:    EXIT_SUCCESS
+ *              Failure:    EXIT_FAILURE
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, const char *argv[])
+{
+    const char *            driver     = "sec2";
+    const char *            output     = NULL;
+    const char *            trace_name = NULL;
+    unsigned                iterations = 1, iter;
+    hbool_t                 pace = FALSE, keep = FALSE;
+    H5FD_log_trace_header_t hdr;
+    replay_stats_t          rd, wr;
+    unsigned long long      ntrunc = 0;
+    double                  wall   = 0.0;
+    FILE *                  fp     = NULL;
+    hid_t                   fapl   = H5I_INVALID_HID;
+    H5FD_t *                file   = NULL;
+    int                     opt;
+    int                     ret_value = EXIT_FAILURE;
+
+    h5tools_init();
+
+    while ((opt = get_option(argc, argv, s_opts, l_opts)) > 0) {
+        switch ((char)opt) {
+            case 'h':
+                usage();
+                return EXIT_SUCCESS;
+            case 'd':
+                driver = opt_arg;
+                break;
+            case 'o':
+                output = opt_arg;
+                break;
+            case 'n':
+                iterations = (unsigned)HDstrtoul(opt_arg, NULL, 10);
+                if (0 == iterations) {
+                    HDfprintf(stderr, "%s: bad iteration count `%s'\n", PROGRAMNAME, opt_arg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'p':
+                pace = TRUE;
+                break;
+            case 'k':
+                keep = TRUE;
+                break;
+            case '?':
+            default:
+                usage();
+                return EXIT_FAILURE;
+        } /* end switch */
+    }     /* end while */
+
+    if (NULL == output)
+        output = (!HDstrcmp(driver, "family") || !HDstrcmp(driver, "stripe")) ? REPLAY_MEMB : REPLAY_FILE;
+
+    if (opt_ind < argc)
+        trace_name = argv[opt_ind];
+    else {
+        trace_name = CAPTURE_TRACE;
+        if (capture_workload(trace_name) < 0) {
+            HDfprintf(stderr, "%s: unable to capture the built-in workload\n", PROGRAMNAME);
+            goto done;
+        }
+    }
+
+    /* Check the trace header */
+    if (NULL == (fp = HDfopen(trace_name, "rb"))) {
+        HDfprintf(stderr, "%s: unable to open trace `%s'\n", PROGRAMNAME, trace_name);
+        goto done;
+    }
+    if (1 != HDfread(&hdr, sizeof(hdr), 1, fp) || hdr.magic != H5FD_LOG_TRACE_MAGIC) {
+        HDfprintf(stderr, "%s: `%s' is not a trace from this kind of machine\n", PROGRAMNAME, trace_name);
+        goto done;
+    }
+    if (hdr.version != H5FD_LOG_TRACE_VERSION || hdr.rec_size != sizeof(H5FD_log_trace_rec_t)) {
+        HDfprintf(stderr, "%s: unsupported trace version %u\n", PROGRAMNAME, (unsigned)hdr.version);
+        goto done;
+    }
+
+    if ((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto done;
+    if (set_driver(fapl, driver) < 0)
+        goto done;
+
+    HDmemset(&rd, 0, sizeof(rd));
+    HDmemset(&wr, 0, sizeof(wr));
+    for (iter = 0; iter < iterations; iter++) {
+        if (NULL ==
+            (file = H5FDopen(output, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF))) {
+            HDfprintf(stderr, "%s: unable to create `%s'\n", PROGRAMNAME, output);
+            goto done;
+        }
+        if (replay(fp, file, (long)sizeof(hdr), pace, &rd, &wr, &ntrunc, &wall) < 0) {
+            HDfprintf(stderr, "%s: replay of `%s' failed\n", PROGRAMNAME, trace_name);
+            goto done;
+        }
+        if (H5FDclose(file) < 0)
+            goto done;
+        file = NULL;
+    }
+
+    HDfprintf(stdout, "Replayed `%s' with the %s driver, %u iteration(s), %llu truncate(s)\n", trace_name,
+              driver, iterations, ntrunc);
+    report("read", &rd, wall);
+    report("write", &wr, wall);
+
+    ret_value = EXIT_SUCCESS;
+
+done:
+    H5E_BEGIN_TRY
+    {
+        if (file)
+            H5FDclose(file);
+        H5Pclose(fapl);
+    }
+    H5E_END_TRY;
+    if (fp)
+        HDfclose(fp);
+    if (output && !keep)
+        remove_file(output);
+
+    h5tools_close();
+
+    return ret_value;
+} /* end main() */